@@ -0,0 +1,23 @@
+-- SPDX-FileCopyrightText: 2024 Istituto Italiano di Tecnologia (IIT)
+-- SPDX-License-Identifier: BSD-3-Clause
+
+-- Port monitor used by test_portmonitor.lua
+
+require("yarp")
+
+PortMonitor.update_batch = function(things)
+    local results = {}
+    for i, thing in ipairs(things) do
+        local bt = thing:asBottle()
+        local value = bt:get(0):asInt32()
+        local envelope = yarp.Bottle(thing:getEnvelope())
+        if value % 2 == 0 and envelope:get(0):asInt32() == value then
+            bt:clear()
+            bt:addInt32(value * 10)
+            results[i] = thing
+        else
+            results[i] = false
+        end
+    end
+    return results
+end
@@ -0,0 +1,40 @@
+#!/usr/bin/lua
+
+-- SPDX-FileCopyrightText: 2024 Istituto Italiano di Tecnologia (IIT)
+-- SPDX-License-Identifier: BSD-3-Clause
+
+require("yarp")
+
+function test_portmonitor_update_batch()
+  yarp.Network()
+  yarp.Network.setLocalMode(true)
+  local inPort = yarp.BufferedPortBottle()
+  inPort:setStrict()
+  assert(inPort:open("/lua/portmonitor/in"))
+  local outPort = yarp.Port()
+  assert(outPort:open("/lua/portmonitor/out"))
+  assert(yarp.Network.connect(outPort:getName(), inPort:getName(),
+                              "tcp+recv.portmonitor+type.lua+file.portmonitor_update_batch"))
+
+  for i = 1, 10 do
+    local envelope = yarp.Bottle()
+    envelope:addInt32(i)
+    outPort:setEnvelope(envelope)
+    local bottle = yarp.Bottle()
+    bottle:addInt32(i)
+    assert(outPort:write(bottle))
+  end
+
+  -- the monitor drops the odd numbers and multiplies the even ones by 10
+  for i = 2, 10, 2 do
+    local bottle = inPort:read()
+    assert(bottle ~= nil)
+    assert(bottle:get(0):asInt32() == i * 10)
+  end
+  assert(inPort:getPendingReads() == 0)
+
+  outPort:close()
+  inPort:close()
+end
+
+test_portmonitor_update_batch()
@@ -6,6 +6,11 @@
 import yarp
 import unittest
 
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
 yarp.Network.init()
 yarp.Network.setLocalMode(True)
 
@@ -42,6 +47,37 @@ class ImageTest(unittest.TestCase):
         port_out.close()
         port_in.close()
 
+    def test_array_interface(self):
+        height = 3
+        width = 5
+        img = yarp.ImageRgb()
+        img.setQuantum(8)
+        img.resize(width, height)
+        interface = img.__array_interface__
+        self.assertEqual((height, width, 3), interface['shape'])
+        self.assertEqual((img.getRowSize(), 3, 1), interface['strides'])
+        self.assertEqual('|u1', interface['typestr'])
+        self.assertEqual(int(img.getRawImage()), interface['data'][0])
+
+    @unittest.skipUnless(numpy, 'numpy not available')
+    def test_numpy_view(self):
+        img = yarp.ImageMono()
+        img.resize(320, 240)
+        img.zero()
+        view = numpy.asarray(img)
+        self.assertEqual((240, 320), view.shape)
+        self.assertEqual(numpy.uint8, view.dtype)
+        view[10, 20] = 42
+        self.assertEqual(42, numpy.asarray(img)[10, 20])
+
+        img_float = yarp.ImageFloat()
+        img_float.resize(4, 2)
+        img_float.zero()
+        view = numpy.asarray(img_float)
+        self.assertEqual(numpy.float32, view.dtype)
+        view[1, 3] = 0.5
+        self.assertEqual(0.5, img_float.getPixel(3, 1))
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,60 @@
+#!/usr/bin/python3
+
+# SPDX-FileCopyrightText: 2024 Istituto Italiano di Tecnologia (IIT)
+# SPDX-License-Identifier: BSD-3-Clause
+
+import yarp
+import unittest
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
+class SoundTest(unittest.TestCase):
+
+    def test_sound_array_interface(self):
+        snd = yarp.Sound()
+        snd.resize(10, 2)
+        interface = snd.__array_interface__
+        self.assertEqual((10, 2), interface['shape'])
+        self.assertEqual((2, 20), interface['strides'])
+        self.assertEqual('<i2', interface['typestr'])
+        self.assertNotEqual(0, interface['data'][0])
+
+    def test_sound_8bit_array_interface(self):
+        snd = yarp.Sound(1)
+        snd.resize(10, 2)
+        interface = snd.__array_interface__
+        self.assertEqual((10, 2), interface['shape'])
+        self.assertEqual((1, 10), interface['strides'])
+        self.assertEqual('|u1', interface['typestr'])
+        self.assertNotEqual(0, interface['data'][0])
+
+    @unittest.skipUnless(numpy, 'numpy not available')
+    def test_sound_numpy_view(self):
+        snd = yarp.Sound()
+        snd.resize(4, 2)
+        snd.set(-3, 1, 0)
+        snd.set(7, 2, 1)
+        view = numpy.asarray(snd)
+        self.assertEqual(numpy.int16, view.dtype)
+        self.assertEqual(-3, view[1, 0])
+        self.assertEqual(7, view[2, 1])
+        view[3, 1] = 9
+        self.assertEqual(9, snd.get(3, 1))
+
+    @unittest.skipUnless(numpy, 'numpy not available')
+    def test_sound_8bit_numpy_view(self):
+        snd = yarp.Sound(1)
+        snd.resize(4, 2)
+        snd.set(200, 1, 0)
+        view = numpy.asarray(snd)
+        self.assertEqual(numpy.uint8, view.dtype)
+        self.assertEqual(200, view[1, 0])
+        view[3, 1] = 9
+        self.assertEqual(9, snd.get(3, 1))
+
+
+if __name__ == '__main__':
+    unittest.main()
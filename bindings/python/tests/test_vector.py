@@ -6,6 +6,11 @@
 import yarp
 import unittest
 
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
 class VectorTest(unittest.TestCase):
 
     def test_vector_copy_costructor(self):
@@ -28,6 +33,26 @@ class VectorTest(unittest.TestCase):
         self.assertEqual(vec2.get(1), 2.0)
         self.assertEqual(vec2.get(2), 3.0)
 
+    def test_vector_array_interface(self):
+        vec = yarp.Vector(10)
+        interface = vec.__array_interface__
+        self.assertEqual((10,), interface['shape'])
+        self.assertEqual('f8', interface['typestr'][1:])
+
+    @unittest.skipUnless(numpy, 'numpy not available')
+    def test_vector_numpy_view(self):
+        vec = yarp.Vector([1.0, 2.0, 3.0])
+        view = numpy.asarray(vec)
+        self.assertEqual(numpy.float64, view.dtype)
+        self.assertEqual([1.0, 2.0, 3.0], view.tolist())
+        view[1] = 5.0
+        self.assertEqual(5.0, vec.get(1))
+
+        vec_int = yarp.VectorInt(4)
+        view = numpy.asarray(vec_int)
+        self.assertEqual(numpy.int32, view.dtype)
+        self.assertEqual((4,), view.shape)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -288,6 +288,126 @@ void setExternal2(yarp::sig::Image *img, PyObject* mem, int w, int h) {
         setExternal(img,mem,w,h);
 }
 
+// Build the dictionary of the NumPy array interface, describing a block of
+// memory owned by a YARP object.
+// See https://numpy.org/doc/stable/reference/arrays.interface.html
+PyObject* arrayInterface(void* data,
+                         const char* typestr,
+                         const std::vector<Py_ssize_t>& shape,
+                         const std::vector<Py_ssize_t>& strides = {}) {
+        PyObject* dict = PyDict_New();
+
+        PyObject* pyShape = PyTuple_New(shape.size());
+        for (size_t i = 0; i < shape.size(); i++) {
+            PyTuple_SET_ITEM(pyShape, i, PyLong_FromSsize_t(shape[i]));
+        }
+        PyDict_SetItemString(dict, "shape", pyShape);
+        Py_DECREF(pyShape);
+
+        if (!strides.empty()) {
+            PyObject* pyStrides = PyTuple_New(strides.size());
+            for (size_t i = 0; i < strides.size(); i++) {
+                PyTuple_SET_ITEM(pyStrides, i, PyLong_FromSsize_t(strides[i]));
+            }
+            PyDict_SetItemString(dict, "strides", pyStrides);
+            Py_DECREF(pyStrides);
+        }
+
+        PyObject* pyTypestr = PyUnicode_FromString(typestr);
+        PyDict_SetItemString(dict, "typestr", pyTypestr);
+        Py_DECREF(pyTypestr);
+
+        // The memory is writable
+        PyObject* pyData = Py_BuildValue("(NO)", PyLong_FromVoidPtr(data), Py_False);
+        PyDict_SetItemString(dict, "data", pyData);
+        Py_DECREF(pyData);
+
+        PyObject* pyVersion = PyLong_FromLong(3);
+        PyDict_SetItemString(dict, "version", pyVersion);
+        Py_DECREF(pyVersion);
+
+        return dict;
+}
+
+// Floating point values and the elements of the vectors are stored with the
+// native byte order, integers larger than one byte in images and sounds
+// (NetInt32, NetUint16) are always little endian.
+#ifdef YARP_BIG_ENDIAN
+# define YARP_NUMPY_INT32 ">i4"
+# define YARP_NUMPY_FLOAT32 ">f4"
+# define YARP_NUMPY_FLOAT64 ">f8"
+#else
+# define YARP_NUMPY_INT32 "<i4"
+# define YARP_NUMPY_FLOAT32 "<f4"
+# define YARP_NUMPY_FLOAT64 "<f8"
+#endif
+
+PyObject* imageArrayInterface(yarp::sig::Image* img) {
+        const char* typestr = "|u1";
+        size_t channels = 1;
+        switch (img->getPixelCode()) {
+        case VOCAB_PIXEL_MONO:
+        case VOCAB_PIXEL_ENCODING_BAYER_GRBG8:
+        case VOCAB_PIXEL_ENCODING_BAYER_BGGR8:
+        case VOCAB_PIXEL_ENCODING_BAYER_GBRG8:
+        case VOCAB_PIXEL_ENCODING_BAYER_RGGB8:
+            break;
+        case VOCAB_PIXEL_MONO16:
+        case VOCAB_PIXEL_ENCODING_BAYER_GRBG16:
+        case VOCAB_PIXEL_ENCODING_BAYER_BGGR16:
+        case VOCAB_PIXEL_ENCODING_BAYER_GBRG16:
+        case VOCAB_PIXEL_ENCODING_BAYER_RGGB16:
+            typestr = "<u2";
+            break;
+        case VOCAB_PIXEL_RGB:
+        case VOCAB_PIXEL_BGR:
+        case VOCAB_PIXEL_HSV:
+            channels = 3;
+            break;
+        case VOCAB_PIXEL_RGBA:
+        case VOCAB_PIXEL_BGRA:
+            channels = 4;
+            break;
+        case VOCAB_PIXEL_MONO_SIGNED:
+            typestr = "|i1";
+            break;
+        case VOCAB_PIXEL_RGB_SIGNED:
+            typestr = "|i1";
+            channels = 3;
+            break;
+        case VOCAB_PIXEL_INT:
+            typestr = "<i4";
+            break;
+        case VOCAB_PIXEL_RGB_INT:
+            typestr = "<i4";
+            channels = 3;
+            break;
+        case VOCAB_PIXEL_MONO_FLOAT:
+            typestr = YARP_NUMPY_FLOAT32;
+            break;
+        case VOCAB_PIXEL_RGB_FLOAT:
+        case VOCAB_PIXEL_HSV_FLOAT:
+            typestr = YARP_NUMPY_FLOAT32;
+            channels = 3;
+            break;
+        default:
+            // Unknown layout, expose the bytes of each pixel
+            channels = img->getPixelSize();
+            break;
+        }
+
+        // Rows can be padded, therefore the strides are always specified
+        const auto height = static_cast<Py_ssize_t>(img->height());
+        const auto width = static_cast<Py_ssize_t>(img->width());
+        const auto rowSize = static_cast<Py_ssize_t>(img->getRowSize());
+        const auto pixelSize = static_cast<Py_ssize_t>(img->getPixelSize());
+        if (channels == 1) {
+            return arrayInterface(img->getRawImage(), typestr, {height, width}, {rowSize, pixelSize});
+        }
+        const auto channelSize = static_cast<Py_ssize_t>(img->getPixelSize() / channels);
+        return arrayInterface(img->getRawImage(), typestr, {height, width, static_cast<Py_ssize_t>(channels)}, {rowSize, pixelSize, channelSize});
+}
+
 %}
 #endif
 
@@ -1859,6 +1979,65 @@ typedef yarp::os::BufferedPort<ImageRgbFloat> BufferedPortImageRgbFloat;
     }
 }
 
+// NumPy array interface: numpy.asarray() returns a view sharing the memory
+// of the YARP object, which is kept alive by the view. The view is no longer
+// valid if the YARP object is resized.
+// The Python API is called, therefore the GIL must not be released.
+%nothreadallow;
+%extend yarp::sig::Image {
+  PyObject* _array_interface() {
+    return imageArrayInterface(self);
+  }
+  %pythoncode %{
+    __array_interface__ = property(_array_interface)
+  %}
+}
+
+%extend yarp::sig::VectorOf<double> {
+  PyObject* _array_interface() {
+    return arrayInterface(self->data(), YARP_NUMPY_FLOAT64, {static_cast<Py_ssize_t>(self->size())});
+  }
+  %pythoncode %{
+    __array_interface__ = property(_array_interface)
+  %}
+}
+
+%extend yarp::sig::VectorOf<int> {
+  PyObject* _array_interface() {
+    return arrayInterface(self->data(), YARP_NUMPY_INT32, {static_cast<Py_ssize_t>(self->size())});
+  }
+  %pythoncode %{
+    __array_interface__ = property(_array_interface)
+  %}
+}
+
+// The samples are stored channel by channel, the array is indexed as
+// [sample, channel] like Sound::get()
+%extend yarp::sig::Sound {
+  PyObject* _array_interface() {
+    const char* typestr = nullptr;
+    switch (self->getBytesPerSample()) {
+    case 1:
+        typestr = "|u1";
+        break;
+    case 2:
+        typestr = "<i2";
+        break;
+    default:
+        PyErr_Format(PyExc_ValueError, "Sounds with %zu bytes per sample cannot be exposed as an array", self->getBytesPerSample());
+        return nullptr;
+    }
+    const auto samples = static_cast<Py_ssize_t>(self->getSamples());
+    const auto channels = static_cast<Py_ssize_t>(self->getChannels());
+    const auto sampleSize = static_cast<Py_ssize_t>(self->getBytesPerSample());
+    return arrayInterface(self->getRawData(), typestr, {samples, channels}, {sampleSize, samples * sampleSize});
+  }
+  %pythoncode %{
+    __array_interface__ = property(_array_interface)
+  %}
+}
+%clearnothreadallow;
+
 %extend yarp::sig::Image {
   std::string tostring() const {
     return std::string((const char *)self->getRawImage(),
@@ -0,0 +1,29 @@
+# SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+# SPDX-License-Identifier: BSD-3-Clause
+
+#[=======================================================================[.rst:
+FindLZ4
+-----------
+
+Try to find the LZ4 library.
+Once done this will define the following variables::
+
+ LZ4_FOUND         - System has LZ4
+ LZ4_INCLUDE_DIRS  - LZ4 include directory
+ LZ4_LIBRARIES     - LZ4 libraries
+ LZ4_DEFINITIONS   - Additional compiler flags for LZ4
+ LZ4_VERSION       - LZ4 version
+ LZ4_MAJOR_VERSION - LZ4 major version
+ LZ4_MINOR_VERSION - LZ4 minor version
+ LZ4_PATCH_VERSION - LZ4 patch version
+#]=======================================================================]
+
+include(StandardFindModule)
+standard_find_module(LZ4 liblz4
+                     SKIP_CMAKE_CONFIG)
+
+# Set package properties if FeatureSummary was included
+if(COMMAND set_package_properties)
+    set_package_properties(LZ4 PROPERTIES DESCRIPTION "Extremely fast lossless compression algorithm"
+                                          URL "https://lz4.org/")
+endif()
@@ -0,0 +1,29 @@
+# SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+# SPDX-License-Identifier: BSD-3-Clause
+
+#[=======================================================================[.rst:
+FindZSTD
+-----------
+
+Try to find the Zstandard library.
+Once done this will define the following variables::
+
+ ZSTD_FOUND         - System has ZSTD
+ ZSTD_INCLUDE_DIRS  - ZSTD include directory
+ ZSTD_LIBRARIES     - ZSTD libraries
+ ZSTD_DEFINITIONS   - Additional compiler flags for ZSTD
+ ZSTD_VERSION       - ZSTD version
+ ZSTD_MAJOR_VERSION - ZSTD major version
+ ZSTD_MINOR_VERSION - ZSTD minor version
+ ZSTD_PATCH_VERSION - ZSTD patch version
+#]=======================================================================]
+
+include(StandardFindModule)
+standard_find_module(ZSTD libzstd
+                     SKIP_CMAKE_CONFIG)
+
+# Set package properties if FeatureSummary was included
+if(COMMAND set_package_properties)
+    set_package_properties(ZSTD PROPERTIES DESCRIPTION "Zstandard real-time compression algorithm"
+                                           URL "https://facebook.github.io/zstd/")
+endif()
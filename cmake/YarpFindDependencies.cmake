@@ -390,12 +390,19 @@ checkandset_dependency(GLIB2)
 find_package(SOXR QUIET)
 checkandset_dependency(SOXR)
 
+set(ZSTD_REQUIRED_VERSION 1.4.0)
+find_package(ZSTD ${ZSTD_REQUIRED_VERSION} QUIET)
+checkandset_dependency(ZSTD)
+
+find_package(LZ4 QUIET)
+checkandset_dependency(LZ4)
+
 set(GStreamer_REQUIRED_VERSION 1.4)
 find_package(GStreamer ${GStreamer_REQUIRED_VERSION} QUIET)
 checkandset_dependency(GStreamer)
 
 set(GStreamerPluginsBase_REQUIRED_VERSION 1.4)
-find_package(GStreamerPluginsBase ${GStreamerPluginsBase_REQUIRED_VERSION} COMPONENTS app QUIET)
+find_package(GStreamerPluginsBase ${GStreamerPluginsBase_REQUIRED_VERSION} COMPONENTS app video QUIET)
 checkandset_dependency(GStreamerPluginsBase)
 
 set(BISON_REQUIRED_VERSION 2.5)
@@ -673,6 +680,8 @@ print_dependency(Libv4l2)
 print_dependency(Libv4lconvert)
 print_dependency(ZLIB)
 print_dependency(SOXR)
+print_dependency(ZSTD)
+print_dependency(LZ4)
 
 ################################################################################
 # Print information for user
@@ -0,0 +1,126 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Measures the jitter of a periodic thread under synthetic load, using the
+ * Absolute and the RealTime clock modes.
+ *
+ * Usage:
+ *   periodicThreadJitter [--period 0.001] [--duration 5] [--load <threads>]
+ *                        [--priority <prio>] [--cpu <cpu>]
+ *
+ * --load sets the number of busy threads (default: the number of cores),
+ * --priority runs the periodic thread with SCHED_FIFO and the given priority
+ * (requires the right permissions), --cpu pins the periodic thread to a CPU.
+ */
+
+#include <yarp/os/Network.h>
+#include <yarp/os/PeriodicThread.h>
+#include <yarp/os/Property.h>
+#include <yarp/os/SystemClock.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using yarp::os::PeriodicThread;
+using yarp::os::PeriodicThreadClock;
+using yarp::os::Property;
+using yarp::os::SystemClock;
+
+class ControlLoop : public PeriodicThread
+{
+    double acc {0.0};
+
+public:
+    ControlLoop(double period, PeriodicThreadClock clock) :
+            PeriodicThread(period, yarp::os::ShouldUseSystemClock::Yes, clock)
+    {
+    }
+
+    void run() override
+    {
+        // some light computation, like a joint level controller
+        for (int i = 0; i < 100; i++) {
+            acc += std::sin(acc + i);
+        }
+    }
+};
+
+void printStatistics(const char* name, const ControlLoop& loop)
+{
+    double av;
+    double std;
+    loop.getEstimatedPeriod(av, std);
+    printf("%s: %u iterations, period %.6f +/- %.6f [s], %u overruns, max jitter %.1f [us]\n",
+           name,
+           loop.getIterations(),
+           av,
+           std,
+           loop.getOverruns(),
+           loop.getMaxJitter() * 1e6);
+
+    std::vector<double> edges;
+    std::vector<unsigned int> counts;
+    loop.getJitterHistogram(edges, counts);
+    for (size_t i = 0; i < counts.size(); i++) {
+        if (counts[i] == 0) {
+            continue;
+        }
+        double percent = 100.0 * counts[i] / std::max(loop.getIterations(), 1U);
+        if (i + 1 < edges.size()) {
+            printf("  [%9.0f, %9.0f) us: %8u (%5.1f%%)\n", edges[i] * 1e6, edges[i + 1] * 1e6, counts[i], percent);
+        } else {
+            printf("  [%9.0f,       inf) us: %8u (%5.1f%%)\n", edges[i] * 1e6, counts[i], percent);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    yarp::os::Network network;
+
+    Property options;
+    options.fromCommand(argc, argv);
+    double period = options.check("period", yarp::os::Value(0.001)).asFloat64();
+    double duration = options.check("duration", yarp::os::Value(5.0)).asFloat64();
+    int load = options.check("load", yarp::os::Value(static_cast<int>(std::thread::hardware_concurrency()))).asInt32();
+
+    // Synthetic load
+    std::atomic<bool> done {false};
+    std::vector<std::thread> busy;
+    for (int i = 0; i < load; i++) {
+        busy.emplace_back([&done]() {
+            volatile double x = 0;
+            while (!done) {
+                x = x + 1;
+            }
+        });
+    }
+    printf("Running a %.1f Hz loop for %.1f s with %d busy threads\n", 1.0 / period, duration, load);
+
+    for (auto clock : {PeriodicThreadClock::Absolute, PeriodicThreadClock::RealTime}) {
+        ControlLoop loop(period, clock);
+        if (options.check("priority")) {
+            loop.setPriority(options.find("priority").asInt32(), 1 /* SCHED_FIFO */);
+        }
+        if (options.check("cpu")) {
+            loop.setCpuAffinity({options.find("cpu").asInt32()});
+        }
+        loop.start();
+        SystemClock::delaySystem(duration);
+        loop.stop();
+        printStatistics(clock == PeriodicThreadClock::Absolute ? "Absolute" : "RealTime", loop);
+    }
+
+    done = true;
+    for (auto& t : busy) {
+        t.join();
+    }
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Compares the compression ratio and the throughput of the bottle compression
+ * port monitors on data recorded by yarpdatadumper.
+ *
+ * Usage:
+ *   compression_benchmark --dir <yarpdatadumper directory> [--repeat <n>]
+ *       [--monitors "(bottle_compression_zlib bottle_compression_fast+algorithm.zstd+level.3)"]
+ *
+ * Each monitor is given as the name of the plugin followed by the parameters
+ * that would be used in the carrier string of the connection.
+ * The port monitor plugins must be findable by YARP.
+ */
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/MonitorObject.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/Property.h>
+#include <yarp/os/SharedLibraryClass.h>
+#include <yarp/os/Things.h>
+#include <yarp/os/Time.h>
+#include <yarp/os/YarpPlugin.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace yarp::os;
+
+class MonitorSelector : public YarpPluginSelector
+{
+    bool select(Searchable& options) override
+    {
+        return options.check("type", Value("none")).asString() == "portmonitor";
+    }
+};
+
+class Monitor
+{
+public:
+    bool open(const std::string& spec, bool sender, MonitorSelector& selector)
+    {
+        std::string name = spec.substr(0, spec.find('+'));
+        settings.setPluginName(name);
+        if (!settings.setSelector(selector) || !plugin.open(settings)) {
+            printf("Cannot find the port monitor %s\n", name.c_str());
+            return false;
+        }
+        monitor.open(*plugin.getFactory());
+        if (!monitor.isValid()) {
+            return false;
+        }
+        Property options;
+        options.put("sender_side", sender ? 1 : 0);
+        options.put("carrier", "tcp+" + std::string(sender ? "send" : "recv") + ".portmonitor+type.dll+file." + spec);
+        return monitor->create(options);
+    }
+
+    ~Monitor()
+    {
+        if (monitor.isValid()) {
+            monitor->destroy();
+        }
+        monitor.close();
+    }
+
+    MonitorObject* operator->() { return &monitor.getContent(); }
+
+private:
+    YarpPluginSettings settings;
+    YarpPlugin<MonitorObject> plugin;
+    SharedLibraryClass<MonitorObject> monitor;
+};
+
+static bool readLog(const std::string& dir, std::vector<Bottle>& messages)
+{
+    std::ifstream info(dir + "/info.log");
+    if (!info.is_open()) {
+        printf("Cannot open %s/info.log\n", dir.c_str());
+        return false;
+    }
+    size_t stamps = 1;
+    std::string line;
+    while (std::getline(info, line)) {
+        if (line.find("Type:") == 0 && line.find("Bottle") == std::string::npos) {
+            printf("Only data logged as Bottle are supported\n");
+            return false;
+        }
+        if (line.find("Stamp: tx+rx") == 0) {
+            stamps = 2;
+        }
+    }
+
+    std::ifstream data(dir + "/data.log");
+    if (!data.is_open()) {
+        printf("Cannot open %s/data.log\n", dir.c_str());
+        return false;
+    }
+    // Each line is: <sequence number> <time stamps> <content>
+    while (std::getline(data, line)) {
+        Bottle b(line);
+        if (b.size() <= 1 + stamps) {
+            continue;
+        }
+        messages.emplace_back();
+        messages.back().copy(b, 1 + stamps, b.size() - 1 - stamps);
+    }
+    return !messages.empty();
+}
+
+static void runBenchmark(const std::string& spec, std::vector<Bottle>& messages, int repeat)
+{
+    MonitorSelector selector;
+    selector.scan();
+
+    Monitor sender;
+    Monitor receiver;
+    if (!sender.open(spec, true, selector) || !receiver.open(spec, false, selector)) {
+        printf("%-50s cannot be created\n", spec.c_str());
+        return;
+    }
+
+    size_t uncompressedBytes = 0;
+    size_t compressedBytes = 0;
+    double compressionTime = 0;
+    double decompressionTime = 0;
+    size_t errors = 0;
+    for (int r = 0; r < repeat; r++) {
+        for (auto& message : messages) {
+            size_t size = 0;
+            message.toBinary(&size);
+            uncompressedBytes += size;
+
+            Things in;
+            in.setPortWriter(&message);
+            double start = Time::now();
+            auto* compressed = sender->update(in).cast_as<Bottle>();
+            compressionTime += Time::now() - start;
+            if (compressed == nullptr) {
+                errors++;
+                continue;
+            }
+            compressed->toBinary(&size);
+            compressedBytes += size;
+
+            Things wire;
+            wire.setPortWriter(compressed);
+            start = Time::now();
+            Bottle* out = nullptr;
+            if (receiver->accept(wire)) {
+                out = receiver->update(wire).cast_as<Bottle>();
+            }
+            decompressionTime += Time::now() - start;
+            if (r == 0 && (out == nullptr || out->toString() != message.toString())) {
+                errors++;
+            }
+        }
+    }
+
+    const double mb = uncompressedBytes / 1e6;
+    printf("%-50s ratio %6.2f:1  compress %9.1f MB/s  decompress %9.1f MB/s%s\n",
+           spec.c_str(),
+           static_cast<double>(uncompressedBytes) / static_cast<double>(compressedBytes > 0 ? compressedBytes : 1),
+           mb / (compressionTime > 0 ? compressionTime : 1e-9),
+           mb / (decompressionTime > 0 ? decompressionTime : 1e-9),
+           errors > 0 ? "  (ERRORS)" : "");
+}
+
+int main(int argc, char* argv[])
+{
+    Network yarp(yarp::os::YARP_CLOCK_SYSTEM);
+
+    Property options;
+    options.fromCommand(argc, argv);
+    if (!options.check("dir")) {
+        printf("Usage: %s --dir <yarpdatadumper directory> [--repeat <n>] [--monitors \"(<monitor> ...)\"]\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<Bottle> messages;
+    if (!readLog(options.find("dir").asString(), messages)) {
+        return 1;
+    }
+    int repeat = options.check("repeat", Value(10)).asInt32();
+
+    Bottle monitors;
+    if (options.find("monitors").isList()) {
+        monitors = *options.find("monitors").asList();
+    } else if (options.check("monitors")) {
+        monitors.add(options.find("monitors"));
+    } else {
+        monitors.fromString("bottle_compression_zlib "
+                            "bottle_compression_fast+algorithm.lz4 "
+                            "bottle_compression_fast+algorithm.lz4+level.9 "
+                            "bottle_compression_fast+algorithm.zstd+level.1 "
+                            "bottle_compression_fast+algorithm.zstd+level.3 "
+                            "bottle_compression_fast+algorithm.zstd+level.3+dictionary.1");
+    }
+
+    printf("%zu messages, repeated %d times\n", messages.size(), repeat);
+    for (size_t i = 0; i < monitors.size(); i++) {
+        runBenchmark(monitors.get(i).asString(), messages, repeat);
+    }
+
+    return 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Measures the time needed to parse a large configuration with
+ * Property::fromConfig(), and the time of the lookups in the resulting
+ * Property and in one of its groups.
+ *
+ * Usage:
+ *   property_benchmark [--groups <n>] [--keys <n>] [--lookups <n>]
+ */
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/Property.h>
+#include <yarp/os/SystemClock.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace yarp::os;
+
+int main(int argc, char* argv[])
+{
+    Property options;
+    options.fromCommand(argc, argv);
+    const int groups = options.check("groups", Value(200)).asInt32();
+    const int keys = options.check("keys", Value(40)).asInt32();
+    const size_t lookups = options.check("lookups", Value(1000000)).asInt32();
+
+    std::string config;
+    for (int g = 0; g < groups; g++) {
+        config += "[group" + std::to_string(g) + "]\n";
+        for (int k = 0; k < keys; k++) {
+            config += "param" + std::to_string(k) + " " + std::to_string(g * k) + "\n";
+        }
+    }
+
+    double t1 = SystemClock::nowSystem();
+    Property p;
+    p.fromConfig(config.c_str());
+    double t_parse = SystemClock::nowSystem() - t1;
+
+    Bottle& group = p.findGroup("group" + std::to_string(groups / 2));
+    Property pgroup(group.toString().c_str());
+    std::vector<std::string> names;
+    for (int k = 0; k < keys; k++) {
+        names.push_back("param" + std::to_string(k));
+    }
+
+    long long sum = 0;
+    t1 = SystemClock::nowSystem();
+    for (size_t i = 0; i < lookups; i++) {
+        sum += p.find(names[i % names.size()]).isNull() ? 0 : 1;
+        sum += pgroup.find(names[i % names.size()]).asInt32();
+    }
+    double t_find = SystemClock::nowSystem() - t1;
+
+    printf("fromConfig of %zu bytes: %f s\n", config.size(), t_parse);
+    printf("%zu lookups: %f s (checksum %lld)\n", 2 * lookups, t_find, sum);
+    return 0;
+}
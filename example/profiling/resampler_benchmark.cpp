@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Measures the throughput of the streaming resampler of yarp::sig::soundfilters
+ * on a stream of short packets, for different filter qualities.
+ *
+ * Usage:
+ *   resampler_benchmark [--in_freq <Hz>] [--out_freq <Hz>] [--chunk <samples>]
+ *       [--packets <n>] [--qualities "(8 16 32)"]
+ */
+
+#include <yarp/os/Property.h>
+#include <yarp/os/SystemClock.h>
+#include <yarp/sig/Sound.h>
+#include <yarp/sig/SoundFilters.h>
+
+#include <cmath>
+#include <cstdio>
+
+using namespace yarp::os;
+using namespace yarp::sig;
+
+int main(int argc, char* argv[])
+{
+    Property options;
+    options.fromCommand(argc, argv);
+    const size_t in_freq = options.check("in_freq", Value(48000)).asInt32();
+    const size_t out_freq = options.check("out_freq", Value(16000)).asInt32();
+    const size_t chunk = options.check("chunk", Value(480)).asInt32(); // 10ms packets
+    const size_t packets = options.check("packets", Value(500)).asInt32();
+
+    Bottle qualities;
+    if (options.find("qualities").isList()) {
+        qualities = *options.find("qualities").asList();
+    } else {
+        qualities.fromString("8 16 32");
+    }
+
+    Sound in;
+    in.resize(chunk, 1);
+    in.setFrequency(in_freq);
+    for (size_t s = 0; s < chunk; s++) {
+        in.set(static_cast<Sound::audio_sample>(10000 * std::sin(2 * M_PI * 440 * s / in_freq)), s, 0);
+    }
+
+    const double audio_time = double(chunk * packets) / in_freq;
+    for (size_t i = 0; i < qualities.size(); i++)
+    {
+        const size_t quality = qualities.get(i).asInt32();
+        soundfilters::Resampler resampler(in_freq, out_freq, 1, quality);
+        Sound out;
+        double t1 = SystemClock::nowSystem();
+        for (size_t p = 0; p < packets; p++) {
+            if (!resampler.process(in, out)) {
+                printf("Resampling failed\n");
+                return 1;
+            }
+        }
+        double elapsed = SystemClock::nowSystem() - t1;
+        printf("quality %zu: %.4f s to resample %.2f s of audio (%.1fx realtime)\n",
+               quality, elapsed, audio_time, audio_time / elapsed);
+    }
+
+    return 0;
+}
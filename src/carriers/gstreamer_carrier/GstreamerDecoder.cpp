@@ -9,8 +9,10 @@
 
 
 #include <gst/gst.h>
+#include <gst/video/video.h>
 #include <glib.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <mutex>
@@ -36,9 +38,34 @@ YARP_LOG_COMPONENT(GSTREAMER_DECODER,
 //---------------  CALLBACK FUNCTIONS -------------------------------
 //-------------------------------------------------------------------
 
+// yarp images pad their rows to a multiple of their quantum. Returns the quantum
+// giving the stride of a gstreamer frame, or 0 if the frame cannot be wrapped.
+static size_t quantum_for_stride(size_t width, size_t stride)
+{
+    for (size_t quantum = 1; quantum <= 128; quantum *= 2)
+    {
+        if ((width * 3 + quantum - 1) / quantum * quantum == stride)
+        {
+            return quantum;
+        }
+    }
+    return 0;
+}
+
+static void release_sample(data_for_gst_callback* dec_data)
+{
+    if (dec_data->sample_pointer)
+    {
+        gst_buffer_unmap(gst_sample_get_buffer(dec_data->sample_pointer), &dec_data->map_info);
+        gst_sample_unref(dec_data->sample_pointer);
+        dec_data->sample_pointer = nullptr;
+    }
+}
+
 GstFlowReturn new_sample_func(GstAppSink *appsink, gpointer user_data)
 {
     static yarp::sig::ImageOf<yarp::sig::PixelRgb> curr_frame;
+    static yarp::sig::ImageOf<yarp::sig::PixelRgb> copied_frame;
 #ifdef debug_time
     static bool isFirst = true;
     double start_time = Time::now();
@@ -58,9 +85,13 @@ GstFlowReturn new_sample_func(GstAppSink *appsink, gpointer user_data)
 #endif
 
     data_for_gst_callback* dec_data = (data_for_gst_callback*)user_data;
-    dec_data->img_pointer = &curr_frame;
     dec_data->sem_pointer_stream->wait();
 
+    // the stream has finished reading the previous frame, so its buffer can be given back to gstreamer
+    dec_data->mutex_pointer->lock();
+    release_sample(dec_data);
+    dec_data->mutex_pointer->unlock();
+
     GstSample* sample = gst_app_sink_pull_sample(appsink);
     if (!sample)
     {
@@ -72,51 +103,73 @@ GstFlowReturn new_sample_func(GstAppSink *appsink, gpointer user_data)
     if(!caps)
     {
         yCError(GSTREAMER_DECODER, "could not get caps of sample!");
+        gst_sample_unref(sample);
         return GST_FLOW_OK;
     }
-    GstStructure *struc = gst_caps_get_structure(caps, 0);
-    if(!struc)
-    {
-        yCError(GSTREAMER_DECODER, "could not get struct of caps!");
-        return GST_FLOW_OK;
-    }
-    gint width, height;
-    gboolean res;
-    res = gst_structure_get_int(struc, "width", &width);
-    if(!res)
+    GstVideoInfo info;
+    if(!gst_video_info_from_caps(&info, caps))
     {
-        yCError(GSTREAMER_DECODER, "could not get width!");
+        yCError(GSTREAMER_DECODER, "could not get the video info from the caps of the sample!");
+        gst_sample_unref(sample);
         return GST_FLOW_ERROR;
     }
+    size_t width = GST_VIDEO_INFO_WIDTH(&info);
+    size_t height = GST_VIDEO_INFO_HEIGHT(&info);
+    size_t stride = GST_VIDEO_INFO_PLANE_STRIDE(&info, 0);
+    size_t offset = GST_VIDEO_INFO_PLANE_OFFSET(&info, 0);
+    yCTrace(GSTREAMER_DECODER, "Image has size %zu x %zu", width, height);
 
-    res = gst_structure_get_int(struc, "height", &height);
-    if(!res)
+    GstBuffer *buffer = gst_sample_get_buffer(sample);
+    // the upstream elements can use a different layout, described by the video meta
+    GstVideoMeta* meta = gst_buffer_get_video_meta(buffer);
+    if (meta && meta->stride[0] > 0)
     {
-        yCError(GSTREAMER_DECODER, "GSTREAMER: could not get height!");
-        return GST_FLOW_ERROR;
+        stride = meta->stride[0];
+        offset = meta->offset[0];
     }
-    yCTrace(GSTREAMER_DECODER, "Image has size %d x %d", width, height);
 
-    GstBuffer *buffer = gst_sample_get_buffer(sample);
     GstMapInfo map;
     if(!gst_buffer_map(buffer, &map, GST_MAP_READ))
     {
         yCError(GSTREAMER_DECODER, "could not get map!");
+        gst_sample_unref(sample);
+        return GST_FLOW_ERROR;
+    }
+    if (height > 0 && map.size < offset + stride * (height - 1) + width * 3)
+    {
+        yCError(GSTREAMER_DECODER, "Unexpected buffer size %zu for a %zu x %zu image", map.size, width, height);
+        gst_buffer_unmap(buffer, &map);
+        gst_sample_unref(sample);
         return GST_FLOW_ERROR;
     }
 
     dec_data->mutex_pointer->lock();
-    curr_frame.resize(width, height);
-    size_t map_size = map.size;
-    size_t img_size = width * height * 3;
-    size_t img_size2 = curr_frame.getRawImageSize();
-    unsigned char* ydata_ptr = curr_frame.getRawImage();
-    memcpy(ydata_ptr, map.data, map_size);
-
-    dec_data->mutex_pointer->unlock();
-    gst_buffer_unmap(buffer, &map);
+    size_t quantum = quantum_for_stride(width, stride);
+    if (quantum != 0 && map.size >= offset + stride * height)
+    {
+        // the frame wraps the memory of the buffer, without copying it.
+        // The sample is released when the next frame is requested by the stream.
+        curr_frame.setQuantum(quantum);
+        curr_frame.setExternal(map.data + offset, width, height);
+        dec_data->img_pointer = &curr_frame;
+        dec_data->sample_pointer = sample;
+        dec_data->map_info = map;
+        dec_data->mutex_pointer->unlock();
+    }
+    else
+    {
+        yCDebug(GSTREAMER_DECODER, "The stride %zu of a %zu x %zu image cannot be wrapped, copying it", stride, width, height);
+        copied_frame.resize(width, height);
+        for (size_t row = 0; row < height; row++)
+        {
+            memcpy(copied_frame.getRow(row), map.data + offset + row * stride, width * 3);
+        }
+        dec_data->img_pointer = &copied_frame;
+        dec_data->mutex_pointer->unlock();
+        gst_buffer_unmap(buffer, &map);
+        gst_sample_unref(sample);
+    }
 
-    gst_sample_unref(sample);
     dec_data->sem_pointer_gst->post();
 
 #ifdef debug_time
@@ -209,6 +262,7 @@ bool GstYarpDecoder::start()
 bool GstYarpDecoder::stop()
 {
     gst_element_set_state(m_pipeline, GST_STATE_NULL);
+    release_sample(&m_gst_cbk_data);
     gst_bus_set_sync_handler(gst_pipeline_get_bus(GST_PIPELINE(m_pipeline)), nullptr, nullptr, nullptr);
     yCDebug(GSTREAMER_DECODER) << "deleting pipeline";
     gst_object_unref(GST_OBJECT(m_pipeline));
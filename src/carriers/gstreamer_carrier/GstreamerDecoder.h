@@ -33,6 +33,10 @@ struct data_for_gst_callback
     yarp::sig::ImageOf<yarp::sig::PixelRgb>* img_pointer = nullptr;
     yarp::os::Semaphore* sem_pointer_gst = nullptr;
     yarp::os::Semaphore* sem_pointer_stream = nullptr;
+
+    // the sample whose buffer is wrapped by img_pointer. It stays mapped until the stream has read the frame.
+    GstSample* sample_pointer = nullptr;
+    GstMapInfo map_info {};
 };
 
 //---------------------------------------------------------------------------------------------
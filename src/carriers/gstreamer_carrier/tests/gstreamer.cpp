@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/conf/environment.h>
+#include <yarp/os/all.h>
+#include <yarp/os/Network.h>
+#include <yarp/sig/all.h>
+
+#include <gst/gst.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::os;
+using namespace yarp::sig;
+
+namespace {
+
+bool hasElements(std::initializer_list<const char*> names)
+{
+    gst_init(nullptr, nullptr);
+    for (const auto* name : names) {
+        GstElementFactory* factory = gst_element_factory_find(name);
+        if (!factory) {
+            return false;
+        }
+        gst_object_unref(factory);
+    }
+    return true;
+}
+
+bool isGreen(const PixelRgb& pixel)
+{
+    constexpr int tolerance = 16;
+    return pixel.r < tolerance && pixel.g > 255 - tolerance && pixel.b < tolerance;
+}
+
+void checkDecodedStream(size_t width, size_t height)
+{
+    // The source is a solid green image: a wrong row stride would shift
+    // the channels of the following rows, turning them red or blue.
+    std::string pipeline = "videotestsrc pattern=solid-color foreground-color=0xff00ff00 ! "
+                           "video/x-raw,format=I420,width=" + std::to_string(width) + ",height=" + std::to_string(height) + " ! "
+                           "x264enc tune=zerolatency ! h264parse ! avdec_h264";
+    yarp::conf::environment::set_string("YARP_TEST_GSTREAMER_PIPELINE", pipeline);
+
+    BufferedPort<ImageOf<PixelRgb>> in;
+    REQUIRE(in.open("/gstreamer/in"));
+    REQUIRE(Network::registerContact(Contact("/gstreamer/src", "gstreamer", "127.0.0.1", 15000)).isValid());
+    REQUIRE(Network::connect("/gstreamer/src", in.getName(), "gstreamer+pipelineEnv.YARP_TEST_GSTREAMER_PIPELINE"));
+
+    // Several frames are read, so the samples wrapped by the previous
+    // images must have been given back to the pipeline
+    for (int i = 0; i < 10; i++) {
+        ImageOf<PixelRgb>* image = in.read();
+        REQUIRE(image != nullptr);
+        REQUIRE(image->width() == width);
+        REQUIRE(image->height() == height);
+        for (size_t y = 0; y < height; y += height / 4) {
+            CHECK(isGreen(image->pixel(0, y)));
+            CHECK(isGreen(image->pixel(width / 2, y)));
+            CHECK(isGreen(image->pixel(width - 1, y)));
+        }
+        CHECK(isGreen(image->pixel(width - 1, height - 1)));
+    }
+
+    Network::disconnect("/gstreamer/src", in.getName());
+    Network::unregisterName("/gstreamer/src");
+    in.interrupt();
+    in.close();
+}
+
+} // namespace
+
+TEST_CASE("carriers::gstreamer", "[carriers]")
+{
+    YARP_REQUIRE_PLUGIN("gstreamer", "carrier");
+
+    if (!hasElements({"videotestsrc", "x264enc", "h264parse", "avdec_h264", "videoconvert"})) {
+        YARP_SKIP_TEST("The gstreamer elements used by the test are not available")
+    }
+
+    Network::setLocalMode(true);
+
+    SECTION("test decoding of images with unpadded rows")
+    {
+        checkDecodedStream(320, 240);
+    }
+
+    SECTION("test decoding of images with padded rows")
+    {
+        // gstreamer pads the 966 bytes rows of RGB frames to 968 bytes
+        checkDecodedStream(322, 242);
+    }
+
+    Network::setLocalMode(false);
+}
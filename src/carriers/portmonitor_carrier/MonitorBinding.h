@@ -12,6 +12,8 @@
 
 #include "MonitorEvent.h"
 
+#include <vector>
+
 class MonitorBinding
 {
 
@@ -30,6 +32,9 @@ public:
     virtual bool hasUpdateReply() = 0;
     virtual yarp::os::Things& updateReply(yarp::os::Things& thing) = 0;
 
+    virtual bool hasUpdateBatch() = 0;
+    virtual std::vector<yarp::os::Things*> updateBatch(const std::vector<yarp::os::Things*>& things) = 0;
+
     virtual bool peerTrigged() = 0;
     virtual bool setAcceptConstraint(const char* constraint) = 0;
     virtual const char* getAcceptConstraint() = 0;
@@ -4,6 +4,7 @@
  */
 
 #include <yarp/os/Log.h>
+#include <map>
 #include <string>
 #include <yarp/os/ResourceFinder.h>
 #include <yarp/os/ConnectionState.h>
@@ -139,27 +140,31 @@ yarp::os::ConnectionReader& PortMonitor::modifyIncomingData(yarp::os::Connection
     // When we are here,
     // the incoming data should be accessed using localReader.
     // The reader passed to this function is infact empty.
-    // first check if we need to call the update callback
-    if(!binder->hasUpdate()) {
-        localReader->setParentConnectionReader(&reader);
-        return *localReader;
+    // first check if we need to call the update callback. When the binder
+    // has a batch callback, the data was already updated in acceptIncomingData()
+    Message& message = getMessage(reader);
+    if(!binder->hasUpdate() || binder->hasUpdateBatch()) {
+        message.localReader->setParentConnectionReader(&reader);
+        return *message.localReader;
     }
 
     PortMonitor::lock();
     yarp::os::Things thing;
-    thing.setConnectionReader(*localReader);
+    thing.setConnectionReader(*message.localReader);
     yarp::os::Things& result = binder->updateData(thing);
+    message.con.reset();
+    bool written = result.write(message.con.getWriter());
+    yarp::os::PortReader* replyHandler = result.getPortReader();
     PortMonitor::unlock();
-    con.reset();
-    if(result.write(con.getWriter())) {
-        auto& cReader = con.getReader(reader.getWriter());
+    if(written) {
+        auto& cReader = message.con.getReader(reader.getWriter());
         cReader.setParentConnectionReader(&reader);
-        if (result.getPortReader() != nullptr) {
-            cReader.getWriter()->setReplyHandler(*result.getPortReader());
+        if (replyHandler != nullptr) {
+            cReader.getWriter()->setReplyHandler(*replyHandler);
         }
         return cReader;
     }
-    return *localReader;
+    return *message.localReader;
 }
 
 bool PortMonitor::acceptIncomingData(yarp::os::ConnectionReader& reader)
@@ -171,9 +176,24 @@ bool PortMonitor::acceptIncomingData(yarp::os::ConnectionReader& reader)
     }
 
     bool result = false;
-    localReader = &reader;
+    Message& message = getMessage(reader);
+    message.localReader = &reader;
+    // The batch callback accepts and updates the data in a single call
+    if(binder->hasUpdateBatch())
+    {
+        Things thing;
+        thing.setConnectionReader(reader);
+        BatchRequest request;
+        request.thing = &thing;
+        request.reader = &reader;
+        request.message = &message;
+        if(!processBatch(request)) {
+            return false;
+        }
+        result = true;
+    }
     // If no accept callback avoid calling the binder
-    if(binder->hasAccept())
+    else if(binder->hasAccept())
     {
         PortMonitor::lock();
         Things thing;
@@ -192,9 +212,9 @@ bool PortMonitor::acceptIncomingData(yarp::os::ConnectionReader& reader)
         // localReader points to a connection reader which contains
         // either the original or modified data.
         if(thing.hasBeenRead()) {
-            con.reset();
-            if(thing.write(con.getWriter())) {
-                localReader = &con.getReader(reader.getWriter());
+            message.con.reset();
+            if(thing.write(message.con.getWriter())) {
+                message.localReader = &message.con.getReader(reader.getWriter());
             }
         }
     }
@@ -216,13 +236,25 @@ const yarp::os::PortWriter& PortMonitor::modifyOutgoingData(const yarp::os::Port
         return writer;
     }
 
+    // The data was already updated in acceptOutgoingData()
+    if(binder->hasUpdateBatch()) {
+        const yarp::os::PortWriter* modified = nullptr;
+        std::lock_guard<std::mutex> guard(messagesMutex);
+        auto it = outgoingMessages.find(&writer);
+        if(it != outgoingMessages.end()) {
+            modified = it->second;
+            outgoingMessages.erase(it);
+        }
+        return (modified != nullptr) ? *modified : writer;
+    }
+
     // If no update callback avoid calling it
     if(!binder->hasUpdate()) {
         return writer;
     }
 
     PortMonitor::lock();
-    thing.reset();
+    yarp::os::Things thing;
     thing.setPortWriter(const_cast<yarp::os::PortWriter*>(&writer));
     yarp::os::Things& result = binder->updateData(thing);
     PortMonitor::unlock();
@@ -237,6 +269,21 @@ bool PortMonitor::acceptOutgoingData(const yarp::os::PortWriter& writer)
         return false;
     }
 
+    // The batch callback accepts and updates the data in a single call
+    if(binder->hasUpdateBatch()) {
+        Things thing;
+        thing.setPortWriter(const_cast<yarp::os::PortWriter*>(&writer));
+        BatchRequest request;
+        request.thing = &thing;
+        if(!processBatch(request)) {
+            return false;
+        }
+        // modifyOutgoingData() is called next with the same writer
+        std::lock_guard<std::mutex> guard(messagesMutex);
+        outgoingMessages[&writer] = request.writer;
+        return true;
+    }
+
     // If no accept callback avoid calling it
     if(!binder->hasAccept()) {
         return true;
@@ -264,13 +311,98 @@ yarp::os::PortReader& PortMonitor::modifyReply(yarp::os::PortReader& reader)
     }
 
     PortMonitor::lock();
-    thing.reset();
+    yarp::os::Things thing;
     thing.setPortReader(&reader);
     yarp::os::Things& result = binder->updateReply(thing);
     PortMonitor::unlock();
     return *result.getPortReader();
 }
 
+PortMonitor::Message& PortMonitor::getMessage(const yarp::os::ConnectionReader& reader)
+{
+    // The elements of the map are not moved when other connections add
+    // theirs, each connection uses its own message without locking
+    std::lock_guard<std::mutex> guard(messagesMutex);
+    return incomingMessages[&reader];
+}
+
+bool PortMonitor::processBatch(BatchRequest& request)
+{
+    std::unique_lock<std::mutex> batchLock(batchMutex);
+    pendingBatch.push_back(&request);
+    while(!request.done)
+    {
+        if(batchRunning) {
+            batchDone.wait(batchLock);
+            continue;
+        }
+
+        // This thread passes all the queued messages, including its own,
+        // to the callback, while the other threads wait for the results
+        batchRunning = true;
+        std::vector<BatchRequest*> batch;
+        batch.swap(pendingBatch);
+        batchLock.unlock();
+
+        std::vector<Things*> things;
+        things.reserve(batch.size());
+        for(auto* queued : batch) {
+            things.push_back(queued->thing);
+        }
+
+        // the results are copied before releasing the monitor object,
+        // since they can be reused by the next call
+        PortMonitor::lock();
+        std::vector<Things*> results = binder->updateBatch(things);
+        if(results.size() != batch.size()) {
+            yCError(PORTMONITORCARRIER, "updateBatch returned %zu results for %zu messages", results.size(), batch.size());
+        }
+        for(size_t i=0; i<batch.size(); i++) {
+            completeBatchRequest(*batch[i], (i < results.size()) ? results[i] : nullptr);
+        }
+        PortMonitor::unlock();
+
+        batchLock.lock();
+        for(auto* queued : batch) {
+            queued->done = true;
+        }
+        batchRunning = false;
+        batchDone.notify_all();
+    }
+    return request.accepted;
+}
+
+void PortMonitor::completeBatchRequest(BatchRequest& request, Things* result)
+{
+    if(result == nullptr) {
+        request.accepted = false;
+        return;
+    }
+
+    // outgoing data: the writer is returned by modifyOutgoingData()
+    if(request.reader == nullptr) {
+        request.writer = result->getPortWriter();
+        request.accepted = (request.writer != nullptr);
+        return;
+    }
+
+    Message& message = *request.message;
+
+    // incoming data: see acceptIncomingData(), the modified data are
+    // passed to modifyIncomingData() through localReader
+    if(result != request.thing || request.thing->hasBeenRead()) {
+        message.con.reset();
+        if(result->write(message.con.getWriter())) {
+            auto& cReader = message.con.getReader(request.reader->getWriter());
+            if (result->getPortReader() != nullptr) {
+                cReader.getWriter()->setReplyHandler(*result->getPortReader());
+            }
+            message.localReader = &cReader;
+        }
+    }
+    request.accepted = true;
+}
+
 /**
  * Class PortMonitorGroup
  */
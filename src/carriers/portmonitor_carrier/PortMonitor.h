@@ -15,7 +15,10 @@
 #include "MonitorBinding.h"
 #include "MonitorEvent.h"
 
+#include <condition_variable>
+#include <map>
 #include <mutex>
+#include <vector>
 
 
 class PortMonitor;
@@ -121,13 +124,52 @@ private:
 
 
 private:
+    /**
+     * The data of an incoming message passing through the monitor, which
+     * must stay available until the next message is read from the same
+     * connection
+     */
+    struct Message
+    {
+        yarp::os::DummyConnector con;
+        yarp::os::ConnectionReader* localReader {nullptr};
+    };
+
+    /**
+     * A message waiting to be processed by the updateBatch callback
+     */
+    struct BatchRequest
+    {
+        yarp::os::Things* thing {nullptr};
+        yarp::os::ConnectionReader* reader {nullptr};
+        Message* message {nullptr};
+        const yarp::os::PortWriter* writer {nullptr};
+        bool accepted {false};
+        bool done {false};
+    };
+
+    Message& getMessage(const yarp::os::ConnectionReader& reader);
+    bool processBatch(BatchRequest& request);
+    void completeBatchRequest(BatchRequest& request, yarp::os::Things* result);
+
+    // A monitor attached to a port is used by all its connections at the
+    // same time, the messages are indexed by the reader of the connection
+    // (incoming data) or by the writer passed to the monitor (outgoing data)
+    std::map<const yarp::os::ConnectionReader*, Message> incomingMessages;
+    std::map<const yarp::os::PortWriter*, const yarp::os::PortWriter*> outgoingMessages;
+    std::mutex messagesMutex;
+
     bool bReady {false};
-    yarp::os::DummyConnector con;
-    yarp::os::ConnectionReader* localReader {nullptr};
-    yarp::os::Things thing;
     MonitorBinding* binder {nullptr};
     PortMonitorGroup *group {nullptr};
     mutable std::mutex mutex;
+
+    // The messages that reach the monitor while the updateBatch callback is
+    // running are queued, and processed together by the next call
+    std::vector<BatchRequest*> pendingBatch;
+    bool batchRunning {false};
+    std::mutex batchMutex;
+    std::condition_variable batchDone;
 };
 
 #endif //PORTMONITOR_INC
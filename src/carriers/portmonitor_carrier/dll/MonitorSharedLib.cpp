@@ -88,6 +88,11 @@ yarp::os::Things& MonitorSharedLib::updateReply(Things &thing)
     return monitor->updateReply(thing);
 }
 
+std::vector<yarp::os::Things*> MonitorSharedLib::updateBatch(const std::vector<yarp::os::Things*>& things)
+{
+    return monitor->updateBatch(things);
+}
+
 
 bool MonitorSharedLib::peerTrigged()
 {
@@ -29,6 +29,7 @@ public:
     bool acceptData(yarp::os::Things &thing) override;
     yarp::os::Things& updateData(yarp::os::Things &thing) override;
     yarp::os::Things& updateReply(yarp::os::Things &thing) override;
+    std::vector<yarp::os::Things*> updateBatch(const std::vector<yarp::os::Things*>& things) override;
 
     bool peerTrigged() override;
     bool canAccept() override;
@@ -48,6 +49,7 @@ public:
     bool hasAccept() override { return true; }
     bool hasUpdate() override { return true; }
     bool hasUpdateReply() override { return true; }
+    bool hasUpdateBatch() override { return monitor.isValid() && monitor->hasUpdateBatch(); }
 
 private:
     std::string constraint;
@@ -19,6 +19,7 @@ using namespace yarp::os;
 MonitorLua::MonitorLua() : bHasAcceptCallback(false),
                            bHasUpdateCallback(false),
                            bHasUpdateReplyCallback(false),
+                           bHasUpdateBatchCallback(false),
                            trigger(nullptr)
 {
     L = luaL_newstate();
@@ -136,6 +137,10 @@ bool MonitorLua::load(const Property &options)
     // Check if there is update callback
     bHasUpdateReplyCallback = getLocalFunction("update_reply");
     lua_pop(L,1);
+
+    // Check if there is update_batch callback
+    bHasUpdateBatchCallback = getLocalFunction("update_batch");
+    lua_pop(L,1);
     luaMutex.unlock();
     return result;
 }
@@ -272,6 +277,72 @@ yarp::os::Things& MonitorLua::updateReply(yarp::os::Things& thing)
     return thing;
 }
 
+std::vector<yarp::os::Things*> MonitorLua::updateBatch(const std::vector<yarp::os::Things*>& things)
+{
+    // the messages that cannot be converted are not delivered
+    std::vector<yarp::os::Things*> results(things.size(), nullptr);
+    luaMutex.lock();
+    if(getLocalFunction("update_batch"))
+    {
+        // mapping to swig type
+        swig_type_info *thingsType = SWIG_TypeQuery(L, "yarp::os::Things *");
+        if(!thingsType)
+        {
+            yCError(PORTMONITORCARRIER, "Swig type of Things is not found");
+            lua_pop(L, 1);
+            luaMutex.unlock();
+            return results;
+        }
+
+        // passing the messages as a lua array of swig-type pointers
+        lua_createtable(L, static_cast<int>(things.size()), 0);
+        for(size_t i=0; i<things.size(); i++)
+        {
+            SWIG_NewPointerObj(L, things[i], thingsType, 0);
+            lua_rawseti(L, -2, static_cast<int>(i+1));
+        }
+        if(lua_pcall(L, 1, 1, 0) != 0)
+        {
+            yCError(PORTMONITORCARRIER, "%s", lua_tostring(L, -1));
+            lua_pop(L, 1);
+            luaMutex.unlock();
+            return results;
+        }
+
+        // converting the results
+        if(lua_istable(L, -1) == 0)
+        {
+            yCError(PORTMONITORCARRIER, "Cannot get a valid return value from PortMonitor.update_batch");
+            lua_pop(L, 1);
+            luaMutex.unlock();
+            return results;
+        }
+        // a nil or false entry drops the corresponding message
+        for(size_t i=0; i<things.size(); i++)
+        {
+            lua_rawgeti(L, -1, static_cast<int>(i+1));
+            yarp::os::Things* result;
+            if(lua_isnil(L, -1) || (lua_isboolean(L, -1) && !lua_toboolean(L, -1)))
+            {
+                result = nullptr;
+            } else if(SWIG_Lua_ConvertPtr(L, -1, (void**)(&result), thingsType, 0) != SWIG_OK )
+            {
+                yCError(PORTMONITORCARRIER, "Cannot get a valid return value from PortMonitor.update_batch");
+                result = nullptr;
+            }
+            results[i] = result;
+            lua_pop(L, 1);
+        }
+        lua_pop(L, 1);
+        luaMutex.unlock();
+        return results;
+    }
+
+    lua_pop(L,1);
+    luaMutex.unlock();
+    return results;
+}
+
 bool MonitorLua::setParams(const yarp::os::Property& params)
 {
     luaMutex.lock();
@@ -29,6 +29,7 @@ public:
     bool acceptData(yarp::os::Things& thing) override;
     yarp::os::Things& updateData(yarp::os::Things& thing) override;
     yarp::os::Things& updateReply(yarp::os::Things& thing) override;
+    std::vector<yarp::os::Things*> updateBatch(const std::vector<yarp::os::Things*>& things) override;
 
     bool peerTrigged() override;
     bool canAccept() override;
@@ -58,12 +59,17 @@ public:
         return bHasUpdateReplyCallback;
     }
 
+    bool hasUpdateBatch() override {
+        return bHasUpdateBatchCallback;
+    }
+
 private:
     lua_State *L;
     std::string constraint;
     bool bHasAcceptCallback;
     bool bHasUpdateCallback;
     bool bHasUpdateReplyCallback;
+    bool bHasUpdateBatchCallback;
     std::recursive_mutex luaMutex;
 
 public:
@@ -14,6 +14,7 @@
 #include <cerrno>
 #include <cstring>
 #include <fcntl.h> /* For O_* constants */
+#include <poll.h>
 #include <sys/socket.h>
 #include <sys/stat.h> /* For mode constants */
 #include <sys/un.h>
@@ -75,6 +76,17 @@ bool UnixSockTwoWayStream::open(bool sender)
             yCError(UNIXSOCK_CARRIER, "listen() error: %d, %s", errno, strerror(errno));
             return false;
         }
+        // do not wait forever if the sender cannot reach the socket (for
+        // example, when the two ports do not share the same file system)
+        struct pollfd pfd {reader_fd, POLLIN, 0};
+        int ready = ::poll(&pfd, 1, static_cast<int>(acceptTimeout * 1000));
+        if (ready <= 0) {
+            // Not an error when the connection was upgraded automatically,
+            // the sender falls back to the original carrier
+            yCDebug(UNIXSOCK_CARRIER, "accept() error, no connection received in %g seconds", acceptTimeout);
+            return false;
+        }
+
         struct sockaddr_un remote;
         uint lenRemote = sizeof(remote);
 
@@ -199,3 +211,29 @@ void UnixSockTwoWayStream::beginPacket()
 void UnixSockTwoWayStream::endPacket()
 {
 }
+
+bool UnixSockTwoWayStream::setTypeOfService(int tos)
+{
+#if defined(__linux__)
+    // The packets never leave the machine, therefore there is no IP header
+    // to set, but the priority of the socket is set as Linux does for the
+    // IP_TOS option of tcp sockets
+    static constexpr int tos2priority[16] = {0, 1, 0, 0, 2, 1, 2, 2, 6, 6, 6, 6, 4, 4, 4, 4};
+    int priority = tos2priority[(tos & 0x1E) >> 1];
+    int fd = openedAsReader ? sender_fd : reader_fd;
+    if (fd < 0 || ::setsockopt(fd, SOL_SOCKET, SO_PRIORITY, &priority, sizeof(priority)) == -1) {
+        yCDebug(UNIXSOCK_CARRIER, "setsockopt() error: %d, %s", errno, strerror(errno));
+        return false;
+    }
+    typeOfService = tos;
+    return true;
+#else
+    YARP_UNUSED(tos);
+    return false;
+#endif
+}
+
+int UnixSockTwoWayStream::getTypeOfService()
+{
+    return typeOfService;
+}
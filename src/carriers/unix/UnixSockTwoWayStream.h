@@ -51,6 +51,9 @@ public:
     void beginPacket() override;
     void endPacket() override;
 
+    bool setTypeOfService(int tos) override;
+    int getTypeOfService() override;
+
     bool open(bool sender = false);
     void setLocalAddress(yarp::os::Contact& _localAddress);
     void setRemoteAddress(yarp::os::Contact& _remoteAddress);
@@ -65,9 +68,12 @@ private:
     std::string socketPath;
     int reader_fd{-1};
     int sender_fd{-1};
+    int typeOfService{-1};
 
     static constexpr size_t maxAttempts = 5;
     static constexpr double delayBetweenAttempts = 0.1;
+    // the receiver waits twice the time the sender tries to connect
+    static constexpr double acceptTimeout = 2 * maxAttempts * delayBetweenAttempts;
 };
 
 #endif // YARP_UNIX_UNIXSOCKTWOWAYSTREAM_H
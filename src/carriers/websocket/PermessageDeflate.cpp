@@ -0,0 +1,139 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "PermessageDeflate.h"
+
+#include <algorithm>
+#include <cctype>
+
+
+namespace {
+
+std::string trim(const std::string& text)
+{
+    size_t begin = text.find_first_not_of(" \t");
+    if (begin == std::string::npos) {
+        return {};
+    }
+    size_t end = text.find_last_not_of(" \t");
+    return text.substr(begin, end - begin + 1);
+}
+
+std::string toLower(std::string text)
+{
+    std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return std::tolower(c); });
+    return text;
+}
+
+std::vector<std::string> split(const std::string& text, char separator)
+{
+    std::vector<std::string> parts;
+    size_t begin = 0;
+    size_t end;
+    while ((end = text.find(separator, begin)) != std::string::npos) {
+        parts.push_back(trim(text.substr(begin, end - begin)));
+        begin = end + 1;
+    }
+    parts.push_back(trim(text.substr(begin)));
+    return parts;
+}
+
+// Parses a window size parameter, 8 to 15 according to RFC 7692
+bool parseWindowBits(const std::string& value, int& bits)
+{
+    if (value.empty() || value.size() > 2 || value[0] == '0'
+        || !std::all_of(value.begin(), value.end(), [](unsigned char c) { return std::isdigit(c); })) {
+        return false;
+    }
+    bits = std::stoi(value);
+    return bits >= 8 && bits <= 15;
+}
+
+/*
+ * Checks a single permessage-deflate offer (the parameters following the
+ * extension name) and prepares the response to it. An offer with unknown,
+ * repeated or invalid parameters is declined, as required by RFC 7692.
+ */
+bool acceptDeflateOffer(const std::vector<std::string>& params, PermessageDeflateOptions& options, std::string& response)
+{
+    options = PermessageDeflateOptions();
+    response = "permessage-deflate";
+    bool clientNoContextTakeover = false;
+    bool clientMaxWindowBits = false;
+    bool serverMaxWindowBits = false;
+    for (size_t i = 1; i < params.size(); i++) {
+        std::string name = toLower(trim(params[i].substr(0, params[i].find('='))));
+        bool hasValue = params[i].find('=') != std::string::npos;
+        std::string value = hasValue ? trim(params[i].substr(params[i].find('=') + 1)) : std::string();
+        if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+            value = value.substr(1, value.size() - 2);
+        }
+        if (name == "server_no_context_takeover") {
+            if (hasValue || options.serverNoContextTakeover) {
+                return false;
+            }
+            options.serverNoContextTakeover = true;
+            response += "; server_no_context_takeover";
+        } else if (name == "client_no_context_takeover") {
+            // A hint only, the decompression copes with any compressor
+            if (hasValue || clientNoContextTakeover) {
+                return false;
+            }
+            clientNoContextTakeover = true;
+        } else if (name == "server_max_window_bits") {
+            if (serverMaxWindowBits || !parseWindowBits(value, options.serverMaxWindowBits)) {
+                return false;
+            }
+            serverMaxWindowBits = true;
+            response += "; server_max_window_bits=" + std::to_string(options.serverMaxWindowBits);
+        } else if (name == "client_max_window_bits") {
+            // A hint only, the decompression always uses the largest window
+            int bits = 0;
+            if (clientMaxWindowBits || (hasValue && !parseWindowBits(value, bits))) {
+                return false;
+            }
+            clientMaxWindowBits = true;
+        } else {
+            return false;
+        }
+    }
+    // zlib cannot produce raw deflate streams with a 256 bytes window
+    if (options.serverMaxWindowBits < 9) {
+        return false;
+    }
+    options.enabled = true;
+    return true;
+}
+
+} // namespace
+
+
+bool appendExtensionOffers(const std::string& line, std::string& offers)
+{
+    // The header names are case-insensitive, and the same header can
+    // be repeated, the offers are then concatenated
+    size_t colon = line.find(':');
+    if (colon == std::string::npos || toLower(trim(line.substr(0, colon))) != "sec-websocket-extensions") {
+        return false;
+    }
+    if (!offers.empty()) {
+        offers += ',';
+    }
+    offers += line.substr(colon + 1);
+    return true;
+}
+
+
+PermessageDeflateOptions negotiatePermessageDeflate(const std::string& offers, std::string& response)
+{
+    PermessageDeflateOptions options;
+    for (const auto& offer : split(offers, ',')) {
+        auto params = split(offer, ';');
+        if (toLower(params[0]) == "permessage-deflate" && acceptDeflateOffer(params, options, response)) {
+            return options;
+        }
+    }
+    return {};
+}
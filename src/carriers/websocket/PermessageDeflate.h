@@ -0,0 +1,46 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_PERMESSAGEDEFLATE_H
+#define YARP_PERMESSAGEDEFLATE_H
+
+#include <string>
+#include <vector>
+
+
+/**
+ * The parameters of the permessage-deflate extension (RFC 7692) negotiated
+ * during the handshake.
+ */
+struct PermessageDeflateOptions
+{
+    bool enabled {false};
+    bool serverNoContextTakeover {false}; // the compression is restarted for each message
+    int serverMaxWindowBits {15};         // the size of the window used for the compression
+};
+
+
+/**
+ * If the line of the handshake is a Sec-WebSocket-Extensions header, its
+ * offers are appended to the ones already collected.
+ * @param line a line of the handshake
+ * @param offers the extension offers collected so far
+ * @return true if the line is a Sec-WebSocket-Extensions header
+ */
+bool appendExtensionOffers(const std::string& line, std::string& offers);
+
+/**
+ * It picks the first acceptable permessage-deflate offer. An offer with
+ * unknown, repeated or invalid parameters is declined, as required by
+ * RFC 7692.
+ * @param offers the extension offers of the client
+ * @param response the value of the Sec-WebSocket-Extensions header of the
+ *                 reply, if an offer was accepted
+ * @return the parameters of the accepted offer, not enabled if no offer
+ *         was accepted
+ */
+PermessageDeflateOptions negotiatePermessageDeflate(const std::string& offers, std::string& response);
+
+#endif // YARP_PERMESSAGEDEFLATE_H
@@ -4,7 +4,6 @@
  */
 
 #include "WebSocketCarrier.h"
-#include "WebSocketStream.h"
 
 #include <yarp/os/ManagedBytes.h>
 #include <yarp/os/Route.h>
@@ -132,6 +131,7 @@ bool WebSocketCarrier::expectSenderSpecifier(yarp::os::ConnectionState& proto)
         if (line.empty()) {
             done = true;
         }
+        appendExtensionOffers(line, extensionOffers);
     }
     auto messagetype = messageHandler.parseHandshake(reinterpret_cast<unsigned char*>(const_cast<char*>(result.c_str())), result.size());
     if (messagetype != WebSocketFrameType::OPENING_FRAME) {
@@ -178,12 +178,21 @@ bool WebSocketCarrier::expectAck(yarp::os::ConnectionState& proto)
 bool WebSocketCarrier::respondToHeader(yarp::os::ConnectionState& proto)
 {
     yCTrace(WEBSOCKETCARRIER);
-    auto& outputStream = proto.os();
+    std::string extension;
+    PermessageDeflateOptions deflateOptions = negotiatePermessageDeflate(extensionOffers, extension);
+    // The stream is created before replying, so that the extension is
+    // accepted only if the compression can actually be initialized
+    TwoWayStream* delegate = proto.giveStreams();
+    WebSocketStream* stream = new WebSocketStream(delegate, deflateOptions);
     std::string reply = messageHandler.answerHandshake();
+    if (stream->usesPermessageDeflate()) {
+        // the extension is accepted before the empty line that ends the reply
+        reply.insert(reply.length() - 2, "Sec-WebSocket-Extensions: " + extension + "\r\n");
+    }
+    auto& outputStream = delegate->getOutputStream();
     yarp::os::Bytes replySerialized(&reply[0], reply.length());
     outputStream.write(replySerialized);
     outputStream.flush();
-    WebSocketStream* stream = new WebSocketStream(proto.giveStreams());
     proto.takeStreams(stream);
     return proto.os().isOk();
 }
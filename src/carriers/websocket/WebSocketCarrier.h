@@ -7,6 +7,7 @@
 #define WEBSOCKETCARRIER_H
 
 #include "WebSocket/WebSocket.h"
+#include "WebSocketStream.h"
 
 #include <yarp/os/Carrier.h>
 #include <yarp/os/ConnectionState.h>
@@ -54,6 +55,7 @@ public:
 private:
     static constexpr size_t header_lenght {8};
     WebSocket messageHandler;
+    std::string extensionOffers;
 };
 
 #endif // WEBSOCKETCARRIER_H
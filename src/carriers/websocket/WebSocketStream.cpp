@@ -10,6 +10,9 @@
 #include <yarp/os/NetType.h>
 #include <yarp/os/NetInt64.h>
 
+#include <algorithm>
+#include <cstring>
+
 using namespace yarp::os;
 
 YARP_LOG_COMPONENT(WEBSOCK_STREAM,
@@ -20,15 +23,42 @@ YARP_LOG_COMPONENT(WEBSOCK_STREAM,
                    nullptr)
 
 
-WebSocketStream::WebSocketStream(yarp::os::TwoWayStream* delegate) :
-        delegate(delegate)
+WebSocketStream::WebSocketStream(yarp::os::TwoWayStream* delegate, const PermessageDeflateOptions& deflateOptions) :
+        delegate(delegate),
+        permessageDeflate(deflateOptions.enabled),
+        noContextTakeover(deflateOptions.serverNoContextTakeover)
 {
+#ifdef YARP_HAS_ZLIB
+    if (permessageDeflate) {
+        // Unless the client asked otherwise, the compression context is kept
+        // between messages (context takeover)
+        if (deflateInit2(&deflater, Z_BEST_SPEED, Z_DEFLATED, -deflateOptions.serverMaxWindowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            yCWarning(WEBSOCK_STREAM) << "Cannot initialize the compression, permessage-deflate disabled";
+            permessageDeflate = false;
+        } else if (inflateInit2(&inflater, -MAX_WBITS) != Z_OK) {
+            yCWarning(WEBSOCK_STREAM) << "Cannot initialize the decompression, permessage-deflate disabled";
+            deflateEnd(&deflater);
+            permessageDeflate = false;
+        }
+    }
+#else
+    permessageDeflate = false;
+#endif
+    pending.resize(headerRoom);
+    sender = std::thread(&WebSocketStream::sendLoop, this);
 }
 
 
 WebSocketStream::~WebSocketStream()
 {
     yCTrace(WEBSOCK_STREAM);
+    stopSender(true);
+#ifdef YARP_HAS_ZLIB
+    if (permessageDeflate) {
+        deflateEnd(&deflater);
+        inflateEnd(&inflater);
+    }
+#endif
 }
 
 
@@ -63,6 +93,8 @@ const Contact& WebSocketStream::getRemoteAddress() const
 void WebSocketStream::interrupt()
 {
     yCTrace(WEBSOCK_STREAM);
+    // the pending messages are not sent, the connection must stop as soon as possible
+    stopSender(false);
     close();
 }
 
@@ -70,10 +102,10 @@ void WebSocketStream::interrupt()
 void WebSocketStream::close()
 {
     yCTrace(WEBSOCK_STREAM);
-    yarp::os::ManagedBytes frame;
-    yarp::os::Bytes b;
-    makeFrame(CLOSING_OPCODE, b, frame);
-    yarp::os::Bytes toWrite(frame.get(), frame.length());
+    // the pending messages are sent before the close frame
+    stopSender(true);
+    std::vector<char> frame(headerRoom);
+    yarp::os::Bytes toWrite = makeFrame(CLOSING_OPCODE, false, frame);
     return delegate->getOutputStream().write(toWrite);
 }
 
@@ -108,16 +140,16 @@ yarp::conf::ssize_t WebSocketStream::read(Bytes& b)
 void WebSocketStream::write(const yarp::os::Bytes& b)
 {
     yCTrace(WEBSOCK_STREAM);
-    yarp::os::ManagedBytes frame;
-    makeFrame(BINARY_FRAME, b, frame);
-    yarp::os::Bytes toWrite(frame.get(), frame.length());
-    return delegate->getOutputStream().write(toWrite);
+    message.insert(message.end(), b.get(), b.get() + b.length());
+    if (!inPacket) {
+        enqueueMessage();
+    }
 }
 
 
 bool WebSocketStream::isOk() const
 {
-    return true;
+    return !writeFailed;
 }
 
 
@@ -128,12 +160,139 @@ void WebSocketStream::reset()
 
 void WebSocketStream::beginPacket()
 {
+    inPacket = true;
 }
 
 
 void WebSocketStream::endPacket()
 {
+    inPacket = false;
+    if (!message.empty()) {
+        enqueueMessage();
+    }
+}
+
+
+bool WebSocketStream::usesPermessageDeflate() const
+{
+    return permessageDeflate;
+}
+
+
+void WebSocketStream::enqueueMessage()
+{
+    size_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        if (!closing) {
+            size_t pendingBytes = pending.size() - headerRoom;
+            if (pendingBytes > 0 && pendingBytes + message.size() > maxPendingBytes) {
+                // The client is not keeping up: the older messages are dropped
+                dropped = pendingMessages;
+                pending.resize(headerRoom);
+                pendingMessages = 0;
+            }
+            pending.insert(pending.end(), message.begin(), message.end());
+            pendingMessages++;
+        }
+    }
+    message.clear();
+    pendingCondition.notify_one();
+
+    if (dropped > 0) {
+        yCWarningThrottle(WEBSOCK_STREAM, 5.0, "The websocket client is too slow, %zu messages dropped", dropped);
+    }
+}
+
+
+void WebSocketStream::sendLoop()
+{
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(pendingMutex);
+            pendingCondition.wait(lock, [this]() { return closing || pending.size() > headerRoom; });
+            if (pending.size() == headerRoom) {
+                // closing, and all the messages were sent
+                return;
+            }
+            // The messages written from now on are coalesced in the next frame
+            std::swap(pending, sending);
+            pending.resize(headerRoom);
+            pendingMessages = 0;
+        }
+
+        std::vector<char>* frame = &sending;
+#ifdef YARP_HAS_ZLIB
+        if (permessageDeflate) {
+            compressed.resize(headerRoom);
+            deflater.next_in = reinterpret_cast<Bytef*>(sending.data() + headerRoom);
+            deflater.avail_in = static_cast<uInt>(sending.size() - headerRoom);
+            do {
+                size_t used = compressed.size();
+                size_t chunk = std::max<size_t>(deflater.avail_in / 2, 1024);
+                compressed.resize(used + chunk);
+                deflater.next_out = reinterpret_cast<Bytef*>(compressed.data() + used);
+                deflater.avail_out = static_cast<uInt>(chunk);
+                deflate(&deflater, Z_SYNC_FLUSH);
+                compressed.resize(compressed.size() - deflater.avail_out);
+            } while (deflater.avail_out == 0);
+            // The empty block that terminates the flush is implied by permessage-deflate
+            compressed.resize(compressed.size() - 4);
+            if (noContextTakeover) {
+                deflateReset(&deflater);
+            }
+            frame = &compressed;
+        }
+#endif
+        yarp::os::Bytes toWrite = makeFrame(BINARY_FRAME, permessageDeflate, *frame);
+        delegate->getOutputStream().write(toWrite);
+        if (!delegate->getOutputStream().isOk()) {
+            yCError(WEBSOCK_STREAM) << "Failed to send the websocket frame";
+            writeFailed = true;
+            return;
+        }
+    }
+}
+
+
+void WebSocketStream::stopSender(bool drain)
+{
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        closing = true;
+        if (!drain) {
+            pending.resize(headerRoom);
+            pendingMessages = 0;
+        }
+    }
+    pendingCondition.notify_all();
+    if (sender.joinable()) {
+        sender.join();
+    }
+}
+
+
+#ifdef YARP_HAS_ZLIB
+bool WebSocketStream::inflateBuffer(const char* data, size_t length)
+{
+    inflater.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    inflater.avail_in = static_cast<uInt>(length);
+    do {
+        size_t used = inflated.size();
+        size_t chunk = std::max<size_t>(length * 2, 1024);
+        inflated.resize(used + chunk);
+        inflater.next_out = reinterpret_cast<Bytef*>(inflated.data() + used);
+        inflater.avail_out = static_cast<uInt>(chunk);
+        int ret = inflate(&inflater, Z_SYNC_FLUSH);
+        inflated.resize(inflated.size() - inflater.avail_out);
+        if (ret != Z_OK && ret != Z_BUF_ERROR) {
+            yCError(WEBSOCK_STREAM) << "Failed to decompress the websocket frame";
+            return false;
+        }
+    } while (inflater.avail_out == 0);
+    return true;
 }
+#endif
 
 
 WebSocketFrameType WebSocketStream::getFrame(yarp::os::ManagedBytes& payload)
@@ -143,6 +302,8 @@ WebSocketFrameType WebSocketStream::getFrame(yarp::os::ManagedBytes& payload)
     yarp::os::ManagedBytes mask_bytes;
     header.allocate(2);
     delegate->getInputStream().read(header.bytes());
+    unsigned char msg_fin = (header.get()[0] >> 7) & 0x01;
+    unsigned char msg_rsv1 = (header.get()[0] >> 6) & 0x01;
     unsigned char msg_opcode = header.get()[0] & 0x0F;
     unsigned char msg_masked = (header.get()[1] >> 7) & 0x01;
     if(msg_opcode == 0x9)
@@ -198,6 +359,28 @@ WebSocketFrameType WebSocketStream::getFrame(yarp::os::ManagedBytes& payload)
         }
     }
 
+    // only the first frame of a message tells whether it is compressed
+    if (msg_opcode == 0x1 || msg_opcode == 0x2) {
+        compressedMessage = (msg_rsv1 != 0);
+    }
+#ifdef YARP_HAS_ZLIB
+    if (permessageDeflate && compressedMessage && msg_opcode <= 0x2) {
+        static const char deflateTail[] = {0x00, 0x00, static_cast<char>(0xFF), static_cast<char>(0xFF)};
+        inflated.clear();
+        bool ok = inflateBuffer(payload.get(), payload.length());
+        if (ok && msg_fin) {
+            ok = inflateBuffer(deflateTail, sizeof(deflateTail));
+        }
+        if (!ok) {
+            return ERROR_FRAME;
+        }
+        payload.allocate(inflated.size());
+        memcpy(payload.get(), inflated.data(), inflated.size());
+    }
+#else
+    YARP_UNUSED(msg_fin);
+#endif
+
     if(msg_opcode == 0x0 || msg_opcode == 0x1)
     {
         return TEXT_FRAME;
@@ -211,40 +394,36 @@ WebSocketFrameType WebSocketStream::getFrame(yarp::os::ManagedBytes& payload)
 
 
 // TODO FIXME STE need to manage if frame is not passed
-void WebSocketStream::makeFrame(WebSocketFrameType frame_type,
-                                const yarp::os::Bytes& payload,
-                                yarp::os::ManagedBytes& frame)
+yarp::os::Bytes WebSocketStream::makeFrame(WebSocketFrameType frame_type,
+                                           bool compressed,
+                                           std::vector<char>& frame)
 {
     yCTrace(WEBSOCK_STREAM);
-    int pos = 0;
-    size_t size = payload.length();
-
-    if (size <= 125) {
-        frame.allocate(2 + size);
-    } else if (size <= 65535) {
-        frame.allocate(4 + size);
-    } else { // >2^16-1 (65535)
-        frame.allocate(10 + size);
-    }
-
-    frame.get()[pos] = static_cast<char>(frame_type); // text frame
-    pos++;
+    char header[headerRoom];
+    size_t pos = 0;
+    size_t size = frame.size() - headerRoom;
 
+    // the rsv1 bit marks the messages compressed with permessage-deflate
+    header[pos++] = static_cast<char>(compressed ? (frame_type | 0x40) : frame_type);
 
     if (size <= 125) {
         // this is a 7 bit size (the first bit is the mask
         // that must be set to 0)
-        frame.get()[pos++] = size;
+        header[pos++] = size;
     } else if (size <= 65535) {
-        frame.get()[pos++] = 126;                //16 bit length follows
-        frame.get()[pos++] = (size >> 8) & 0xFF; // leftmost first
-        frame.get()[pos++] = size & 0xFF;
+        header[pos++] = 126;                //16 bit length follows
+        header[pos++] = (size >> 8) & 0xFF; // leftmost first
+        header[pos++] = size & 0xFF;
     } else {                      // >2^16-1 (65535)
-        frame.get()[pos++] = 127; //64 bit length follows
+        header[pos++] = 127; //64 bit length follows
         // write the actual 64bit msg_length in the next 4 bytes
         for (int i = 7; i >= 0; i--) {
-            frame.get()[pos++] = ((size >> 8 * i) & 0xFF);
+            header[pos++] = ((size >> 8 * i) & 0xFF);
         }
     }
-    memcpy(reinterpret_cast<void*>(frame.get() + pos), payload.get(), size);
+
+    // the header is written just before the payload, in the room left for it
+    char* start = frame.data() + headerRoom - pos;
+    memcpy(start, header, pos);
+    return {start, pos + size};
 }
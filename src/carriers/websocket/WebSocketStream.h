@@ -6,11 +6,22 @@
 #ifndef YARP_WEBSOCKSTREAM_H
 #define YARP_WEBSOCKSTREAM_H
 
+#include "PermessageDeflate.h"
 #include "WebSocket/WebSocket.h"
 
 #include <yarp/os/ManagedBytes.h>
 #include <yarp/os/TwoWayStream.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef YARP_HAS_ZLIB
+#include <zlib.h>
+#endif
+
 
 class WebSocketStream :
         public yarp::os::TwoWayStream,
@@ -18,7 +29,12 @@ class WebSocketStream :
         public yarp::os::OutputStream
 {
 public:
-    WebSocketStream(TwoWayStream* delegate);
+    /**
+     * @param delegate the stream of the underlying connection
+     * @param deflateOptions the parameters of the permessage-deflate extension,
+     *                       if it was negotiated during the handshake
+     */
+    WebSocketStream(TwoWayStream* delegate, const PermessageDeflateOptions& deflateOptions = {});
 
     ~WebSocketStream() override;
 
@@ -44,9 +60,11 @@ public:
 
     /**
      * this override the write call to the stream,
-     * it automatically makes the header for the frame
-     * and sends it over websocket.
-     * It makes a binary frame.
+     * the bytes are collected until the end of the packet, and each
+     * message is sent over websocket as a single binary frame.
+     * Messages written while the previous frame is still being sent
+     * are coalesced into the next frame. If the client is too slow,
+     * older messages are dropped instead of blocking the writer.
      * @param bytesToRead the bytes that must be written into the socket
      */
     using yarp::os::OutputStream::write;
@@ -59,12 +77,68 @@ public:
     void beginPacket() override;
     void endPacket() override;
 
+    /**
+     * @return true if the messages are compressed with permessage-deflate.
+     * It is false if the compression cannot be initialized, even if the
+     * extension was negotiated.
+     */
+    bool usesPermessageDeflate() const;
+
 private:
     yarp::os::TwoWayStream* delegate;
     yarp::os::Contact local, remote;
     yarp::os::ManagedBytes buffer;
     size_t currentHead {0};
 
+    // room left at the beginning of the outgoing buffers for the frame header
+    static constexpr size_t headerRoom {10};
+    // above this size the pending messages are dropped in favour of the new one
+    static constexpr size_t maxPendingBytes {256 * 1024};
+
+    bool inPacket {false};
+    std::vector<char> message;          // the message being written
+    std::vector<char> pending;          // complete messages waiting to be sent
+    std::vector<char> sending;          // messages being sent by the sender thread
+    size_t pendingMessages {0};
+    bool closing {false};
+    std::atomic<bool> writeFailed {false};
+    std::mutex pendingMutex;
+    std::condition_variable pendingCondition;
+    std::thread sender;
+
+    bool permessageDeflate {false};
+    bool noContextTakeover {false};
+    bool compressedMessage {false};
+#ifdef YARP_HAS_ZLIB
+    z_stream deflater {};
+    z_stream inflater {};
+    std::vector<char> compressed;
+    std::vector<char> inflated;
+
+    /**
+     * It decompresses a permessage-deflate payload, appending it to inflated.
+     * @return false if the data cannot be decompressed
+     */
+    bool inflateBuffer(const char* data, size_t length);
+#endif
+
+    /**
+     * It moves the message written so far to the pending messages.
+     */
+    void enqueueMessage();
+
+    /**
+     * The loop of the sender thread, that sends the pending messages.
+     */
+    void sendLoop();
+
+    /**
+     * It stops the sender thread.
+     * @param drain if true, the pending messages are sent before stopping,
+     *              otherwise they are discarded
+     */
+    void stopSender(bool drain);
+
     /**
      * It reads from the delegate stream a websocket frame.
      * It automatically remove the header and unmasks the frame
@@ -77,12 +151,14 @@ private:
      * It creates a frame in the websocket format
      * @param frame_type a WebSocketFrameType for the frame that wants to be created
      *                   usually BINARY_FRAME or TEXT_FRAME
-     * @param payload the payload of the frame
-     * @param frame a pointer to the bytes where the frame must be creeated
+     * @param compressed true if the payload is compressed with permessage-deflate
+     * @param frame the buffer with the payload of the frame, starting after headerRoom
+     *              bytes, where the header is written
+     * @return the frame, including the header
      */
-    static void makeFrame(WebSocketFrameType frame_type,
-                   const yarp::os::Bytes& payload,
-                   yarp::os::ManagedBytes& frame);
+    static yarp::os::Bytes makeFrame(WebSocketFrameType frame_type,
+                                     bool compressed,
+                                     std::vector<char>& frame);
 };
 
 #endif // YARP_WEBSOCKSTREAM_H
@@ -0,0 +1,365 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "PermessageDeflate.h"
+#include "WebSocketStream.h"
+
+#include <yarp/os/Bytes.h>
+#include <yarp/os/Contact.h>
+#include <yarp/os/TwoWayStream.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace yarp::os;
+
+namespace {
+
+/**
+ * A stream that keeps the frames written, and returns them when it is read.
+ * The writes can be blocked, to simulate a slow client.
+ */
+class LoopbackStream :
+        public TwoWayStream,
+        public InputStream,
+        public OutputStream
+{
+public:
+    InputStream& getInputStream() override { return *this; }
+    OutputStream& getOutputStream() override { return *this; }
+    const Contact& getLocalAddress() const override { return address; }
+    const Contact& getRemoteAddress() const override { return address; }
+    bool isOk() const override { return true; }
+    void reset() override {}
+    void close() override {}
+    void beginPacket() override {}
+    void endPacket() override {}
+
+    using OutputStream::write;
+    void write(const Bytes& b) override
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        blockedWriters++;
+        condition.notify_all();
+        condition.wait(lock, [this]() { return !blocked; });
+        blockedWriters--;
+        frames.emplace_back(b.get(), b.length());
+        data.append(b.get(), b.length());
+        condition.notify_all();
+    }
+
+    using InputStream::read;
+    yarp::conf::ssize_t read(Bytes& b) override
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&]() { return data.size() - readPos >= b.length(); });
+        memcpy(b.get(), data.data() + readPos, b.length());
+        readPos += b.length();
+        return static_cast<yarp::conf::ssize_t>(b.length());
+    }
+
+    void block()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        blocked = true;
+    }
+
+    void unblock()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        blocked = false;
+        condition.notify_all();
+    }
+
+    // waits until a write is blocked
+    bool waitBlockedWriter()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        return condition.wait_for(lock, std::chrono::seconds(5), [this]() { return blockedWriters > 0; });
+    }
+
+    bool waitFrames(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        return condition.wait_for(lock, std::chrono::seconds(5), [&]() { return frames.size() >= count; });
+    }
+
+    std::vector<std::string> getFrames()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return frames;
+    }
+
+private:
+    Contact address;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool blocked {false};
+    size_t blockedWriters {0};
+    std::vector<std::string> frames;
+    std::string data;
+    size_t readPos {0};
+};
+
+struct Frame
+{
+    bool rsv1 {false};
+    int opcode {0};
+    std::string payload;
+};
+
+// Parses an unmasked frame written by the server
+Frame parseFrame(const std::string& frame)
+{
+    Frame ret;
+    auto byte = [&frame](size_t i) { return static_cast<unsigned char>(frame[i]); };
+    ret.rsv1 = (byte(0) & 0x40) != 0;
+    ret.opcode = byte(0) & 0x0F;
+    size_t length = byte(1) & 0x7F;
+    size_t pos = 2;
+    if (length == 126) {
+        length = (byte(2) << 8) | byte(3);
+        pos = 4;
+    } else if (length == 127) {
+        length = 0;
+        for (size_t i = 2; i < 10; i++) {
+            length = (length << 8) | byte(i);
+        }
+        pos = 10;
+    }
+    ret.payload = frame.substr(pos);
+    REQUIRE(ret.payload.size() == length);
+    return ret;
+}
+
+void writeMessage(WebSocketStream& stream, const std::string& message)
+{
+    stream.beginPacket();
+    // a message is usually written in more parts
+    size_t half = message.size() / 2;
+    stream.write(Bytes(const_cast<char*>(message.data()), half));
+    stream.write(Bytes(const_cast<char*>(message.data()) + half, message.size() - half));
+    stream.endPacket();
+}
+
+std::string readMessage(WebSocketStream& stream, size_t length)
+{
+    std::string message(length, '\0');
+    Bytes b(&message[0], length);
+    stream.read(b);
+    return message;
+}
+
+std::string makeMessage(size_t index, size_t length)
+{
+    std::string message = "message " + std::to_string(index) + ": ";
+    while (message.size() < length) {
+        message += "the quick brown fox jumps over the lazy dog ";
+    }
+    message.resize(length);
+    return message;
+}
+
+} // namespace
+
+TEST_CASE("carriers::websocket", "[carriers]")
+{
+    SECTION("test permessage-deflate accepted offers")
+    {
+        std::string response;
+        PermessageDeflateOptions options = negotiatePermessageDeflate("permessage-deflate", response);
+        CHECK(options.enabled);
+        CHECK_FALSE(options.serverNoContextTakeover);
+        CHECK(options.serverMaxWindowBits == 15);
+        CHECK(response == "permessage-deflate");
+
+        options = negotiatePermessageDeflate(" Permessage-Deflate; client_max_window_bits", response);
+        CHECK(options.enabled);
+        CHECK(response == "permessage-deflate");
+
+        options = negotiatePermessageDeflate("permessage-deflate; server_max_window_bits=10; server_no_context_takeover", response);
+        CHECK(options.enabled);
+        CHECK(options.serverNoContextTakeover);
+        CHECK(options.serverMaxWindowBits == 10);
+        CHECK(response == "permessage-deflate; server_max_window_bits=10; server_no_context_takeover");
+
+        options = negotiatePermessageDeflate("permessage-deflate; server_max_window_bits=\"12\"; client_max_window_bits=\"9\"", response);
+        CHECK(options.enabled);
+        CHECK(options.serverMaxWindowBits == 12);
+        CHECK(response == "permessage-deflate; server_max_window_bits=12");
+
+        // the first acceptable offer is used
+        options = negotiatePermessageDeflate("x-webkit-deflate-frame, permessage-deflate; server_max_window_bits=8, permessage-deflate; server_max_window_bits=11", response);
+        CHECK(options.enabled);
+        CHECK(options.serverMaxWindowBits == 11);
+        CHECK(response == "permessage-deflate; server_max_window_bits=11");
+    }
+
+    SECTION("test permessage-deflate declined offers")
+    {
+        std::string response;
+        CHECK_FALSE(negotiatePermessageDeflate("", response).enabled);
+        CHECK_FALSE(negotiatePermessageDeflate("x-webkit-deflate-frame", response).enabled);
+        // zlib does not support a 256 bytes window
+        CHECK_FALSE(negotiatePermessageDeflate("permessage-deflate; server_max_window_bits=8", response).enabled);
+        CHECK_FALSE(negotiatePermessageDeflate("permessage-deflate; server_max_window_bits=16", response).enabled);
+        CHECK_FALSE(negotiatePermessageDeflate("permessage-deflate; server_max_window_bits=010", response).enabled);
+        CHECK_FALSE(negotiatePermessageDeflate("permessage-deflate; server_max_window_bits", response).enabled);
+        CHECK_FALSE(negotiatePermessageDeflate("permessage-deflate; client_max_window_bits=7", response).enabled);
+        CHECK_FALSE(negotiatePermessageDeflate("permessage-deflate; server_no_context_takeover=1", response).enabled);
+        CHECK_FALSE(negotiatePermessageDeflate("permessage-deflate; unknown_parameter", response).enabled);
+        // repeated parameters
+        CHECK_FALSE(negotiatePermessageDeflate("permessage-deflate; server_no_context_takeover; server_no_context_takeover", response).enabled);
+        CHECK_FALSE(negotiatePermessageDeflate("permessage-deflate; server_max_window_bits=10; server_max_window_bits=10", response).enabled);
+        CHECK_FALSE(negotiatePermessageDeflate("permessage-deflate; client_no_context_takeover; client_no_context_takeover", response).enabled);
+    }
+
+    SECTION("test collecting the extension offers from the handshake")
+    {
+        std::string offers;
+        CHECK_FALSE(appendExtensionOffers("Host: localhost", offers));
+        CHECK_FALSE(appendExtensionOffers("", offers));
+        CHECK(appendExtensionOffers("Sec-WebSocket-Extensions: permessage-deflate; server_max_window_bits=8", offers));
+        CHECK(appendExtensionOffers("sec-websocket-extensions : permessage-deflate", offers));
+        std::string response;
+        PermessageDeflateOptions options = negotiatePermessageDeflate(offers, response);
+        CHECK(options.enabled);
+        CHECK(options.serverMaxWindowBits == 15);
+    }
+
+#if defined(YARP_HAS_ZLIB)
+    SECTION("test permessage-deflate round trip")
+    {
+        for (bool noContextTakeover : {false, true}) {
+            PermessageDeflateOptions options;
+            options.enabled = true;
+            options.serverNoContextTakeover = noContextTakeover;
+            options.serverMaxWindowBits = 12;
+
+            LoopbackStream loopback;
+            WebSocketStream writer(&loopback, options);
+            WebSocketStream reader(&loopback, options);
+            REQUIRE(writer.usesPermessageDeflate());
+            REQUIRE(reader.usesPermessageDeflate());
+
+            const size_t count = 20;
+            size_t written = 0;
+            for (size_t i = 0; i < count; i++) {
+                std::string message = makeMessage(i, 100 + i * 500);
+                writeMessage(writer, message);
+                written += message.size();
+                CHECK(readMessage(reader, message.size()) == message);
+            }
+
+            size_t sent = 0;
+            for (const auto& frame : loopback.getFrames()) {
+                Frame f = parseFrame(frame);
+                CHECK(f.rsv1);
+                CHECK(f.opcode == (BINARY_FRAME & 0x0F));
+                sent += f.payload.size();
+            }
+            CHECK(sent < written / 4);
+        }
+    }
+#endif
+
+    SECTION("test coalescing the messages written while sending")
+    {
+        LoopbackStream loopback;
+        WebSocketStream stream(&loopback);
+
+        loopback.block();
+        writeMessage(stream, "first");
+        REQUIRE(loopback.waitBlockedWriter());
+        writeMessage(stream, "second");
+        writeMessage(stream, "third");
+        writeMessage(stream, "fourth");
+        loopback.unblock();
+
+        REQUIRE(loopback.waitFrames(2));
+        stream.close();
+        auto frames = loopback.getFrames();
+        REQUIRE(frames.size() == 3);
+        CHECK(parseFrame(frames[0]).payload == "first");
+        CHECK(parseFrame(frames[1]).payload == "secondthirdfourth");
+        CHECK_FALSE(parseFrame(frames[1]).rsv1);
+        CHECK(parseFrame(frames[2]).opcode == CLOSING_OPCODE);
+    }
+
+    SECTION("test dropping the messages of a slow client")
+    {
+        LoopbackStream loopback;
+        WebSocketStream stream(&loopback);
+
+        loopback.block();
+        writeMessage(stream, "first");
+        REQUIRE(loopback.waitBlockedWriter());
+        // the pending messages would exceed 256 KiB, the older ones are dropped
+        std::string second = makeMessage(2, 200 * 1024);
+        std::string third = makeMessage(3, 100 * 1024);
+        std::string fourth = makeMessage(4, 1024);
+        writeMessage(stream, second);
+        writeMessage(stream, third);
+        writeMessage(stream, fourth);
+        loopback.unblock();
+
+        REQUIRE(loopback.waitFrames(2));
+        stream.close();
+        auto frames = loopback.getFrames();
+        REQUIRE(frames.size() == 3);
+        CHECK(parseFrame(frames[0]).payload == "first");
+        CHECK(parseFrame(frames[1]).payload == third + fourth);
+        CHECK(stream.isOk());
+    }
+
+    SECTION("test sending the pending messages on close")
+    {
+        LoopbackStream loopback;
+        WebSocketStream stream(&loopback);
+
+        loopback.block();
+        writeMessage(stream, "first");
+        REQUIRE(loopback.waitBlockedWriter());
+        writeMessage(stream, "second");
+        std::thread closer([&stream]() { stream.close(); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        loopback.unblock();
+        closer.join();
+
+        auto frames = loopback.getFrames();
+        REQUIRE(frames.size() == 3);
+        CHECK(parseFrame(frames[0]).payload == "first");
+        CHECK(parseFrame(frames[1]).payload == "second");
+        CHECK(parseFrame(frames[2]).opcode == CLOSING_OPCODE);
+    }
+
+    SECTION("test discarding the pending messages on interrupt")
+    {
+        LoopbackStream loopback;
+        WebSocketStream stream(&loopback);
+
+        loopback.block();
+        writeMessage(stream, "first");
+        REQUIRE(loopback.waitBlockedWriter());
+        writeMessage(stream, "second");
+        std::thread interrupter([&stream]() { stream.interrupt(); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        loopback.unblock();
+        interrupter.join();
+
+        auto frames = loopback.getFrames();
+        REQUIRE(frames.size() == 2);
+        CHECK(parseFrame(frames[0]).payload == "first");
+        CHECK(parseFrame(frames[1]).opcode == CLOSING_OPCODE);
+    }
+}
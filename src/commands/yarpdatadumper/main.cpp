@@ -50,7 +50,7 @@ protected:
 
 public:
     virtual ~DumpObj() = default;
-    virtual const std::string toFile(const std::string&, unsigned int) = 0;
+    virtual const std::string toFile(const std::string&, unsigned int, file::AsyncImageWriter*) = 0;
     virtual void attachFormat(const DumpFormat &format) { m_dump_format=format; }
 };
 
@@ -69,7 +69,7 @@ public:
     const DumpBottle &operator=(const DumpBottle &obj) { *p=*(obj.p); return *this; }
     ~DumpBottle() { delete p; }
 
-    const std::string toFile(const std::string &dirName, unsigned int cnt) override
+    const std::string toFile(const std::string &dirName, unsigned int cnt, file::AsyncImageWriter*) override
     {
         std::string ret=p->toString();
         return ret;
@@ -103,7 +103,7 @@ public:
     const DumpImage &operator=(const DumpImage &obj) { *p=*(obj.p); return *this; }
     ~DumpImage() { delete p; }
 
-    const std::string toFile(const std::string &dirName, unsigned int cnt) override
+    const std::string toFile(const std::string &dirName, unsigned int cnt, file::AsyncImageWriter* writer) override
     {
         file::image_fileformat fileformat = file::FORMAT_NULL;
         std::string ext;
@@ -161,7 +161,13 @@ public:
 
         std::ostringstream fName;
         fName << std::setw(8) << std::setfill('0') << cnt << ext;
-        file::write(*p,dirName+"/"+fName.str(), fileformat);
+        if (writer != nullptr) {
+            // the image is encoded in background, the queue is flushed
+            // when the thread is stopped
+            writer->write(*p, dirName + "/" + fName.str(), fileformat);
+        } else {
+            file::write(*p, dirName + "/" + fName.str(), fileformat);
+        }
 
         return (fName.str()+" ["+Vocab32::decode(code)+"]");
     }
@@ -353,6 +359,8 @@ private:
     bool            txTime;
     bool            closing;
 
+    file::AsyncImageWriter *writer;
+
 #ifdef ADD_VIDEO
     std::ofstream   ftimecodes;
     std::string     videoFile;
@@ -366,7 +374,7 @@ private:
 public:
     DumpThread(DumpFormat _type, DumpQueue &Q, const std::string &_dirName, const int szToWrite,
                const bool _saveData, const bool _videoOn, const std::string &_videoType,
-               const bool _rxTime, const bool _txTime) :
+               const bool _rxTime, const bool _txTime, file::AsyncImageWriter *_writer=nullptr) :
         PeriodicThread(0.05),
         buf(Q),
         type(_type),
@@ -380,7 +388,8 @@ public:
         videoType(std::move(_videoType)),
         rxTime(_rxTime),
         txTime(_txTime),
-        closing(false)
+        closing(false),
+        writer(_writer)
     {
         infoFile=dirName;
         infoFile+="/info.log";
@@ -539,7 +548,7 @@ public:
 
                 fdata << item.seqNumber << ' ' << item.timeStamp.getString() << ' ';
                 if (saveData) {
-                    fdata << item.obj->toFile(dirName,counter++) << '\n';
+                    fdata << item.obj->toFile(dirName,counter++,writer) << '\n';
                 } else {
                     std::ostringstream frame;
                     frame << "frame_" << std::setw(8) << std::setfill('0') << counter++;
@@ -571,6 +580,10 @@ public:
         closing=true;
         run();
 
+        if ((writer != nullptr) && !writer->flush()) {
+            yError() << "some images could not be written";
+        }
+
         finfo.close();
         fdata.close();
 
@@ -609,6 +622,7 @@ private:
     DumpPort<Bottle> *p_bottle{nullptr};
     DumpPort<Image>  *p_image{nullptr};
     DumpThread       *t{nullptr};
+    file::AsyncImageWriter *writer{nullptr};
     DumpReporter      reporter;
     Port              rpcPort;
     DumpFormat        dumptype{ DumpFormat::bottle};
@@ -741,13 +755,26 @@ public:
         }
         yarp::os::mkdir_p(dirName.c_str());
 
+        if ((dumptype != DumpFormat::bottle) && saveData)
+        {
+            // images are encoded in parallel, the order of the frames in
+            // data.log is not affected
+            writer=new file::AsyncImageWriter(rf.check("writerThreads",Value(0)).asInt32());
+            file::image_write_options options;
+            options.jpeg_quality=rf.check("jpegQuality",Value(options.jpeg_quality)).asInt32();
+            options.png_compression_level=rf.check("pngCompression",Value(options.png_compression_level)).asInt32();
+            options.png_fast_filter=rf.check("pngFastFilter");
+            writer->setOptions(options);
+        }
+
         q=new DumpQueue();
-        t=new DumpThread(dumptype,*q,dirName,100,saveData,videoOn,videoType,rxTime,txTime);
+        t=new DumpThread(dumptype,*q,dirName,100,saveData,videoOn,videoType,rxTime,txTime,writer);
 
         if (!t->start())
         {
             delete t;
             delete q;
+            delete writer;
 
             return false;
         }
@@ -820,6 +847,7 @@ public:
 
         delete t;
         delete q;
+        delete writer;
 
         return true;
     }
@@ -854,6 +882,10 @@ int main(int argc, char *argv[])
         yInfo() << "\t--downsample    n: downsample rate (default: 1 => downsample disabled)";
         yInfo() << "\t--rxTime         : dump the receiver time instead of the sender time";
         yInfo() << "\t--txTime         : dump the sender time straightaway";
+        yInfo() << "\t--writerThreads n: number of threads encoding the images (default: 0 => number of cores)";
+        yInfo() << "\t--jpegQuality   n: quality of the jpg images [1-100] (default: 100)";
+        yInfo() << "\t--pngCompression n: zlib compression level of the png images [0-9] (default: -1 => zlib default)";
+        yInfo() << "\t--pngFastFilter  : faster png encoding, producing larger files";
         yInfo();
 
         return 0;
@@ -294,6 +294,12 @@ public:
 
     bool is_member_nested(t_field* field);
 
+    bool is_struct_bulk(t_struct* tstruct);
+    std::string packed_wire_id(t_type* type);
+    std::string packed_wire_tag(t_type* type);
+    size_t packed_wire_size(t_type* type);
+    std::vector<std::vector<t_field*>> packed_runs(t_struct* tstruct);
+
     void print_const_value(std::ostringstream& out, const std::string& name, t_type* type, t_const_value* value);
     std::string render_const_value(std::ostringstream& out, const std::string& name, t_type* type, t_const_value* value);
 
@@ -575,6 +581,119 @@ bool t_yarp_generator::is_member_nested(t_field* member)
 
 
 
+bool t_yarp_generator::is_struct_bulk(t_struct* tstruct)
+{
+    auto it = tstruct->annotations_.find("yarp.bulk");
+    return (it != tstruct->annotations_.end() && it->second == "true");
+}
+
+// The suffix of the WirePacked method used to serialize the type, or an
+// empty string if the type does not have a fixed size on the wire.
+std::string t_yarp_generator::packed_wire_id(t_type* type)
+{
+    type = get_true_type(type);
+    if (!type->is_base_type()) {
+        return {};
+    }
+
+    auto it = type->annotations_.find("yarp.type");
+    std::string yarp_type = (it != type->annotations_.end() ? it->second : std::string{});
+    bool is_unsigned = (yarp_type.find("uint") != std::string::npos || yarp_type.find("unsigned") != std::string::npos);
+
+    switch (static_cast<t_base_type*>(type)->get_base()) {
+    case t_base_type::TYPE_BOOL:
+        return "Bool";
+    case t_base_type::TYPE_I8:
+        return is_unsigned ? "UI8" : "I8";
+    case t_base_type::TYPE_I16:
+        return is_unsigned ? "UI16" : "I16";
+    case t_base_type::TYPE_I32:
+        if (yarp_type == "yarp::conf::vocab32_t") {
+            return "Vocab32";
+        }
+        if (yarp_type == "std::size_t" || yarp_type == "size_t") {
+            return "SizeT";
+        }
+        return is_unsigned ? "UI32" : "I32";
+    case t_base_type::TYPE_I64:
+        return is_unsigned ? "UI64" : "I64";
+    case t_base_type::TYPE_DOUBLE:
+        return (yarp_type == "yarp::conf::float32_t") ? "Float32" : "Float64";
+    default:
+        return {};
+    }
+}
+
+// The tag written by WirePacked for a type with a fixed size
+std::string t_yarp_generator::packed_wire_tag(t_type* type)
+{
+    const std::string id = packed_wire_id(type);
+    if (id == "Bool" || id == "Vocab32") {
+        return "BOTTLE_TAG_VOCAB32";
+    }
+    if (id == "I8" || id == "UI8") {
+        return "BOTTLE_TAG_INT8";
+    }
+    if (id == "I16" || id == "UI16") {
+        return "BOTTLE_TAG_INT16";
+    }
+    if (id == "I64" || id == "UI64") {
+        return "BOTTLE_TAG_INT64";
+    }
+    if (id == "Float32") {
+        return "BOTTLE_TAG_FLOAT32";
+    }
+    if (id == "Float64") {
+        return "BOTTLE_TAG_FLOAT64";
+    }
+    return "BOTTLE_TAG_INT32";
+}
+
+// The size on the wire of a type with a fixed size, including its tag
+size_t t_yarp_generator::packed_wire_size(t_type* type)
+{
+    const std::string id = packed_wire_id(type);
+    if (id.empty()) {
+        return 0;
+    }
+    if (id == "I8" || id == "UI8") {
+        return 4 + 1;
+    }
+    if (id == "I16" || id == "UI16") {
+        return 4 + 2;
+    }
+    if (id == "I64" || id == "UI64" || id == "Float64") {
+        return 4 + 8;
+    }
+    return 4 + 4;
+}
+
+// Sequences of consecutive fields of a "yarp.bulk" struct that can be
+// serialized as a single block.
+std::vector<std::vector<t_field*>> t_yarp_generator::packed_runs(t_struct* tstruct)
+{
+    std::vector<std::vector<t_field*>> runs;
+    if (!is_struct_bulk(tstruct)) {
+        return runs;
+    }
+    std::vector<t_field*> run;
+    for (const auto& member : tstruct->get_members()) {
+        // Fields with a default value can be missing from the message
+        if (packed_wire_size(member->get_type()) != 0 && member->get_value() == nullptr) {
+            run.push_back(member);
+            continue;
+        }
+        if (run.size() > 1) {
+            runs.push_back(run);
+        }
+        run.clear();
+    }
+    if (run.size() > 1) {
+        runs.push_back(run);
+    }
+    return runs;
+}
+
 std::string t_yarp_generator::copyright_comment() const
 {
     std::string ret;
@@ -2306,6 +2425,10 @@ void t_yarp_generator::generate_struct(t_struct* tstruct)
 
     // Add includes to .cpp file
     f_cpp_ << "#include <" << get_include_prefix(program_) << name << ".h>\n";
+    if (!packed_runs(tstruct).empty()) {
+        f_cpp_ << '\n';
+        f_cpp_ << "#include <yarp/os/idl/WirePacked.h>\n";
+    }
     f_cpp_ << '\n';
 
     // Open namespace
@@ -2392,6 +2515,25 @@ void t_yarp_generator::generate_struct_fields(t_struct* tstruct, std::ostringstr
 
     f_h_ << '\n';
 
+    // For "yarp.bulk" structs containing only fields with a fixed size, the
+    // size of the message is known at compile time
+    if (is_struct_bulk(tstruct)) {
+        size_t wire_size = 8; // list header
+        for (const auto& member : tstruct->get_members()) {
+            size_t member_size = packed_wire_size(member->get_type());
+            if (member_size == 0) {
+                wire_size = 0;
+                break;
+            }
+            wire_size += member_size;
+        }
+        if (wire_size != 0) {
+            f_h_ << indent_h() << "// Size of the structure on a Connection [bytes]\n";
+            f_h_ << indent_h() << "static constexpr size_t wireSize = " << wire_size << ";\n";
+            f_h_ << '\n';
+        }
+    }
+
     assert(indent_count_h() == 1);
     assert(indent_count_cpp() == 0);
 }
@@ -2479,7 +2621,43 @@ void t_yarp_generator::generate_struct_read_wirereader(t_struct* tstruct, std::o
     f_cpp_ << indent_cpp() << "{\n";
     indent_up_cpp();
     {
-        for (const auto& member : members) {
+        const auto runs = packed_runs(tstruct);
+        auto run = runs.begin();
+        for (auto it = members.begin(); it != members.end(); ++it) {
+            const auto& member = *it;
+            if (run != runs.end() && run->front() == member) {
+                size_t run_size = 0;
+                for (const auto& field : *run) {
+                    run_size += packed_wire_size(field->get_type());
+                }
+                f_cpp_ << indent_cpp() << "// Read fields from " << run->front()->get_name() << " to " << run->back()->get_name() << " as a single block\n";
+                f_cpp_ << indent_cpp() << "{\n";
+                indent_up_cpp();
+                {
+                    f_cpp_ << indent_cpp() << "yarp::os::idl::WirePacked<" << run_size << "> packed;\n";
+                    f_cpp_ << indent_cpp() << "if (!packed.read(reader, {";
+                    for (auto field = run->begin(); field != run->end(); ++field) {
+                        f_cpp_ << (field != run->begin() ? ", " : "") << packed_wire_tag((*field)->get_type());
+                    }
+                    f_cpp_ << "})";
+                    for (const auto& field : *run) {
+                        f_cpp_ << "\n" << indent_cpp() << indent_initializer_str() << "|| !packed.read" << packed_wire_id(field->get_type()) << "(" << field->get_name() << ")";
+                    }
+                    f_cpp_ << ") {\n";
+                    indent_up_cpp();
+                    {
+                        f_cpp_ << indent_cpp() << "reader.fail();\n";
+                        f_cpp_ << indent_cpp() << "return false;\n";
+                    }
+                    indent_down_cpp();
+                    f_cpp_ << indent_cpp() << "}\n";
+                }
+                indent_down_cpp();
+                f_cpp_ << indent_cpp() << "}\n";
+                it += run->size() - 1;
+                ++run;
+                continue;
+            }
             f_cpp_ << indent_cpp() << "if (!" << (is_member_nested(member) ? "nested_" : "") << "read_" << member->get_name() << "(reader))" << inline_return_cpp("false");
         }
         f_cpp_ << indent_cpp() << "if (reader.isError())" << inline_return_cpp("false");
@@ -2539,7 +2717,31 @@ void t_yarp_generator::generate_struct_write_wirewriter(t_struct* tstruct, std::
     f_cpp_ << indent_cpp() << "{\n";
     indent_up_cpp();
     {
-        for (const auto& member : members) {
+        const auto runs = packed_runs(tstruct);
+        auto run = runs.begin();
+        for (auto it = members.begin(); it != members.end(); ++it) {
+            const auto& member = *it;
+            if (run != runs.end() && run->front() == member) {
+                size_t run_size = 0;
+                for (const auto& field : *run) {
+                    run_size += packed_wire_size(field->get_type());
+                }
+                f_cpp_ << indent_cpp() << "// Write fields from " << run->front()->get_name() << " to " << run->back()->get_name() << " as a single block\n";
+                f_cpp_ << indent_cpp() << "{\n";
+                indent_up_cpp();
+                {
+                    f_cpp_ << indent_cpp() << "yarp::os::idl::WirePacked<" << run_size << "> packed;\n";
+                    for (const auto& field : *run) {
+                        f_cpp_ << indent_cpp() << "packed.write" << packed_wire_id(field->get_type()) << "(" << field->get_name() << ");\n";
+                    }
+                    f_cpp_ << indent_cpp() << "if (!packed.write(writer))" << inline_return_cpp("false");
+                }
+                indent_down_cpp();
+                f_cpp_ << indent_cpp() << "}\n";
+                it += run->size() - 1;
+                ++run;
+                continue;
+            }
             f_cpp_ << indent_cpp() << "if (!" << (is_member_nested(member) ? "nested_" : "") << "write_" << member->get_name() << "(writer))" << inline_return_cpp("false");
         }
         f_cpp_ << indent_cpp() << "if (writer.isError())" << inline_return_cpp("false");
@@ -144,6 +144,9 @@ void AudioFromFileDevice::run()
         m_bpnt++;
     }
 
+    //wake up the consumer waiting in getSound()
+    m_inputBuffer->notify();
+
     if (m_audiobase_debug)
     {
         yCDebug(AUDIOFROMFILE) << "b_pnt" << m_bpnt << "/" << fsize_in_samples << " samples";
@@ -37,6 +37,7 @@ bool FakeDepthCameraDriver::open(Searchable& config)
     cfg.put("device", "fakeFrameGrabber");
     testgrabber.open(cfg);
     testgrabber.view(image);
+    testgrabber.view(notifier);
 
     return true;
 }
@@ -256,3 +257,15 @@ std::string FakeDepthCameraDriver::getLastErrorMsg(Stamp* timeStamp)
 {
     return "no error";
 }
+
+bool FakeDepthCameraDriver::addDataReadyListener(yarp::dev::IDataReadyListener* listener)
+{
+    if (!notifier) {return false;}
+    return notifier->addDataReadyListener(listener);
+}
+
+bool FakeDepthCameraDriver::removeDataReadyListener(yarp::dev::IDataReadyListener* listener)
+{
+    if (!notifier) {return false;}
+    return notifier->removeDataReadyListener(listener);
+}
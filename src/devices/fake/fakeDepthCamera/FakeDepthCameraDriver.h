@@ -13,6 +13,7 @@
 #include <yarp/os/Stamp.h>
 #include <yarp/dev/IRGBDSensor.h>
 #include <yarp/dev/IFrameGrabberImage.h>
+#include <yarp/dev/IDataReadyNotifier.h>
 #include <yarp/dev/PolyDriver.h>
 #include "FakeDepthCameraDriver_ParamsParser.h"
 
@@ -24,11 +25,15 @@
  * Parameters required by this device are shown in class: FakeDepthCameraDriver_ParamsParser
  *
  * The device internally opens a fakeFrameGrabber, so check also FakeFrameGrabber_ParamsParser
+ *
+ * The IDataReadyNotifier listeners are notified every time the internal
+ * fakeFrameGrabber generates a new image.
  */
 
 class FakeDepthCameraDriver :
         public yarp::dev::DeviceDriver,
         public yarp::dev::IRGBDSensor,
+        public yarp::dev::IDataReadyNotifier,
         public FakeDepthCameraDriver_ParamsParser
 {
 private:
@@ -79,9 +84,14 @@ public:
     RGBDSensor_status getSensorStatus() override;
     std::string getLastErrorMsg(Stamp* timeStamp = nullptr) override;
 
+    // IDataReadyNotifier
+    bool addDataReadyListener(yarp::dev::IDataReadyListener* listener) override;
+    bool removeDataReadyListener(yarp::dev::IDataReadyListener* listener) override;
+
 private:
     yarp::sig::ImageOf<yarp::sig::PixelRgb> imageof;
     yarp::dev::PolyDriver                   testgrabber;
     yarp::dev::IFrameGrabberImage*                     image;
+    yarp::dev::IDataReadyNotifier*                     notifier{nullptr};
 };
 #endif // YARP_FAKEDEPTHCAMERADRIVER_H
@@ -396,6 +396,7 @@ void FakeFrameGrabber::run()
                 curr_buff_mutex.lock();
                 curr_buff = i;
                 curr_buff_mutex.unlock();
+                notifyDataReady();
                 std::this_thread::yield();
             } else {
                 std::unique_lock<std::mutex> lk(mutex[i]);
@@ -408,6 +409,8 @@ void FakeFrameGrabber::run()
                 createTestImage(buffs[i], buff_ts[i]);
                 img_ready[i] = true;
                 img_ready_cv[i].notify_all();
+                lk.unlock();
+                notifyDataReady();
             }
         }
     }
@@ -21,6 +21,7 @@
 #include <yarp/os/Log.h>
 #include <yarp/os/Value.h>
 #include <yarp/dev/IRgbVisualParams.h>
+#include <yarp/dev/ImplementDataReadyNotifier.h>
 
 #include <cstdio>
 #include <random>
@@ -34,6 +35,8 @@
  *
  * Implements the IFrameGrabberImage and IFrameGrabberControls
  * interfaces.
+ * Notifies the IDataReadyNotifier listeners every time a new image is
+ * generated.
  *
  * Parameters required by this device are shown in class: FakeFrameGrabber_ParamsParser
  */
@@ -49,6 +52,7 @@ class FakeFrameGrabber :
         public yarp::dev::IPreciselyTimed,
         public yarp::dev::IAudioVisualStream,
         public yarp::dev::IRgbVisualParams,
+        public yarp::dev::ImplementDataReadyNotifier,
         public yarp::os::Thread,
         public yarp::os::PortReader,
         public FakeFrameGrabber_ParamsParser
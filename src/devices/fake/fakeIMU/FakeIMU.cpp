@@ -93,6 +93,8 @@ void FakeIMU::run()
     if (count >= 360) {
         count = 0;
     }
+
+    notifyDataReady();
 }
 
 yarp::dev::MAS_status FakeIMU::genericGetStatus(size_t sens_index) const
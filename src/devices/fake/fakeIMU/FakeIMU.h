@@ -7,6 +7,7 @@
 #include <yarp/dev/DeviceDriver.h>
 #include <yarp/os/PeriodicThread.h>
 #include <yarp/dev/MultipleAnalogSensorsInterfaces.h>
+#include <yarp/dev/ImplementDataReadyNotifier.h>
 #include <yarp/os/Stamp.h>
 #include <yarp/math/Math.h>
 #include "FakeIMU_ParamsParser.h"
@@ -15,6 +16,8 @@
 * @ingroup dev_impl_fake
 * \brief `fakeIMU` : fake device implementing the device interface typically implemented by an Inertial Measurement Unit
 *
+* The IDataReadyNotifier listeners are notified at the end of each period.
+*
 * Parameters required by this device are shown in class: FakeIMU_ParamsParser
 *
 */
@@ -25,6 +28,7 @@ class FakeIMU :
         public yarp::dev::IThreeAxisLinearAccelerometers,
         public yarp::dev::IThreeAxisMagnetometers,
         public yarp::dev::IOrientationSensors,
+        public yarp::dev::ImplementDataReadyNotifier,
         public FakeIMU_ParamsParser
 {
 public:
@@ -176,4 +176,6 @@ void FakeMicrophone::run()
             yCInfo(FAKEMICROPHONE) << "Not implemented/unreachable code";
         }
     }
+    //wake up the consumer waiting in getSound()
+    m_inputBuffer->notify();
 }
@@ -7,10 +7,14 @@
 #include <yarp/dev/PolyDriver.h>
 #include <yarp/dev/WrapperSingle.h>
 #include <yarp/dev/IAudioGrabberSound.h>
+#include <yarp/os/Time.h>
+#include <yarp/sig/Sound.h>
 
 #include <catch2/catch_amalgamated.hpp>
 #include <harness.h>
 
+#include <thread>
+
 using namespace yarp::dev;
 using namespace yarp::os;
 
@@ -47,5 +51,83 @@ TEST_CASE("dev::fakeMicrophone", "[yarp::dev]")
         }
     }
 
+    SECTION("Checking getSound() number of samples")
+    {
+        const size_t min_samples = 512;
+        const double timeout = 10.0;
+
+        for (bool low_latency : { false, true })
+        {
+            PolyDriver dd;
+            yarp::dev::IAudioGrabberSound* igrb = nullptr;
+
+            Property p_cfg;
+            p_cfg.put("device", "fakeMicrophone");
+            Property& audio_base = p_cfg.addGroup("AUDIO_BASE");
+            audio_base.put("low_latency", low_latency);
+            REQUIRE(dd.open(p_cfg));
+            REQUIRE(dd.view(igrb));
+            CHECK(igrb->startRecording());
+
+            yarp::sig::Sound snd;
+            INFO("low_latency=" << low_latency);
+            if (low_latency)
+            {
+                // returns as soon as the first blocks are written by the device,
+                // much before the one second needed to fill max_samples
+                const size_t max_samples = 44100;
+                CHECK(igrb->getSound(snd, min_samples, max_samples, timeout));
+                CHECK(snd.getSamples() >= min_samples);
+                CHECK(snd.getSamples() < max_samples);
+            }
+            else
+            {
+                // waits for max_samples, which arrive before the timeout
+                const size_t max_samples = 2048;
+                CHECK(igrb->getSound(snd, min_samples, max_samples, timeout));
+                CHECK(snd.getSamples() == max_samples);
+            }
+            CHECK(snd.getChannels() == 2);
+
+            // invalid request
+            CHECK_FALSE(igrb->getSound(snd, 1024, 512, timeout));
+
+            CHECK(igrb->stopRecording());
+            CHECK(dd.close());
+        }
+    }
+
+    SECTION("Checking getSound() is woken up by stopRecording()")
+    {
+        PolyDriver dd;
+        yarp::dev::IAudioGrabberSound* igrb = nullptr;
+
+        Property p_cfg;
+        p_cfg.put("device", "fakeMicrophone");
+        REQUIRE(dd.open(p_cfg));
+        REQUIRE(dd.view(igrb));
+        CHECK(igrb->startRecording());
+
+        // the minimum number of samples is never reached, since the recording is stopped
+        const size_t min_samples = 40000;
+        yarp::sig::Sound snd;
+        bool ret = false;
+        std::thread reader([&]() { ret = igrb->getSound(snd, min_samples, min_samples, 10.0); });
+
+        yarp::sig::AudioBufferSize size;
+        do {
+            yarp::os::Time::delay(0.01);
+            CHECK(igrb->getRecordingAudioBufferCurrentSize(size));
+        } while (size.getSamples() == 0);
+        CHECK(igrb->stopRecording());
+        reader.join();
+
+        // the samples recorded so far are returned
+        CHECK(ret);
+        CHECK(snd.getSamples() > 0);
+        CHECK(snd.getSamples() < min_samples);
+        CHECK(dd.close());
+    }
+
     Network::setLocalMode(false);
 }
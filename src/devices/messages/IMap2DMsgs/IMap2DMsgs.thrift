@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+const i16 protocol_version = 1
+
 struct yarp_dev_Nav2D_Map2DLocation{
 } (
   yarp.name = "yarp::dev::Nav2D::Map2DLocation"
@@ -37,6 +39,23 @@ struct return_get_map {
   2: yarp_dev_Nav2D_MapGrid2D themap;
 }
 
+struct map_tile {
+  1: i32 x;
+  2: i32 y;
+  3: i32 w;
+  4: i32 h;
+  5: binary occupancy;
+  6: binary flags;
+}
+
+struct return_get_map_delta {
+  1: yReturnValue retval;
+  2: i64 version;
+  3: bool full_map;
+  4: yarp_dev_Nav2D_MapGrid2D themap;
+  5: list<map_tile> tiles;
+}
+
 struct return_get_map_names {
   1: yReturnValue retval;
   2: list<string> map_names;
@@ -86,6 +105,7 @@ service IMap2DMsgs
     yReturnValue clear_all_maps_RPC ();
     yReturnValue store_map_RPC (1:yarp_dev_Nav2D_MapGrid2D themap);
     return_get_map get_map_RPC (1:string map_name);
+    return_get_map_delta get_map_delta_RPC (1:string map_name, 2:i64 known_version);
     return_get_map_names get_map_names_RPC();
     yReturnValue remove_map_RPC (1:string map_name);
     yReturnValue store_location_RPC (1:string location_name, 2:yarp_dev_Nav2D_Map2DLocation loc);
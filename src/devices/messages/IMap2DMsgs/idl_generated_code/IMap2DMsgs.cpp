@@ -95,10 +95,7 @@ bool IMap2DMsgs::checkProtocolVersion()
 yarp::os::ApplicationNetworkProtocolVersion IMap2DMsgs::getLocalProtocolVersion()
 {
     yarp::os::ApplicationNetworkProtocolVersion myproto;
-    //myproto.protocol_version using default value = 0
-    //to change this value add the following line to the .thrift file:
-    //const i16 protocol_version = <your_number_here>
-    myproto.protocol_version = 0;
+    myproto.protocol_version = protocol_version;
     myproto.yarp_major = YARP_VERSION_MAJOR;
     myproto.yarp_minor = YARP_VERSION_MINOR;
     myproto.yarp_patch = YARP_VERSION_PATCH;
@@ -289,6 +286,70 @@ public:
     static constexpr const char* s_help{""};
 };
 
+// get_map_delta_RPC helper class declaration
+class IMap2DMsgs_get_map_delta_RPC_helper :
+        public yarp::os::Portable
+{
+public:
+    IMap2DMsgs_get_map_delta_RPC_helper() = default;
+    IMap2DMsgs_get_map_delta_RPC_helper(const std::string& map_name, const std::int64_t known_version);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    class Command :
+            public yarp::os::idl::WirePortable
+    {
+    public:
+        Command() = default;
+        Command(const std::string& map_name, const std::int64_t known_version);
+
+        ~Command() override = default;
+
+        bool write(yarp::os::ConnectionWriter& connection) const override;
+        bool read(yarp::os::ConnectionReader& connection) override;
+
+        bool write(const yarp::os::idl::WireWriter& writer) const override;
+        bool writeTag(const yarp::os::idl::WireWriter& writer) const;
+        bool writeArgs(const yarp::os::idl::WireWriter& writer) const;
+
+        bool read(yarp::os::idl::WireReader& reader) override;
+        bool readTag(yarp::os::idl::WireReader& reader);
+        bool readArgs(yarp::os::idl::WireReader& reader);
+
+        std::string map_name{};
+        std::int64_t known_version{0};
+    };
+
+    class Reply :
+            public yarp::os::idl::WirePortable
+    {
+    public:
+        Reply() = default;
+        ~Reply() override = default;
+
+        bool write(yarp::os::ConnectionWriter& connection) const override;
+        bool read(yarp::os::ConnectionReader& connection) override;
+
+        bool write(const yarp::os::idl::WireWriter& writer) const override;
+        bool read(yarp::os::idl::WireReader& reader) override;
+
+        return_get_map_delta return_helper{};
+    };
+
+    using funcptr_t = return_get_map_delta (*)(const std::string&, const std::int64_t);
+    void call(IMap2DMsgs* ptr);
+
+    Command cmd;
+    Reply reply;
+
+    static constexpr const char* s_tag{"get_map_delta_RPC"};
+    static constexpr size_t s_tag_len{4};
+    static constexpr size_t s_cmd_len{6};
+    static constexpr size_t s_reply_len{5};
+    static constexpr const char* s_prototype{"return_get_map_delta IMap2DMsgs::get_map_delta_RPC(const std::string& map_name, const std::int64_t known_version)"};
+    static constexpr const char* s_help{""};
+};
+
 // get_map_names_RPC helper class declaration
 class IMap2DMsgs_get_map_names_RPC_helper :
         public yarp::os::Portable
@@ -2686,6 +2747,172 @@ void IMap2DMsgs_get_map_RPC_helper::call(IMap2DMsgs* ptr)
     reply.return_helper = ptr->get_map_RPC(cmd.map_name);
 }
 
+// get_map_delta_RPC helper class implementation
+IMap2DMsgs_get_map_delta_RPC_helper::IMap2DMsgs_get_map_delta_RPC_helper(const std::string& map_name, const std::int64_t known_version) :
+        cmd{map_name, known_version}
+{
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    return cmd.write(connection);
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::read(yarp::os::ConnectionReader& connection)
+{
+    return reply.read(connection);
+}
+
+IMap2DMsgs_get_map_delta_RPC_helper::Command::Command(const std::string& map_name, const std::int64_t known_version) :
+        map_name{map_name},
+        known_version{known_version}
+{
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::Command::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(s_cmd_len)) {
+        return false;
+    }
+    return write(writer);
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::Command::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListHeader()) {
+        reader.fail();
+        return false;
+    }
+    return read(reader);
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::Command::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writeTag(writer)) {
+        return false;
+    }
+    if (!writeArgs(writer)) {
+        return false;
+    }
+    return true;
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::Command::writeTag(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeTag(s_tag, 1, s_tag_len)) {
+        return false;
+    }
+    return true;
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::Command::writeArgs(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeString(map_name)) {
+        return false;
+    }
+    if (!writer.writeI64(known_version)) {
+        return false;
+    }
+    return true;
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::Command::read(yarp::os::idl::WireReader& reader)
+{
+    if (!readTag(reader)) {
+        return false;
+    }
+    if (!readArgs(reader)) {
+        return false;
+    }
+    return true;
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::Command::readTag(yarp::os::idl::WireReader& reader)
+{
+    std::string tag = reader.readTag(s_tag_len);
+    if (reader.isError()) {
+        return false;
+    }
+    if (tag != s_tag) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::Command::readArgs(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readString(map_name)) {
+        reader.fail();
+        return false;
+    }
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readI64(known_version)) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::Reply::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    return write(writer);
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::Reply::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    return read(reader);
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::Reply::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.isNull()) {
+        if (!writer.writeListHeader(s_reply_len)) {
+            return false;
+        }
+        if (!writer.write(return_helper)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool IMap2DMsgs_get_map_delta_RPC_helper::Reply::read(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.read(return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+void IMap2DMsgs_get_map_delta_RPC_helper::call(IMap2DMsgs* ptr)
+{
+    reply.return_helper = ptr->get_map_delta_RPC(cmd.map_name, cmd.known_version);
+}
+
 // get_map_names_RPC helper class implementation
 bool IMap2DMsgs_get_map_names_RPC_helper::write(yarp::os::ConnectionWriter& connection) const
 {
@@ -7371,6 +7598,16 @@ return_get_map IMap2DMsgs::get_map_RPC(const std::string& map_name)
     return ok ? helper.reply.return_helper : return_get_map{};
 }
 
+return_get_map_delta IMap2DMsgs::get_map_delta_RPC(const std::string& map_name, const std::int64_t known_version)
+{
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", IMap2DMsgs_get_map_delta_RPC_helper::s_prototype);
+    }
+    IMap2DMsgs_get_map_delta_RPC_helper helper{map_name, known_version};
+    bool ok = yarp().write(helper, helper);
+    return ok ? helper.reply.return_helper : return_get_map_delta{};
+}
+
 return_get_map_names IMap2DMsgs::get_map_names_RPC()
 {
     if (!yarp().canWrite()) {
@@ -7701,6 +7938,7 @@ std::vector<std::string> IMap2DMsgs::help(const std::string& functionName)
         helpString.emplace_back(IMap2DMsgs_clear_all_maps_RPC_helper::s_tag);
         helpString.emplace_back(IMap2DMsgs_store_map_RPC_helper::s_tag);
         helpString.emplace_back(IMap2DMsgs_get_map_RPC_helper::s_tag);
+        helpString.emplace_back(IMap2DMsgs_get_map_delta_RPC_helper::s_tag);
         helpString.emplace_back(IMap2DMsgs_get_map_names_RPC_helper::s_tag);
         helpString.emplace_back(IMap2DMsgs_remove_map_RPC_helper::s_tag);
         helpString.emplace_back(IMap2DMsgs_store_location_RPC_helper::s_tag);
@@ -7744,6 +7982,9 @@ std::vector<std::string> IMap2DMsgs::help(const std::string& functionName)
         if (functionName == IMap2DMsgs_get_map_RPC_helper::s_tag) {
             helpString.emplace_back(IMap2DMsgs_get_map_RPC_helper::s_prototype);
         }
+        if (functionName == IMap2DMsgs_get_map_delta_RPC_helper::s_tag) {
+            helpString.emplace_back(IMap2DMsgs_get_map_delta_RPC_helper::s_prototype);
+        }
         if (functionName == IMap2DMsgs_get_map_names_RPC_helper::s_tag) {
             helpString.emplace_back(IMap2DMsgs_get_map_names_RPC_helper::s_prototype);
         }
@@ -7937,6 +8178,21 @@ bool IMap2DMsgs::read(yarp::os::ConnectionReader& connection)
             reader.accept();
             return true;
         }
+        if (tag == IMap2DMsgs_get_map_delta_RPC_helper::s_tag) {
+            IMap2DMsgs_get_map_delta_RPC_helper helper;
+            if (!helper.cmd.readArgs(reader)) {
+                return false;
+            }
+
+            helper.call(this);
+
+            yarp::os::idl::WireWriter writer(reader);
+            if (!helper.reply.write(writer)) {
+                return false;
+            }
+            reader.accept();
+            return true;
+        }
         if (tag == IMap2DMsgs_get_map_names_RPC_helper::s_tag) {
             IMap2DMsgs_get_map_names_RPC_helper helper;
             if (!helper.cmd.readArgs(reader)) {
@@ -14,6 +14,7 @@
 #include <yarp/os/Wire.h>
 #include <yarp/os/idl/WireTypes.h>
 #include <yarp/os/ApplicationNetworkProtocolVersion.h>
+#include <IMap2DMsgs_common.h>
 #include <return_get_all_areas.h>
 #include <return_get_all_locations.h>
 #include <return_get_all_paths.h>
@@ -22,6 +23,7 @@
 #include <return_get_location.h>
 #include <return_get_locations_list.h>
 #include <return_get_map.h>
+#include <return_get_map_delta.h>
 #include <return_get_map_names.h>
 #include <return_get_path.h>
 #include <return_get_paths_list.h>
@@ -50,6 +52,8 @@ public:
 
     virtual return_get_map get_map_RPC(const std::string& map_name);
 
+    virtual return_get_map_delta get_map_delta_RPC(const std::string& map_name, const std::int64_t known_version);
+
     virtual return_get_map_names get_map_names_RPC();
 
     virtual yarp::dev::ReturnValue remove_map_RPC(const std::string& map_name);
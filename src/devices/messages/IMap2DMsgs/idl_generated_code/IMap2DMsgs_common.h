@@ -0,0 +1,17 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Autogenerated by Thrift Compiler (0.14.1-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#ifndef YARP_THRIFT_GENERATOR_COMMON_IMAP2DMSGS_H
+#define YARP_THRIFT_GENERATOR_COMMON_IMAP2DMSGS_H
+
+
+constexpr std::int16_t protocol_version = 1;
+
+#endif // YARP_THRIFT_GENERATOR_COMMON_IMAP2DMSGS_H
@@ -0,0 +1,394 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Autogenerated by Thrift Compiler (0.14.1-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#include <map_tile.h>
+
+// Constructor with field values
+map_tile::map_tile(const std::int32_t x,
+                   const std::int32_t y,
+                   const std::int32_t w,
+                   const std::int32_t h,
+                   const std::string& occupancy,
+                   const std::string& flags) :
+        WirePortable(),
+        x(x),
+        y(y),
+        w(w),
+        h(h),
+        occupancy(occupancy),
+        flags(flags)
+{
+}
+
+// Read structure on a Wire
+bool map_tile::read(yarp::os::idl::WireReader& reader)
+{
+    if (!read_x(reader)) {
+        return false;
+    }
+    if (!read_y(reader)) {
+        return false;
+    }
+    if (!read_w(reader)) {
+        return false;
+    }
+    if (!read_h(reader)) {
+        return false;
+    }
+    if (!read_occupancy(reader)) {
+        return false;
+    }
+    if (!read_flags(reader)) {
+        return false;
+    }
+    if (reader.isError()) {
+        return false;
+    }
+    return true;
+}
+
+// Read structure on a Connection
+bool map_tile::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListHeader(6)) {
+        return false;
+    }
+    if (!read(reader)) {
+        return false;
+    }
+    return true;
+}
+
+// Write structure on a Wire
+bool map_tile::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!write_x(writer)) {
+        return false;
+    }
+    if (!write_y(writer)) {
+        return false;
+    }
+    if (!write_w(writer)) {
+        return false;
+    }
+    if (!write_h(writer)) {
+        return false;
+    }
+    if (!write_occupancy(writer)) {
+        return false;
+    }
+    if (!write_flags(writer)) {
+        return false;
+    }
+    if (writer.isError()) {
+        return false;
+    }
+    return true;
+}
+
+// Write structure on a Connection
+bool map_tile::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(6)) {
+        return false;
+    }
+    if (!write(writer)) {
+        return false;
+    }
+    return true;
+}
+
+// Convert to a printable string
+std::string map_tile::toString() const
+{
+    yarp::os::Bottle b;
+    if (!yarp::os::Portable::copyPortable(*this, b)) {
+        return {};
+    }
+    return b.toString();
+}
+
+// read x field
+bool map_tile::read_x(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readI32(x)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write x field
+bool map_tile::write_x(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(x)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) x field
+bool map_tile::nested_read_x(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readI32(x)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) x field
+bool map_tile::nested_write_x(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(x)) {
+        return false;
+    }
+    return true;
+}
+
+// read y field
+bool map_tile::read_y(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readI32(y)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write y field
+bool map_tile::write_y(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(y)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) y field
+bool map_tile::nested_read_y(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readI32(y)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) y field
+bool map_tile::nested_write_y(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(y)) {
+        return false;
+    }
+    return true;
+}
+
+// read w field
+bool map_tile::read_w(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readI32(w)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write w field
+bool map_tile::write_w(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(w)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) w field
+bool map_tile::nested_read_w(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readI32(w)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) w field
+bool map_tile::nested_write_w(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(w)) {
+        return false;
+    }
+    return true;
+}
+
+// read h field
+bool map_tile::read_h(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readI32(h)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write h field
+bool map_tile::write_h(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(h)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) h field
+bool map_tile::nested_read_h(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readI32(h)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) h field
+bool map_tile::nested_write_h(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(h)) {
+        return false;
+    }
+    return true;
+}
+
+// read occupancy field
+bool map_tile::read_occupancy(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readBinary(occupancy)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write occupancy field
+bool map_tile::write_occupancy(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBinary(occupancy)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) occupancy field
+bool map_tile::nested_read_occupancy(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readBinary(occupancy)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) occupancy field
+bool map_tile::nested_write_occupancy(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBinary(occupancy)) {
+        return false;
+    }
+    return true;
+}
+
+// read flags field
+bool map_tile::read_flags(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readBinary(flags)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write flags field
+bool map_tile::write_flags(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBinary(flags)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) flags field
+bool map_tile::nested_read_flags(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readBinary(flags)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) flags field
+bool map_tile::nested_write_flags(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBinary(flags)) {
+        return false;
+    }
+    return true;
+}
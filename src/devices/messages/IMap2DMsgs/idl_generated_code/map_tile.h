@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Autogenerated by Thrift Compiler (0.14.1-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#ifndef YARP_THRIFT_GENERATOR_STRUCT_MAP_TILE_H
+#define YARP_THRIFT_GENERATOR_STRUCT_MAP_TILE_H
+
+#include <yarp/os/Wire.h>
+#include <yarp/os/idl/WireTypes.h>
+
+#include <IMap2DMsgs_common.h>
+
+class map_tile :
+        public yarp::os::idl::WirePortable
+{
+public:
+    // Fields
+    std::int32_t x{0};
+    std::int32_t y{0};
+    std::int32_t w{0};
+    std::int32_t h{0};
+    std::string occupancy{};
+    std::string flags{};
+
+    // Default constructor
+    map_tile() = default;
+
+    // Constructor with field values
+    map_tile(const std::int32_t x,
+             const std::int32_t y,
+             const std::int32_t w,
+             const std::int32_t h,
+             const std::string& occupancy,
+             const std::string& flags);
+
+    // Read structure on a Wire
+    bool read(yarp::os::idl::WireReader& reader) override;
+
+    // Read structure on a Connection
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    // Write structure on a Wire
+    bool write(const yarp::os::idl::WireWriter& writer) const override;
+
+    // Write structure on a Connection
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    // Convert to a printable string
+    std::string toString() const;
+
+    // If you want to serialize this class without nesting, use this helper
+    typedef yarp::os::idl::Unwrapped<map_tile> unwrapped;
+
+private:
+    // read/write x field
+    bool read_x(yarp::os::idl::WireReader& reader);
+    bool write_x(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_x(yarp::os::idl::WireReader& reader);
+    bool nested_write_x(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write y field
+    bool read_y(yarp::os::idl::WireReader& reader);
+    bool write_y(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_y(yarp::os::idl::WireReader& reader);
+    bool nested_write_y(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write w field
+    bool read_w(yarp::os::idl::WireReader& reader);
+    bool write_w(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_w(yarp::os::idl::WireReader& reader);
+    bool nested_write_w(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write h field
+    bool read_h(yarp::os::idl::WireReader& reader);
+    bool write_h(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_h(yarp::os::idl::WireReader& reader);
+    bool nested_write_h(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write occupancy field
+    bool read_occupancy(yarp::os::idl::WireReader& reader);
+    bool write_occupancy(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_occupancy(yarp::os::idl::WireReader& reader);
+    bool nested_write_occupancy(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write flags field
+    bool read_flags(yarp::os::idl::WireReader& reader);
+    bool write_flags(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_flags(yarp::os::idl::WireReader& reader);
+    bool nested_write_flags(const yarp::os::idl::WireWriter& writer) const;
+};
+
+#endif // YARP_THRIFT_GENERATOR_STRUCT_MAP_TILE_H
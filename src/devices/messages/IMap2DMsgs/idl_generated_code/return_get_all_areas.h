@@ -13,6 +13,8 @@
 
 #include <yarp/os/Wire.h>
 #include <yarp/os/idl/WireTypes.h>
+
+#include <IMap2DMsgs_common.h>
 #include <yarp/dev/Map2DArea.h>
 #include <yarp/dev/ReturnValue.h>
 
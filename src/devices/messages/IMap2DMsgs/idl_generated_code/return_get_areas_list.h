@@ -13,6 +13,8 @@
 
 #include <yarp/os/Wire.h>
 #include <yarp/os/idl/WireTypes.h>
+
+#include <IMap2DMsgs_common.h>
 #include <yarp/dev/ReturnValue.h>
 
 class return_get_areas_list :
@@ -0,0 +1,392 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Autogenerated by Thrift Compiler (0.14.1-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#include <return_get_map_delta.h>
+
+// Constructor with field values
+return_get_map_delta::return_get_map_delta(const yarp::dev::ReturnValue& retval,
+                                           const std::int64_t version,
+                                           const bool full_map,
+                                           const yarp::dev::Nav2D::MapGrid2D& themap,
+                                           const std::vector<map_tile>& tiles) :
+        WirePortable(),
+        retval(retval),
+        version(version),
+        full_map(full_map),
+        themap(themap),
+        tiles(tiles)
+{
+}
+
+// Read structure on a Wire
+bool return_get_map_delta::read(yarp::os::idl::WireReader& reader)
+{
+    if (!nested_read_retval(reader)) {
+        return false;
+    }
+    if (!read_version(reader)) {
+        return false;
+    }
+    if (!read_full_map(reader)) {
+        return false;
+    }
+    if (!nested_read_themap(reader)) {
+        return false;
+    }
+    if (!read_tiles(reader)) {
+        return false;
+    }
+    if (reader.isError()) {
+        return false;
+    }
+    return true;
+}
+
+// Read structure on a Connection
+bool return_get_map_delta::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListHeader(5)) {
+        return false;
+    }
+    if (!read(reader)) {
+        return false;
+    }
+    return true;
+}
+
+// Write structure on a Wire
+bool return_get_map_delta::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!nested_write_retval(writer)) {
+        return false;
+    }
+    if (!write_version(writer)) {
+        return false;
+    }
+    if (!write_full_map(writer)) {
+        return false;
+    }
+    if (!nested_write_themap(writer)) {
+        return false;
+    }
+    if (!write_tiles(writer)) {
+        return false;
+    }
+    if (writer.isError()) {
+        return false;
+    }
+    return true;
+}
+
+// Write structure on a Connection
+bool return_get_map_delta::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(5)) {
+        return false;
+    }
+    if (!write(writer)) {
+        return false;
+    }
+    return true;
+}
+
+// Convert to a printable string
+std::string return_get_map_delta::toString() const
+{
+    yarp::os::Bottle b;
+    if (!yarp::os::Portable::copyPortable(*this, b)) {
+        return {};
+    }
+    return b.toString();
+}
+
+// read retval field
+bool return_get_map_delta::read_retval(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.read(retval)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write retval field
+bool return_get_map_delta::write_retval(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.write(retval)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) retval field
+bool return_get_map_delta::nested_read_retval(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readNested(retval)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) retval field
+bool return_get_map_delta::nested_write_retval(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeNested(retval)) {
+        return false;
+    }
+    return true;
+}
+
+// read version field
+bool return_get_map_delta::read_version(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readI64(version)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write version field
+bool return_get_map_delta::write_version(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI64(version)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) version field
+bool return_get_map_delta::nested_read_version(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readI64(version)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) version field
+bool return_get_map_delta::nested_write_version(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI64(version)) {
+        return false;
+    }
+    return true;
+}
+
+// read full_map field
+bool return_get_map_delta::read_full_map(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readBool(full_map)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write full_map field
+bool return_get_map_delta::write_full_map(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBool(full_map)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) full_map field
+bool return_get_map_delta::nested_read_full_map(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readBool(full_map)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) full_map field
+bool return_get_map_delta::nested_write_full_map(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBool(full_map)) {
+        return false;
+    }
+    return true;
+}
+
+// read themap field
+bool return_get_map_delta::read_themap(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.read(themap)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write themap field
+bool return_get_map_delta::write_themap(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.write(themap)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) themap field
+bool return_get_map_delta::nested_read_themap(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readNested(themap)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+// write (nested) themap field
+bool return_get_map_delta::nested_write_themap(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeNested(themap)) {
+        return false;
+    }
+    return true;
+}
+
+// read tiles field
+bool return_get_map_delta::read_tiles(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    size_t _csize;
+    yarp::os::idl::WireState _etype;
+    reader.readListBegin(_etype, _csize);
+    // WireReader removes BOTTLE_TAG_LIST from the tag
+    constexpr int expected_tag = ((BOTTLE_TAG_LIST) & (~BOTTLE_TAG_LIST));
+    if constexpr (expected_tag != 0) {
+        if (_csize != 0 && _etype.code != expected_tag) {
+            return false;
+        }
+    }
+    tiles.resize(_csize);
+    for (size_t _i = 0; _i < _csize; ++_i) {
+        if (reader.noMore()) {
+            reader.fail();
+            return false;
+        }
+        if (!reader.readNested(tiles[_i])) {
+            reader.fail();
+            return false;
+        }
+    }
+    reader.readListEnd();
+    return true;
+}
+
+// write tiles field
+bool return_get_map_delta::write_tiles(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeListBegin(BOTTLE_TAG_LIST, tiles.size())) {
+        return false;
+    }
+    for (const auto& _item : tiles) {
+        if (!writer.writeNested(_item)) {
+            return false;
+        }
+    }
+    if (!writer.writeListEnd()) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) tiles field
+bool return_get_map_delta::nested_read_tiles(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    size_t _csize;
+    yarp::os::idl::WireState _etype;
+    reader.readListBegin(_etype, _csize);
+    // WireReader removes BOTTLE_TAG_LIST from the tag
+    constexpr int expected_tag = ((BOTTLE_TAG_LIST) & (~BOTTLE_TAG_LIST));
+    if constexpr (expected_tag != 0) {
+        if (_csize != 0 && _etype.code != expected_tag) {
+            return false;
+        }
+    }
+    tiles.resize(_csize);
+    for (size_t _i = 0; _i < _csize; ++_i) {
+        if (reader.noMore()) {
+            reader.fail();
+            return false;
+        }
+        if (!reader.readNested(tiles[_i])) {
+            reader.fail();
+            return false;
+        }
+    }
+    reader.readListEnd();
+    return true;
+}
+
+// write (nested) tiles field
+bool return_get_map_delta::nested_write_tiles(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeListBegin(BOTTLE_TAG_LIST, tiles.size())) {
+        return false;
+    }
+    for (const auto& _item : tiles) {
+        if (!writer.writeNested(_item)) {
+            return false;
+        }
+    }
+    if (!writer.writeListEnd()) {
+        return false;
+    }
+    return true;
+}
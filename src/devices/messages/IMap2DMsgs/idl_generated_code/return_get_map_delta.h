@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Autogenerated by Thrift Compiler (0.14.1-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#ifndef YARP_THRIFT_GENERATOR_STRUCT_RETURN_GET_MAP_DELTA_H
+#define YARP_THRIFT_GENERATOR_STRUCT_RETURN_GET_MAP_DELTA_H
+
+#include <yarp/os/Wire.h>
+#include <yarp/os/idl/WireTypes.h>
+
+#include <IMap2DMsgs_common.h>
+#include <map_tile.h>
+#include <yarp/dev/MapGrid2D.h>
+#include <yarp/dev/ReturnValue.h>
+
+class return_get_map_delta :
+        public yarp::os::idl::WirePortable
+{
+public:
+    // Fields
+    yarp::dev::ReturnValue retval{};
+    std::int64_t version{0};
+    bool full_map{false};
+    yarp::dev::Nav2D::MapGrid2D themap{};
+    std::vector<map_tile> tiles{};
+
+    // Default constructor
+    return_get_map_delta() = default;
+
+    // Constructor with field values
+    return_get_map_delta(const yarp::dev::ReturnValue& retval,
+                         const std::int64_t version,
+                         const bool full_map,
+                         const yarp::dev::Nav2D::MapGrid2D& themap,
+                         const std::vector<map_tile>& tiles);
+
+    // Read structure on a Wire
+    bool read(yarp::os::idl::WireReader& reader) override;
+
+    // Read structure on a Connection
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    // Write structure on a Wire
+    bool write(const yarp::os::idl::WireWriter& writer) const override;
+
+    // Write structure on a Connection
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    // Convert to a printable string
+    std::string toString() const;
+
+    // If you want to serialize this class without nesting, use this helper
+    typedef yarp::os::idl::Unwrapped<return_get_map_delta> unwrapped;
+
+private:
+    // read/write retval field
+    bool read_retval(yarp::os::idl::WireReader& reader);
+    bool write_retval(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_retval(yarp::os::idl::WireReader& reader);
+    bool nested_write_retval(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write version field
+    bool read_version(yarp::os::idl::WireReader& reader);
+    bool write_version(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_version(yarp::os::idl::WireReader& reader);
+    bool nested_write_version(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write full_map field
+    bool read_full_map(yarp::os::idl::WireReader& reader);
+    bool write_full_map(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_full_map(yarp::os::idl::WireReader& reader);
+    bool nested_write_full_map(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write themap field
+    bool read_themap(yarp::os::idl::WireReader& reader);
+    bool write_themap(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_themap(yarp::os::idl::WireReader& reader);
+    bool nested_write_themap(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write tiles field
+    bool read_tiles(yarp::os::idl::WireReader& reader);
+    bool write_tiles(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_tiles(yarp::os::idl::WireReader& reader);
+    bool nested_write_tiles(const yarp::os::idl::WireWriter& writer) const;
+};
+
+#endif // YARP_THRIFT_GENERATOR_STRUCT_RETURN_GET_MAP_DELTA_H
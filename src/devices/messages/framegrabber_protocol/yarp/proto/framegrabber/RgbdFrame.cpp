@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "RgbdFrame.h"
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/ConnectionReader.h>
+#include <yarp/os/ConnectionWriter.h>
+
+using yarp::proto::framegrabber::RgbdFrame;
+
+namespace {
+constexpr std::int32_t rgbdFrameElements = 4;
+}
+
+bool RgbdFrame::read(yarp::os::ConnectionReader& connection)
+{
+    connection.convertTextMode();
+
+    if (connection.expectInt32() != BOTTLE_TAG_LIST) {
+        return false;
+    }
+    if (connection.expectInt32() != rgbdFrameElements) {
+        return false;
+    }
+
+    return colorStamp.read(connection) &&
+           depthStamp.read(connection) &&
+           colorImage.read(connection) &&
+           depthImage.read(connection);
+}
+
+bool RgbdFrame::write(yarp::os::ConnectionWriter& connection) const
+{
+    connection.appendInt32(BOTTLE_TAG_LIST);
+    connection.appendInt32(rgbdFrameElements);
+
+    bool ok = colorStamp.write(connection) &&
+              depthStamp.write(connection) &&
+              colorImage.write(connection) &&
+              depthImage.write(connection);
+
+    if (ok) {
+        connection.convertTextMode();
+    }
+
+    return ok;
+}
@@ -0,0 +1,38 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_FRAMEGRABBER_PROTOCOL_RGBDFRAME_H
+#define YARP_FRAMEGRABBER_PROTOCOL_RGBDFRAME_H
+
+#include <yarp/os/Portable.h>
+#include <yarp/os/Stamp.h>
+#include <yarp/sig/Image.h>
+
+namespace yarp::proto::framegrabber {
+
+/**
+ * Color and depth images acquired together by a RGBD sensor, with their time
+ * stamps, sent in a single message.
+ *
+ * The pixels of the images are written as external blocks, therefore the
+ * images can wrap the buffers of the sender using setExternal(), and they
+ * must not be modified until the message has been sent.
+ */
+class RgbdFrame :
+        public yarp::os::Portable
+{
+public:
+    yarp::os::Stamp colorStamp;
+    yarp::os::Stamp depthStamp;
+    yarp::sig::FlexImage colorImage;
+    yarp::sig::ImageOf<yarp::sig::PixelFloat> depthImage;
+
+    bool read(yarp::os::ConnectionReader& connection) override;
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+};
+
+} // namespace yarp::proto::framegrabber
+
+#endif // YARP_FRAMEGRABBER_PROTOCOL_RGBDFRAME_H
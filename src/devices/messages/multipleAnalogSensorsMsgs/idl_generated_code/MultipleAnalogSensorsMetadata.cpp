@@ -165,6 +165,137 @@ public:
     };
 };
 
+// subscribe helper class declaration
+class MultipleAnalogSensorsMetadata_subscribe_helper :
+        public yarp::os::Portable
+{
+public:
+    MultipleAnalogSensorsMetadata_subscribe_helper() = default;
+    explicit MultipleAnalogSensorsMetadata_subscribe_helper(const SensorSubscription& subscription);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    class Command :
+            public yarp::os::idl::WirePortable
+    {
+    public:
+        Command() = default;
+        explicit Command(const SensorSubscription& subscription);
+
+        ~Command() override = default;
+
+        bool write(yarp::os::ConnectionWriter& connection) const override;
+        bool read(yarp::os::ConnectionReader& connection) override;
+
+        bool write(const yarp::os::idl::WireWriter& writer) const override;
+        bool writeTag(const yarp::os::idl::WireWriter& writer) const;
+        bool writeArgs(const yarp::os::idl::WireWriter& writer) const;
+
+        bool read(yarp::os::idl::WireReader& reader) override;
+        bool readTag(yarp::os::idl::WireReader& reader);
+        bool readArgs(yarp::os::idl::WireReader& reader);
+
+        SensorSubscription subscription{};
+    };
+
+    class Reply :
+            public yarp::os::idl::WirePortable
+    {
+    public:
+        Reply() = default;
+        ~Reply() override = default;
+
+        bool write(yarp::os::ConnectionWriter& connection) const override;
+        bool read(yarp::os::ConnectionReader& connection) override;
+
+        bool write(const yarp::os::idl::WireWriter& writer) const override;
+        bool read(yarp::os::idl::WireReader& reader) override;
+
+        std::string return_helper{};
+    };
+
+    using funcptr_t = std::string (*)(const SensorSubscription&);
+    void call(MultipleAnalogSensorsMetadata* ptr);
+
+    Command cmd;
+    Reply reply;
+
+    static constexpr const char* s_tag{"subscribe"};
+    static constexpr size_t s_tag_len{1};
+    static constexpr size_t s_cmd_len{5};
+    static constexpr size_t s_reply_len{1};
+    static constexpr const char* s_prototype{"std::string MultipleAnalogSensorsMetadata::subscribe(const SensorSubscription& subscription)"};
+    static constexpr const char* s_help{
+        "Request a dedicated stream of the measurements with the given options.\n"
+        "Returns the name of the port streaming the data, or an empty string on failure."
+    };
+};
+
+// unsubscribe helper class declaration
+class MultipleAnalogSensorsMetadata_unsubscribe_helper :
+        public yarp::os::Portable
+{
+public:
+    MultipleAnalogSensorsMetadata_unsubscribe_helper() = default;
+    explicit MultipleAnalogSensorsMetadata_unsubscribe_helper(const std::string& portName);
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    class Command :
+            public yarp::os::idl::WirePortable
+    {
+    public:
+        Command() = default;
+        explicit Command(const std::string& portName);
+
+        ~Command() override = default;
+
+        bool write(yarp::os::ConnectionWriter& connection) const override;
+        bool read(yarp::os::ConnectionReader& connection) override;
+
+        bool write(const yarp::os::idl::WireWriter& writer) const override;
+        bool writeTag(const yarp::os::idl::WireWriter& writer) const;
+        bool writeArgs(const yarp::os::idl::WireWriter& writer) const;
+
+        bool read(yarp::os::idl::WireReader& reader) override;
+        bool readTag(yarp::os::idl::WireReader& reader);
+        bool readArgs(yarp::os::idl::WireReader& reader);
+
+        std::string portName{};
+    };
+
+    class Reply :
+            public yarp::os::idl::WirePortable
+    {
+    public:
+        Reply() = default;
+        ~Reply() override = default;
+
+        bool write(yarp::os::ConnectionWriter& connection) const override;
+        bool read(yarp::os::ConnectionReader& connection) override;
+
+        bool write(const yarp::os::idl::WireWriter& writer) const override;
+        bool read(yarp::os::idl::WireReader& reader) override;
+
+        bool return_helper{false};
+    };
+
+    using funcptr_t = bool (*)(const std::string&);
+    void call(MultipleAnalogSensorsMetadata* ptr);
+
+    Command cmd;
+    Reply reply;
+
+    static constexpr const char* s_tag{"unsubscribe"};
+    static constexpr size_t s_tag_len{1};
+    static constexpr size_t s_cmd_len{2};
+    static constexpr size_t s_reply_len{1};
+    static constexpr const char* s_prototype{"bool MultipleAnalogSensorsMetadata::unsubscribe(const std::string& portName)"};
+    static constexpr const char* s_help{
+        "Release a stream obtained with subscribe."
+    };
+};
+
 // getMetadata helper class implementation
 bool MultipleAnalogSensorsMetadata_getMetadata_helper::write(yarp::os::ConnectionWriter& connection) const
 {
@@ -298,6 +429,314 @@ void MultipleAnalogSensorsMetadata_getMetadata_helper::call(MultipleAnalogSensor
     reply.return_helper = ptr->getMetadata();
 }
 
+// subscribe helper class implementation
+MultipleAnalogSensorsMetadata_subscribe_helper::MultipleAnalogSensorsMetadata_subscribe_helper(const SensorSubscription& subscription) :
+        cmd{subscription}
+{
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    return cmd.write(connection);
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::read(yarp::os::ConnectionReader& connection)
+{
+    return reply.read(connection);
+}
+
+MultipleAnalogSensorsMetadata_subscribe_helper::Command::Command(const SensorSubscription& subscription) :
+        subscription{subscription}
+{
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::Command::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(s_cmd_len)) {
+        return false;
+    }
+    return write(writer);
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::Command::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListHeader()) {
+        reader.fail();
+        return false;
+    }
+    return read(reader);
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::Command::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writeTag(writer)) {
+        return false;
+    }
+    if (!writeArgs(writer)) {
+        return false;
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::Command::writeTag(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeTag(s_tag, 1, s_tag_len)) {
+        return false;
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::Command::writeArgs(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.write(subscription)) {
+        return false;
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::Command::read(yarp::os::idl::WireReader& reader)
+{
+    if (!readTag(reader)) {
+        return false;
+    }
+    if (!readArgs(reader)) {
+        return false;
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::Command::readTag(yarp::os::idl::WireReader& reader)
+{
+    std::string tag = reader.readTag(s_tag_len);
+    if (reader.isError()) {
+        return false;
+    }
+    if (tag != s_tag) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::Command::readArgs(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.read(subscription)) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::Reply::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    return write(writer);
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::Reply::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    return read(reader);
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::Reply::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.isNull()) {
+        if (!writer.writeListHeader(s_reply_len)) {
+            return false;
+        }
+        if (!writer.writeString(return_helper)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_subscribe_helper::Reply::read(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readString(return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+void MultipleAnalogSensorsMetadata_subscribe_helper::call(MultipleAnalogSensorsMetadata* ptr)
+{
+    reply.return_helper = ptr->subscribe(cmd.subscription);
+}
+
+// unsubscribe helper class implementation
+MultipleAnalogSensorsMetadata_unsubscribe_helper::MultipleAnalogSensorsMetadata_unsubscribe_helper(const std::string& portName) :
+        cmd{portName}
+{
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::write(yarp::os::ConnectionWriter& connection) const
+{
+    return cmd.write(connection);
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::read(yarp::os::ConnectionReader& connection)
+{
+    return reply.read(connection);
+}
+
+MultipleAnalogSensorsMetadata_unsubscribe_helper::Command::Command(const std::string& portName) :
+        portName{portName}
+{
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::Command::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(s_cmd_len)) {
+        return false;
+    }
+    return write(writer);
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::Command::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListHeader()) {
+        reader.fail();
+        return false;
+    }
+    return read(reader);
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::Command::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writeTag(writer)) {
+        return false;
+    }
+    if (!writeArgs(writer)) {
+        return false;
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::Command::writeTag(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeTag(s_tag, 1, s_tag_len)) {
+        return false;
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::Command::writeArgs(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeString(portName)) {
+        return false;
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::Command::read(yarp::os::idl::WireReader& reader)
+{
+    if (!readTag(reader)) {
+        return false;
+    }
+    if (!readArgs(reader)) {
+        return false;
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::Command::readTag(yarp::os::idl::WireReader& reader)
+{
+    std::string tag = reader.readTag(s_tag_len);
+    if (reader.isError()) {
+        return false;
+    }
+    if (tag != s_tag) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::Command::readArgs(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readString(portName)) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::Reply::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    return write(writer);
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::Reply::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    return read(reader);
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::Reply::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.isNull()) {
+        if (!writer.writeListHeader(s_reply_len)) {
+            return false;
+        }
+        if (!writer.writeBool(return_helper)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool MultipleAnalogSensorsMetadata_unsubscribe_helper::Reply::read(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readListReturn()) {
+        return false;
+    }
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    if (!reader.readBool(return_helper)) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+void MultipleAnalogSensorsMetadata_unsubscribe_helper::call(MultipleAnalogSensorsMetadata* ptr)
+{
+    reply.return_helper = ptr->unsubscribe(cmd.portName);
+}
+
 // Constructor
 MultipleAnalogSensorsMetadata::MultipleAnalogSensorsMetadata()
 {
@@ -314,6 +753,26 @@ SensorRPCData MultipleAnalogSensorsMetadata::getMetadata()
     return ok ? helper.reply.return_helper : SensorRPCData{};
 }
 
+std::string MultipleAnalogSensorsMetadata::subscribe(const SensorSubscription& subscription)
+{
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", MultipleAnalogSensorsMetadata_subscribe_helper::s_prototype);
+    }
+    MultipleAnalogSensorsMetadata_subscribe_helper helper{subscription};
+    bool ok = yarp().write(helper, helper);
+    return ok ? helper.reply.return_helper : std::string{};
+}
+
+bool MultipleAnalogSensorsMetadata::unsubscribe(const std::string& portName)
+{
+    if (!yarp().canWrite()) {
+        yError("Missing server method '%s'?", MultipleAnalogSensorsMetadata_unsubscribe_helper::s_prototype);
+    }
+    MultipleAnalogSensorsMetadata_unsubscribe_helper helper{portName};
+    bool ok = yarp().write(helper, helper);
+    return ok ? helper.reply.return_helper : bool{};
+}
+
 // help method
 std::vector<std::string> MultipleAnalogSensorsMetadata::help(const std::string& functionName)
 {
@@ -322,12 +781,22 @@ std::vector<std::string> MultipleAnalogSensorsMetadata::help(const std::string&
     if (showAll) {
         helpString.emplace_back("*** Available commands:");
         helpString.emplace_back(MultipleAnalogSensorsMetadata_getMetadata_helper::s_tag);
+        helpString.emplace_back(MultipleAnalogSensorsMetadata_subscribe_helper::s_tag);
+        helpString.emplace_back(MultipleAnalogSensorsMetadata_unsubscribe_helper::s_tag);
         helpString.emplace_back("help");
     } else {
         if (functionName == MultipleAnalogSensorsMetadata_getMetadata_helper::s_tag) {
             helpString.emplace_back(MultipleAnalogSensorsMetadata_getMetadata_helper::s_prototype);
             helpString.emplace_back(MultipleAnalogSensorsMetadata_getMetadata_helper::s_help);
         }
+        if (functionName == MultipleAnalogSensorsMetadata_subscribe_helper::s_tag) {
+            helpString.emplace_back(MultipleAnalogSensorsMetadata_subscribe_helper::s_prototype);
+            helpString.emplace_back(MultipleAnalogSensorsMetadata_subscribe_helper::s_help);
+        }
+        if (functionName == MultipleAnalogSensorsMetadata_unsubscribe_helper::s_tag) {
+            helpString.emplace_back(MultipleAnalogSensorsMetadata_unsubscribe_helper::s_prototype);
+            helpString.emplace_back(MultipleAnalogSensorsMetadata_unsubscribe_helper::s_help);
+        }
         if (functionName == "help") {
             helpString.emplace_back("std::vector<std::string> help(const std::string& functionName = \"--all\")");
             helpString.emplace_back("Return list of available commands, or help message for a specific function");
@@ -395,6 +864,36 @@ bool MultipleAnalogSensorsMetadata::read(yarp::os::ConnectionReader& connection)
             reader.accept();
             return true;
         }
+        if (tag == MultipleAnalogSensorsMetadata_subscribe_helper::s_tag) {
+            MultipleAnalogSensorsMetadata_subscribe_helper helper;
+            if (!helper.cmd.readArgs(reader)) {
+                return false;
+            }
+
+            helper.call(this);
+
+            yarp::os::idl::WireWriter writer(reader);
+            if (!helper.reply.write(writer)) {
+                return false;
+            }
+            reader.accept();
+            return true;
+        }
+        if (tag == MultipleAnalogSensorsMetadata_unsubscribe_helper::s_tag) {
+            MultipleAnalogSensorsMetadata_unsubscribe_helper helper;
+            if (!helper.cmd.readArgs(reader)) {
+                return false;
+            }
+
+            helper.call(this);
+
+            yarp::os::idl::WireWriter writer(reader);
+            if (!helper.reply.write(writer)) {
+                return false;
+            }
+            reader.accept();
+            return true;
+        }
         if (tag == "help") {
             std::string functionName;
             if (!reader.readString(functionName)) {
@@ -15,6 +15,7 @@
 #include <yarp/os/idl/WireTypes.h>
 #include <yarp/os/ApplicationNetworkProtocolVersion.h>
 #include <SensorRPCData.h>
+#include <SensorSubscription.h>
 
 class MultipleAnalogSensorsMetadata :
         public yarp::os::Wire
@@ -34,6 +35,17 @@ public:
      */
     virtual SensorRPCData getMetadata();
 
+    /**
+     * Request a dedicated stream of the measurements with the given options.
+     * Returns the name of the port streaming the data, or an empty string on failure.
+     */
+    virtual std::string subscribe(const SensorSubscription& subscription);
+
+    /**
+     * Release a stream obtained with subscribe.
+     */
+    virtual bool unsubscribe(const std::string& portName);
+
     // help method
     virtual std::vector<std::string> help(const std::string& functionName = "--all");
 
@@ -0,0 +1,308 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Autogenerated by Thrift Compiler (0.14.1-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#include <SensorSubscription.h>
+
+// Constructor with field values
+SensorSubscription::SensorSubscription(const std::vector<std::string>& sensors,
+                                       const std::int32_t decimation,
+                                       const double resolution,
+                                       const bool delta) :
+        WirePortable(),
+        sensors(sensors),
+        decimation(decimation),
+        resolution(resolution),
+        delta(delta)
+{
+}
+
+// Read structure on a Wire
+bool SensorSubscription::read(yarp::os::idl::WireReader& reader)
+{
+    if (!read_sensors(reader)) {
+        return false;
+    }
+    if (!read_decimation(reader)) {
+        return false;
+    }
+    if (!read_resolution(reader)) {
+        return false;
+    }
+    if (!read_delta(reader)) {
+        return false;
+    }
+    if (reader.isError()) {
+        return false;
+    }
+    return true;
+}
+
+// Read structure on a Connection
+bool SensorSubscription::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::idl::WireReader reader(connection);
+    if (!reader.readListHeader(4)) {
+        return false;
+    }
+    if (!read(reader)) {
+        return false;
+    }
+    return true;
+}
+
+// Write structure on a Wire
+bool SensorSubscription::write(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!write_sensors(writer)) {
+        return false;
+    }
+    if (!write_decimation(writer)) {
+        return false;
+    }
+    if (!write_resolution(writer)) {
+        return false;
+    }
+    if (!write_delta(writer)) {
+        return false;
+    }
+    if (writer.isError()) {
+        return false;
+    }
+    return true;
+}
+
+// Write structure on a Connection
+bool SensorSubscription::write(yarp::os::ConnectionWriter& connection) const
+{
+    yarp::os::idl::WireWriter writer(connection);
+    if (!writer.writeListHeader(4)) {
+        return false;
+    }
+    if (!write(writer)) {
+        return false;
+    }
+    return true;
+}
+
+// Convert to a printable string
+std::string SensorSubscription::toString() const
+{
+    yarp::os::Bottle b;
+    if (!yarp::os::Portable::copyPortable(*this, b)) {
+        return {};
+    }
+    return b.toString();
+}
+
+// read sensors field
+bool SensorSubscription::read_sensors(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    size_t _csize;
+    yarp::os::idl::WireState _etype;
+    reader.readListBegin(_etype, _csize);
+    // WireReader removes BOTTLE_TAG_LIST from the tag
+    constexpr int expected_tag = ((BOTTLE_TAG_STRING) & (~BOTTLE_TAG_LIST));
+    if constexpr (expected_tag != 0) {
+        if (_csize != 0 && _etype.code != expected_tag) {
+            return false;
+        }
+    }
+    sensors.resize(_csize);
+    for (size_t _i = 0; _i < _csize; ++_i) {
+        if (reader.noMore()) {
+            reader.fail();
+            return false;
+        }
+        if (!reader.readString(sensors[_i])) {
+            reader.fail();
+            return false;
+        }
+    }
+    reader.readListEnd();
+    return true;
+}
+
+// write sensors field
+bool SensorSubscription::write_sensors(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeListBegin(BOTTLE_TAG_STRING, sensors.size())) {
+        return false;
+    }
+    for (const auto& _item : sensors) {
+        if (!writer.writeString(_item, true)) {
+            return false;
+        }
+    }
+    if (!writer.writeListEnd()) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) sensors field
+bool SensorSubscription::nested_read_sensors(yarp::os::idl::WireReader& reader)
+{
+    if (reader.noMore()) {
+        reader.fail();
+        return false;
+    }
+    size_t _csize;
+    yarp::os::idl::WireState _etype;
+    reader.readListBegin(_etype, _csize);
+    // WireReader removes BOTTLE_TAG_LIST from the tag
+    constexpr int expected_tag = ((BOTTLE_TAG_STRING) & (~BOTTLE_TAG_LIST));
+    if constexpr (expected_tag != 0) {
+        if (_csize != 0 && _etype.code != expected_tag) {
+            return false;
+        }
+    }
+    sensors.resize(_csize);
+    for (size_t _i = 0; _i < _csize; ++_i) {
+        if (reader.noMore()) {
+            reader.fail();
+            return false;
+        }
+        if (!reader.readString(sensors[_i])) {
+            reader.fail();
+            return false;
+        }
+    }
+    reader.readListEnd();
+    return true;
+}
+
+// write (nested) sensors field
+bool SensorSubscription::nested_write_sensors(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeListBegin(BOTTLE_TAG_STRING, sensors.size())) {
+        return false;
+    }
+    for (const auto& _item : sensors) {
+        if (!writer.writeString(_item, true)) {
+            return false;
+        }
+    }
+    if (!writer.writeListEnd()) {
+        return false;
+    }
+    return true;
+}
+
+// read decimation field
+bool SensorSubscription::read_decimation(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readI32(decimation)) {
+        decimation = 1;
+    }
+    return true;
+}
+
+// write decimation field
+bool SensorSubscription::write_decimation(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(decimation)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) decimation field
+bool SensorSubscription::nested_read_decimation(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readI32(decimation)) {
+        decimation = 1;
+    }
+    return true;
+}
+
+// write (nested) decimation field
+bool SensorSubscription::nested_write_decimation(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeI32(decimation)) {
+        return false;
+    }
+    return true;
+}
+
+// read resolution field
+bool SensorSubscription::read_resolution(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readFloat64(resolution)) {
+        resolution = 0.000000;
+    }
+    return true;
+}
+
+// write resolution field
+bool SensorSubscription::write_resolution(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeFloat64(resolution)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) resolution field
+bool SensorSubscription::nested_read_resolution(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readFloat64(resolution)) {
+        resolution = 0.000000;
+    }
+    return true;
+}
+
+// write (nested) resolution field
+bool SensorSubscription::nested_write_resolution(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeFloat64(resolution)) {
+        return false;
+    }
+    return true;
+}
+
+// read delta field
+bool SensorSubscription::read_delta(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readBool(delta)) {
+        delta = false;
+    }
+    return true;
+}
+
+// write delta field
+bool SensorSubscription::write_delta(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBool(delta)) {
+        return false;
+    }
+    return true;
+}
+
+// read (nested) delta field
+bool SensorSubscription::nested_read_delta(yarp::os::idl::WireReader& reader)
+{
+    if (!reader.readBool(delta)) {
+        delta = false;
+    }
+    return true;
+}
+
+// write (nested) delta field
+bool SensorSubscription::nested_write_delta(const yarp::os::idl::WireWriter& writer) const
+{
+    if (!writer.writeBool(delta)) {
+        return false;
+    }
+    return true;
+}
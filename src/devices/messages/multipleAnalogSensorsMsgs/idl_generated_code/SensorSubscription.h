@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Autogenerated by Thrift Compiler (0.14.1-yarped)
+//
+// This is an automatically generated file.
+// It could get re-generated if the ALLOW_IDL_GENERATION flag is on.
+
+#ifndef YARP_THRIFT_GENERATOR_STRUCT_SENSORSUBSCRIPTION_H
+#define YARP_THRIFT_GENERATOR_STRUCT_SENSORSUBSCRIPTION_H
+
+#include <yarp/os/Wire.h>
+#include <yarp/os/idl/WireTypes.h>
+
+/**
+ * Options of a stream requested by a MultipleAnalogSensorsClient.
+ * Clients requesting the same options share the same stream.
+ */
+class SensorSubscription :
+        public yarp::os::idl::WirePortable
+{
+public:
+    // Fields
+    /**
+     * Names of the sensors to stream, an empty list means all the sensors.
+     */
+    std::vector<std::string> sensors{};
+    /**
+     * A message is sent every `decimation` measurements read by the server.
+     */
+    std::int32_t decimation{1};
+    /**
+     * If positive, the measurements are rounded to a multiple of this value.
+     */
+    double resolution{0.000000};
+    /**
+     * If true, the measurements that did not change since the last message are sent as empty vectors.
+     */
+    bool delta{false};
+
+    // Default constructor
+    SensorSubscription() = default;
+
+    // Constructor with field values
+    SensorSubscription(const std::vector<std::string>& sensors,
+                       const std::int32_t decimation,
+                       const double resolution,
+                       const bool delta);
+
+    // Read structure on a Wire
+    bool read(yarp::os::idl::WireReader& reader) override;
+
+    // Read structure on a Connection
+    bool read(yarp::os::ConnectionReader& connection) override;
+
+    // Write structure on a Wire
+    bool write(const yarp::os::idl::WireWriter& writer) const override;
+
+    // Write structure on a Connection
+    bool write(yarp::os::ConnectionWriter& connection) const override;
+
+    // Convert to a printable string
+    std::string toString() const;
+
+    // If you want to serialize this class without nesting, use this helper
+    typedef yarp::os::idl::Unwrapped<SensorSubscription> unwrapped;
+
+private:
+    // read/write sensors field
+    bool read_sensors(yarp::os::idl::WireReader& reader);
+    bool write_sensors(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_sensors(yarp::os::idl::WireReader& reader);
+    bool nested_write_sensors(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write decimation field
+    bool read_decimation(yarp::os::idl::WireReader& reader);
+    bool write_decimation(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_decimation(yarp::os::idl::WireReader& reader);
+    bool nested_write_decimation(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write resolution field
+    bool read_resolution(yarp::os::idl::WireReader& reader);
+    bool write_resolution(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_resolution(yarp::os::idl::WireReader& reader);
+    bool nested_write_resolution(const yarp::os::idl::WireWriter& writer) const;
+
+    // read/write delta field
+    bool read_delta(yarp::os::idl::WireReader& reader);
+    bool write_delta(const yarp::os::idl::WireWriter& writer) const;
+    bool nested_read_delta(yarp::os::idl::WireReader& reader);
+    bool nested_write_delta(const yarp::os::idl::WireWriter& writer) const;
+};
+
+#endif // YARP_THRIFT_GENERATOR_STRUCT_SENSORSUBSCRIPTION_H
@@ -57,10 +57,37 @@ struct SensorRPCData
   12: list<SensorMetadata> ThreeAxisAngularAccelerometers;
 }
 
+/**
+ * Options of a stream requested by a MultipleAnalogSensorsClient.
+ * Clients requesting the same options share the same stream.
+ */
+struct SensorSubscription
+{
+  /** Names of the sensors to stream, an empty list means all the sensors. */
+  1: list<string> sensors;
+  /** A message is sent every `decimation` measurements read by the server. */
+  2: i32 decimation = 1;
+  /** If positive, the measurements are rounded to a multiple of this value. */
+  3: double resolution = 0.0;
+  /** If true, the measurements that did not change since the last message are sent as empty vectors. */
+  4: bool delta = false;
+}
+
 service MultipleAnalogSensorsMetadata
 {
   /**
    * Read the sensor metadata necessary to configure the MultipleAnalogSensorsClient device.
    */
   SensorRPCData getMetadata();
+
+  /**
+   * Request a dedicated stream of the measurements with the given options.
+   * Returns the name of the port streaming the data, or an empty string on failure.
+   */
+  string subscribe(1: SensorSubscription subscription);
+
+  /**
+   * Release a stream obtained with subscribe.
+   */
+  bool unsubscribe(1: string portName);
 }
@@ -42,27 +42,47 @@ bool RGBDSensorClient::open(yarp::os::Searchable& config)
 
     bool ret = false;
 
-    // Opening Streaming ports
-    ret = colorFrame_StreamingPort.open(m_localImagePort);
-    ret &= depthFrame_StreamingPort.open(m_localDepthPort);
-
-    if (!ret)
+    const bool useRgbdPort = !m_remoteRgbdPort.empty() && !m_localRgbdPort.empty();
+    if (useRgbdPort)
     {
-        yCError(RGBDSENSORCLIENT) << " cannot open local streaming ports: " << m_localImagePort << " or " << m_localDepthPort;
-        colorFrame_StreamingPort.close();
-        depthFrame_StreamingPort.close();
+        // Single streaming port, receiving both the images in the same message
+        if (!rgbdFrame_StreamingPort.open(m_localRgbdPort))
+        {
+            yCError(RGBDSENSORCLIENT) << " cannot open local streaming port: " << m_localRgbdPort;
+            return false;
+        }
+
+        if (!yarp::os::Network::connect(m_remoteRgbdPort, rgbdFrame_StreamingPort.getName(), m_ImageCarrier))
+        {
+            yCError(RGBDSENSORCLIENT) << rgbdFrame_StreamingPort.getName() << " cannot connect to remote port " << m_remoteRgbdPort << "with carrier " << m_ImageCarrier;
+            rgbdFrame_StreamingPort.close();
+            return false;
+        }
     }
-
-    if (!yarp::os::Network::connect(m_remoteImagePort, colorFrame_StreamingPort.getName(), m_ImageCarrier))
+    else
     {
-        yCError(RGBDSENSORCLIENT) << colorFrame_StreamingPort.getName() << " cannot connect to remote port " << m_remoteImagePort << "with carrier " << m_ImageCarrier;
-        return false;
-    }
-
-    if (!yarp::os::Network::connect(m_remoteDepthPort, depthFrame_StreamingPort.getName(), m_DepthCarrier))
-    {
-        yCError(RGBDSENSORCLIENT) << depthFrame_StreamingPort.getName() << " cannot connect to remote port " << m_remoteDepthPort << "with carrier " << m_DepthCarrier;
-        return false;
+        // Opening Streaming ports
+        ret = colorFrame_StreamingPort.open(m_localImagePort);
+        ret &= depthFrame_StreamingPort.open(m_localDepthPort);
+
+        if (!ret)
+        {
+            yCError(RGBDSENSORCLIENT) << " cannot open local streaming ports: " << m_localImagePort << " or " << m_localDepthPort;
+            colorFrame_StreamingPort.close();
+            depthFrame_StreamingPort.close();
+        }
+
+        if (!yarp::os::Network::connect(m_remoteImagePort, colorFrame_StreamingPort.getName(), m_ImageCarrier))
+        {
+            yCError(RGBDSENSORCLIENT) << colorFrame_StreamingPort.getName() << " cannot connect to remote port " << m_remoteImagePort << "with carrier " << m_ImageCarrier;
+            return false;
+        }
+
+        if (!yarp::os::Network::connect(m_remoteDepthPort, depthFrame_StreamingPort.getName(), m_DepthCarrier))
+        {
+            yCError(RGBDSENSORCLIENT) << depthFrame_StreamingPort.getName() << " cannot connect to remote port " << m_remoteDepthPort << "with carrier " << m_DepthCarrier;
+            return false;
+        }
     }
 
 
@@ -74,6 +94,7 @@ bool RGBDSensorClient::open(yarp::os::Searchable& config)
         yCError(RGBDSENSORCLIENT) << " cannot open local RPC port " << m_localRpcPort;
         colorFrame_StreamingPort.close();
         depthFrame_StreamingPort.close();
+        rgbdFrame_StreamingPort.close();
         rpcPort.close();
     }
 
@@ -82,6 +103,7 @@ bool RGBDSensorClient::open(yarp::os::Searchable& config)
         yCError(RGBDSENSORCLIENT) << " cannot connect to port " << m_remoteRpcPort;
         colorFrame_StreamingPort.close();
         depthFrame_StreamingPort.close();
+        rgbdFrame_StreamingPort.close();
         rpcPort.close();
         return false;
     }
@@ -110,7 +132,11 @@ bool RGBDSensorClient::open(yarp::os::Searchable& config)
                       Expected: " << RGBD_INTERFACE_PROTOCOL_VERSION_MINOR << " received: " << minor;
     }
 
-    streamingReader->attach(&colorFrame_StreamingPort, &depthFrame_StreamingPort);
+    if (useRgbdPort) {
+        streamingReader->attach(&rgbdFrame_StreamingPort);
+    } else {
+        streamingReader->attach(&colorFrame_StreamingPort, &depthFrame_StreamingPort);
+    }
 
     return true;
 }
@@ -119,6 +145,7 @@ bool RGBDSensorClient::close()
 {
     colorFrame_StreamingPort.close();
     depthFrame_StreamingPort.close();
+    rgbdFrame_StreamingPort.close();
     rpcPort.close();
     return true;
 }
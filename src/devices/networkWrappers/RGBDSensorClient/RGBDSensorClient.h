@@ -39,6 +39,10 @@ class RGBDSensor_StreamingMsgParser;
  *
  * This device is paired with its server called RGBDSensor_nws_yarp to receive the data streams and perform remote operations.
  *
+ * If the `remoteRgbdPort` and `localRgbdPort` parameters are set, the color and the depth images are instead received
+ * together, in a single message, from the `rgbdImage:o` port of the server. In this case getImages() always returns
+ * two images acquired together, and the image and depth ports are not opened.
+ *
  * Parameters required by this device are shown in class: RGBDSensorClient_ParamsParser
  *
  */
@@ -58,6 +62,7 @@ protected:
 
     RgbImageBufferedPort   colorFrame_StreamingPort;
     FloatImageBufferedPort depthFrame_StreamingPort;
+    RgbdFrameBufferedPort  rgbdFrame_StreamingPort;
 
     // Image data specs
     yarp::dev::IRGBDSensor *sensor_p{nullptr};
@@ -8,7 +8,7 @@
 // This is an automatically generated file. Please do not edit it.
 // It will be re-generated if the cmake flag ALLOW_DEVICE_PARAM_PARSER_GERNERATION is ON.
 
-// Generated on: Thu May 22 11:32:44 2025
+// Generated on: Mon Oct 19 03:59:41 2026
 
 
 #include "RGBDSensorClient_ParamsParser.h"
@@ -37,6 +37,8 @@ std::vector<std::string> RGBDSensorClient_ParamsParser::getListOfParams() const
     params.push_back("remoteRpcPort");
     params.push_back("ImageCarrier");
     params.push_back("DepthCarrier");
+    params.push_back("localRgbdPort");
+    params.push_back("remoteRgbdPort");
     return params;
 }
 
@@ -88,6 +90,16 @@ bool RGBDSensorClient_ParamsParser::getParamValue(const std::string& paramName,
         paramValue = m_DepthCarrier;
         return true;
     }
+    if (paramName =="localRgbdPort")
+    {
+        paramValue = m_localRgbdPort;
+        return true;
+    }
+    if (paramName =="remoteRgbdPort")
+    {
+        paramValue = m_remoteRgbdPort;
+        return true;
+    }
 
     yError() <<"parameter '" << paramName << "' was not found";
     return false;
@@ -253,6 +265,34 @@ bool      RGBDSensorClient_ParamsParser::parseParams(const yarp::os::Searchable
         prop_check.unput("DepthCarrier");
     }
 
+    //Parser of parameter localRgbdPort
+    {
+        if (config.check("localRgbdPort"))
+        {
+            m_localRgbdPort = config.find("localRgbdPort").asString();
+            yCInfo(RGBDSensorClientParamsCOMPONENT) << "Parameter 'localRgbdPort' using value:" << m_localRgbdPort;
+        }
+        else
+        {
+            yCInfo(RGBDSensorClientParamsCOMPONENT) << "Parameter 'localRgbdPort' using DEFAULT value:" << m_localRgbdPort;
+        }
+        prop_check.unput("localRgbdPort");
+    }
+
+    //Parser of parameter remoteRgbdPort
+    {
+        if (config.check("remoteRgbdPort"))
+        {
+            m_remoteRgbdPort = config.find("remoteRgbdPort").asString();
+            yCInfo(RGBDSensorClientParamsCOMPONENT) << "Parameter 'remoteRgbdPort' using value:" << m_remoteRgbdPort;
+        }
+        else
+        {
+            yCInfo(RGBDSensorClientParamsCOMPONENT) << "Parameter 'remoteRgbdPort' using DEFAULT value:" << m_remoteRgbdPort;
+        }
+        prop_check.unput("remoteRgbdPort");
+    }
+
     /*
     //This code check if the user set some parameter which are not check by the parser
     //If the parser is set in strict mode, this will generate an error
@@ -298,9 +338,11 @@ std::string      RGBDSensorClient_ParamsParser::getDocumentationOfDeviceParams()
     doc = doc + std::string("'remoteRpcPort': Full name of the remote rpc port to connect to\n");
     doc = doc + std::string("'ImageCarrier': Carrier for the image stream\n");
     doc = doc + std::string("'DepthCarrier': Carrier for the depth stream\n");
+    doc = doc + std::string("'localRgbdPort': Full name of the local port receiving the color and depth images in a single message\n");
+    doc = doc + std::string("'remoteRgbdPort': Full name of the remote port streaming the color and depth images in a single message, e.g. /RGBD_nws/rgbdImage:o\n");
     doc = doc + std::string("\n");
     doc = doc + std::string("Here are some examples of invocation command with yarpdev, with all params:\n");
-    doc = doc + " yarpdev --device RGBDSensorClient --period 0.03 --localImagePort /RGBD_nwc/Image:o --localDepthPort /RGBD_nwc/Depth:o --remoteImagePort /RGBD_nws/Image:o --remoteDepthPort /RGBD_nws/Depth:i --localRpcPort /RGBD_nwc/rpc:o --remoteRpcPort /RGBD_nws/rpc:i --ImageCarrier udp --DepthCarrier udp\n";
+    doc = doc + " yarpdev --device RGBDSensorClient --period 0.03 --localImagePort /RGBD_nwc/Image:o --localDepthPort /RGBD_nwc/Depth:o --remoteImagePort /RGBD_nws/Image:o --remoteDepthPort /RGBD_nws/Depth:i --localRpcPort /RGBD_nwc/rpc:o --remoteRpcPort /RGBD_nws/rpc:i --ImageCarrier udp --DepthCarrier udp --localRgbdPort <optional_value> --remoteRgbdPort <optional_value>\n";
     doc = doc + std::string("Using only mandatory params:\n");
     doc = doc + " yarpdev --device RGBDSensorClient --localImagePort /RGBD_nwc/Image:o --localDepthPort /RGBD_nwc/Depth:o --remoteImagePort /RGBD_nws/Image:o --remoteDepthPort /RGBD_nws/Depth:i --localRpcPort /RGBD_nwc/rpc:o --remoteRpcPort /RGBD_nws/rpc:i\n";
     doc = doc + std::string("=============================================\n\n");    return doc;
@@ -8,7 +8,7 @@
 // This is an automatically generated file. Please do not edit it.
 // It will be re-generated if the cmake flag ALLOW_DEVICE_PARAM_PARSER_GERNERATION is ON.
 
-// Generated on: Thu May 22 11:32:44 2025
+// Generated on: Mon Oct 19 03:59:41 2026
 
 
 #ifndef RGBDSENSORCLIENT_PARAMSPARSER_H
@@ -23,21 +23,23 @@
 * This class is the parameters parser for class RGBDSensorClient.
 *
 * These are the used parameters:
-* | Group name | Parameter name  | Type   | Units | Default Value     | Required | Description                                                        | Notes         |
-* |:----------:|:---------------:|:------:|:-----:|:-----------------:|:--------:|:------------------------------------------------------------------:|:-------------:|
-* | -          | period          | double | s     | 0.03              | 0        | refresh period (in s) of the broadcasted values through yarp ports | default 0.03s |
-* | -          | localImagePort  | string | -     | /RGBD_nwc/Image:o | 1        | Full name of the local image streaming port to open                | -             |
-* | -          | localDepthPort  | string | -     | /RGBD_nwc/Depth:o | 1        | Full name of the local depth streaming port to open                | -             |
-* | -          | remoteImagePort | string | -     | /RGBD_nws/Image:o | 1        | Full name of the remote image port to connect to                   | -             |
-* | -          | remoteDepthPort | string | -     | /RGBD_nws/Depth:i | 1        | Full name of the remote depth port to connect to                   | -             |
-* | -          | localRpcPort    | string | -     | /RGBD_nwc/rpc:o   | 1        | Full name of the local rpc port to open                            | -             |
-* | -          | remoteRpcPort   | string | -     | /RGBD_nws/rpc:i   | 1        | Full name of the remote rpc port to connect to                     | -             |
-* | -          | ImageCarrier    | string | -     | udp               | 0        | Carrier for the image stream                                       | -             |
-* | -          | DepthCarrier    | string | -     | udp               | 0        | Carrier for the depth stream                                       | -             |
+* | Group name | Parameter name  | Type   | Units | Default Value     | Required | Description                                                                                                       | Notes                                          |
+* |:----------:|:---------------:|:------:|:-----:|:-----------------:|:--------:|:-----------------------------------------------------------------------------------------------------------------:|:----------------------------------------------:|
+* | -          | period          | double | s     | 0.03              | 0        | refresh period (in s) of the broadcasted values through yarp ports                                                | default 0.03s                                  |
+* | -          | localImagePort  | string | -     | /RGBD_nwc/Image:o | 1        | Full name of the local image streaming port to open                                                               | -                                              |
+* | -          | localDepthPort  | string | -     | /RGBD_nwc/Depth:o | 1        | Full name of the local depth streaming port to open                                                               | -                                              |
+* | -          | remoteImagePort | string | -     | /RGBD_nws/Image:o | 1        | Full name of the remote image port to connect to                                                                  | -                                              |
+* | -          | remoteDepthPort | string | -     | /RGBD_nws/Depth:i | 1        | Full name of the remote depth port to connect to                                                                  | -                                              |
+* | -          | localRpcPort    | string | -     | /RGBD_nwc/rpc:o   | 1        | Full name of the local rpc port to open                                                                           | -                                              |
+* | -          | remoteRpcPort   | string | -     | /RGBD_nws/rpc:i   | 1        | Full name of the remote rpc port to connect to                                                                    | -                                              |
+* | -          | ImageCarrier    | string | -     | udp               | 0        | Carrier for the image stream                                                                                      | -                                              |
+* | -          | DepthCarrier    | string | -     | udp               | 0        | Carrier for the depth stream                                                                                      | -                                              |
+* | -          | localRgbdPort   | string | -     | -                 | 0        | Full name of the local port receiving the color and depth images in a single message                              | If set, the image and depth ports are not used |
+* | -          | remoteRgbdPort  | string | -     | -                 | 0        | Full name of the remote port streaming the color and depth images in a single message, e.g. /RGBD_nws/rgbdImage:o | If set, the image and depth ports are not used |
 *
 * The device can be launched by yarpdev using one of the following examples (with and without all optional parameters):
 * \code{.unparsed}
-* yarpdev --device RGBDSensorClient --period 0.03 --localImagePort /RGBD_nwc/Image:o --localDepthPort /RGBD_nwc/Depth:o --remoteImagePort /RGBD_nws/Image:o --remoteDepthPort /RGBD_nws/Depth:i --localRpcPort /RGBD_nwc/rpc:o --remoteRpcPort /RGBD_nws/rpc:i --ImageCarrier udp --DepthCarrier udp
+* yarpdev --device RGBDSensorClient --period 0.03 --localImagePort /RGBD_nwc/Image:o --localDepthPort /RGBD_nwc/Depth:o --remoteImagePort /RGBD_nws/Image:o --remoteDepthPort /RGBD_nws/Depth:i --localRpcPort /RGBD_nwc/rpc:o --remoteRpcPort /RGBD_nws/rpc:i --ImageCarrier udp --DepthCarrier udp --localRgbdPort <optional_value> --remoteRgbdPort <optional_value>
 * \endcode
 *
 * \code{.unparsed}
@@ -74,6 +76,8 @@ public:
     const std::string m_remoteRpcPort_defaultValue = {"/RGBD_nws/rpc:i"};
     const std::string m_ImageCarrier_defaultValue = {"udp"};
     const std::string m_DepthCarrier_defaultValue = {"udp"};
+    const std::string m_localRgbdPort_defaultValue = {""};
+    const std::string m_remoteRgbdPort_defaultValue = {""};
 
     double m_period = {0.03};
     std::string m_localImagePort = {"/RGBD_nwc/Image:o"};
@@ -84,6 +88,8 @@ public:
     std::string m_remoteRpcPort = {"/RGBD_nws/rpc:i"};
     std::string m_ImageCarrier = {"udp"};
     std::string m_DepthCarrier = {"udp"};
+    std::string m_localRgbdPort = {}; //This default value of this string is an empty string. It is highly recommended to provide a suggested value also for optional string parameters.
+    std::string m_remoteRgbdPort = {}; //This default value of this string is an empty string. It is highly recommended to provide a suggested value also for optional string parameters.
 
     bool          parseParams(const yarp::os::Searchable & config) override;
     std::string   getDeviceClassName() const override { return m_device_classname; }
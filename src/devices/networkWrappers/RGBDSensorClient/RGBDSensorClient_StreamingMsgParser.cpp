@@ -61,9 +61,75 @@ std::tuple<bool, yarp::sig::ImageOf<yarp::sig::PixelFloat>, yarp::os::Stamp> Flo
 }
 
 
+// callback reader for the color and depth images received together
+void RgbdFrameBufferedPort::onRead(yarp::proto::framegrabber::RgbdFrame& datum)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    local_arrival_time = yarp::os::Time::now();
+    std::swap(datum.colorImage, last_frame.colorImage);
+    std::swap(datum.depthImage, last_frame.depthImage);
+    last_frame.colorStamp = datum.colorStamp;
+    last_frame.depthStamp = datum.depthStamp;
+}
+
+bool RgbdFrameBufferedPort::getRgbImage(yarp::sig::FlexImage& image, yarp::os::Stamp* stamp) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (local_arrival_time <= 0.0) {
+        // No image received yet
+        return false;
+    }
+    image = last_frame.colorImage;
+    if (stamp) {
+        *stamp = last_frame.colorStamp;
+    }
+    return true;
+}
+
+bool RgbdFrameBufferedPort::getDepthImage(yarp::sig::ImageOf<yarp::sig::PixelFloat>& image, yarp::os::Stamp* stamp) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (local_arrival_time <= 0.0) {
+        // No image received yet
+        return false;
+    }
+    image = last_frame.depthImage;
+    if (stamp) {
+        *stamp = last_frame.depthStamp;
+    }
+    return true;
+}
+
+bool RgbdFrameBufferedPort::getImages(yarp::sig::FlexImage& rgbImage,
+                                      yarp::sig::ImageOf<yarp::sig::PixelFloat>& depthImage,
+                                      yarp::os::Stamp* rgbStamp,
+                                      yarp::os::Stamp* depthStamp) const
+{
+    // Both the images come from the same message, no need to pair them
+    std::lock_guard<std::mutex> lock(mutex);
+    if (local_arrival_time <= 0.0) {
+        // No image received yet
+        return false;
+    }
+    rgbImage = last_frame.colorImage;
+    depthImage = last_frame.depthImage;
+    if (rgbStamp) {
+        *rgbStamp = last_frame.colorStamp;
+    }
+    if (depthStamp) {
+        *depthStamp = last_frame.depthStamp;
+    }
+    return true;
+}
+
+
 // Streaming handler
 bool RGBDSensor_StreamingMsgParser::readRgb(yarp::sig::FlexImage &data, yarp::os::Stamp *timeStamp)
 {
+    if (port_rgbd) {
+        return port_rgbd->getRgbImage(data, timeStamp);
+    }
+
     auto result = port_rgb->getImage();
 
     if (!std::get<0>(result)) {
@@ -80,6 +146,10 @@ bool RGBDSensor_StreamingMsgParser::readRgb(yarp::sig::FlexImage &data, yarp::os
 
 bool RGBDSensor_StreamingMsgParser::readDepth(yarp::sig::ImageOf< yarp::sig::PixelFloat > &data, yarp::os::Stamp *timeStamp)
 {
+    if (port_rgbd) {
+        return port_rgbd->getDepthImage(data, timeStamp);
+    }
+
     auto result = port_depth->getImage();
 
     if (!std::get<0>(result)) {
@@ -96,6 +166,10 @@ bool RGBDSensor_StreamingMsgParser::readDepth(yarp::sig::ImageOf< yarp::sig::Pix
 
 bool RGBDSensor_StreamingMsgParser::read(yarp::sig::FlexImage &rgbImage, yarp::sig::ImageOf< yarp::sig::PixelFloat > &depthImage, yarp::os::Stamp *rgbStamp, yarp::os::Stamp *depthStamp)
 {
+    if (port_rgbd) {
+        return port_rgbd->getImages(rgbImage, depthImage, rgbStamp, depthStamp);
+    }
+
     auto resultRgb = port_rgb->getImage();
     auto resultDepth = port_depth->getImage();
 
@@ -126,3 +200,9 @@ void RGBDSensor_StreamingMsgParser::attach(RgbImageBufferedPort* _port_rgb,
     port_rgb->useCallback();
     port_depth->useCallback();
 }
+
+void RGBDSensor_StreamingMsgParser::attach(RgbdFrameBufferedPort* _port_rgbd)
+{
+    port_rgbd = _port_rgbd;
+    port_rgbd->useCallback();
+}
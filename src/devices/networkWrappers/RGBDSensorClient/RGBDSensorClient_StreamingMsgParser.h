@@ -11,6 +11,7 @@
 #include <yarp/os/Stamp.h>
 #include <yarp/sig/Image.h>
 #include <yarp/dev/DeviceDriver.h>
+#include <yarp/proto/framegrabber/RgbdFrame.h>
 
 #include <list>
 #include <tuple>
@@ -55,11 +56,35 @@ public:
 };
 
 
+class RgbdFrameBufferedPort :
+        public yarp::os::BufferedPort<yarp::proto::framegrabber::RgbdFrame>
+{
+private:
+    double local_arrival_time {0.0};
+    yarp::proto::framegrabber::RgbdFrame last_frame;
+    mutable std::mutex mutex;
+
+public:
+    RgbdFrameBufferedPort() = default;
+    ~RgbdFrameBufferedPort() override = default;
+
+    using yarp::os::TypedReaderCallback<yarp::proto::framegrabber::RgbdFrame>::onRead;
+    void onRead(yarp::proto::framegrabber::RgbdFrame& datum) override;
+    bool getRgbImage(yarp::sig::FlexImage& image, yarp::os::Stamp* stamp) const;
+    bool getDepthImage(yarp::sig::ImageOf<yarp::sig::PixelFloat>& image, yarp::os::Stamp* stamp) const;
+    bool getImages(yarp::sig::FlexImage& rgbImage,
+                   yarp::sig::ImageOf<yarp::sig::PixelFloat>& depthImage,
+                   yarp::os::Stamp* rgbStamp,
+                   yarp::os::Stamp* depthStamp) const;
+};
+
+
 class RGBDSensor_StreamingMsgParser
 {
 private:
     RgbImageBufferedPort   *port_rgb {nullptr};
     FloatImageBufferedPort *port_depth {nullptr};
+    RgbdFrameBufferedPort  *port_rgbd {nullptr};
 
 public:
     RGBDSensor_StreamingMsgParser() = default;
@@ -77,6 +102,12 @@ public:
 
     void attach(RgbImageBufferedPort* _port_rgb,
                 FloatImageBufferedPort* _port_depth);
+
+    /**
+     * Read both the images from a single port, receiving them in the same
+     * message, instead of the rgb and the depth ports.
+     */
+    void attach(RgbdFrameBufferedPort* _port_rgbd);
 };
 
 #endif  // YARP_DEV_RGBDSENSORCLIENT_RGBDSENSORCLIENT_STREAMINGMSGPARSER_H
@@ -170,6 +170,7 @@ RgbdSensor_nws_yarp::RgbdSensor_nws_yarp() :
     PeriodicThread(DEFAULT_THREAD_PERIOD),
     sensor_p(nullptr),
     fgCtrl(nullptr),
+    dataReadyNotifier(nullptr),
     sensorStatus(IRGBDSensor::RGBD_SENSOR_NOT_READY),
     verbose(4)
 {}
@@ -192,6 +193,7 @@ bool RgbdSensor_nws_yarp::open(yarp::os::Searchable &config)
     std::string rpcPort_Name = rootName + "/rpc:i";
     colorFrame_StreamingPort_Name = rootName + "/rgbImage:o";
     depthFrame_StreamingPort_Name = rootName + "/depthImage:o";
+    rgbdFrame_StreamingPort_Name  = rootName + "/rgbdImage:o";
 
     // Open ports
     bool bRet;
@@ -213,6 +215,11 @@ bool RgbdSensor_nws_yarp::open(yarp::os::Searchable &config)
         yCError(RGBDSENSORNWSYARP) << "Unable to open depth streaming Port" << depthFrame_StreamingPort_Name.c_str();
         bRet = false;
     }
+    if (!rgbdFrame_StreamingPort.open(rgbdFrame_StreamingPort_Name))
+    {
+        yCError(RGBDSENSORNWSYARP) << "Unable to open rgbd streaming Port" << rgbdFrame_StreamingPort_Name.c_str();
+        bRet = false;
+    }
 
     return true;
 }
@@ -226,10 +233,12 @@ bool RgbdSensor_nws_yarp::close()
     rpcPort.interrupt();
     colorFrame_StreamingPort.interrupt();
     depthFrame_StreamingPort.interrupt();
+    rgbdFrame_StreamingPort.interrupt();
 
     rpcPort.close();
     colorFrame_StreamingPort.close();
     depthFrame_StreamingPort.close();
+    rgbdFrame_StreamingPort.close();
 
     return true;
 }
@@ -240,6 +249,11 @@ bool RgbdSensor_nws_yarp::close()
 
 bool RgbdSensor_nws_yarp::detach()
 {
+    if (dataReadyNotifier != nullptr) {
+        dataReadyNotifier->removeDataReadyListener(this);
+        dataReadyNotifier = nullptr;
+    }
+
     if (yarp::os::PeriodicThread::isRunning()) {
         yarp::os::PeriodicThread::stop();
     }
@@ -281,6 +295,17 @@ bool RgbdSensor_nws_yarp::attach(PolyDriver* poly)
         yCWarning(RGBDSENSORNWSYARP) << "Attached device has no valid IFrameGrabberControls interface.";
     }
 
+    if (m_publish_on_new_data && poly->view(dataReadyNotifier))
+    {
+        if (dataReadyNotifier->addDataReadyListener(this))
+        {
+            yCInfo(RGBDSENSORNWSYARP) << "Publishing the images as soon as they are available";
+            return true;
+        }
+        yCWarning(RGBDSENSORNWSYARP) << "Unable to register to the device notifications, using the periodic thread";
+        dataReadyNotifier = nullptr;
+    }
+
     PeriodicThread::setPeriod(m_period);
     return PeriodicThread::start();
 }
@@ -419,6 +444,20 @@ bool RgbdSensor_nws_yarp::writeData()
         depthFrame_StreamingPort.setEnvelope(depthStamp);
         depthFrame_StreamingPort.write();
     }
+    if ((rgb_data_ok || depth_data_ok) && rgbdFrame_StreamingPort.getOutputCount() > 0)
+    {
+        // Both images in a single message, so that the client does not need to pair them
+        yarp::proto::framegrabber::RgbdFrame& yRgbdFrame = rgbdFrame_StreamingPort.prepare();
+        yRgbdFrame.colorStamp = colorStamp;
+        yRgbdFrame.depthStamp = depthStamp;
+        yRgbdFrame.colorImage.setPixelCode(colorImage.getPixelCode());
+        yRgbdFrame.colorImage.setQuantum(colorImage.getQuantum());
+        yRgbdFrame.colorImage.setExternal(colorImage.getRawImage(), colorImage.width(), colorImage.height());
+        yRgbdFrame.depthImage.setQuantum(depthImage.getQuantum());
+        yRgbdFrame.depthImage.setExternal(depthImage.getRawImage(), depthImage.width(), depthImage.height());
+        rgbdFrame_StreamingPort.setEnvelope(colorStamp);
+        rgbdFrame_StreamingPort.write();
+    }
 
     return true;
 }
@@ -466,3 +505,8 @@ void RgbdSensor_nws_yarp::run()
         }
     }
 }
+
+void RgbdSensor_nws_yarp::onDataReady()
+{
+    run();
+}
@@ -26,10 +26,12 @@
 #include <yarp/dev/WrapperSingle.h>
 #include <yarp/dev/PolyDriver.h>
 #include <yarp/dev/IRGBDSensor.h>
+#include <yarp/dev/IDataReadyNotifier.h>
 
 #include <yarp/proto/framegrabber/FrameGrabberControls_Responder.h>
 #include <yarp/proto/framegrabber/RgbVisualParams_Responder.h>
 #include <yarp/proto/framegrabber/DepthVisualParams_Responder.h>
+#include <yarp/proto/framegrabber/RgbdFrame.h>
 
 #include "RgbdSensor_nws_yarp_ParamsParser.h"
 
@@ -76,6 +78,12 @@ public:
  *
  * This device is paired with its client called RgbdSensor_nws_yarp to receive the data streams and perform remote operations.
  *
+ * A third port, `<name>/rgbdImage:o`, streams the color and the depth images acquired together in a single message,
+ * with their time stamps (see yarp::proto::framegrabber::RgbdFrame). The images are sent without copying them.
+ *
+ * If the attached device implements IDataReadyNotifier, the images are published as soon as the device notifies them,
+ * and the `period` parameter is ignored. This can be disabled with the `publish_on_new_data` parameter.
+ *
  * Parameters required by this device are shown in class: RgbdSensor_nws_yarp_ParamsParser
  */
 
@@ -83,12 +91,14 @@ class RgbdSensor_nws_yarp :
         public yarp::dev::DeviceDriver,
         public yarp::dev::WrapperSingle,
         public yarp::os::PeriodicThread,
+        public yarp::dev::IDataReadyListener,
         public RgbdSensor_nws_yarp_ParamsParser
 {
 private:
     typedef yarp::sig::ImageOf<yarp::sig::PixelFloat>    DepthImage;
     typedef yarp::os::BufferedPort<DepthImage>           DepthPortType;
     typedef yarp::os::BufferedPort<yarp::sig::FlexImage> ImagePortType;
+    typedef yarp::os::BufferedPort<yarp::proto::framegrabber::RgbdFrame> RgbdPortType;
     typedef unsigned int                                 UInt;
 
     enum SensorType{COLOR_SENSOR, DEPTH_SENSOR};
@@ -107,8 +117,10 @@ private:
 
     std::string colorFrame_StreamingPort_Name;
     std::string depthFrame_StreamingPort_Name;
+    std::string rgbdFrame_StreamingPort_Name;
     ImagePortType         colorFrame_StreamingPort;
     DepthPortType         depthFrame_StreamingPort;
+    RgbdPortType          rgbdFrame_StreamingPort;
 
     // One RPC port should be enough for the wrapper in all cases
     yarp::os::Port        rpcPort;
@@ -129,6 +141,7 @@ private:
     // int hDim, vDim;
     yarp::dev::IRGBDSensor*        sensor_p;
     yarp::dev::IFrameGrabberControls* fgCtrl;
+    yarp::dev::IDataReadyNotifier* dataReadyNotifier;
     yarp::dev::IRGBDSensor::RGBDSensor_status sensorStatus;
     int                            verbose;
 
@@ -162,6 +175,9 @@ public:
     bool        threadInit() override;
     void        threadRelease() override;
     void        run() override;
+
+    // IDataReadyListener
+    void        onDataReady() override;
 };
 
 #endif   // YARP_DEV_RGBDSENSOR_NWS_YARP_H
@@ -8,7 +8,7 @@
 // This is an automatically generated file. Please do not edit it.
 // It will be re-generated if the cmake flag ALLOW_DEVICE_PARAM_PARSER_GERNERATION is ON.
 
-// Generated on: Thu May 22 11:32:44 2025
+// Generated on: Mon Oct 19 03:56:54 2026
 
 
 #include "RgbdSensor_nws_yarp_ParamsParser.h"
@@ -30,6 +30,7 @@ std::vector<std::string> RgbdSensor_nws_yarp_ParamsParser::getListOfParams() con
     std::vector<std::string> params;
     params.push_back("period");
     params.push_back("name");
+    params.push_back("publish_on_new_data");
     return params;
 }
 
@@ -46,6 +47,12 @@ bool RgbdSensor_nws_yarp_ParamsParser::getParamValue(const std::string& paramNam
         paramValue = m_name;
         return true;
     }
+    if (paramName =="publish_on_new_data")
+    {
+        if (m_publish_on_new_data==true) paramValue = "true";
+        else paramValue = "false";
+        return true;
+    }
 
     yError() <<"parameter '" << paramName << "' was not found";
     return false;
@@ -103,6 +110,20 @@ bool      RgbdSensor_nws_yarp_ParamsParser::parseParams(const yarp::os::Searchab
         prop_check.unput("name");
     }
 
+    //Parser of parameter publish_on_new_data
+    {
+        if (config.check("publish_on_new_data"))
+        {
+            m_publish_on_new_data = config.find("publish_on_new_data").asBool();
+            yCInfo(RgbdSensor_nws_yarpParamsCOMPONENT) << "Parameter 'publish_on_new_data' using value:" << m_publish_on_new_data;
+        }
+        else
+        {
+            yCInfo(RgbdSensor_nws_yarpParamsCOMPONENT) << "Parameter 'publish_on_new_data' using DEFAULT value:" << m_publish_on_new_data;
+        }
+        prop_check.unput("publish_on_new_data");
+    }
+
     /*
     //This code check if the user set some parameter which are not check by the parser
     //If the parser is set in strict mode, this will generate an error
@@ -141,9 +162,10 @@ std::string      RgbdSensor_nws_yarp_ParamsParser::getDocumentationOfDeviceParam
     doc = doc + std::string("This is the list of the parameters accepted by the device:\n");
     doc = doc + std::string("'period': refresh period of the broadcasted values in s\n");
     doc = doc + std::string("'name': Prefix name of the ports opened by the RGBD wrapper, e.g. /robotName/RGBD\n");
+    doc = doc + std::string("'publish_on_new_data': Publish each sample as soon as the attached device notifies it (IDataReadyNotifier), instead of periodically\n");
     doc = doc + std::string("\n");
     doc = doc + std::string("Here are some examples of invocation command with yarpdev, with all params:\n");
-    doc = doc + " yarpdev --device rgbdSensor_nws_yarp --period 0.02 --name <mandatory_value>\n";
+    doc = doc + " yarpdev --device rgbdSensor_nws_yarp --period 0.02 --name <mandatory_value> --publish_on_new_data true\n";
     doc = doc + std::string("Using only mandatory params:\n");
     doc = doc + " yarpdev --device rgbdSensor_nws_yarp --name <mandatory_value>\n";
     doc = doc + std::string("=============================================\n\n");    return doc;
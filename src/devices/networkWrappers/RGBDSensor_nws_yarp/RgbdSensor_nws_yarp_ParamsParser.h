@@ -8,7 +8,7 @@
 // This is an automatically generated file. Please do not edit it.
 // It will be re-generated if the cmake flag ALLOW_DEVICE_PARAM_PARSER_GERNERATION is ON.
 
-// Generated on: Thu May 22 11:32:44 2025
+// Generated on: Mon Oct 19 03:56:54 2026
 
 
 #ifndef RGBDSENSOR_NWS_YARP_PARAMSPARSER_H
@@ -23,14 +23,15 @@
 * This class is the parameters parser for class RgbdSensor_nws_yarp.
 *
 * These are the used parameters:
-* | Group name | Parameter name | Type   | Units | Default Value | Required | Description                                                               | Notes                                                   |
-* |:----------:|:--------------:|:------:|:-----:|:-------------:|:--------:|:-------------------------------------------------------------------------:|:-------------------------------------------------------:|
-* | -          | period         | double | s     | 0.02          | 0        | refresh period of the broadcasted values in s                             | default 0.02s                                           |
-* | -          | name           | string | -     | -             | 1        | Prefix name of the ports opened by the RGBD wrapper, e.g. /robotName/RGBD | Required suffix like '/rpc' will be added by the device |
+* | Group name | Parameter name      | Type   | Units | Default Value | Required | Description                                                                                                  | Notes                                                   |
+* |:----------:|:-------------------:|:------:|:-----:|:-------------:|:--------:|:------------------------------------------------------------------------------------------------------------:|:-------------------------------------------------------:|
+* | -          | period              | double | s     | 0.02          | 0        | refresh period of the broadcasted values in s                                                                | default 0.02s                                           |
+* | -          | name                | string | -     | -             | 1        | Prefix name of the ports opened by the RGBD wrapper, e.g. /robotName/RGBD                                    | Required suffix like '/rpc' will be added by the device |
+* | -          | publish_on_new_data | bool   | -     | true          | 0        | Publish each sample as soon as the attached device notifies it (IDataReadyNotifier), instead of periodically | -                                                       |
 *
 * The device can be launched by yarpdev using one of the following examples (with and without all optional parameters):
 * \code{.unparsed}
-* yarpdev --device rgbdSensor_nws_yarp --period 0.02 --name <mandatory_value>
+* yarpdev --device rgbdSensor_nws_yarp --period 0.02 --name <mandatory_value> --publish_on_new_data true
 * \endcode
 *
 * \code{.unparsed}
@@ -60,9 +61,11 @@ public:
 
     const std::string m_period_defaultValue = {"0.02"};
     const std::string m_name_defaultValue = {""};
+    const std::string m_publish_on_new_data_defaultValue = {"true"};
 
     double m_period = {0.02};
     std::string m_name = {}; //This default value is autogenerated. It is highly recommended to provide a suggested value also for mandatory parameters.
+    bool m_publish_on_new_data = {true};
 
     bool          parseParams(const yarp::os::Searchable & config) override;
     std::string   getDeviceClassName() const override { return m_device_classname; }
@@ -82,6 +82,12 @@ bool FrameGrabber_nws_yarp::open(yarp::os::Searchable& config)
     }
     pImg.setReader(*this);
 
+    if (m_cap == COLOR) {
+        img = new yarp::sig::ImageOf<yarp::sig::PixelRgb>;
+    } else {
+        img_Raw = new yarp::sig::ImageOf<yarp::sig::PixelMono>;
+    }
+
     yCInfo(FRAMEGRABBER_NWS_YARP) << "Running, waiting for attach...";
 
     return true;
@@ -155,12 +161,26 @@ bool FrameGrabber_nws_yarp::attach(yarp::dev::PolyDriver* poly)
         }
     }
 
+    if (m_publish_on_new_data && poly->view(iDataReadyNotifier)) {
+        if (iDataReadyNotifier->addDataReadyListener(this)) {
+            yCInfo(FRAMEGRABBER_NWS_YARP) << "Publishing the images as soon as they are available";
+            return true;
+        }
+        yCWarning(FRAMEGRABBER_NWS_YARP) << "Unable to register to the device notifications, using the periodic thread";
+        iDataReadyNotifier = nullptr;
+    }
+
     return PeriodicThread::start();
 }
 
 
 bool FrameGrabber_nws_yarp::detach()
 {
+    if (iDataReadyNotifier != nullptr) {
+        iDataReadyNotifier->removeDataReadyListener(this);
+        iDataReadyNotifier = nullptr;
+    }
+
     if (yarp::os::PeriodicThread::isRunning()) {
         yarp::os::PeriodicThread::stop();
     }
@@ -175,17 +195,6 @@ bool FrameGrabber_nws_yarp::detach()
     return true;
 }
 
-bool FrameGrabber_nws_yarp::threadInit()
-{
-    if (m_cap == COLOR) {
-        img = new yarp::sig::ImageOf<yarp::sig::PixelRgb>;
-    } else {
-        img_Raw = new yarp::sig::ImageOf<yarp::sig::PixelMono>;
-    }
-
-    return true;
-}
-
 // Publish the images on the buffered port
 void FrameGrabber_nws_yarp::run()
 {
@@ -228,6 +237,12 @@ void FrameGrabber_nws_yarp::run()
     pImg.write();
 }
 
+// Publish the images as soon as the device notifies them
+void FrameGrabber_nws_yarp::onDataReady()
+{
+    run();
+}
+
 // Respond to the RPC calls
 bool FrameGrabber_nws_yarp::respond(const yarp::os::Bottle& command,
                                     yarp::os::Bottle& reply)
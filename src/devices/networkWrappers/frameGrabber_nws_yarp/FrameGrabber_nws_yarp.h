@@ -13,6 +13,7 @@
 #include <yarp/os/Stamp.h>
 
 #include <yarp/dev/DeviceDriver.h>
+#include <yarp/dev/IDataReadyNotifier.h>
 #include <yarp/dev/IFrameGrabberControls.h>
 #include <yarp/dev/IFrameGrabberControlsDC1394.h>
 #include <yarp/dev/IFrameGrabberImage.h>
@@ -38,6 +39,10 @@
  * It is also possible to read the images without the client connecting to
  * the streaming Port.
  *
+ * If the attached device implements IDataReadyNotifier, each image is
+ * published as soon as the device notifies it, and the `period` parameter is
+ * ignored. This can be disabled with the `publish_on_new_data` parameter.
+ *
  * \section frameGrabber_nws_yarp_device_parameters Description of input parameters
  *
  * Parameters required by this device are shown in class: FrameGrabber_nws_yarp_ParamsParser
@@ -48,6 +53,7 @@ class FrameGrabber_nws_yarp :
         public yarp::dev::WrapperSingle,
         public yarp::os::PeriodicThread,
         public yarp::dev::DeviceResponder,
+        public yarp::dev::IDataReadyListener,
         public FrameGrabber_nws_yarp_ParamsParser
 {
 private:
@@ -62,6 +68,7 @@ private:
     yarp::dev::IFrameGrabberControls* iFrameGrabberControls {nullptr};
     yarp::dev::IFrameGrabberControlsDC1394* iFrameGrabberControlsDC1394 {nullptr};
     yarp::dev::IPreciselyTimed* iPreciselyTimed {nullptr};
+    yarp::dev::IDataReadyNotifier* iDataReadyNotifier {nullptr};
 
     // Responders
     yarp::proto::framegrabber::FrameGrabberOf_Responder<yarp::sig::ImageOf<yarp::sig::PixelRgb>> frameGrabberImage_Responder;
@@ -101,9 +108,11 @@ public:
     bool detach() override;
 
     //RateThread
-    bool threadInit() override;
     void run() override;
 
+    // IDataReadyListener
+    void onDataReady() override;
+
     // DeviceResponder
     bool respond(const yarp::os::Bottle& command, yarp::os::Bottle& reply) override;
 };
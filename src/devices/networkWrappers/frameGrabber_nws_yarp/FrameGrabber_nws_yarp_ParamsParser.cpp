@@ -8,7 +8,7 @@
 // This is an automatically generated file. Please do not edit it.
 // It will be re-generated if the cmake flag ALLOW_DEVICE_PARAM_PARSER_GERNERATION is ON.
 
-// Generated on: Thu May 22 11:32:40 2025
+// Generated on: Mon Oct 19 03:56:54 2026
 
 
 #include "FrameGrabber_nws_yarp_ParamsParser.h"
@@ -32,6 +32,7 @@ std::vector<std::string> FrameGrabber_nws_yarp_ParamsParser::getListOfParams() c
     params.push_back("name");
     params.push_back("capabilities");
     params.push_back("no_drop");
+    params.push_back("publish_on_new_data");
     return params;
 }
 
@@ -59,6 +60,12 @@ bool FrameGrabber_nws_yarp_ParamsParser::getParamValue(const std::string& paramN
         else paramValue = "false";
         return true;
     }
+    if (paramName =="publish_on_new_data")
+    {
+        if (m_publish_on_new_data==true) paramValue = "true";
+        else paramValue = "false";
+        return true;
+    }
 
     yError() <<"parameter '" << paramName << "' was not found";
     return false;
@@ -142,6 +149,20 @@ bool      FrameGrabber_nws_yarp_ParamsParser::parseParams(const yarp::os::Search
         prop_check.unput("no_drop");
     }
 
+    //Parser of parameter publish_on_new_data
+    {
+        if (config.check("publish_on_new_data"))
+        {
+            m_publish_on_new_data = config.find("publish_on_new_data").asBool();
+            yCInfo(FrameGrabber_nws_yarpParamsCOMPONENT) << "Parameter 'publish_on_new_data' using value:" << m_publish_on_new_data;
+        }
+        else
+        {
+            yCInfo(FrameGrabber_nws_yarpParamsCOMPONENT) << "Parameter 'publish_on_new_data' using DEFAULT value:" << m_publish_on_new_data;
+        }
+        prop_check.unput("publish_on_new_data");
+    }
+
     /*
     //This code check if the user set some parameter which are not check by the parser
     //If the parser is set in strict mode, this will generate an error
@@ -182,9 +203,10 @@ std::string      FrameGrabber_nws_yarp_ParamsParser::getDocumentationOfDevicePar
     doc = doc + std::string("'name': Prefix name of the ports opened by the FrameGrabber_nws_yarp\n");
     doc = doc + std::string("'capabilities': two capabilities supported, COLOR and RAW respectively for rgb and raw streaming\n");
     doc = doc + std::string("'no_drop': if present, use strict policy for sending data\n");
+    doc = doc + std::string("'publish_on_new_data': Publish each sample as soon as the attached device notifies it (IDataReadyNotifier), instead of periodically\n");
     doc = doc + std::string("\n");
     doc = doc + std::string("Here are some examples of invocation command with yarpdev, with all params:\n");
-    doc = doc + " yarpdev --device frameGrabber_nws_yarp --period 0.033 --name /grabber --capabilities COLOR --no_drop true\n";
+    doc = doc + " yarpdev --device frameGrabber_nws_yarp --period 0.033 --name /grabber --capabilities COLOR --no_drop true --publish_on_new_data true\n";
     doc = doc + std::string("Using only mandatory params:\n");
     doc = doc + " yarpdev --device frameGrabber_nws_yarp\n";
     doc = doc + std::string("=============================================\n\n");    return doc;
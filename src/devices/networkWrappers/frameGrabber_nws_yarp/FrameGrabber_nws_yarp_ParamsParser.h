@@ -8,7 +8,7 @@
 // This is an automatically generated file. Please do not edit it.
 // It will be re-generated if the cmake flag ALLOW_DEVICE_PARAM_PARSER_GERNERATION is ON.
 
-// Generated on: Thu May 22 11:32:40 2025
+// Generated on: Mon Oct 19 03:56:54 2026
 
 
 #ifndef FRAMEGRABBER_NWS_YARP_PARAMSPARSER_H
@@ -23,16 +23,17 @@
 * This class is the parameters parser for class FrameGrabber_nws_yarp.
 *
 * These are the used parameters:
-* | Group name | Parameter name | Type   | Units | Default Value | Required | Description                                                                      | Notes                                                   |
-* |:----------:|:--------------:|:------:|:-----:|:-------------:|:--------:|:--------------------------------------------------------------------------------:|:-------------------------------------------------------:|
-* | -          | period         | double | s     | 0.033         | 0        | refresh period (in s) of the broadcasted values through yarp ports               | default 0.03s                                           |
-* | -          | name           | string | -     | /grabber      | 0        | Prefix name of the ports opened by the FrameGrabber_nws_yarp                     | Required suffix like '/rpc' will be added by the device |
-* | -          | capabilities   | string | -     | COLOR         | 0        | two capabilities supported, COLOR and RAW respectively for rgb and raw streaming | -                                                       |
-* | -          | no_drop        | bool   | -     | true          | 0        | if present, use strict policy for sending data                                   | -                                                       |
+* | Group name | Parameter name      | Type   | Units | Default Value | Required | Description                                                                                                  | Notes                                                   |
+* |:----------:|:-------------------:|:------:|:-----:|:-------------:|:--------:|:------------------------------------------------------------------------------------------------------------:|:-------------------------------------------------------:|
+* | -          | period              | double | s     | 0.033         | 0        | refresh period (in s) of the broadcasted values through yarp ports                                           | default 0.03s                                           |
+* | -          | name                | string | -     | /grabber      | 0        | Prefix name of the ports opened by the FrameGrabber_nws_yarp                                                 | Required suffix like '/rpc' will be added by the device |
+* | -          | capabilities        | string | -     | COLOR         | 0        | two capabilities supported, COLOR and RAW respectively for rgb and raw streaming                             | -                                                       |
+* | -          | no_drop             | bool   | -     | true          | 0        | if present, use strict policy for sending data                                                               | -                                                       |
+* | -          | publish_on_new_data | bool   | -     | true          | 0        | Publish each sample as soon as the attached device notifies it (IDataReadyNotifier), instead of periodically | -                                                       |
 *
 * The device can be launched by yarpdev using one of the following examples (with and without all optional parameters):
 * \code{.unparsed}
-* yarpdev --device frameGrabber_nws_yarp --period 0.033 --name /grabber --capabilities COLOR --no_drop true
+* yarpdev --device frameGrabber_nws_yarp --period 0.033 --name /grabber --capabilities COLOR --no_drop true --publish_on_new_data true
 * \endcode
 *
 * \code{.unparsed}
@@ -64,11 +65,13 @@ public:
     const std::string m_name_defaultValue = {"/grabber"};
     const std::string m_capabilities_defaultValue = {"COLOR"};
     const std::string m_no_drop_defaultValue = {"true"};
+    const std::string m_publish_on_new_data_defaultValue = {"true"};
 
     double m_period = {0.033};
     std::string m_name = {"/grabber"};
     std::string m_capabilities = {"COLOR"};
     bool m_no_drop = {true};
+    bool m_publish_on_new_data = {true};
 
     bool          parseParams(const yarp::os::Searchable & config) override;
     std::string   getDeviceClassName() const override { return m_device_classname; }
@@ -9,6 +9,7 @@
 #include <yarp/dev/tests/IFrameGrabberImageTest.h>
 #include <yarp/dev/tests/IRgbVisualParamsTest.h>
 
+#include <yarp/os/BufferedPort.h>
 #include <yarp/os/Network.h>
 #include <yarp/sig/Image.h>
 #include <yarp/sig/Vector.h>
@@ -59,5 +60,45 @@ TEST_CASE("dev::frameGrabber_nws_yarpTest", "[yarp::dev]")
         CHECK(dd_fake.close());
     }
 
+    SECTION("Test the publication of the images notified by the device")
+    {
+        PolyDriver dd_fake;
+        PolyDriver dd_nws;
+        Property p_fake;
+        Property p_nws;
+
+        p_nws.put("device", "frameGrabber_nws_yarp");
+        p_nws.put("name", "/grabber_push");
+        // Polling would be too slow to receive the images in time
+        p_nws.put("period", 10.0);
+
+        p_fake.put("device", "fakeFrameGrabber");
+
+        REQUIRE(dd_fake.open(p_fake));
+        REQUIRE(dd_nws.open(p_nws));
+
+        BufferedPort<ImageOf<PixelRgb>> reader;
+        REQUIRE(reader.open("/grabber_push/reader"));
+        REQUIRE(Network::connect("/grabber_push", "/grabber_push/reader"));
+
+        {yarp::dev::WrapperSingle* ww_nws; dd_nws.view(ww_nws);
+        REQUIRE(ww_nws);
+        bool result_att = ww_nws->attach(&dd_fake);
+        REQUIRE(result_att); }
+
+        size_t received = 0;
+        for (size_t i = 0; i < 200 && received < 3; ++i) {
+            if (reader.read(false) != nullptr) {
+                received++;
+            }
+            yarp::os::SystemClock::delaySystem(0.01);
+        }
+        CHECK(received >= 3);
+
+        reader.close();
+        CHECK(dd_nws.close());
+        CHECK(dd_fake.close());
+    }
+
     Network::setLocalMode(false);
 }
@@ -55,7 +55,16 @@ bool Map2D_nwc_yarp::open(yarp::os::Searchable &config)
     }
 
     //Check the protocol version
-    if (!m_map_RPC.checkProtocolVersion()) { return false; }
+    //Servers using the protocol version 0 do not provide get_map_delta_RPC(), hence the maps are not cached
+    if (m_map_RPC.getRemoteProtocolVersion().protocol_version == 0)
+    {
+        if (m_map_cache)
+        {
+            yCWarning(MAP2D_NWC_YARP, "The server does not support incremental map updates, map_cache disabled");
+            m_map_cache = false;
+        }
+    }
+    else if (!m_map_RPC.checkProtocolVersion()) { return false; }
 
     yCInfo(MAP2D_NWC_YARP) << "Opening of NWC successful";
     return true;
@@ -70,19 +79,54 @@ ReturnValue Map2D_nwc_yarp::store_map(const MapGrid2D& map)
 ReturnValue Map2D_nwc_yarp::get_map(std::string map_name, MapGrid2D& map)
 {
     std::lock_guard <std::mutex> lg(m_mutex);
-    auto ret = m_map_RPC.get_map_RPC(map_name);
+    if (!m_map_cache)
+    {
+        auto ret = m_map_RPC.get_map_RPC(map_name);
+        if (!ret.retval)
+        {
+            yCError(MAP2D_NWC_YARP, "Unable to get_map");
+            return ret.retval;
+        }
+        map = ret.themap;
+        return ret.retval;
+    }
+
+    auto it = m_maps_cache.find(map_name);
+    std::int64_t known_version = (it != m_maps_cache.end()) ? it->second.version : -1;
+    auto ret = m_map_RPC.get_map_delta_RPC(map_name, known_version);
     if (!ret.retval)
     {
+        m_maps_cache.erase(map_name);
         yCError(MAP2D_NWC_YARP, "Unable to get_map");
         return ret.retval;
     }
-    map = ret.themap;
+
+    cached_map& cached = m_maps_cache[map_name];
+    if (ret.full_map)
+    {
+        cached.map = ret.themap;
+    }
+    else
+    {
+        for (const auto& tile : ret.tiles)
+        {
+            if (!cached.map.setRegion(tile.x, tile.y, tile.w, tile.h, tile.occupancy, tile.flags))
+            {
+                m_maps_cache.erase(map_name);
+                yCError(MAP2D_NWC_YARP, "Unable to get_map: invalid map tile received");
+                return ReturnValue::return_code::return_value_error_nws_nwc_communication_error;
+            }
+        }
+    }
+    cached.version = ret.version;
+    map = cached.map;
     return ret.retval;
 }
 
 ReturnValue Map2D_nwc_yarp::clearAllMaps()
 {
     std::lock_guard <std::mutex> lg(m_mutex);
+    m_maps_cache.clear();
     return m_map_RPC.clear_all_maps_RPC();
 }
 
@@ -102,6 +146,7 @@ ReturnValue Map2D_nwc_yarp::get_map_names(std::vector<std::string>& map_names)
 ReturnValue Map2D_nwc_yarp::remove_map(std::string map_name)
 {
     std::lock_guard <std::mutex> lg(m_mutex);
+    m_maps_cache.erase(map_name);
     return m_map_RPC.remove_map_RPC(map_name);
 }
 
@@ -19,6 +19,8 @@
 #include <yarp/dev/PolyDriver.h>
 #include "IMap2DMsgs.h"
 
+#include <map>
+
 #include "Map2D_nwc_yarp_ParamsParser.h"
 
 /**
@@ -42,6 +44,14 @@ protected:
     IMap2DMsgs          m_map_RPC;
     std::mutex          m_mutex;
 
+    // maps received from the server, together with their version, used to request only the changed tiles
+    struct cached_map
+    {
+        std::int64_t                 version = 0;
+        yarp::dev::Nav2D::MapGrid2D map;
+    };
+    std::map<std::string, cached_map> m_maps_cache;
+
 public:
 
      /* DeviceDriver methods */
@@ -8,7 +8,7 @@
 // This is an automatically generated file. Please do not edit it.
 // It will be re-generated if the cmake flag ALLOW_DEVICE_PARAM_PARSER_GERNERATION is ON.
 
-// Generated on: Thu May 22 11:32:42 2025
+// Generated on: Mon Oct 19 02:25:33 2026
 
 
 #include "Map2D_nwc_yarp_ParamsParser.h"
@@ -31,6 +31,7 @@ std::vector<std::string> Map2D_nwc_yarp_ParamsParser::getListOfParams() const
     params.push_back("local");
     params.push_back("remote");
     params.push_back("carrier");
+    params.push_back("map_cache");
     return params;
 }
 
@@ -52,6 +53,12 @@ bool Map2D_nwc_yarp_ParamsParser::getParamValue(const std::string& paramName, st
         paramValue = m_carrier;
         return true;
     }
+    if (paramName =="map_cache")
+    {
+        if (m_map_cache==true) paramValue = "true";
+        else paramValue = "false";
+        return true;
+    }
 
     yError() <<"parameter '" << paramName << "' was not found";
     return false;
@@ -125,6 +132,20 @@ bool      Map2D_nwc_yarp_ParamsParser::parseParams(const yarp::os::Searchable &
         prop_check.unput("carrier");
     }
 
+    //Parser of parameter map_cache
+    {
+        if (config.check("map_cache"))
+        {
+            m_map_cache = config.find("map_cache").asBool();
+            yCInfo(Map2D_nwc_yarpParamsCOMPONENT) << "Parameter 'map_cache' using value:" << m_map_cache;
+        }
+        else
+        {
+            yCInfo(Map2D_nwc_yarpParamsCOMPONENT) << "Parameter 'map_cache' using DEFAULT value:" << m_map_cache;
+        }
+        prop_check.unput("map_cache");
+    }
+
     /*
     //This code check if the user set some parameter which are not check by the parser
     //If the parser is set in strict mode, this will generate an error
@@ -164,9 +185,10 @@ std::string      Map2D_nwc_yarp_ParamsParser::getDocumentationOfDeviceParams() c
     doc = doc + std::string("'local': Full port name opened by the Map2D_nwc_yarp device.\n");
     doc = doc + std::string("'remote': Full port name of the port remotely opened by the Map2D_nws_yarp, to which the Map2D_nwc_yarp connects to.\n");
     doc = doc + std::string("'carrier': The carrier used for the connection with the server.\n");
+    doc = doc + std::string("'map_cache': If true, the maps are cached by the client and only the tiles changed since the cached version are received from the server.\n");
     doc = doc + std::string("\n");
     doc = doc + std::string("Here are some examples of invocation command with yarpdev, with all params:\n");
-    doc = doc + " yarpdev --device map2D_nwc_yarp --local <mandatory_value> --remote <mandatory_value> --carrier fast_tcp\n";
+    doc = doc + " yarpdev --device map2D_nwc_yarp --local <mandatory_value> --remote <mandatory_value> --carrier fast_tcp --map_cache true\n";
     doc = doc + std::string("Using only mandatory params:\n");
     doc = doc + " yarpdev --device map2D_nwc_yarp --local <mandatory_value> --remote <mandatory_value>\n";
     doc = doc + std::string("=============================================\n\n");    return doc;
@@ -8,7 +8,7 @@
 // This is an automatically generated file. Please do not edit it.
 // It will be re-generated if the cmake flag ALLOW_DEVICE_PARAM_PARSER_GERNERATION is ON.
 
-// Generated on: Thu May 22 11:32:42 2025
+// Generated on: Mon Oct 19 02:25:33 2026
 
 
 #ifndef MAP2D_NWC_YARP_PARAMSPARSER_H
@@ -23,15 +23,16 @@
 * This class is the parameters parser for class Map2D_nwc_yarp.
 *
 * These are the used parameters:
-* | Group name | Parameter name | Type   | Units | Default Value | Required | Description                                                                                                | Notes |
-* |:----------:|:--------------:|:------:|:-----:|:-------------:|:--------:|:----------------------------------------------------------------------------------------------------------:|:-----:|
-* | -          | local          | string | -     | -             | 1        | Full port name opened by the Map2D_nwc_yarp device.                                                        | -     |
-* | -          | remote         | string | -     | -             | 1        | Full port name of the port remotely opened by the Map2D_nws_yarp, to which the Map2D_nwc_yarp connects to. | -     |
-* | -          | carrier        | string | -     | fast_tcp      | 0        | The carrier used for the connection with the server.                                                       | -     |
+* | Group name | Parameter name | Type   | Units | Default Value | Required | Description                                                                                                                  | Notes |
+* |:----------:|:--------------:|:------:|:-----:|:-------------:|:--------:|:----------------------------------------------------------------------------------------------------------------------------:|:-----:|
+* | -          | local          | string | -     | -             | 1        | Full port name opened by the Map2D_nwc_yarp device.                                                                          | -     |
+* | -          | remote         | string | -     | -             | 1        | Full port name of the port remotely opened by the Map2D_nws_yarp, to which the Map2D_nwc_yarp connects to.                   | -     |
+* | -          | carrier        | string | -     | fast_tcp      | 0        | The carrier used for the connection with the server.                                                                         | -     |
+* | -          | map_cache      | bool   | -     | true          | 0        | If true, the maps are cached by the client and only the tiles changed since the cached version are received from the server. | -     |
 *
 * The device can be launched by yarpdev using one of the following examples (with and without all optional parameters):
 * \code{.unparsed}
-* yarpdev --device map2D_nwc_yarp --local <mandatory_value> --remote <mandatory_value> --carrier fast_tcp
+* yarpdev --device map2D_nwc_yarp --local <mandatory_value> --remote <mandatory_value> --carrier fast_tcp --map_cache true
 * \endcode
 *
 * \code{.unparsed}
@@ -62,10 +63,12 @@ public:
     const std::string m_local_defaultValue = {""};
     const std::string m_remote_defaultValue = {""};
     const std::string m_carrier_defaultValue = {"fast_tcp"};
+    const std::string m_map_cache_defaultValue = {"true"};
 
     std::string m_local = {}; //This default value is autogenerated. It is highly recommended to provide a suggested value also for mandatory parameters.
     std::string m_remote = {}; //This default value is autogenerated. It is highly recommended to provide a suggested value also for mandatory parameters.
     std::string m_carrier = {"fast_tcp"};
+    bool m_map_cache = {true};
 
     bool          parseParams(const yarp::os::Searchable & config) override;
     std::string   getDeviceClassName() const override { return m_device_classname; }
@@ -63,6 +63,49 @@ TEST_CASE("dev::Map2DnwcTest", "[yarp::dev]")
         yarp::dev::tests::exec_iMap2D_test_1 (imap);
         yarp::dev::tests::exec_iMap2D_test_2 (imap);
 
+        //Checking the maps received as incremental updates
+        {
+            IMap2D* istorage = nullptr;
+            REQUIRE(ddmapstorage.view(istorage));
+
+            MapGrid2D big_map;
+            big_map.m_map_name = "big_map";
+            big_map.setResolution(0.05);
+            big_map.setSize_in_cells(300, 200);
+            REQUIRE(imap->store_map(big_map));
+
+            MapGrid2D received;
+            REQUIRE(imap->get_map("big_map", received));
+            CHECK(received.isIdenticalTo(big_map));
+
+            //change a few cells of the map stored in the server
+            big_map.setMapFlag(XYCell(10, 10), MapGrid2D::map_flags::MAP_CELL_KEEP_OUT);
+            big_map.setOccupancyData(XYCell(299, 199), 100);
+            REQUIRE(istorage->store_map(big_map));
+            REQUIRE(imap->get_map("big_map", received));
+            CHECK(received.isIdenticalTo(big_map));
+
+            //change only the fields of the map which are not carried by the tiles
+            REQUIRE(big_map.setOrigin(1.0, 2.0, 0.5));
+            REQUIRE(istorage->store_map(big_map));
+            REQUIRE(imap->get_map("big_map", received));
+            CHECK(received.isIdenticalTo(big_map));
+
+            REQUIRE(big_map.setResolution(0.1));
+            REQUIRE(istorage->store_map(big_map));
+            REQUIRE(imap->get_map("big_map", received));
+            CHECK(received.isIdenticalTo(big_map));
+
+            //change the layout of the map
+            big_map.setSize_in_cells(100, 150);
+            REQUIRE(istorage->store_map(big_map));
+            REQUIRE(imap->get_map("big_map", received));
+            CHECK(received.isIdenticalTo(big_map));
+
+            REQUIRE(imap->remove_map("big_map"));
+            CHECK_FALSE(imap->get_map("big_map", received));
+        }
+
         //"Close all polydrivers and check"
         {
             CHECK(ddmapclient.close());
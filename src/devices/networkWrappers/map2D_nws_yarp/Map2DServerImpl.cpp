@@ -5,9 +5,12 @@
 
 #include <yarp/os/LogComponent.h>
 #include <yarp/os/LogStream.h>
+#include <yarp/os/SystemClock.h>
 #include <yarp/dev/ILocalization2D.h>
 #include "Map2DServerImpl.h"
 
+#include <algorithm>
+
 /*! \file Map2DServerImpl.cpp */
 
 using namespace yarp::os;
@@ -27,10 +30,87 @@ YARP_LOG_COMPONENT(MAP2D_RPC, "yarp.device.map2D_nws_yarp.IMap2DRPCd")
 
 #define CHECK_POINTER(xxx) {if (xxx==nullptr) {yCError(MAP2D_RPC, "Invalid interface"); return false;}}
 
+IMap2DRPCd::IMap2DRPCd(yarp::dev::Nav2D::IMap2D* _imap)
+{
+    m_iMap = _imap;
+    // The versions start from the current time (in microseconds), so that a client which
+    // reconnects to a restarted server never confuses its cached versions with the new ones.
+    m_last_version = static_cast<std::int64_t>(SystemClock::nowSystem() * 1e6);
+}
+
+std::shared_ptr<const IMap2DRPCd::map_snapshot> IMap2DRPCd::updateSnapshot(const std::string& map_name, const MapGrid2D& map)
+{
+    std::shared_ptr<const map_snapshot> prev;
+    auto it = m_snapshots.find(map_name);
+    if (it != m_snapshots.end())
+    {
+        prev = it->second;
+    }
+
+    bool same_info = prev &&
+                       prev->width == map.width() &&
+                       prev->height == map.height() &&
+                       prev->resolution == map.m_resolution &&
+                       !(prev->origin != map.m_origin) &&
+                       prev->map_name == map.m_map_name;
+
+    auto next = std::make_shared<map_snapshot>();
+    next->width = map.width();
+    next->height = map.height();
+    next->resolution = map.m_resolution;
+    next->origin = map.m_origin;
+    next->map_name = map.m_map_name;
+    next->tiles_x = (next->width + c_tile_size - 1) / c_tile_size;
+    next->tiles_y = (next->height + c_tile_size - 1) / c_tile_size;
+    next->tiles.resize(next->tiles_x * next->tiles_y);
+
+    std::int64_t new_version = m_last_version + 1;
+    bool changed = !same_info;
+    for (size_t ty = 0; ty < next->tiles_y; ty++)
+    {
+        for (size_t tx = 0; tx < next->tiles_x; tx++)
+        {
+            size_t x = tx * c_tile_size;
+            size_t y = ty * c_tile_size;
+            size_t w = std::min(c_tile_size, next->width - x);
+            size_t h = std::min(c_tile_size, next->height - y);
+            size_t index = ty * next->tiles_x + tx;
+            map.getRegion(x, y, w, h, m_tmp_occupancy, m_tmp_flags);
+            if (same_info &&
+                prev->tiles[index]->occupancy == m_tmp_occupancy &&
+                prev->tiles[index]->flags == m_tmp_flags)
+            {
+                next->tiles[index] = prev->tiles[index];
+                continue;
+            }
+            auto tile = std::make_shared<map_tile_snapshot>();
+            tile->version = new_version;
+            tile->occupancy = m_tmp_occupancy;
+            tile->flags = m_tmp_flags;
+            next->tiles[index] = std::move(tile);
+            changed = true;
+        }
+    }
+
+    if (!changed)
+    {
+        return prev;
+    }
+
+    m_last_version = new_version;
+    next->version = new_version;
+    next->base_version = same_info ? prev->base_version : new_version;
+    m_snapshots[map_name] = next;
+    return next;
+}
+
 ReturnValue IMap2DRPCd::clear_all_maps_RPC()
 {
     std::lock_guard <std::mutex> lg(m_mutex);
 
+    // the snapshots of the removed maps are not needed anymore
+    m_snapshots.clear();
+
     auto ret = m_iMap->clearAllMaps();
     if (!ret)
     {
@@ -69,6 +149,54 @@ return_get_map IMap2DRPCd::get_map_RPC(const std::string& map_name)
     return ret;
 }
 
+return_get_map_delta IMap2DRPCd::get_map_delta_RPC(const std::string& map_name, const std::int64_t known_version)
+{
+    std::lock_guard <std::mutex> lg(m_mutex);
+
+    return_get_map_delta ret;
+    yarp::dev::Nav2D::MapGrid2D map;
+    ret.retval = m_iMap->get_map(map_name, map);
+    if (!ret.retval)
+    {
+        m_snapshots.erase(map_name);
+        yCError(MAP2D_RPC, "Unable to get_map");
+        return ret;
+    }
+
+    auto snapshot = updateSnapshot(map_name, map);
+    ret.version = snapshot->version;
+
+    // The client does not know this map (or its size, resolution, origin or name changed): send it all
+    if (known_version < snapshot->base_version || known_version > snapshot->version)
+    {
+        ret.full_map = true;
+        ret.themap = map;
+        return ret;
+    }
+
+    ret.full_map = false;
+    for (size_t ty = 0; ty < snapshot->tiles_y; ty++)
+    {
+        for (size_t tx = 0; tx < snapshot->tiles_x; tx++)
+        {
+            const auto& tile = snapshot->tiles[ty * snapshot->tiles_x + tx];
+            if (tile->version <= known_version)
+            {
+                continue;
+            }
+            map_tile t;
+            t.x = static_cast<std::int32_t>(tx * c_tile_size);
+            t.y = static_cast<std::int32_t>(ty * c_tile_size);
+            t.w = static_cast<std::int32_t>(std::min(c_tile_size, snapshot->width - t.x));
+            t.h = static_cast<std::int32_t>(std::min(c_tile_size, snapshot->height - t.y));
+            t.occupancy = tile->occupancy;
+            t.flags = tile->flags;
+            ret.tiles.push_back(std::move(t));
+        }
+    }
+    return ret;
+}
+
 return_get_map_names IMap2DRPCd::get_map_names_RPC()
 {
     std::lock_guard <std::mutex> lg(m_mutex);
@@ -91,6 +219,8 @@ ReturnValue IMap2DRPCd::remove_map_RPC(const std::string& map_name)
 {
     std::lock_guard <std::mutex> lg(m_mutex);
 
+    m_snapshots.erase(map_name);
+
     auto ret = m_iMap->remove_map(map_name);
     if (!ret)
     {
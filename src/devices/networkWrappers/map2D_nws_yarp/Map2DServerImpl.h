@@ -11,18 +11,54 @@
 #include <yarp/os/Stamp.h>
 #include <yarp/dev/ReturnValue.h>
 
+#include <map>
+#include <memory>
+#include <vector>
+
 class IMap2DRPCd : public IMap2DMsgs
 {
     private:
     yarp::dev::Nav2D::IMap2D* m_iMap = nullptr;
     std::mutex                m_mutex;
 
+    // The maps are split in tiles, which are compared with the last served version to
+    // send only the tiles that changed since the version known by the client.
+    // Tiles are immutable and shared between consecutive versions of the same map.
+    struct map_tile_snapshot
+    {
+        std::int64_t version = 0;
+        std::string  occupancy;
+        std::string  flags;
+    };
+    struct map_snapshot
+    {
+        std::int64_t version = 0;      // last change of the map
+        std::int64_t base_version = 0; // last change of the fields of the map not carried by the tiles
+        size_t       width = 0;
+        size_t       height = 0;
+        double       resolution = 0;
+        yarp::dev::Nav2D::MapGrid2DOrigin origin;
+        std::string  map_name;
+        size_t       tiles_x = 0;
+        size_t       tiles_y = 0;
+        std::vector<std::shared_ptr<const map_tile_snapshot>> tiles;
+    };
+    std::map<std::string, std::shared_ptr<const map_snapshot>> m_snapshots;
+    std::int64_t m_last_version = 0;
+    std::string  m_tmp_occupancy;
+    std::string  m_tmp_flags;
+
+    std::shared_ptr<const map_snapshot> updateSnapshot(const std::string& map_name, const yarp::dev::Nav2D::MapGrid2D& map);
+
     public:
-    IMap2DRPCd(yarp::dev::Nav2D::IMap2D* _imap) { m_iMap = _imap; }
+    static constexpr size_t c_tile_size = 64;
+
+    IMap2DRPCd(yarp::dev::Nav2D::IMap2D* _imap);
 
     yarp::dev::ReturnValue clear_all_maps_RPC() override;
     yarp::dev::ReturnValue store_map_RPC(const yarp::dev::Nav2D::MapGrid2D& themap) override;
     return_get_map get_map_RPC(const std::string& map_name) override;
+    return_get_map_delta get_map_delta_RPC(const std::string& map_name, const std::int64_t known_version) override;
     return_get_map_names get_map_names_RPC() override;
     yarp::dev::ReturnValue remove_map_RPC(const std::string& map_name) override;
     yarp::dev::ReturnValue store_location_RPC(const std::string& location_name, const yarp::dev::Nav2D::Map2DLocation& loc) override;
@@ -10,16 +10,73 @@
 
 #include <yarp/os/LogComponent.h>
 
+#include <algorithm>
+#include <iterator>
+
 namespace {
 YARP_LOG_COMPONENT(MULTIPLEANALOGSENSORSCLIENT, "yarp.device.multipleanalogsensorsclient")
+
+/**
+ * Fields of the streaming data and of the metadata related to each type of sensors.
+ */
+struct MAS_SensorTypeFields
+{
+    SensorMeasurements SensorStreamingData::* measurements;
+    std::vector<SensorMetadata> SensorRPCData::* metadata;
+};
+
+const MAS_SensorTypeFields MAS_sensorTypeFields[] = {
+    {&SensorStreamingData::ThreeAxisGyroscopes, &SensorRPCData::ThreeAxisGyroscopes},
+    {&SensorStreamingData::ThreeAxisLinearAccelerometers, &SensorRPCData::ThreeAxisLinearAccelerometers},
+    {&SensorStreamingData::ThreeAxisMagnetometers, &SensorRPCData::ThreeAxisMagnetometers},
+    {&SensorStreamingData::OrientationSensors, &SensorRPCData::OrientationSensors},
+    {&SensorStreamingData::TemperatureSensors, &SensorRPCData::TemperatureSensors},
+    {&SensorStreamingData::SixAxisForceTorqueSensors, &SensorRPCData::SixAxisForceTorqueSensors},
+    {&SensorStreamingData::ContactLoadCellArrays, &SensorRPCData::ContactLoadCellArrays},
+    {&SensorStreamingData::EncoderArrays, &SensorRPCData::EncoderArrays},
+    {&SensorStreamingData::SkinPatches, &SensorRPCData::SkinPatches},
+    {&SensorStreamingData::PositionSensors, &SensorRPCData::PositionSensors},
+    {&SensorStreamingData::LinearVelocitySensors, &SensorRPCData::LinearVelocitySensors},
+    {&SensorStreamingData::ThreeAxisAngularAccelerometers, &SensorRPCData::ThreeAxisAngularAccelerometers}
+};
 }
 
 void SensorStreamingDataInputPort::onRead(SensorStreamingData& v)
 {
     std::lock_guard<std::mutex> guard(dataMutex);
+
+    // Keep the last value of the measurements that did not change
+    bool complete = true;
+    if (mergeDeltas)
+    {
+        for (const auto& fields : MAS_sensorTypeFields)
+        {
+            auto& newMeasurements = (v.*(fields.measurements)).measurements;
+            const auto& oldMeasurements = (receivedData.*(fields.measurements)).measurements;
+            for (size_t i = 0; i < newMeasurements.size(); i++)
+            {
+                if (newMeasurements[i].measurement.size() == 0)
+                {
+                    if (i < oldMeasurements.size() && oldMeasurements[i].measurement.size() != 0)
+                    {
+                        newMeasurements[i].measurement = oldMeasurements[i].measurement;
+                    }
+                    else
+                    {
+                        complete = false;
+                    }
+                }
+            }
+        }
+    }
+
     receivedData = v;
     lastTimeStampReadInSeconds = yarp::os::Time::now();
-    status = yarp::dev::MAS_OK;
+    // Wait for a full message before reporting the measurements as valid
+    if (complete)
+    {
+        status = yarp::dev::MAS_OK;
+    }
 }
 
 void SensorStreamingDataInputPort::updateTimeoutStatus() const
@@ -48,6 +105,12 @@ bool MultipleAnalogSensorsClient::open(yarp::os::Searchable& config)
     std::string remoteRPCPortName = m_remote + "/rpc:o";
     std::string remoteStreamingPortName = m_remote + "/measures:o";
 
+    if (m_externalConnection && needsSubscription())
+    {
+        yCWarning(MULTIPLEANALOGSENSORSCLIENT,
+                  "The sensors, decimation, resolution and delta options are ignored when externalConnection is true.");
+    }
+
     // TODO(traversaro) : as soon as the method for checking port names validity
     //                    are available in YARP ( https://github.com/robotology/yarp/pull/1508 ) add some checks
 
@@ -87,17 +150,6 @@ bool MultipleAnalogSensorsClient::open(yarp::os::Searchable& config)
             return false;
         }
 
-        ok = yarp::os::Network::connect(remoteStreamingPortName, localStreamingPortName, m_carrier);
-        if (!ok) {
-            yCError(MULTIPLEANALOGSENSORSCLIENT,
-                    "Failure connecting port %s to %s.",
-                    remoteStreamingPortName.c_str(),
-                    localStreamingPortName.c_str());
-            yCError(MULTIPLEANALOGSENSORSCLIENT, "Check that the specified MultipleAnalogSensorsServer is up.");
-            close();
-            return false;
-        }
-
         // Once the connection is active, we just the metadata only once
         ok = m_RPCInterface.yarp().attachAsClient(m_rpcPort);
         if (!ok) {
@@ -111,14 +163,85 @@ bool MultipleAnalogSensorsClient::open(yarp::os::Searchable& config)
         // here
         m_sensorsMetadata = m_RPCInterface.getMetadata();
 
+        // Ask the server for a dedicated stream if needed
+        if (needsSubscription() && !subscribe(remoteStreamingPortName)) {
+            close();
+            return false;
+        }
+
+        ok = yarp::os::Network::connect(remoteStreamingPortName, localStreamingPortName, m_carrier);
+        if (!ok) {
+            yCError(MULTIPLEANALOGSENSORSCLIENT,
+                    "Failure connecting port %s to %s.",
+                    remoteStreamingPortName.c_str(),
+                    localStreamingPortName.c_str());
+            yCError(MULTIPLEANALOGSENSORSCLIENT, "Check that the specified MultipleAnalogSensorsServer is up.");
+            close();
+            return false;
+        }
+
     }
 
     yCDebug(MULTIPLEANALOGSENSORSCLIENT,"Open complete");
     return true;
 }
 
+bool MultipleAnalogSensorsClient::needsSubscription() const
+{
+    return !m_sensors.empty() || m_decimation != 1 || m_resolution > 0.0 || m_delta;
+}
+
+bool MultipleAnalogSensorsClient::subscribe(std::string& remoteStreamingPortName)
+{
+    SensorSubscription subscription;
+    subscription.sensors = m_sensors;
+    subscription.decimation = m_decimation;
+    subscription.resolution = m_resolution;
+    subscription.delta = m_delta;
+
+    std::string portName = m_RPCInterface.subscribe(subscription);
+    if (portName.empty())
+    {
+        yCError(MULTIPLEANALOGSENSORSCLIENT,
+                "Failure subscribing to the server %s, check the requested sensors and options.",
+                m_remote.c_str());
+        return false;
+    }
+    m_subscriptionPortName = portName;
+    remoteStreamingPortName = portName;
+    m_streamingPort.mergeDeltas = m_delta;
+    // Each delta is relative to the previous message, so the messages received
+    // while the callback is still running are queued instead of replaced
+    if (m_delta)
+    {
+        m_streamingPort.setStrict();
+    }
+
+    // The dedicated stream contains only the requested sensors, in the same order of the metadata
+    if (!m_sensors.empty())
+    {
+        for (const auto& fields : MAS_sensorTypeFields)
+        {
+            std::vector<SensorMetadata>& metadataVector = m_sensorsMetadata.*(fields.metadata);
+            metadataVector.erase(std::remove_if(metadataVector.begin(), metadataVector.end(),
+                                                [this](const SensorMetadata& metadata) {
+                                                    return std::find(m_sensors.begin(), m_sensors.end(), metadata.name) == m_sensors.end();
+                                                }),
+                                 metadataVector.end());
+        }
+    }
+
+    return true;
+}
+
 bool MultipleAnalogSensorsClient::close()
 {
+    if (!m_subscriptionPortName.empty())
+    {
+        m_RPCInterface.unsubscribe(m_subscriptionPortName);
+        m_subscriptionPortName.clear();
+    }
+
     m_streamingPort.close();
     m_rpcPort.close();
 
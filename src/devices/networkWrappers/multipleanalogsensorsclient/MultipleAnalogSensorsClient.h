@@ -10,6 +10,7 @@
 
 #include "MultipleAnalogSensorsMetadata.h"
 #include "SensorStreamingData.h"
+#include "SensorSubscription.h"
 
 #include <yarp/os/BufferedPort.h>
 #include <yarp/os/Network.h>
@@ -29,6 +30,8 @@ public:
     mutable std::mutex dataMutex;
     double timeoutInSeconds{0.01};
     double lastTimeStampReadInSeconds{0.0};
+    // If true, the empty measurements received are the ones not changed since the last message
+    bool mergeDeltas{false};
 
     using yarp::os::BufferedPort<SensorStreamingData>::onRead;
     void onRead(SensorStreamingData &v) override;
@@ -40,6 +43,10 @@ public:
 *
 * \brief `multipleanalogsensorsclient`: The client side of a device exposing MultipleAnalogSensors interfaces.
 *
+* If any of the `sensors`, `decimation`, `resolution` or `delta` parameters is set, the device asks the server for a
+* dedicated stream containing only the requested sensors, at the requested rate and with quantized or delta-encoded
+* measurements. In this case only the requested sensors are exposed by the device.
+*
 * Parameters required by this device are shown in class: MultipleAnalogSensorsClient_ParamsParser
 *
 */
@@ -64,6 +71,11 @@ class MultipleAnalogSensorsClient :
 
     MultipleAnalogSensorsMetadata m_RPCInterface;
     SensorRPCData m_sensorsMetadata;
+    // Name of the port of the dedicated stream, empty if the default stream is used
+    std::string m_subscriptionPortName;
+
+    bool needsSubscription() const;
+    bool subscribe(std::string& remoteStreamingPortName);
 
     size_t genericGetNrOfSensors(const std::vector<SensorMetadata>& metadataVector,
                                  const SensorMeasurements& measurementsVector) const;
@@ -8,7 +8,7 @@
 // This is an automatically generated file. Please do not edit it.
 // It will be re-generated if the cmake flag ALLOW_DEVICE_PARAM_PARSER_GERNERATION is ON.
 
-// Generated on: Thu May 22 11:32:42 2025
+// Generated on: Mon Oct 19 04:03:40 2026
 
 
 #include "MultipleAnalogSensorsClient_ParamsParser.h"
@@ -33,6 +33,10 @@ std::vector<std::string> MultipleAnalogSensorsClient_ParamsParser::getListOfPara
     params.push_back("timeout");
     params.push_back("externalConnection");
     params.push_back("carrier");
+    params.push_back("sensors");
+    params.push_back("decimation");
+    params.push_back("resolution");
+    params.push_back("delta");
     return params;
 }
 
@@ -65,6 +69,26 @@ bool MultipleAnalogSensorsClient_ParamsParser::getParamValue(const std::string&
         paramValue = m_carrier;
         return true;
     }
+    if (paramName =="sensors")
+    {
+        return false;
+    }
+    if (paramName =="decimation")
+    {
+        paramValue = std::to_string(m_decimation);
+        return true;
+    }
+    if (paramName =="resolution")
+    {
+        paramValue = std::to_string(m_resolution);
+        return true;
+    }
+    if (paramName =="delta")
+    {
+        if (m_delta==true) paramValue = "true";
+        else paramValue = "false";
+        return true;
+    }
 
     yError() <<"parameter '" << paramName << "' was not found";
     return false;
@@ -166,6 +190,77 @@ bool      MultipleAnalogSensorsClient_ParamsParser::parseParams(const yarp::os::
         prop_check.unput("carrier");
     }
 
+    //Parser of parameter sensors
+    {
+        if (config.check("sensors"))
+        {
+            {
+                m_sensors.clear();
+                yarp::os::Bottle* tempBot = config.find("sensors").asList();
+                if (tempBot)
+                {
+                    std::string tempBots = tempBot->toString();
+                    for (size_t i=0; i<tempBot->size(); i++)
+                    {
+                        m_sensors.push_back(tempBot->get(i).asString());
+                    }
+                }
+                else
+                {
+                     yCError(MultipleAnalogSensorsClientParamsCOMPONENT) <<"parameter 'sensors' is not a properly formatted bottle";
+                }
+            }
+            yCInfo(MultipleAnalogSensorsClientParamsCOMPONENT) << "Parameter 'sensors' using value:" << m_sensors;
+        }
+        else
+        {
+            yCInfo(MultipleAnalogSensorsClientParamsCOMPONENT) << "Parameter 'sensors' using DEFAULT value:" << m_sensors;
+        }
+        prop_check.unput("sensors");
+    }
+
+    //Parser of parameter decimation
+    {
+        if (config.check("decimation"))
+        {
+            m_decimation = config.find("decimation").asInt64();
+            yCInfo(MultipleAnalogSensorsClientParamsCOMPONENT) << "Parameter 'decimation' using value:" << m_decimation;
+        }
+        else
+        {
+            yCInfo(MultipleAnalogSensorsClientParamsCOMPONENT) << "Parameter 'decimation' using DEFAULT value:" << m_decimation;
+        }
+        prop_check.unput("decimation");
+    }
+
+    //Parser of parameter resolution
+    {
+        if (config.check("resolution"))
+        {
+            m_resolution = config.find("resolution").asFloat64();
+            yCInfo(MultipleAnalogSensorsClientParamsCOMPONENT) << "Parameter 'resolution' using value:" << m_resolution;
+        }
+        else
+        {
+            yCInfo(MultipleAnalogSensorsClientParamsCOMPONENT) << "Parameter 'resolution' using DEFAULT value:" << m_resolution;
+        }
+        prop_check.unput("resolution");
+    }
+
+    //Parser of parameter delta
+    {
+        if (config.check("delta"))
+        {
+            m_delta = config.find("delta").asBool();
+            yCInfo(MultipleAnalogSensorsClientParamsCOMPONENT) << "Parameter 'delta' using value:" << m_delta;
+        }
+        else
+        {
+            yCInfo(MultipleAnalogSensorsClientParamsCOMPONENT) << "Parameter 'delta' using DEFAULT value:" << m_delta;
+        }
+        prop_check.unput("delta");
+    }
+
     /*
     //This code check if the user set some parameter which are not check by the parser
     //If the parser is set in strict mode, this will generate an error
@@ -207,9 +302,13 @@ std::string      MultipleAnalogSensorsClient_ParamsParser::getDocumentationOfDev
     doc = doc + std::string("'timeout': Timeout after which the device reports an error if no measurement was received.\n");
     doc = doc + std::string("'externalConnection': If set to true, the connection to the rpc port of the MAS server is skipped and it is possible to connect to the data source externally after being opened\n");
     doc = doc + std::string("'carrier': The carier used for the connection with the server.\n");
+    doc = doc + std::string("'sensors': Names of the sensors to stream, if set the server opens a dedicated stream with only these sensors.\n");
+    doc = doc + std::string("'decimation': If greater than 1, the server opens a dedicated stream sending one measurement every decimation ones.\n");
+    doc = doc + std::string("'resolution': If positive, the server opens a dedicated stream with the measurements rounded to a multiple of this value.\n");
+    doc = doc + std::string("'delta': If true, the server opens a dedicated stream sending only the measurements that changed since the last message.\n");
     doc = doc + std::string("\n");
     doc = doc + std::string("Here are some examples of invocation command with yarpdev, with all params:\n");
-    doc = doc + " yarpdev --device multipleanalogsensorsclient --remote <mandatory_value> --local <mandatory_value> --timeout 0.02 --externalConnection false --carrier tcp\n";
+    doc = doc + " yarpdev --device multipleanalogsensorsclient --remote <mandatory_value> --local <mandatory_value> --timeout 0.02 --externalConnection false --carrier tcp --sensors <optional_value> --decimation 1 --resolution 0.0 --delta false\n";
     doc = doc + std::string("Using only mandatory params:\n");
     doc = doc + " yarpdev --device multipleanalogsensorsclient --remote <mandatory_value> --local <mandatory_value>\n";
     doc = doc + std::string("=============================================\n\n");    return doc;
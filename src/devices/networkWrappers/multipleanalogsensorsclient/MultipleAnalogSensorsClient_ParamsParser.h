@@ -8,7 +8,7 @@
 // This is an automatically generated file. Please do not edit it.
 // It will be re-generated if the cmake flag ALLOW_DEVICE_PARAM_PARSER_GERNERATION is ON.
 
-// Generated on: Thu May 22 11:32:42 2025
+// Generated on: Mon Oct 19 04:03:40 2026
 
 
 #ifndef MULTIPLEANALOGSENSORSCLIENT_PARAMSPARSER_H
@@ -23,17 +23,21 @@
 * This class is the parameters parser for class MultipleAnalogSensorsClient.
 *
 * These are the used parameters:
-* | Group name | Parameter name     | Type   | Units | Default Value | Required | Description                                                                                                                                                | Notes                                                                                                                                                         |
-* |:----------:|:------------------:|:------:|:-----:|:-------------:|:--------:|:----------------------------------------------------------------------------------------------------------------------------------------------------------:|:-------------------------------------------------------------------------------------------------------------------------------------------------------------:|
-* | -          | remote             | string | -     | -             | 1        | Prefix of the ports to which to connect, opened by MultipleAnalogSensorsServer device.                                                                     | -                                                                                                                                                             |
-* | -          | local              | string | -     | -             | 1        | Port prefix of the ports opened by this device.                                                                                                            | -                                                                                                                                                             |
-* | -          | timeout            | double | s     | 0.02          | 0        | Timeout after which the device reports an error if no measurement was received.                                                                            | -                                                                                                                                                             |
-* | -          | externalConnection | bool   | -     | false         | 0        | If set to true, the connection to the rpc port of the MAS server is skipped and it is possible to connect to the data source externally after being opened | Use case: e.g yarpdataplayer source. Note that with this configuration some information like sensor name, frame name and sensor number will be not available. |
-* | -          | carrier            | string | -     | tcp           | 0        | The carier used for the connection with the server.                                                                                                        | -                                                                                                                                                             |
+* | Group name | Parameter name     | Type           | Units | Default Value | Required | Description                                                                                                                                                | Notes                                                                                                                                                         |
+* |:----------:|:------------------:|:--------------:|:-----:|:-------------:|:--------:|:----------------------------------------------------------------------------------------------------------------------------------------------------------:|:-------------------------------------------------------------------------------------------------------------------------------------------------------------:|
+* | -          | remote             | string         | -     | -             | 1        | Prefix of the ports to which to connect, opened by MultipleAnalogSensorsServer device.                                                                     | -                                                                                                                                                             |
+* | -          | local              | string         | -     | -             | 1        | Port prefix of the ports opened by this device.                                                                                                            | -                                                                                                                                                             |
+* | -          | timeout            | double         | s     | 0.02          | 0        | Timeout after which the device reports an error if no measurement was received.                                                                            | -                                                                                                                                                             |
+* | -          | externalConnection | bool           | -     | false         | 0        | If set to true, the connection to the rpc port of the MAS server is skipped and it is possible to connect to the data source externally after being opened | Use case: e.g yarpdataplayer source. Note that with this configuration some information like sensor name, frame name and sensor number will be not available. |
+* | -          | carrier            | string         | -     | tcp           | 0        | The carier used for the connection with the server.                                                                                                        | -                                                                                                                                                             |
+* | -          | sensors            | vector<string> | -     | -             | 0        | Names of the sensors to stream, if set the server opens a dedicated stream with only these sensors.                                                        | Use case: e.g. a GUI showing a single sensor. Requires the subscription to the server, not available with externalConnection.                                 |
+* | -          | decimation         | int            | -     | 1             | 0        | If greater than 1, the server opens a dedicated stream sending one measurement every decimation ones.                                                      | -                                                                                                                                                             |
+* | -          | resolution         | double         | -     | 0.0           | 0        | If positive, the server opens a dedicated stream with the measurements rounded to a multiple of this value.                                                | -                                                                                                                                                             |
+* | -          | delta              | bool           | -     | false         | 0        | If true, the server opens a dedicated stream sending only the measurements that changed since the last message.                                            | -                                                                                                                                                             |
 *
 * The device can be launched by yarpdev using one of the following examples (with and without all optional parameters):
 * \code{.unparsed}
-* yarpdev --device multipleanalogsensorsclient --remote <mandatory_value> --local <mandatory_value> --timeout 0.02 --externalConnection false --carrier tcp
+* yarpdev --device multipleanalogsensorsclient --remote <mandatory_value> --local <mandatory_value> --timeout 0.02 --externalConnection false --carrier tcp --sensors <optional_value> --decimation 1 --resolution 0.0 --delta false
 * \endcode
 *
 * \code{.unparsed}
@@ -66,12 +70,20 @@ public:
     const std::string m_timeout_defaultValue = {"0.02"};
     const std::string m_externalConnection_defaultValue = {"false"};
     const std::string m_carrier_defaultValue = {"tcp"};
+    const std::string m_sensors_defaultValue = {""};
+    const std::string m_decimation_defaultValue = {"1"};
+    const std::string m_resolution_defaultValue = {"0.0"};
+    const std::string m_delta_defaultValue = {"false"};
 
     std::string m_remote = {}; //This default value is autogenerated. It is highly recommended to provide a suggested value also for mandatory parameters.
     std::string m_local = {}; //This default value is autogenerated. It is highly recommended to provide a suggested value also for mandatory parameters.
     double m_timeout = {0.02};
     bool m_externalConnection = {false};
     std::string m_carrier = {"tcp"};
+    std::vector<std::string> m_sensors = {}; //The default value of this list is an empty list. It is highly recommended to provide a suggested value also for optional string parameters.
+    int m_decimation = {1};
+    double m_resolution = {0.0};
+    bool m_delta = {false};
 
     bool          parseParams(const yarp::os::Searchable & config) override;
     std::string   getDeviceClassName() const override { return m_device_classname; }
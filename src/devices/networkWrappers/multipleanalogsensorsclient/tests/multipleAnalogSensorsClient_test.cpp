@@ -11,6 +11,9 @@
 #include <yarp/dev/PolyDriverList.h>
 #include <yarp/dev/IMultipleWrapper.h>
 
+#include <yarp/dev/Drivers.h>
+
+#include <atomic>
 #include <cmath>
 #include <chrono>
 #include <thread>
@@ -21,6 +24,50 @@
 using namespace yarp::os;
 using namespace yarp::dev;
 
+namespace {
+
+// Two temperature sensors, the first one reports the value set by the test,
+// the second one never changes
+class TwoTemperatureSensors :
+        public yarp::dev::DeviceDriver,
+        public yarp::dev::ITemperatureSensors
+{
+public:
+    static std::atomic<double> changingValue;
+    static constexpr double constantValue = 21.5;
+
+    size_t getNrOfTemperatureSensors() const override { return 2; }
+    yarp::dev::MAS_status getTemperatureSensorStatus(size_t sens_index) const override
+    {
+        return sens_index < 2 ? yarp::dev::MAS_OK : yarp::dev::MAS_ERROR;
+    }
+    bool getTemperatureSensorName(size_t sens_index, std::string& name) const override
+    {
+        name = (sens_index == 0) ? "changing" : "constant";
+        return sens_index < 2;
+    }
+    bool getTemperatureSensorFrameName(size_t sens_index, std::string& frameName) const override
+    {
+        frameName = "frame";
+        return sens_index < 2;
+    }
+    bool getTemperatureSensorMeasure(size_t sens_index, double& out, double& timestamp) const override
+    {
+        out = (sens_index == 0) ? changingValue.load() : constantValue;
+        timestamp = yarp::os::Time::now();
+        return sens_index < 2;
+    }
+    bool getTemperatureSensorMeasure(size_t sens_index, yarp::sig::Vector& out, double& timestamp) const override
+    {
+        out.resize(1);
+        return getTemperatureSensorMeasure(sens_index, out[0], timestamp);
+    }
+};
+
+std::atomic<double> TwoTemperatureSensors::changingValue{0.0};
+
+} // namespace
+
 
 TEST_CASE("dev::MultipleAnalogSensorsClientTest", "[yarp::dev]")
 {
@@ -105,5 +152,154 @@ TEST_CASE("dev::MultipleAnalogSensorsClientTest", "[yarp::dev]")
         INFO("Test complete");
     }
 
+    SECTION("Test the multiple analog sensors device with a dedicated subscription stream")
+    {
+        PolyDriver imuSensor;
+        PolyDriver wrapper;
+
+        Property p;
+        p.put("device", "fakeIMU");
+        p.put("constantValue", 1);
+        REQUIRE(imuSensor.open(p)); // sensor open reported successful
+
+        Property pWrapper;
+        pWrapper.put("device", "multipleanalogsensorsserver");
+        std::string serverPrefix = "/test/mas/server";
+        pWrapper.put("name", serverPrefix);
+        pWrapper.put("period", 10);
+        REQUIRE(wrapper.open(pWrapper)); // multipleanalogsensorsserver open reported successful
+
+        yarp::dev::IMultipleWrapper *iwrap = nullptr;
+        REQUIRE(wrapper.view(iwrap));
+        REQUIRE(iwrap);
+
+        PolyDriverList pdList;
+        pdList.push(&imuSensor, "pdlist_key");
+        REQUIRE(iwrap->attachAll(pdList)); // multipleanalogsensorsserver attached successfully to the device
+
+        // Subscribing to an unknown sensor fails
+        Property pWrongClient;
+        pWrongClient.put("device", "multipleanalogsensorsclient");
+        pWrongClient.put("remote", serverPrefix);
+        pWrongClient.put("local", "/test/mas/wrongclient");
+        pWrongClient.put("sensors", Value::makeList("unknownSensor"));
+        PolyDriver wrongClient;
+        CHECK_FALSE(wrongClient.open(pWrongClient));
+
+        // Open a client on a decimated, quantized and delta-encoded stream
+        Property pClient;
+        pClient.put("device", "multipleanalogsensorsclient");
+        pClient.put("remote", serverPrefix);
+        pClient.put("local", "/test/mas/client");
+        pClient.put("timeout", 1.0);
+        pClient.put("sensors", Value::makeList("sensorName"));
+        pClient.put("decimation", 2);
+        pClient.put("resolution", 0.001);
+        pClient.put("delta", true);
+
+        PolyDriver client;
+        REQUIRE(client.open(pClient)); // multipleanalogsensorsclient open reported successful
+
+        // Let make sure that several messages get read by the client
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        yarp::dev::IOrientationSensors* orientSens = nullptr;
+        REQUIRE(imuSensor.view(orientSens));
+        yarp::dev::IOrientationSensors* clientOrientSens = nullptr;
+        REQUIRE(client.view(clientOrientSens));
+        REQUIRE(clientOrientSens);
+
+        CHECK(clientOrientSens->getNrOfOrientationSensors() == 1);
+        CHECK(clientOrientSens->getOrientationSensorStatus(0) == MAS_status::MAS_OK);
+
+        std::string name;
+        CHECK(clientOrientSens->getOrientationSensorName(0, name));
+        CHECK(name == "sensorName");
+
+        // The measures that did not change are kept by the client
+        yarp::sig::Vector sensorMeasure(3, 0.0), clientMeasure(3, 0.0);
+        double timestamp{ 0.0 }, clientTimestamp{ 0.0 };
+        CHECK(orientSens->getOrientationSensorMeasureAsRollPitchYaw(0, sensorMeasure, timestamp));
+        CHECK(clientOrientSens->getOrientationSensorMeasureAsRollPitchYaw(0, clientMeasure, clientTimestamp));
+        REQUIRE(clientMeasure.size() == 3);
+        for (size_t i = 0; i < 3; i++) {
+            CHECK(std::abs(sensorMeasure[i] - clientMeasure[i]) <= 0.0005 + 1e-9);
+        }
+
+        // Close devices
+        client.close();
+        yarp::os::Time::delay(0.1);
+
+        iwrap->detachAll();
+        wrapper.close();
+        yarp::os::Time::delay(0.1);
+
+        imuSensor.close();
+        yarp::os::Time::delay(0.1);
+    }
+
+    SECTION("Test the delta-encoded stream with changing and unchanged measurements")
+    {
+        Drivers::factory().add(new DriverCreatorOf<TwoTemperatureSensors>("twotemperaturesensors",
+                                                                          "",
+                                                                          "TwoTemperatureSensors"));
+        TwoTemperatureSensors::changingValue = 1.0;
+
+        PolyDriver sensors;
+        Property p;
+        p.put("device", "twotemperaturesensors");
+        REQUIRE(sensors.open(p));
+
+        PolyDriver wrapper;
+        Property pWrapper;
+        pWrapper.put("device", "multipleanalogsensorsserver");
+        std::string serverPrefix = "/test/mas/deltaserver";
+        pWrapper.put("name", serverPrefix);
+        pWrapper.put("period", 10);
+        REQUIRE(wrapper.open(pWrapper));
+
+        yarp::dev::IMultipleWrapper* iwrap = nullptr;
+        REQUIRE(wrapper.view(iwrap));
+        PolyDriverList pdList;
+        pdList.push(&sensors, "pdlist_key");
+        REQUIRE(iwrap->attachAll(pdList));
+
+        Property pClient;
+        pClient.put("device", "multipleanalogsensorsclient");
+        pClient.put("remote", serverPrefix);
+        pClient.put("local", "/test/mas/deltaclient");
+        pClient.put("timeout", 1.0);
+        pClient.put("delta", true);
+        PolyDriver client;
+        REQUIRE(client.open(pClient));
+
+        yarp::dev::ITemperatureSensors* clientTemperatures = nullptr;
+        REQUIRE(client.view(clientTemperatures));
+        REQUIRE(clientTemperatures->getNrOfTemperatureSensors() == 2);
+
+        // Only the first sensor changes, the second one is sent once and then
+        // kept by the client from the previous messages
+        for (int i = 0; i < 5; i++)
+        {
+            TwoTemperatureSensors::changingValue = 10.0 * (i + 1);
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+            CHECK(clientTemperatures->getTemperatureSensorStatus(0) == MAS_status::MAS_OK);
+            double value{0.0};
+            double timestamp{0.0};
+            CHECK(clientTemperatures->getTemperatureSensorMeasure(0, value, timestamp));
+            CHECK(value == 10.0 * (i + 1));
+            CHECK(clientTemperatures->getTemperatureSensorMeasure(1, value, timestamp));
+            CHECK(value == TwoTemperatureSensors::constantValue);
+        }
+
+        client.close();
+        yarp::os::Time::delay(0.1);
+
+        iwrap->detachAll();
+        wrapper.close();
+        sensors.close();
+    }
+
     Network::setLocalMode(false);
 }
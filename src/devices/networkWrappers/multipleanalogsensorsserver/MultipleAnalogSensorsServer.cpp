@@ -13,9 +13,16 @@
 #include <yarp/os/Property.h>
 #include <yarp/dev/PolyDriverList.h>
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
 
 namespace {
 YARP_LOG_COMPONENT(MULTIPLEANALOGSENSORSSERVER, "yarp.device.multipleanalogsensorsserver")
+
+// Number of messages after which a full message is sent on the delta-encoded streams
+constexpr size_t MAS_deltaKeyframePeriod = 100;
 }
 
 /**
@@ -37,6 +44,30 @@ enum MAS_SensorTypeServer
     ThreeAxisAngularAccelerometers=11
 };
 
+/**
+ * Fields of the streaming data and of the metadata related to each type of sensors.
+ */
+struct MAS_SensorTypeFields
+{
+    SensorMeasurements SensorStreamingData::* measurements;
+    std::vector<SensorMetadata> SensorRPCData::* metadata;
+};
+
+const MAS_SensorTypeFields MAS_sensorTypeFields[] = {
+    {&SensorStreamingData::ThreeAxisGyroscopes, &SensorRPCData::ThreeAxisGyroscopes},
+    {&SensorStreamingData::ThreeAxisLinearAccelerometers, &SensorRPCData::ThreeAxisLinearAccelerometers},
+    {&SensorStreamingData::ThreeAxisMagnetometers, &SensorRPCData::ThreeAxisMagnetometers},
+    {&SensorStreamingData::OrientationSensors, &SensorRPCData::OrientationSensors},
+    {&SensorStreamingData::TemperatureSensors, &SensorRPCData::TemperatureSensors},
+    {&SensorStreamingData::SixAxisForceTorqueSensors, &SensorRPCData::SixAxisForceTorqueSensors},
+    {&SensorStreamingData::ContactLoadCellArrays, &SensorRPCData::ContactLoadCellArrays},
+    {&SensorStreamingData::EncoderArrays, &SensorRPCData::EncoderArrays},
+    {&SensorStreamingData::SkinPatches, &SensorRPCData::SkinPatches},
+    {&SensorStreamingData::PositionSensors, &SensorRPCData::PositionSensors},
+    {&SensorStreamingData::LinearVelocitySensors, &SensorRPCData::LinearVelocitySensors},
+    {&SensorStreamingData::ThreeAxisAngularAccelerometers, &SensorRPCData::ThreeAxisAngularAccelerometers}
+};
+
 /**
  * Get measure size for sensors with fixed size measure.
  */
@@ -424,6 +455,18 @@ bool MultipleAnalogSensorsServer::attach(yarp::dev::PolyDriver* poly)
         return false;
     }
 
+    // Publish the measures as soon as the device notifies them, if possible
+    if (m_publish_on_new_data && poly->view(m_iDataReadyNotifier))
+    {
+        if (m_iDataReadyNotifier->addDataReadyListener(this))
+        {
+            yCDebug(MULTIPLEANALOGSENSORSSERVER, "Attach complete, publishing the measures as soon as they are available");
+            return true;
+        }
+        yCWarning(MULTIPLEANALOGSENSORSSERVER, "Failure in registering to the device notifications, using the periodic thread.");
+        m_iDataReadyNotifier = nullptr;
+    }
+
     // Set rate period
     ok = this->setPeriod(m_periodInS);
     ok = ok && this->start();
@@ -440,7 +483,13 @@ bool MultipleAnalogSensorsServer::attach(yarp::dev::PolyDriver* poly)
 
 bool MultipleAnalogSensorsServer::detach()
 {
-    // Stop the thread on detach
+    // Stop the notifications and the thread on detach
+    if (m_iDataReadyNotifier)
+    {
+        m_iDataReadyNotifier->removeDataReadyListener(this);
+        m_iDataReadyNotifier = nullptr;
+    }
+
     if (this->isRunning())
     {
         this->stop();
@@ -448,6 +497,7 @@ bool MultipleAnalogSensorsServer::detach()
 
     m_rpcPort.close();
     m_streamingPort.close();
+    closeAllSubscriptions();
 
     yCDebug(MULTIPLEANALOGSENSORSSERVER, "Detach complete");
     return true;
@@ -458,6 +508,191 @@ SensorRPCData MultipleAnalogSensorsServer::getMetadata()
     return m_sensorMetadata;
 }
 
+std::string MultipleAnalogSensorsServer::subscribe(const SensorSubscription& subscription)
+{
+    if (subscription.decimation < 1 || subscription.resolution < 0.0)
+    {
+        yCError(MULTIPLEANALOGSENSORSSERVER,
+                "Invalid subscription (decimation: %d, resolution: %f).",
+                subscription.decimation,
+                subscription.resolution);
+        return {};
+    }
+
+    SensorSubscription requested = subscription;
+    std::sort(requested.sensors.begin(), requested.sensors.end());
+    requested.sensors.erase(std::unique(requested.sensors.begin(), requested.sensors.end()), requested.sensors.end());
+
+    std::lock_guard<std::mutex> guard(m_subscriptionsMutex);
+
+    // Clients requesting the same options share the same stream
+    for (auto& it : m_subscriptions)
+    {
+        const SensorSubscription& other = it.second->subscription;
+        if (other.sensors == requested.sensors &&
+            other.decimation == requested.decimation &&
+            other.resolution == requested.resolution &&
+            other.delta == requested.delta)
+        {
+            it.second->nrOfClients++;
+            return it.first;
+        }
+    }
+
+    auto stream = std::make_unique<SubscriptionStream>();
+    stream->subscription = requested;
+    stream->selectedSensors.resize(std::size(MAS_sensorTypeFields));
+    std::vector<bool> found(requested.sensors.size(), false);
+    for (size_t type = 0; type < std::size(MAS_sensorTypeFields); type++)
+    {
+        const std::vector<SensorMetadata>& metadataVector = m_sensorMetadata.*(MAS_sensorTypeFields[type].metadata);
+        for (size_t i = 0; i < metadataVector.size(); i++)
+        {
+            auto name = std::lower_bound(requested.sensors.begin(), requested.sensors.end(), metadataVector[i].name);
+            if (requested.sensors.empty())
+            {
+                stream->selectedSensors[type].push_back(i);
+            }
+            else if (name != requested.sensors.end() && *name == metadataVector[i].name)
+            {
+                stream->selectedSensors[type].push_back(i);
+                found[std::distance(requested.sensors.begin(), name)] = true;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < found.size(); i++)
+    {
+        if (!found[i])
+        {
+            yCError(MULTIPLEANALOGSENSORSSERVER, "Subscription to unknown sensor %s.", requested.sensors[i].c_str());
+            return {};
+        }
+    }
+
+    std::string portName = m_streamingPortName + "/" + std::to_string(m_subscriptionsCounter++);
+    if (!stream->port.open(portName))
+    {
+        yCError(MULTIPLEANALOGSENSORSSERVER, "Failure in opening port named %s.", portName.c_str());
+        return {};
+    }
+
+    stream->nrOfClients = 1;
+    m_subscriptions[portName] = std::move(stream);
+
+    yCDebug(MULTIPLEANALOGSENSORSSERVER, "Opened subscription stream %s.", portName.c_str());
+    return portName;
+}
+
+bool MultipleAnalogSensorsServer::unsubscribe(const std::string& portName)
+{
+    std::lock_guard<std::mutex> guard(m_subscriptionsMutex);
+
+    auto it = m_subscriptions.find(portName);
+    if (it == m_subscriptions.end())
+    {
+        yCError(MULTIPLEANALOGSENSORSSERVER, "Unsubscribe from unknown stream %s.", portName.c_str());
+        return false;
+    }
+
+    // Close the stream when its last client leaves
+    if (--it->second->nrOfClients == 0)
+    {
+        it->second->port.interrupt();
+        it->second->port.close();
+        m_subscriptions.erase(it);
+        yCDebug(MULTIPLEANALOGSENSORSSERVER, "Closed subscription stream %s.", portName.c_str());
+    }
+
+    return true;
+}
+
+void MultipleAnalogSensorsServer::closeAllSubscriptions()
+{
+    std::lock_guard<std::mutex> guard(m_subscriptionsMutex);
+
+    for (auto& it : m_subscriptions)
+    {
+        it.second->port.interrupt();
+        it.second->port.close();
+    }
+    m_subscriptions.clear();
+}
+
+void MultipleAnalogSensorsServer::streamSubscriptions(const SensorStreamingData& streamingData)
+{
+    std::lock_guard<std::mutex> guard(m_subscriptionsMutex);
+
+    for (auto& it : m_subscriptions)
+    {
+        SubscriptionStream& stream = *(it.second);
+        const SensorSubscription& subscription = stream.subscription;
+
+        // A new client is connected, it needs a full message as soon as possible
+        size_t nrOfConnections = stream.port.getOutputCount();
+        bool keyframe = nrOfConnections > stream.nrOfConnections;
+        stream.nrOfConnections = nrOfConnections;
+        if (nrOfConnections == 0)
+        {
+            continue;
+        }
+
+        size_t sample = stream.nrOfSamples++;
+        if (!keyframe && (sample % subscription.decimation) != 0)
+        {
+            continue;
+        }
+
+        keyframe = keyframe || !subscription.delta || stream.keyframePending || stream.nrOfMessagesSinceKeyframe >= MAS_deltaKeyframePeriod;
+
+        // The payload is computed once and shared by all the clients of the stream
+        SensorStreamingData& output = stream.port.prepare();
+        for (size_t type = 0; type < std::size(MAS_sensorTypeFields); type++)
+        {
+            const auto& inputVector = (streamingData.*(MAS_sensorTypeFields[type].measurements)).measurements;
+            auto& outputVector = (output.*(MAS_sensorTypeFields[type].measurements)).measurements;
+            auto& lastSentVector = (stream.lastSent.*(MAS_sensorTypeFields[type].measurements)).measurements;
+            const std::vector<size_t>& selectedSensors = stream.selectedSensors[type];
+
+            outputVector.resize(selectedSensors.size());
+            lastSentVector.resize(selectedSensors.size());
+            for (size_t i = 0; i < selectedSensors.size() && selectedSensors[i] < inputVector.size(); i++)
+            {
+                const SensorMeasurement& input = inputVector[selectedSensors[i]];
+                SensorMeasurement& out = outputVector[i];
+                out.timestamp = input.timestamp;
+                out.measurement.resize(input.measurement.size());
+                for (size_t j = 0; j < input.measurement.size(); j++)
+                {
+                    out.measurement[j] = (subscription.resolution > 0.0)
+                        ? std::round(input.measurement[j] / subscription.resolution) * subscription.resolution
+                        : input.measurement[j];
+                }
+
+                // Unchanged measurements are sent as empty vectors
+                if (subscription.delta)
+                {
+                    if (!keyframe && out.measurement == lastSentVector[i].measurement)
+                    {
+                        out.measurement.clear();
+                    }
+                    else
+                    {
+                        lastSentVector[i].measurement = out.measurement;
+                    }
+                }
+            }
+        }
+
+        stream.nrOfMessagesSinceKeyframe = keyframe ? 0 : stream.nrOfMessagesSinceKeyframe + 1;
+        stream.port.setEnvelope(m_stamp);
+        // A connection still sending the previous message drops this one, and
+        // the next deltas would be relative to a message the client never got
+        stream.keyframePending = subscription.delta && stream.port.isWriting();
+        stream.port.write();
+    }
+}
+
 template<typename Interface>
 bool MultipleAnalogSensorsServer::genericStreamData(Interface* wrappedDeviceInterface,
                                                     const std::vector< SensorMetadata >& metadataVector,
@@ -575,6 +810,7 @@ void MultipleAnalogSensorsServer::run()
     if (ok)
     {
         m_stamp.update();
+        streamSubscriptions(streamingData);
         m_streamingPort.setEnvelope(m_stamp);
         m_streamingPort.write();
     }
@@ -584,6 +820,11 @@ void MultipleAnalogSensorsServer::run()
     }
 }
 
+void MultipleAnalogSensorsServer::onDataReady()
+{
+    run();
+}
+
 void MultipleAnalogSensorsServer::threadRelease()
 {
     return;
@@ -12,10 +12,16 @@
 #include <yarp/dev/DeviceDriver.h>
 #include <yarp/dev/PolyDriver.h>
 #include <yarp/dev/WrapperSingle.h>
+#include <yarp/dev/IDataReadyNotifier.h>
 #include <yarp/dev/MultipleAnalogSensorsInterfaces.h>
 
+#include <map>
+#include <memory>
+#include <mutex>
+
 // Thrift-generated classes
 #include "SensorStreamingData.h"
+#include "SensorSubscription.h"
 #include "MultipleAnalogSensorsMetadata.h"
 
 #include "MultipleAnalogSensorsServer_ParamsParser.h"
@@ -27,6 +33,11 @@
  * This device opens two ports: /${name}/measures:o that streams the data of the sensors, and /${name}/rpc:o that is a YARP RPC port that exposes the metadata.
  * The data on the /${name}/measures:o is streamed every ${period} milliseconds, and an envelope to each data is added with a timestamp obtained by calling the
  * yarp::os::Time::now() method when the message is written on the port.
+ * If the attached device implements IDataReadyNotifier, the data is instead streamed as soon as the device notifies a new sample,
+ * unless the `publish_on_new_data` parameter is false.
+ * Clients can also request through the subscribe RPC a dedicated stream containing only a subset of the sensors,
+ * sent at a fraction of the rate and with quantized or delta-encoded measurements. Clients requesting the
+ * same options share the same stream, so each distinct payload is computed once per published sample.
  *
  * Parameters required by this device are shown in class: MultipleAnalogSensorsServer_ParamsParser
  */
@@ -34,6 +45,7 @@ class MultipleAnalogSensorsServer :
         public yarp::os::PeriodicThread,
         public yarp::dev::DeviceDriver,
         public yarp::dev::WrapperSingle,
+        public yarp::dev::IDataReadyListener,
         public MultipleAnalogSensorsMetadata,
         public MultipleAnalogSensorsServer_ParamsParser
 {
@@ -46,6 +58,28 @@ class MultipleAnalogSensorsServer :
     // Generic vector buffer
     yarp::sig::Vector m_buffer;
 
+    // Streams requested by the clients through the subscribe RPC, indexed by port name
+    struct SubscriptionStream
+    {
+        SensorSubscription subscription;
+        yarp::os::BufferedPort<SensorStreamingData> port;
+        // For each sensor type, the indices of the streamed sensors
+        std::vector<std::vector<size_t>> selectedSensors;
+        size_t nrOfClients{0};
+        size_t nrOfConnections{0};
+        size_t nrOfSamples{0};
+        size_t nrOfMessagesSinceKeyframe{0};
+        // The previous message may have been dropped, the next one must be a full message
+        bool keyframePending{false};
+        // Last measurements sent to the clients, used for delta encoding
+        SensorStreamingData lastSent;
+    };
+    std::mutex m_subscriptionsMutex;
+    std::map<std::string, std::unique_ptr<SubscriptionStream>> m_subscriptions;
+    size_t m_subscriptionsCounter{0};
+    void closeAllSubscriptions();
+    void streamSubscriptions(const SensorStreamingData& streamingData);
+
     // Interface of the wrapped device
     yarp::dev::IThreeAxisGyroscopes* m_iThreeAxisGyroscopes{nullptr};
     yarp::dev::IThreeAxisLinearAccelerometers* m_iThreeAxisLinearAccelerometers{nullptr};
@@ -59,6 +93,7 @@ class MultipleAnalogSensorsServer :
     yarp::dev::IContactLoadCellArrays* m_iContactLoadCellArrays{nullptr};
     yarp::dev::IEncoderArrays* m_iEncoderArrays{nullptr};
     yarp::dev::ISkinPatches* m_iSkinPatches{nullptr};
+    yarp::dev::IDataReadyNotifier* m_iDataReadyNotifier{nullptr};
 
     // Metadata to be server via the RPC port
     SensorRPCData m_sensorMetadata;
@@ -116,8 +151,13 @@ public:
     void threadRelease() override;
     void run() override;
 
+    /* IDataReadyListener methods */
+    void onDataReady() override;
+
     /* MultipleAnalogSensorsMetadata */
     SensorRPCData getMetadata() override;
+    std::string subscribe(const SensorSubscription& subscription) override;
+    bool unsubscribe(const std::string& portName) override;
 };
 
 #endif
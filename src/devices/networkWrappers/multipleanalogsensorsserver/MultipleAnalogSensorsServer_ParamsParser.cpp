@@ -8,7 +8,7 @@
 // This is an automatically generated file. Please do not edit it.
 // It will be re-generated if the cmake flag ALLOW_DEVICE_PARAM_PARSER_GERNERATION is ON.
 
-// Generated on: Thu May 22 11:32:42 2025
+// Generated on: Mon Oct 19 03:56:54 2026
 
 
 #include "MultipleAnalogSensorsServer_ParamsParser.h"
@@ -30,6 +30,7 @@ std::vector<std::string> MultipleAnalogSensorsServer_ParamsParser::getListOfPara
     std::vector<std::string> params;
     params.push_back("name");
     params.push_back("period");
+    params.push_back("publish_on_new_data");
     return params;
 }
 
@@ -46,6 +47,12 @@ bool MultipleAnalogSensorsServer_ParamsParser::getParamValue(const std::string&
         paramValue = std::to_string(m_period);
         return true;
     }
+    if (paramName =="publish_on_new_data")
+    {
+        if (m_publish_on_new_data==true) paramValue = "true";
+        else paramValue = "false";
+        return true;
+    }
 
     yError() <<"parameter '" << paramName << "' was not found";
     return false;
@@ -106,6 +113,20 @@ bool      MultipleAnalogSensorsServer_ParamsParser::parseParams(const yarp::os::
         prop_check.unput("period");
     }
 
+    //Parser of parameter publish_on_new_data
+    {
+        if (config.check("publish_on_new_data"))
+        {
+            m_publish_on_new_data = config.find("publish_on_new_data").asBool();
+            yCInfo(MultipleAnalogSensorsServerParamsCOMPONENT) << "Parameter 'publish_on_new_data' using value:" << m_publish_on_new_data;
+        }
+        else
+        {
+            yCInfo(MultipleAnalogSensorsServerParamsCOMPONENT) << "Parameter 'publish_on_new_data' using DEFAULT value:" << m_publish_on_new_data;
+        }
+        prop_check.unput("publish_on_new_data");
+    }
+
     /*
     //This code check if the user set some parameter which are not check by the parser
     //If the parser is set in strict mode, this will generate an error
@@ -144,9 +165,10 @@ std::string      MultipleAnalogSensorsServer_ParamsParser::getDocumentationOfDev
     doc = doc + std::string("This is the list of the parameters accepted by the device:\n");
     doc = doc + std::string("'name': Prefix of the port opened by this device\n");
     doc = doc + std::string("'period': Refresh period of the broadcasted values in ms\n");
+    doc = doc + std::string("'publish_on_new_data': Publish each sample as soon as the attached device notifies it (IDataReadyNotifier), instead of periodically\n");
     doc = doc + std::string("\n");
     doc = doc + std::string("Here are some examples of invocation command with yarpdev, with all params:\n");
-    doc = doc + " yarpdev --device multipleanalogsensorsserver --name <mandatory_value> --period <mandatory_value>\n";
+    doc = doc + " yarpdev --device multipleanalogsensorsserver --name <mandatory_value> --period <mandatory_value> --publish_on_new_data true\n";
     doc = doc + std::string("Using only mandatory params:\n");
     doc = doc + " yarpdev --device multipleanalogsensorsserver --name <mandatory_value> --period <mandatory_value>\n";
     doc = doc + std::string("=============================================\n\n");    return doc;
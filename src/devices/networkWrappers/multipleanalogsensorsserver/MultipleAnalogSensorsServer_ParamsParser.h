@@ -8,7 +8,7 @@
 // This is an automatically generated file. Please do not edit it.
 // It will be re-generated if the cmake flag ALLOW_DEVICE_PARAM_PARSER_GERNERATION is ON.
 
-// Generated on: Thu May 22 11:32:42 2025
+// Generated on: Mon Oct 19 03:56:54 2026
 
 
 #ifndef MULTIPLEANALOGSENSORSSERVER_PARAMSPARSER_H
@@ -23,14 +23,15 @@
 * This class is the parameters parser for class MultipleAnalogSensorsServer.
 *
 * These are the used parameters:
-* | Group name | Parameter name | Type   | Units | Default Value | Required | Description                                    | Notes                           |
-* |:----------:|:--------------:|:------:|:-----:|:-------------:|:--------:|:----------------------------------------------:|:-------------------------------:|
-* | -          | name           | string | -     | -             | 1        | Prefix of the port opened by this device       | MUST start with a '/' character |
-* | -          | period         | int    | ms    | -             | 1        | Refresh period of the broadcasted values in ms | -                               |
+* | Group name | Parameter name      | Type   | Units | Default Value | Required | Description                                                                                                  | Notes                           |
+* |:----------:|:-------------------:|:------:|:-----:|:-------------:|:--------:|:------------------------------------------------------------------------------------------------------------:|:-------------------------------:|
+* | -          | name                | string | -     | -             | 1        | Prefix of the port opened by this device                                                                     | MUST start with a '/' character |
+* | -          | period              | int    | ms    | -             | 1        | Refresh period of the broadcasted values in ms                                                               | -                               |
+* | -          | publish_on_new_data | bool   | -     | true          | 0        | Publish each sample as soon as the attached device notifies it (IDataReadyNotifier), instead of periodically | -                               |
 *
 * The device can be launched by yarpdev using one of the following examples (with and without all optional parameters):
 * \code{.unparsed}
-* yarpdev --device multipleanalogsensorsserver --name <mandatory_value> --period <mandatory_value>
+* yarpdev --device multipleanalogsensorsserver --name <mandatory_value> --period <mandatory_value> --publish_on_new_data true
 * \endcode
 *
 * \code{.unparsed}
@@ -60,9 +61,11 @@ public:
 
     const std::string m_name_defaultValue = {""};
     const std::string m_period_defaultValue = {""};
+    const std::string m_publish_on_new_data_defaultValue = {"true"};
 
     std::string m_name = {}; //This default value is autogenerated. It is highly recommended to provide a suggested value also for mandatory parameters.
     int m_period = {0}; //This default value is autogenerated. It is highly recommended to provide a suggested value also for mandatory parameters.
+    bool m_publish_on_new_data = {true};
 
     bool          parseParams(const yarp::os::Searchable & config) override;
     std::string   getDeviceClassName() const override { return m_device_classname; }
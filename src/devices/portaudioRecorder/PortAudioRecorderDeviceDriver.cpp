@@ -100,6 +100,11 @@ static int bufferIOCallback( const void *inputBuffer, void *outputBuffer,
                 }
             }
         }
+        else if (sizeof(SAMPLE) == sizeof(unsigned short))
+        {
+            //same sample format: copy the whole (interleaved) block at once
+            recdata->write(reinterpret_cast<const unsigned short*>(rptr), framesToCalc * num_rec_channels);
+        }
         else
         {
             for( size_t i=0; i<framesToCalc; i++ )
@@ -110,6 +115,8 @@ static int bufferIOCallback( const void *inputBuffer, void *outputBuffer,
                 }
             }
         }
+        //wake up the consumer waiting in getSound()
+        recdata->notify();
         return finished;
     }
 
@@ -10,12 +10,19 @@
 #include <yarp/os/Carriers.h>
 #include <yarp/os/LogStream.h>
 #include <yarp/os/Network.h>
+#include <yarp/os/Route.h>
 #include <yarp/os/Value.h>
 
+#include <fstream>
+#include <sstream>
+#include <vector>
+
 using yarp::companion::impl::Companion;
 using yarp::os::Bottle;
 using yarp::os::Carriers;
+using yarp::os::ContactStyle;
 using yarp::os::NetworkBase;
+using yarp::os::Route;
 using yarp::os::Value;
 
 
@@ -31,6 +38,44 @@ std::string slashify(const std::string& src)
     return std::string("/") + src;
 }
 
+/*
+ * Read a file with one connection per line, in the same format as the
+ * arguments of "yarp connect" (OUTPUT_PORT INPUT_PORT [CARRIER]).
+ * Empty lines and lines starting with '#' are ignored.
+ */
+bool readConnectionFile(const std::string& filename, std::vector<Route>& routes)
+{
+    std::ifstream fin(filename);
+    if (!fin.is_open()) {
+        yCError(COMPANION, "Cannot open connection file %s", filename.c_str());
+        return false;
+    }
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(fin, line)) {
+        lineNumber++;
+        std::istringstream ss(line);
+        std::vector<std::string> fields;
+        std::string field;
+        while (ss >> field) {
+            fields.push_back(field);
+        }
+        if (fields.empty() || fields[0][0] == '#') {
+            continue;
+        }
+        if (fields.size() < 2 || fields.size() > 3) {
+            yCError(COMPANION, "%s:%zu: expected OUTPUT_PORT INPUT_PORT [CARRIER]", filename.c_str(), lineNumber);
+            return false;
+        }
+        std::string dest = fields[1];
+        if (fields.size() == 3) {
+            dest = fields[2] + ":/" + slashify(dest);
+        }
+        routes.emplace_back(fields[0], dest, "");
+    }
+    return true;
+}
+
 } // namespace
 
 
@@ -48,6 +93,32 @@ int Companion::connect(const char *src, const char *dest, bool silent)
 }
 
 
+/**
+ * Make all the connections listed in a file, see connectMany().
+ * @param filename the connection file
+ * @return 0 if all the connections were made, non-zero otherwise
+ */
+int Companion::connectFromFile(const char *filename)
+{
+    std::vector<Route> routes;
+    if (!readConnectionFile(filename, routes)) {
+        return 1;
+    }
+    ContactStyle style;
+    style.quiet = false;
+    std::vector<bool> results = NetworkBase::connectMany(routes, style);
+    size_t failed = 0;
+    for (size_t i = 0; i < routes.size(); i++) {
+        if (!results[i]) {
+            yCError(COMPANION, "Failed to connect %s to %s", routes[i].getFromName().c_str(), routes[i].getToName().c_str());
+            failed++;
+        }
+    }
+    yCInfo(COMPANION, "%zu of %zu connections made", routes.size() - failed, routes.size());
+    return (failed == 0) ? 0 : 1;
+}
+
+
 int Companion::subscribe(const char *src, const char *dest, const char *mode)
 {
     Bottle cmd;
@@ -122,6 +193,12 @@ int Companion::cmdConnect(int argc, char *argv[])
             }
             yCInfo(COMPANION);
             return 0;
+        } else if (arg=="--file") {
+            if (argc!=2) {
+                yCError(COMPANION, "Usage: yarp connect --file CONNECTION_FILE");
+                return 1;
+            }
+            return connectFromFile(argv[1]);
         } else if (arg=="--help") {
             yCInfo(COMPANION, "USAGE:");
             yCInfo(COMPANION, "yarp connect OUTPUT_PORT INPUT_PORT");
@@ -143,6 +220,11 @@ int Companion::cmdConnect(int argc, char *argv[])
             yCInfo(COMPANION, "  Ask the name server to connect the OUTPUT_PORT whenever available to the");
             yCInfo(COMPANION, "  INPUT_PORT which exists at the time the connection is requested.  The ");
             yCInfo(COMPANION, "  request expires when INPUT_PORT is closed.");
+            yCInfo(COMPANION, "yarp connect --file CONNECTION_FILE");
+            yCInfo(COMPANION, "  Make all the connections listed in a file, one per line, in the form");
+            yCInfo(COMPANION, "  OUTPUT_PORT INPUT_PORT [CARRIER]. Lines starting with '#' are ignored.");
+            yCInfo(COMPANION, "  The name server lookups are batched, and the connections are made in parallel.");
+            yCInfo(COMPANION);
             yCInfo(COMPANION, "yarp connect --list-carriers");
             yCInfo(COMPANION, "  List carriers available for connections.");
             return 0;
@@ -59,6 +59,7 @@ public:
     // Defined in Companion.cmdConnect.cpp
     static int connect(const char *src, const char *dest, bool silent = false);
     static int subscribe(const char *src, const char *dest, const char *mode = nullptr);
+    static int connectFromFile(const char *filename);
     int cmdConnect(int argc, char *argv[]);
 
     // Defined in Companion.cmdDisconnect.cpp
@@ -30,4 +30,5 @@ struct OdometryData
 } (
     yarp.api.include = "yarp/dev/api.h"
     yarp.api.keyword = "YARP_dev_API"
+    yarp.bulk = "true"
 )
@@ -48,4 +48,5 @@ struct OdometryData6D
 } (
     yarp.api.include = "yarp/dev/api.h"
     yarp.api.keyword = "YARP_dev_API"
+    yarp.bulk = "true"
 )
@@ -10,6 +10,8 @@
 
 #include <yarp/dev/OdometryData.h>
 
+#include <yarp/os/idl/WirePacked.h>
+
 namespace yarp::dev {
 
 // Constructor with field values
@@ -38,32 +40,22 @@ OdometryData::OdometryData(const double odom_x,
 // Read structure on a Wire
 bool OdometryData::read(yarp::os::idl::WireReader& reader)
 {
-    if (!read_odom_x(reader)) {
-        return false;
-    }
-    if (!read_odom_y(reader)) {
-        return false;
-    }
-    if (!read_odom_theta(reader)) {
-        return false;
-    }
-    if (!read_base_vel_x(reader)) {
-        return false;
-    }
-    if (!read_base_vel_y(reader)) {
-        return false;
-    }
-    if (!read_base_vel_theta(reader)) {
-        return false;
-    }
-    if (!read_odom_vel_x(reader)) {
-        return false;
-    }
-    if (!read_odom_vel_y(reader)) {
-        return false;
-    }
-    if (!read_odom_vel_theta(reader)) {
-        return false;
+    // Read fields from odom_x to odom_vel_theta as a single block
+    {
+        yarp::os::idl::WirePacked<108> packed;
+        if (!packed.read(reader, {BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64})
+                || !packed.readFloat64(odom_x)
+                || !packed.readFloat64(odom_y)
+                || !packed.readFloat64(odom_theta)
+                || !packed.readFloat64(base_vel_x)
+                || !packed.readFloat64(base_vel_y)
+                || !packed.readFloat64(base_vel_theta)
+                || !packed.readFloat64(odom_vel_x)
+                || !packed.readFloat64(odom_vel_y)
+                || !packed.readFloat64(odom_vel_theta)) {
+            reader.fail();
+            return false;
+        }
     }
     if (reader.isError()) {
         return false;
@@ -87,32 +79,21 @@ bool OdometryData::read(yarp::os::ConnectionReader& connection)
 // Write structure on a Wire
 bool OdometryData::write(const yarp::os::idl::WireWriter& writer) const
 {
-    if (!write_odom_x(writer)) {
-        return false;
-    }
-    if (!write_odom_y(writer)) {
-        return false;
-    }
-    if (!write_odom_theta(writer)) {
-        return false;
-    }
-    if (!write_base_vel_x(writer)) {
-        return false;
-    }
-    if (!write_base_vel_y(writer)) {
-        return false;
-    }
-    if (!write_base_vel_theta(writer)) {
-        return false;
-    }
-    if (!write_odom_vel_x(writer)) {
-        return false;
-    }
-    if (!write_odom_vel_y(writer)) {
-        return false;
-    }
-    if (!write_odom_vel_theta(writer)) {
-        return false;
+    // Write fields from odom_x to odom_vel_theta as a single block
+    {
+        yarp::os::idl::WirePacked<108> packed;
+        packed.writeFloat64(odom_x);
+        packed.writeFloat64(odom_y);
+        packed.writeFloat64(odom_theta);
+        packed.writeFloat64(base_vel_x);
+        packed.writeFloat64(base_vel_y);
+        packed.writeFloat64(base_vel_theta);
+        packed.writeFloat64(odom_vel_x);
+        packed.writeFloat64(odom_vel_y);
+        packed.writeFloat64(odom_vel_theta);
+        if (!packed.write(writer)) {
+            return false;
+        }
     }
     if (writer.isError()) {
         return false;
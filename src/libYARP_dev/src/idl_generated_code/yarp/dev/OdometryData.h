@@ -60,6 +60,9 @@ public:
      */
     double odom_vel_theta{0.0};
 
+    // Size of the structure on a Connection [bytes]
+    static constexpr size_t wireSize = 116;
+
     // Default constructor
     OdometryData() = default;
 
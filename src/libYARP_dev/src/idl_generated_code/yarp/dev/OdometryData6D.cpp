@@ -10,6 +10,8 @@
 
 #include <yarp/dev/OdometryData6D.h>
 
+#include <yarp/os/idl/WirePacked.h>
+
 namespace yarp::dev {
 
 // Constructor with field values
@@ -56,59 +58,31 @@ OdometryData6D::OdometryData6D(const double odom_x,
 // Read structure on a Wire
 bool OdometryData6D::read(yarp::os::idl::WireReader& reader)
 {
-    if (!read_odom_x(reader)) {
-        return false;
-    }
-    if (!read_odom_y(reader)) {
-        return false;
-    }
-    if (!read_odom_z(reader)) {
-        return false;
-    }
-    if (!read_odom_roll(reader)) {
-        return false;
-    }
-    if (!read_odom_pitch(reader)) {
-        return false;
-    }
-    if (!read_odom_yaw(reader)) {
-        return false;
-    }
-    if (!read_base_vel_x(reader)) {
-        return false;
-    }
-    if (!read_base_vel_y(reader)) {
-        return false;
-    }
-    if (!read_base_vel_z(reader)) {
-        return false;
-    }
-    if (!read_base_vel_roll(reader)) {
-        return false;
-    }
-    if (!read_base_vel_pitch(reader)) {
-        return false;
-    }
-    if (!read_base_vel_yaw(reader)) {
-        return false;
-    }
-    if (!read_odom_vel_x(reader)) {
-        return false;
-    }
-    if (!read_odom_vel_y(reader)) {
-        return false;
-    }
-    if (!read_odom_vel_z(reader)) {
-        return false;
-    }
-    if (!read_odom_vel_roll(reader)) {
-        return false;
-    }
-    if (!read_odom_vel_pitch(reader)) {
-        return false;
-    }
-    if (!read_odom_vel_yaw(reader)) {
-        return false;
+    // Read fields from odom_x to odom_vel_yaw as a single block
+    {
+        yarp::os::idl::WirePacked<216> packed;
+        if (!packed.read(reader, {BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64, BOTTLE_TAG_FLOAT64})
+                || !packed.readFloat64(odom_x)
+                || !packed.readFloat64(odom_y)
+                || !packed.readFloat64(odom_z)
+                || !packed.readFloat64(odom_roll)
+                || !packed.readFloat64(odom_pitch)
+                || !packed.readFloat64(odom_yaw)
+                || !packed.readFloat64(base_vel_x)
+                || !packed.readFloat64(base_vel_y)
+                || !packed.readFloat64(base_vel_z)
+                || !packed.readFloat64(base_vel_roll)
+                || !packed.readFloat64(base_vel_pitch)
+                || !packed.readFloat64(base_vel_yaw)
+                || !packed.readFloat64(odom_vel_x)
+                || !packed.readFloat64(odom_vel_y)
+                || !packed.readFloat64(odom_vel_z)
+                || !packed.readFloat64(odom_vel_roll)
+                || !packed.readFloat64(odom_vel_pitch)
+                || !packed.readFloat64(odom_vel_yaw)) {
+            reader.fail();
+            return false;
+        }
     }
     if (reader.isError()) {
         return false;
@@ -132,59 +106,30 @@ bool OdometryData6D::read(yarp::os::ConnectionReader& connection)
 // Write structure on a Wire
 bool OdometryData6D::write(const yarp::os::idl::WireWriter& writer) const
 {
-    if (!write_odom_x(writer)) {
-        return false;
-    }
-    if (!write_odom_y(writer)) {
-        return false;
-    }
-    if (!write_odom_z(writer)) {
-        return false;
-    }
-    if (!write_odom_roll(writer)) {
-        return false;
-    }
-    if (!write_odom_pitch(writer)) {
-        return false;
-    }
-    if (!write_odom_yaw(writer)) {
-        return false;
-    }
-    if (!write_base_vel_x(writer)) {
-        return false;
-    }
-    if (!write_base_vel_y(writer)) {
-        return false;
-    }
-    if (!write_base_vel_z(writer)) {
-        return false;
-    }
-    if (!write_base_vel_roll(writer)) {
-        return false;
-    }
-    if (!write_base_vel_pitch(writer)) {
-        return false;
-    }
-    if (!write_base_vel_yaw(writer)) {
-        return false;
-    }
-    if (!write_odom_vel_x(writer)) {
-        return false;
-    }
-    if (!write_odom_vel_y(writer)) {
-        return false;
-    }
-    if (!write_odom_vel_z(writer)) {
-        return false;
-    }
-    if (!write_odom_vel_roll(writer)) {
-        return false;
-    }
-    if (!write_odom_vel_pitch(writer)) {
-        return false;
-    }
-    if (!write_odom_vel_yaw(writer)) {
-        return false;
+    // Write fields from odom_x to odom_vel_yaw as a single block
+    {
+        yarp::os::idl::WirePacked<216> packed;
+        packed.writeFloat64(odom_x);
+        packed.writeFloat64(odom_y);
+        packed.writeFloat64(odom_z);
+        packed.writeFloat64(odom_roll);
+        packed.writeFloat64(odom_pitch);
+        packed.writeFloat64(odom_yaw);
+        packed.writeFloat64(base_vel_x);
+        packed.writeFloat64(base_vel_y);
+        packed.writeFloat64(base_vel_z);
+        packed.writeFloat64(base_vel_roll);
+        packed.writeFloat64(base_vel_pitch);
+        packed.writeFloat64(base_vel_yaw);
+        packed.writeFloat64(odom_vel_x);
+        packed.writeFloat64(odom_vel_y);
+        packed.writeFloat64(odom_vel_z);
+        packed.writeFloat64(odom_vel_roll);
+        packed.writeFloat64(odom_vel_pitch);
+        packed.writeFloat64(odom_vel_yaw);
+        if (!packed.write(writer)) {
+            return false;
+        }
     }
     if (writer.isError()) {
         return false;
@@ -96,6 +96,9 @@ public:
      */
     double odom_vel_yaw{0.0};
 
+    // Size of the structure on a Connection [bytes]
+    static constexpr size_t wireSize = 224;
+
     // Default constructor
     OdometryData6D() = default;
 
@@ -5,6 +5,8 @@
 
 #include <yarp/dev/AudioRecorderDeviceBase.h>
 #include <yarp/os/LogStream.h>
+#include <algorithm>
+#include <chrono>
 #include <mutex>
 #include <limits>
 #include <functional>
@@ -13,7 +15,8 @@ using namespace yarp::os;
 using namespace yarp::dev;
 using namespace yarp::sig;
 
-constexpr double c_sleep_time=0.005;
+constexpr double c_recording_wait_msg_period=5.0;
+constexpr double c_buffer_wait_msg_period=1.0;
 
 YARP_LOG_COMPONENT(AUDIORECORDER_BASE, "yarp.devices.AudioRecorderDeviceBase")
 
@@ -28,6 +31,12 @@ YARP_LOG_COMPONENT(AUDIORECORDER_BASE, "yarp.devices.AudioRecorderDeviceBase")
 
 ReturnValue AudioRecorderDeviceBase::getSound(yarp::sig::Sound& sound, size_t min_number_of_samples, size_t max_number_of_samples, double max_samples_timeout_s)
 {
+    if (m_inputBuffer == nullptr)
+    {
+        yCError(AUDIORECORDER_BASE) << "getSound() called, but no audio buffer is allocated yet";
+        return ReturnValue::return_code::return_value_error_not_ready;
+    }
+
     //check for something_to_record
     {
     #if AUTOMATIC_REC_START
@@ -36,16 +45,15 @@ ReturnValue AudioRecorderDeviceBase::getSound(yarp::sig::Sound& sound, size_t mi
     this->startRecording();
     }
     #else
-    double debug_time = yarp::os::Time::now();
+    std::unique_lock<std::mutex> lock(m_mutex);
     while (m_recording_enabled == false)
     {
-        if (yarp::os::Time::now() - debug_time > 5.0)
+        //startRecording() wakes us up, the timeout is used only to periodically print the message
+        if (!m_recording_cv.wait_for(lock, std::chrono::duration<double>(c_recording_wait_msg_period), [this]() { return m_recording_enabled.load(); }))
         {
             yCInfo(AUDIORECORDER_BASE) << "getSound() is currently waiting. Use startRecording() to start the audio stream";
-            debug_time = yarp::os::Time::now();
-        }
-        yarp::os::SystemClock::delaySystem(c_sleep_time);
         }
+    }
     #endif
     }
 
@@ -64,23 +72,37 @@ ReturnValue AudioRecorderDeviceBase::getSound(yarp::sig::Sound& sound, size_t mi
         max_number_of_samples = this->m_audiorecorder_cfg.numSamples;
     }
 
-    //wait until the desired number of samples are obtained
+    //wait until the desired number of samples are obtained.
+    //The producer (the device driver) notifies the circular buffer every time a new block of samples is written,
+    //and stopRecording() notifies it too, so the thread sleeps until new data is available.
+    //In low latency mode, the method returns as soon as min_number_of_samples are available.
     size_t buff_size = 0;
+    size_t target_samples = m_low_latency ? std::max<size_t>(min_number_of_samples, 1) : max_number_of_samples;
     double start_time = yarp::os::Time::now();
-    double debug_time = yarp::os::Time::now();
+    double debug_time = start_time;
     do
     {
         buff_size = m_inputBuffer->size().getSamples();
         if (buff_size >= max_number_of_samples) { break; }
-        if (buff_size >= min_number_of_samples && yarp::os::Time::now() - start_time > max_samples_timeout_s) { break; }
+        if (m_low_latency && buff_size >= target_samples) { break; }
+        double now = yarp::os::Time::now();
+        if (buff_size >= min_number_of_samples && now - start_time > max_samples_timeout_s) { break; }
         if (m_recording_enabled == false) { break; }
 
-        if (yarp::os::Time::now() - debug_time > 1.0)
+        if (now - debug_time > 1.0)
         {
-            debug_time = yarp::os::Time::now();
+            debug_time = now;
             yCDebug(AUDIORECORDER_BASE) << "getSound() Buffer size is " << buff_size << "/" << max_number_of_samples << " after 1s";
         }
-        yarp::os::SystemClock::delaySystem(c_sleep_time);
+
+        //until min_number_of_samples are available there is no timeout, the thread wakes up
+        //only to print the debug message
+        double wait_time = c_buffer_wait_msg_period;
+        if (buff_size >= min_number_of_samples)
+        {
+            wait_time = std::max(start_time + max_samples_timeout_s - now, 0.0);
+        }
+        m_inputBuffer->waitForSamples(target_samples, wait_time, [this]() { return !m_recording_enabled; });
     } while (true);
 
     //prepare the sound data struct
@@ -88,9 +110,10 @@ ReturnValue AudioRecorderDeviceBase::getSound(yarp::sig::Sound& sound, size_t mi
     if (samples_to_be_copied > max_number_of_samples) {
         samples_to_be_copied = max_number_of_samples;
     }
-    if (sound.getChannels() != this->m_audiorecorder_cfg.numChannels || sound.getSamples() != samples_to_be_copied)
+    const size_t num_channels = this->m_audiorecorder_cfg.numChannels;
+    if (sound.getChannels() != num_channels || sound.getSamples() != samples_to_be_copied)
     {
-        sound.resize(samples_to_be_copied, this->m_audiorecorder_cfg.numChannels);
+        sound.resize(samples_to_be_copied, num_channels);
     }
     sound.setFrequency(this->m_audiorecorder_cfg.frequency);
 
@@ -98,24 +121,29 @@ ReturnValue AudioRecorderDeviceBase::getSound(yarp::sig::Sound& sound, size_t mi
     #if DEBUG_TIME_SPENT
     double ct1 = yarp::os::Time::now();
     #endif
-    for (size_t i = 0; i < samples_to_be_copied; i++)
+    //the circular buffer stores the samples interleaved, while the sound stores them channel by channel:
+    //read the whole block with a single copy, then deinterleave it.
+    m_rec_block.resize(samples_to_be_copied * num_channels);
+    size_t elements_read = m_inputBuffer->read(m_rec_block.data(), m_rec_block.size());
+    std::fill(m_rec_block.begin() + elements_read, m_rec_block.end(), 0);
+
+    const int16_t max_val = std::numeric_limits<int16_t>::max() - m_cliptol;
+    const int16_t min_val = std::numeric_limits<int16_t>::min() + m_cliptol;
+    const auto* block = reinterpret_cast<const Sound::audio_sample*>(m_rec_block.data());
+    bool clipped = false;
+    for (size_t i = 0; i < m_rec_block.size(); i++)
     {
-        for (size_t j = 0; j < this->m_audiorecorder_cfg.numChannels; j++)
-        {
-            int16_t s = (int16_t)(m_inputBuffer->read());
-            if (s > (std::numeric_limits<int16_t>::max() - m_cliptol) ||
-                s < (std::numeric_limits<int16_t>::min() + m_cliptol))
-            {
-                yCWarningThrottle(AUDIORECORDER_BASE, 0.1) << "Sound clipped!";
-            }
-            sound.set(s, i, j);
-        }
+        clipped |= (block[i] > max_val || block[i] < min_val);
+    }
+    if (clipped)
+    {
+        yCWarningThrottle(AUDIORECORDER_BASE, 0.1) << "Sound clipped!";
     }
+    sound.setInterleavedAudioRawData(block);
 
     //amplify if required
     if (m_sw_gain!=1.0) {sound.amplify(m_sw_gain);}
 
-    auto debug_p = sound.getInterleavedAudioRawData();
     #if DEBUG_TIME_SPENT
     double ct2 = yarp::os::Time::now();
     yCDebug(AUDIORECORDER_BASE) << ct2 - ct1;
@@ -181,6 +209,7 @@ ReturnValue AudioRecorderDeviceBase::startRecording()
     {
         this->m_inputBuffer->clear();
     }
+    m_recording_cv.notify_all();
     yCInfo(AUDIORECORDER_BASE) << "Recording started";
     return ReturnValue_ok;
 }
@@ -195,6 +224,11 @@ ReturnValue AudioRecorderDeviceBase::stopRecording()
         //which has been partially captured until the stopRecording has been called.
         //this->m_inputBuffer->clear();
     }
+    if (this->m_inputBuffer)
+    {
+        //wake up getSound(), which will return the samples captured so far
+        this->m_inputBuffer->notify();
+    }
     yCInfo(AUDIORECORDER_BASE) << "Recording stopped";
     return ReturnValue_ok;
 }
@@ -251,6 +285,11 @@ bool AudioRecorderDeviceBase::configureRecorderAudioDevice(yarp::os::Searchable&
     //additional options
     m_enable_buffer_autoclear = config.check("buffer_autoclear", Value(true), "Automatically clear the buffer every time the devices is started/stopped").asBool();
     m_audiobase_debug         = config.check("debug", Value(false), "Enable debug mode").asBool();
+    m_low_latency             = config.check("low_latency", Value(false), "getSound() returns as soon as the minimum number of samples is available").asBool();
+    if (m_low_latency)
+    {
+        yCInfo(AUDIORECORDER_BASE) << "Low latency mode enabled";
+    }
 
     return true;
 }
@@ -9,6 +9,8 @@
 #include <yarp/dev/AudioGrabberInterfaces.h>
 #include <yarp/dev/api.h>
 #include <yarp/dev/CircularAudioBuffer.h>
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
 
 #ifndef YARP_DEV_AUDIORECORDERDEVICETEMPLATE_H
@@ -39,6 +41,7 @@ class AudioDeviceDriverSettings
 * | AUDIO_BASE       |  sw_gain          | double  | -              | 1.0                      | No                          | A SW gain for audio waveform amplification | - |
 * | AUDIO_BASE       |  buffer_autoclear | bool    | -              | true                     | No                          | Automatically clear the buffer every time the devices is started/stopped | - |
 * | AUDIO_BASE       |  debug            | bool    | -              | false                    | No                          | Enable debug mode | The value is stored into variable m_audiobase_debug |
+* | AUDIO_BASE       |  low_latency      | bool    | -              | false                    | No                          | getSound() returns as soon as min_number_of_samples are available, without waiting for max_number_of_samples | - |
 *
 * See \ref AudioDoc for additional documentation on YARP audio.
 */
@@ -47,14 +50,19 @@ class YARP_dev_API AudioRecorderDeviceBase : public yarp::dev::IAudioGrabberSoun
 {
 protected:
     bool            m_enable_buffer_autoclear = false;
-    bool            m_recording_enabled = false;
+    std::atomic<bool> m_recording_enabled {false};
     std::mutex      m_mutex;
+    std::condition_variable m_recording_cv;
     yarp::dev::CircularAudioBuffer_16t* m_inputBuffer = nullptr;
     double          m_sw_gain = 1.0;
     double          m_hw_gain = 1.0;
     AudioDeviceDriverSettings m_audiorecorder_cfg;
     bool            m_audiobase_debug = false;
     int16_t         m_cliptol = 3;
+    bool            m_low_latency = false;
+
+private:
+    std::vector<unsigned short> m_rec_block;
 
 public:
     virtual yarp::dev::ReturnValue getSound(yarp::sig::Sound& sound, size_t min_number_of_samples, size_t max_number_of_samples, double max_samples_timeout_s) override;
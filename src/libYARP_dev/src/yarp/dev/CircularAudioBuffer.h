@@ -8,7 +8,13 @@
 
 #include <yarp/os/Log.h>
 #include <yarp/sig/AudioBufferSize.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
+#include <cstring>
+#include <mutex>
 #include <string>
 
 #include <yarp/os/LogStream.h>
@@ -21,10 +27,15 @@ class CircularAudioBuffer
 {
     std::string name;
     yarp::sig::AudioBufferSize maxsize;
-    size_t start;
-    size_t end;
+    std::atomic<size_t> start;
+    std::atomic<size_t> end;
     SAMPLE *elems=nullptr;
 
+    // used to wake up the consumers waiting for new samples (see waitForSamples())
+    std::mutex              notify_mutex;
+    std::condition_variable notify_cv;
+    size_t                  notify_count = 0;
+
     public:
     bool isFull()
     {
@@ -52,15 +63,121 @@ class CircularAudioBuffer
         }
     }
 
+    /**
+     * Writes a block of (interleaved) elements into the buffer.
+     * If the block does not fit in the free space, the oldest elements are overwritten.
+     * Waiting consumers are notified once the whole block has been written.
+     * @param data pointer to the elements to be written
+     * @param count the number of elements (i.e. samples*channels) to be written
+     */
+    void write(const SAMPLE* data, size_t count)
+    {
+        const size_t capacity = maxsize.getBufferElements();
+        if (count >= capacity)
+        {
+            // only the most recent elements can be kept
+            printf ("ERROR: %s buffer overrun!\n", name.c_str());
+            data += count - (capacity - 1);
+            count = capacity - 1;
+            start = 0;
+            end = 0;
+        }
+        size_t used = (end >= start) ? (end - start) : (capacity - start + end);
+        size_t e = end;
+        size_t first_chunk = std::min(count, capacity - e);
+        memcpy(elems + e, data, first_chunk * sizeof(SAMPLE));
+        memcpy(elems, data + first_chunk, (count - first_chunk) * sizeof(SAMPLE));
+        if (used + count >= capacity)
+        {
+            printf ("ERROR: %s buffer overrun!\n", name.c_str());
+            start = (e + count + 1) % capacity; // full, overwrite
+        }
+        end = (e + count) % capacity;
+        notify();
+    }
+
+    /**
+     * Reads a block of (interleaved) elements from the buffer.
+     * @param data pointer to the destination memory, which must be able to hold count elements
+     * @param count the number of elements (i.e. samples*channels) to be read
+     * @return the number of elements actually read (it is less than count if the buffer does not contain enough data)
+     */
+    size_t read(SAMPLE* data, size_t count)
+    {
+        const size_t capacity = maxsize.getBufferElements();
+        size_t s = start;
+        size_t e = end;
+        size_t available = (e >= s) ? (e - s) : (capacity - s + e);
+        if (count > available)
+        {
+            printf ("ERROR: %s buffer underrun!\n", name.c_str());
+            count = available;
+        }
+        size_t first_chunk = std::min(count, capacity - s);
+        memcpy(data, elems + s, first_chunk * sizeof(SAMPLE));
+        memcpy(data + first_chunk, elems, (count - first_chunk) * sizeof(SAMPLE));
+        start = (s + count) % capacity;
+        return count;
+    }
+
+    /**
+     * Wakes up all the consumers currently blocked in waitForSamples().
+     * Producers writing one element at time should call this method once a whole
+     * block of samples has been written.
+     */
+    void notify()
+    {
+        {
+            std::lock_guard<std::mutex> lock(notify_mutex);
+            notify_count++;
+        }
+        notify_cv.notify_all();
+    }
+
+    /**
+     * Blocks the caller until the buffer contains at least the requested number of samples,
+     * until notify() is called, or until the timeout expires.
+     * @param samples the number of samples (per channel) to wait for
+     * @param timeout_s the maximum waiting time, in seconds
+     * @return true if the buffer contains at least the requested number of samples
+     */
+    bool waitForSamples(size_t samples, double timeout_s)
+    {
+        return waitForSamples(samples, timeout_s, []() { return false; });
+    }
+
+    /**
+     * Same as waitForSamples(size_t, double), but the caller is not blocked if
+     * the stop predicate is true.
+     * The predicate is evaluated while holding the lock used by notify(), therefore
+     * a condition that is changed before calling notify() is never missed.
+     */
+    template <typename Predicate>
+    bool waitForSamples(size_t samples, double timeout_s, Predicate stop)
+    {
+        std::unique_lock<std::mutex> lock(notify_mutex);
+        if (size().getSamples() >= samples) {
+            return true;
+        }
+        if (timeout_s > 0 && !stop())
+        {
+            size_t count = notify_count;
+            notify_cv.wait_for(lock, std::chrono::duration<double>(timeout_s), [&]() { return notify_count != count || stop(); });
+        }
+        return size().getSamples() >= samples;
+    }
+
     yarp::sig::AudioBufferSize size()
     {
         size_t i;
-        if (end > start) {
-            i = end-start;
-        } else if (end == start) {
+        size_t s = start;
+        size_t e = end;
+        if (e > s) {
+            i = e-s;
+        } else if (e == s) {
             i = 0;
         } else {
-            i = maxsize.getBufferElements() - start + end;
+            i = maxsize.getBufferElements() - s + e;
         }
         return yarp::sig::AudioBufferSize(i/maxsize.getChannels(), maxsize.getChannels(), sizeof(SAMPLE));
     }
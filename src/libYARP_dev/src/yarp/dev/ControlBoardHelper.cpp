@@ -46,6 +46,18 @@ public:
     double *coulombNegToRaws;
     double *velocityThresToRaws;
 
+    // Tables used by the vector conversions from hardware to user units: each entry k
+    // contains the factor of the user axis toUser(k), so that the tables are read sequentially
+    bool    identityAxisMap;
+    double *absAngleToEncoders;
+    double *position_zeros_hw;
+    double *angleToEncoders_hw;
+    double *absAngleToEncoders_hw;
+    double *newtonsToSensors_hw;
+    double *ampereToSensors_hw;
+    double *voltToSensors_hw;
+    double *dutycycleToPWMs_hw;
+
     PidUnits* PosPid_units;
     PidUnits* VelPid_units;
     PidUnits* CurPid_units;
@@ -70,6 +82,15 @@ public:
         coulombPosToRaws(nullptr),
         coulombNegToRaws(nullptr),
         velocityThresToRaws(nullptr),
+        identityAxisMap(false),
+        absAngleToEncoders(nullptr),
+        position_zeros_hw(nullptr),
+        angleToEncoders_hw(nullptr),
+        absAngleToEncoders_hw(nullptr),
+        newtonsToSensors_hw(nullptr),
+        ampereToSensors_hw(nullptr),
+        voltToSensors_hw(nullptr),
+        dutycycleToPWMs_hw(nullptr),
         PosPid_units(nullptr),
         VelPid_units(nullptr),
         CurPid_units(nullptr),
@@ -114,6 +135,14 @@ public:
         checkAndDestroy<double>(coulombPosToRaws);
         checkAndDestroy<double>(coulombNegToRaws);
         checkAndDestroy<double>(velocityThresToRaws);
+        checkAndDestroy<double>(absAngleToEncoders);
+        checkAndDestroy<double>(position_zeros_hw);
+        checkAndDestroy<double>(angleToEncoders_hw);
+        checkAndDestroy<double>(absAngleToEncoders_hw);
+        checkAndDestroy<double>(newtonsToSensors_hw);
+        checkAndDestroy<double>(ampereToSensors_hw);
+        checkAndDestroy<double>(voltToSensors_hw);
+        checkAndDestroy<double>(dutycycleToPWMs_hw);
     }
 
     void alloc(int n)
@@ -139,6 +168,14 @@ public:
         coulombPosToRaws = new double[nj];
         coulombNegToRaws = new double[nj];
         velocityThresToRaws = new double[nj];
+        absAngleToEncoders = new double[nj];
+        position_zeros_hw = new double[nj];
+        angleToEncoders_hw = new double[nj];
+        absAngleToEncoders_hw = new double[nj];
+        newtonsToSensors_hw = new double[nj];
+        ampereToSensors_hw = new double[nj];
+        voltToSensors_hw = new double[nj];
+        dutycycleToPWMs_hw = new double[nj];
 
         yAssert(position_zeros != nullptr);
         yAssert(helper_ones != nullptr);
@@ -160,6 +197,14 @@ public:
         yAssert(coulombPosToRaws != nullptr);
         yAssert(coulombNegToRaws != nullptr);
         yAssert(velocityThresToRaws != nullptr);
+        yAssert(absAngleToEncoders != nullptr);
+        yAssert(position_zeros_hw != nullptr);
+        yAssert(angleToEncoders_hw != nullptr);
+        yAssert(absAngleToEncoders_hw != nullptr);
+        yAssert(newtonsToSensors_hw != nullptr);
+        yAssert(ampereToSensors_hw != nullptr);
+        yAssert(voltToSensors_hw != nullptr);
+        yAssert(dutycycleToPWMs_hw != nullptr);
 
         pid_units[VOCAB_PIDTYPE_POSITION] = PosPid_units;
         pid_units[VOCAB_PIDTYPE_VELOCITY] = VelPid_units;
@@ -167,6 +212,28 @@ public:
         pid_units[VOCAB_PIDTYPE_TORQUE] = TrqPid_units;
     }
 
+    // To be called every time the axis map or the conversion factors change
+    void updateConversionTables()
+    {
+        identityAxisMap = true;
+        for (int j = 0; j < nj; j++)
+        {
+            identityAxisMap = identityAxisMap && (axisMap[j] == j);
+            absAngleToEncoders[j] = fabs(angleToEncoders[j]);
+        }
+        for (int k = 0; k < nj; k++)
+        {
+            int j = invAxisMap[k];
+            position_zeros_hw[k] = position_zeros[j];
+            angleToEncoders_hw[k] = angleToEncoders[j];
+            absAngleToEncoders_hw[k] = absAngleToEncoders[j];
+            newtonsToSensors_hw[k] = newtonsToSensors[j];
+            ampereToSensors_hw[k] = ampereToSensors[j];
+            voltToSensors_hw[k] = voltToSensors[j];
+            dutycycleToPWMs_hw[k] = dutycycleToPWMs[j];
+        }
+    }
+
     PrivateUnitsHandler(const PrivateUnitsHandler& other)
     {
         alloc(other.nj);
@@ -190,9 +257,36 @@ public:
         memcpy(this->coulombPosToRaws, other.coulombPosToRaws, sizeof(*other.coulombPosToRaws)*nj);
         memcpy(this->coulombNegToRaws, other.coulombNegToRaws, sizeof(*other.coulombNegToRaws)*nj);
         memcpy(this->velocityThresToRaws, other.velocityThresToRaws, sizeof(*other.velocityThresToRaws)*nj);
+        updateConversionTables();
     }
 };
 
+namespace {
+/*
+ * Vector conversion kernels: the conversion is applied to the i-th element using the
+ * tables entries at index i, and the result is written at index map[i]. The operations
+ * are the same of the single joint conversions, so the results are identical, but the
+ * tables are read sequentially and, when the axis map is the identity, the loop can be
+ * vectorized by the compiler.
+ */
+template <typename T, typename Conversion>
+inline void convertAndMap(int n, const T* in, const int* map, bool identity, T* out, Conversion conversion)
+{
+    if (identity)
+    {
+        for (int i = 0; i < n; i++) {
+            out[i] = conversion(in[i], i);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < n; i++) {
+            out[map[i]] = conversion(in[i], i);
+        }
+    }
+}
+} // namespace
+
 ControlBoardHelper::ControlBoardHelper(int n, const int *aMap, const double *angToEncs, const double *zs, const double *newtons, const double *amps, const double *volts, const double *dutycycles, const double *kbemf, const double *ktau)
 {
     yAssert(n>=0);         // if number of joints is negative complain!
@@ -241,6 +335,8 @@ ControlBoardHelper::ControlBoardHelper(int n, const int *aMap, const double *ang
             }
         }
     }
+
+    mPriv->updateConversionTables();
 }
 
 ControlBoardHelper::~ControlBoardHelper()
@@ -301,33 +397,29 @@ int ControlBoardHelper::toUser(int axis)
 //map a vector, no conversion
     void ControlBoardHelper::toUser(const double *hwData, double *user)
 {
-    for (int k = 0; k < mPriv->nj; k++) {
-        user[toUser(k)] = hwData[k];
-    }
+    convertAndMap(mPriv->nj, hwData, mPriv->invAxisMap, mPriv->identityAxisMap, user,
+                  [](double v, int) { return v; });
 }
 
 //map a vector, no conversion
 void ControlBoardHelper::ControlBoardHelper::toUser(const int *hwData, int *user)
 {
-    for (int k = 0; k < mPriv->nj; k++) {
-        user[toUser(k)] = hwData[k];
-    }
+    convertAndMap(mPriv->nj, hwData, mPriv->invAxisMap, mPriv->identityAxisMap, user,
+                  [](int v, int) { return v; });
 }
 
 //map a vector, no conversion
     void ControlBoardHelper::toHw(const double *usr, double *hwData)
 {
-    for (int k = 0; k < mPriv->nj; k++) {
-        hwData[toHw(k)] = usr[k];
-    }
+    convertAndMap(mPriv->nj, usr, mPriv->axisMap, mPriv->identityAxisMap, hwData,
+                  [](double v, int) { return v; });
 }
 
 //map a vector, no conversion
 void ControlBoardHelper::toHw(const int *usr, int *hwData)
 {
-    for (int k = 0; k < mPriv->nj; k++) {
-        hwData[toHw(k)] = usr[k];
-    }
+    convertAndMap(mPriv->nj, usr, mPriv->axisMap, mPriv->identityAxisMap, hwData,
+                  [](int v, int) { return v; });
 }
 
 void ControlBoardHelper::posA2E(double ang, int j, double &enc, int &k)
@@ -368,13 +460,10 @@ double ControlBoardHelper::impN2S(double newtons, int j)
 
 void ControlBoardHelper::impN2S(const double *newtons, double *sens)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        impN2S(newtons[j], j, tmp, index);
-        sens[index]=tmp;
-    }
+    const double* trqScale = mPriv->newtonsToSensors;
+    const double* scale = mPriv->angleToEncoders;
+    convertAndMap(mPriv->nj, newtons, mPriv->axisMap, mPriv->identityAxisMap, sens,
+                  [trqScale, scale](double v, int i) { return v* trqScale[i]/ scale[i]; });
 }
 
 void ControlBoardHelper::trqN2S(double newtons, int j, double &sens, int &k)
@@ -391,25 +480,17 @@ double ControlBoardHelper::trqN2S(double newtons, int j)
 //map a vector, convert from newtons to sensors
 void ControlBoardHelper::trqN2S(const double *newtons, double *sens)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        trqN2S(newtons[j], j, tmp, index);
-        sens[index]=tmp;
-    }
+    const double* scale = mPriv->newtonsToSensors;
+    convertAndMap(mPriv->nj, newtons, mPriv->axisMap, mPriv->identityAxisMap, sens,
+                  [scale](double v, int i) { return v* scale[i]; });
 }
 
 //map a vector, convert from sensor to newtons
 void ControlBoardHelper::trqS2N(const double *sens, double *newtons)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        trqS2N(sens[j], j, tmp, index);
-        newtons[index]=tmp;
-    }
+    const double* scale = mPriv->newtonsToSensors_hw;
+    convertAndMap(mPriv->nj, sens, mPriv->invAxisMap, mPriv->identityAxisMap, newtons,
+                  [scale](double v, int i) { return (v/ scale[i]); });
 }
 
 void ControlBoardHelper::trqS2N(double sens, int j, double &newton, int &k)
@@ -426,13 +507,10 @@ double ControlBoardHelper::trqS2N(double sens, int j)
 
 void ControlBoardHelper::impS2N(const double *sens, double *newtons)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        impS2N(sens[j], j, tmp, index);
-        newtons[index]=tmp;
-    }
+    const double* trqScale = mPriv->newtonsToSensors_hw;
+    const double* scale = mPriv->angleToEncoders_hw;
+    convertAndMap(mPriv->nj, sens, mPriv->invAxisMap, mPriv->identityAxisMap, newtons,
+                  [trqScale, scale](double v, int i) { return (v/ trqScale[i]* scale[i]); });
 }
 
 void ControlBoardHelper::impS2N(double sens, int j, double &newton, int &k)
@@ -523,113 +601,75 @@ double ControlBoardHelper::accE2A_abs(double enc, int j)
 //map a vector, convert from angles to encoders
 void ControlBoardHelper::posA2E(const double *ang, double *enc)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        posA2E(ang[j], j, tmp, index);
-        enc[index]=tmp;
-    }
+    const double* zeros = mPriv->position_zeros;
+    const double* scale = mPriv->angleToEncoders;
+    convertAndMap(mPriv->nj, ang, mPriv->axisMap, mPriv->identityAxisMap, enc,
+                  [zeros, scale](double v, int i) { return (v+ zeros[i])*scale[i]; });
 }
 
 //map a vector, convert from encoders to angles
 void ControlBoardHelper::posE2A(const double *enc, double *ang)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        posE2A(enc[j], j, tmp, index);
-        ang[index]=tmp;
-    }
+    const double* zeros = mPriv->position_zeros_hw;
+    const double* scale = mPriv->angleToEncoders_hw;
+    convertAndMap(mPriv->nj, enc, mPriv->invAxisMap, mPriv->identityAxisMap, ang,
+                  [zeros, scale](double v, int i) { return (v/ scale[i])- zeros[i]; });
 }
 
 void ControlBoardHelper::velA2E(const double *ang, double *enc)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        velA2E(ang[j], j, tmp, index);
-        enc[index]=tmp;
-    }
+    const double* scale = mPriv->angleToEncoders;
+    convertAndMap(mPriv->nj, ang, mPriv->axisMap, mPriv->identityAxisMap, enc,
+                  [scale](double v, int i) { return v* scale[i]; });
 }
 
 void ControlBoardHelper::velA2E_abs(const double *ang, double *enc)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        velA2E_abs(ang[j], j, tmp, index);
-        enc[index]=tmp;
-    }
+    const double* scale = mPriv->absAngleToEncoders;
+    convertAndMap(mPriv->nj, ang, mPriv->axisMap, mPriv->identityAxisMap, enc,
+                  [scale](double v, int i) { return v*scale[i]; });
 }
 
 void ControlBoardHelper::velE2A(const double *enc, double *ang)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        velE2A(enc[j], j, tmp, index);
-        ang[index]=tmp;
-    }
+    const double* scale = mPriv->angleToEncoders_hw;
+    convertAndMap(mPriv->nj, enc, mPriv->invAxisMap, mPriv->identityAxisMap, ang,
+                  [scale](double v, int i) { return v/ scale[i]; });
 }
 
 void ControlBoardHelper::velE2A_abs(const double *enc, double *ang)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        velE2A_abs(enc[j], j, tmp, index);
-        ang[index]=tmp;
-    }
+    const double* scale = mPriv->absAngleToEncoders_hw;
+    convertAndMap(mPriv->nj, enc, mPriv->invAxisMap, mPriv->identityAxisMap, ang,
+                  [scale](double v, int i) { return v/scale[i]; });
 }
 
 void ControlBoardHelper::accA2E(const double *ang, double *enc)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        accA2E(ang[j], j, tmp, index);
-        enc[index]=tmp;
-    }
+    const double* scale = mPriv->angleToEncoders;
+    convertAndMap(mPriv->nj, ang, mPriv->axisMap, mPriv->identityAxisMap, enc,
+                  [scale](double v, int i) { return v* scale[i]; });
 }
 
 void ControlBoardHelper::accA2E_abs(const double *ang, double *enc)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        accA2E_abs(ang[j], j, tmp, index);
-        enc[index]=tmp;
-    }
+    const double* scale = mPriv->absAngleToEncoders;
+    convertAndMap(mPriv->nj, ang, mPriv->axisMap, mPriv->identityAxisMap, enc,
+                  [scale](double v, int i) { return v*scale[i]; });
 }
 
 void ControlBoardHelper::accE2A(const double *enc, double *ang)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        accE2A(enc[j], j, tmp, index);
-        ang[index]=tmp;
-    }
+    const double* scale = mPriv->angleToEncoders_hw;
+    convertAndMap(mPriv->nj, enc, mPriv->invAxisMap, mPriv->identityAxisMap, ang,
+                  [scale](double v, int i) { return v/ scale[i]; });
 }
 
 void ControlBoardHelper::accE2A_abs(const double *enc, double *ang)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        accE2A_abs(enc[j], j, tmp, index);
-        ang[index]=tmp;
-    }
+    const double* scale = mPriv->absAngleToEncoders_hw;
+    convertAndMap(mPriv->nj, enc, mPriv->invAxisMap, mPriv->identityAxisMap, ang,
+                  [scale](double v, int i) { return v/scale[i]; });
 }
 
 //***************** current ******************//
@@ -647,25 +687,17 @@ double ControlBoardHelper::ampereA2S(double ampere, int j)
 //map a vector, convert from ampere to sensors
 void ControlBoardHelper::ampereA2S(const double *ampere, double *sens)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        ampereA2S(ampere[j], j, tmp, index);
-        sens[index]=tmp;
-    }
+    const double* scale = mPriv->ampereToSensors;
+    convertAndMap(mPriv->nj, ampere, mPriv->axisMap, mPriv->identityAxisMap, sens,
+                  [scale](double v, int i) { return v* scale[i]; });
 }
 
 //map a vector, convert from sensor to ampere
 void ControlBoardHelper::ampereS2A(const double *sens, double *ampere)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        ampereS2A(sens[j], j, tmp, index);
-        ampere[index]=tmp;
-    }
+    const double* scale = mPriv->ampereToSensors_hw;
+    convertAndMap(mPriv->nj, sens, mPriv->invAxisMap, mPriv->identityAxisMap, ampere,
+                  [scale](double v, int i) { return (v/ scale[i]); });
 }
 
 void ControlBoardHelper::ampereS2A(double sens, int j, double &ampere, int &k)
@@ -696,25 +728,17 @@ double ControlBoardHelper::voltageV2S(double voltage, int j)
 //map a vector, convert from voltage to sensors
 void ControlBoardHelper::voltageV2S(const double *voltage, double *sens)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        voltageV2S(voltage[j], j, tmp, index);
-        sens[index]=tmp;
-    }
+    const double* scale = mPriv->voltToSensors;
+    convertAndMap(mPriv->nj, voltage, mPriv->axisMap, mPriv->identityAxisMap, sens,
+                  [scale](double v, int i) { return v* scale[i]; });
 }
 
 //map a vector, convert from sensor to newtons
 void ControlBoardHelper::voltageS2V(const double *sens, double *voltage)
 {
-    double tmp;
-    int index;
-    for(int j=0;j<mPriv->nj;j++)
-    {
-        voltageS2V(sens[j], j, tmp, index);
-        voltage[index]=tmp;
-    }
+    const double* scale = mPriv->voltToSensors_hw;
+    convertAndMap(mPriv->nj, sens, mPriv->invAxisMap, mPriv->identityAxisMap, voltage,
+                  [scale](double v, int i) { return (v/ scale[i]); });
 }
 
 void ControlBoardHelper::voltageS2V(double sens, int j, double &voltage, int &k)
@@ -744,24 +768,16 @@ double ControlBoardHelper::dutycycle2PWM(double dutycycle, int j)
 
 void ControlBoardHelper::dutycycle2PWM(const double *dutycycle, double *sens)
 {
-    double tmp;
-    int index;
-    for (int j = 0; j<mPriv->nj; j++)
-    {
-        dutycycle2PWM(dutycycle[j], j, tmp, index);
-        sens[index] = tmp;
-    }
+    const double* scale = mPriv->dutycycleToPWMs;
+    convertAndMap(mPriv->nj, dutycycle, mPriv->axisMap, mPriv->identityAxisMap, sens,
+                  [scale](double v, int i) { return v* scale[i]; });
 }
 
 void ControlBoardHelper::PWM2dutycycle(const double *pwm, double *dutycycle)
 {
-    double tmp;
-    int index;
-    for (int j = 0; j<mPriv->nj; j++)
-    {
-        PWM2dutycycle(pwm[j], j, tmp, index);
-        dutycycle[index] = tmp;
-    }
+    const double* scale = mPriv->dutycycleToPWMs_hw;
+    convertAndMap(mPriv->nj, pwm, mPriv->invAxisMap, mPriv->identityAxisMap, dutycycle,
+                  [scale](double v, int i) { return (v / scale[i]); });
 }
 
 void ControlBoardHelper::PWM2dutycycle(double pwm_raw, int k_raw, double &dutycycle, int &j)
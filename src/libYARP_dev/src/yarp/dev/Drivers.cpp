@@ -21,6 +21,7 @@
 #include <yarp/dev/ServiceInterfaces.h>
 #include <yarp/dev/IDeviceDriverParams.h>
 
+#include <mutex>
 #include <vector>
 #include <sstream>
 #include <iterator>
@@ -36,6 +37,8 @@ YARP_LOG_COMPONENT(DRIVERS, "yarp.dev.Drivers")
 class Drivers::Private : public YarpPluginSelector {
 public:
     std::vector<DriverCreator *> delegates;
+    // devices can be opened concurrently (e.g. by yarprobotinterface)
+    std::mutex mutex;
 
     ~Private() override {
         for (auto& delegate : delegates) {
@@ -281,19 +284,23 @@ Drivers::~Drivers() {
 }
 
 std::string Drivers::toString() const {
+    std::lock_guard<std::mutex> lock(mPriv->mutex);
     return mPriv->toString();
 }
 
 void Drivers::add(DriverCreator *creator) {
+    std::lock_guard<std::mutex> lock(mPriv->mutex);
     mPriv->add(creator);
 }
 
 
 DriverCreator *Drivers::find(const char *name) {
+    std::lock_guard<std::mutex> lock(mPriv->mutex);
     return mPriv->find(name);
 }
 
 bool Drivers::remove(const char *name) {
+    std::lock_guard<std::mutex> lock(mPriv->mutex);
     return mPriv->remove(name);
 }
 
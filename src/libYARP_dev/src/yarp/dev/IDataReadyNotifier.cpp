@@ -0,0 +1,10 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/dev/IDataReadyNotifier.h>
+
+yarp::dev::IDataReadyListener::~IDataReadyListener() = default;
+
+yarp::dev::IDataReadyNotifier::~IDataReadyNotifier() = default;
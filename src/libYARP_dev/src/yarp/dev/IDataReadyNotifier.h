@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_DEV_IDATAREADYNOTIFIER_H
+#define YARP_DEV_IDATAREADYNOTIFIER_H
+
+#include <yarp/dev/api.h>
+
+namespace yarp::dev {
+
+/**
+ * @ingroup dev_iface_other
+ *
+ * Object receiving the notifications of an IDataReadyNotifier.
+ */
+class YARP_dev_API IDataReadyListener
+{
+public:
+    virtual ~IDataReadyListener();
+
+    /**
+     * Called by the device as soon as a new sample is available.
+     *
+     * The method is called from the acquisition thread of the device, and the
+     * device may wait for it to return before acquiring the next sample,
+     * therefore it should return quickly.
+     * The new sample can be read with the usual methods of the interfaces of
+     * the device.
+     * The listener must not add or remove listeners from this method.
+     */
+    virtual void onDataReady() = 0;
+};
+
+/**
+ * @ingroup dev_iface_other
+ *
+ * Optional interface for the devices that can notify when a new sample is
+ * available, instead of being polled periodically.
+ *
+ * Wrappers attached to a device implementing this interface can publish each
+ * sample as soon as it is acquired, avoiding both the latency and the
+ * duplicated or skipped samples caused by a polling period different from
+ * the acquisition rate of the device.
+ */
+class YARP_dev_API IDataReadyNotifier
+{
+public:
+    virtual ~IDataReadyNotifier();
+
+    /**
+     * Register a listener to be notified when a new sample is available.
+     * @param listener the listener. It must stay valid until it is removed.
+     * @return true/false on success/failure.
+     */
+    virtual bool addDataReadyListener(IDataReadyListener* listener) = 0;
+
+    /**
+     * Remove a listener registered with addDataReadyListener().
+     * When this method returns, the listener is not called anymore.
+     * @param listener the listener.
+     * @return true/false on success/failure (e.g. listener not registered).
+     */
+    virtual bool removeDataReadyListener(IDataReadyListener* listener) = 0;
+};
+
+} // namespace yarp::dev
+
+#endif // YARP_DEV_IDATAREADYNOTIFIER_H
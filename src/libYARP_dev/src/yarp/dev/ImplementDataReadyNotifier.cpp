@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/dev/ImplementDataReadyNotifier.h>
+
+#include <yarp/os/LogComponent.h>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace {
+YARP_LOG_COMPONENT(IMPLEMENTDATAREADYNOTIFIER, "yarp.dev.ImplementDataReadyNotifier")
+}
+
+class yarp::dev::ImplementDataReadyNotifier::Private
+{
+public:
+    // Held while the listeners are notified, so that a listener is never
+    // called after removeDataReadyListener() returns.
+    mutable std::mutex mutex;
+    std::vector<IDataReadyListener*> listeners;
+};
+
+yarp::dev::ImplementDataReadyNotifier::ImplementDataReadyNotifier() :
+        mPriv(new Private)
+{
+}
+
+yarp::dev::ImplementDataReadyNotifier::~ImplementDataReadyNotifier()
+{
+    delete mPriv;
+}
+
+bool yarp::dev::ImplementDataReadyNotifier::addDataReadyListener(IDataReadyListener* listener)
+{
+    if (listener == nullptr) {
+        yCError(IMPLEMENTDATAREADYNOTIFIER, "Null listener");
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mPriv->mutex);
+    if (std::find(mPriv->listeners.begin(), mPriv->listeners.end(), listener) != mPriv->listeners.end()) {
+        yCError(IMPLEMENTDATAREADYNOTIFIER, "Listener already registered");
+        return false;
+    }
+    mPriv->listeners.push_back(listener);
+    return true;
+}
+
+bool yarp::dev::ImplementDataReadyNotifier::removeDataReadyListener(IDataReadyListener* listener)
+{
+    std::lock_guard<std::mutex> lock(mPriv->mutex);
+    auto it = std::find(mPriv->listeners.begin(), mPriv->listeners.end(), listener);
+    if (it == mPriv->listeners.end()) {
+        yCError(IMPLEMENTDATAREADYNOTIFIER, "Listener not registered");
+        return false;
+    }
+    mPriv->listeners.erase(it);
+    return true;
+}
+
+void yarp::dev::ImplementDataReadyNotifier::notifyDataReady()
+{
+    std::lock_guard<std::mutex> lock(mPriv->mutex);
+    for (auto* listener : mPriv->listeners) {
+        listener->onDataReady();
+    }
+}
+
+bool yarp::dev::ImplementDataReadyNotifier::hasDataReadyListeners() const
+{
+    std::lock_guard<std::mutex> lock(mPriv->mutex);
+    return !mPriv->listeners.empty();
+}
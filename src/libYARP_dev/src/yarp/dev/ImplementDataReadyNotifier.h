@@ -0,0 +1,51 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_DEV_IMPLEMENTDATAREADYNOTIFIER_H
+#define YARP_DEV_IMPLEMENTDATAREADYNOTIFIER_H
+
+#include <yarp/dev/IDataReadyNotifier.h>
+#include <yarp/dev/api.h>
+
+namespace yarp::dev {
+
+/**
+ * Default implementation of the IDataReadyNotifier interface.
+ *
+ * Devices inherit from this class and call notifyDataReady() from their
+ * acquisition thread every time a new sample is available.
+ */
+class YARP_dev_API ImplementDataReadyNotifier : public IDataReadyNotifier
+{
+public:
+    ImplementDataReadyNotifier();
+    ImplementDataReadyNotifier(const ImplementDataReadyNotifier&) = delete;
+    ImplementDataReadyNotifier(ImplementDataReadyNotifier&&) = delete;
+    ImplementDataReadyNotifier& operator=(const ImplementDataReadyNotifier&) = delete;
+    ImplementDataReadyNotifier& operator=(ImplementDataReadyNotifier&&) = delete;
+    ~ImplementDataReadyNotifier() override;
+
+    bool addDataReadyListener(IDataReadyListener* listener) override;
+    bool removeDataReadyListener(IDataReadyListener* listener) override;
+
+protected:
+    /**
+     * Call onDataReady() on all the registered listeners.
+     */
+    void notifyDataReady();
+
+    /**
+     * @return true if at least one listener is registered.
+     */
+    bool hasDataReadyListeners() const;
+
+private:
+    class Private;
+    Private* mPriv;
+};
+
+} // namespace yarp::dev
+
+#endif // YARP_DEV_IMPLEMENTDATAREADYNOTIFIER_H
@@ -15,6 +15,10 @@
 #include <algorithm>
 #include <fstream>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
 
 #if defined (YARP_HAS_ZLIB)
 #include <zlib.h>
@@ -56,6 +60,32 @@ static std::string extractExtensionFromFile(std::string full_filename)
     return full_filename.substr(start, 3);
 }
 
+// splits the range [0, count) among the available cores and runs func(begin, end) on each part.
+// work_per_item is used to avoid spawning threads for small problems.
+template <typename F>
+static void parallel_for(size_t count, size_t work_per_item, F&& func)
+{
+    constexpr size_t min_work_per_thread = 1 << 16;
+    size_t n_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    n_threads = std::min(n_threads, count * work_per_item / min_work_per_thread);
+    n_threads = std::min(n_threads, count);
+    if (n_threads <= 1)
+    {
+        func(0, count);
+        return;
+    }
+    std::vector<std::thread> threads;
+    size_t chunk = (count + n_threads - 1) / n_threads;
+    for (size_t begin = 0; begin < count; begin += chunk)
+    {
+        threads.emplace_back(func, begin, std::min(begin + chunk, count));
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+}
+
 
 bool MapGrid2D::isIdenticalTo(const MapGrid2D& other) const
 {
@@ -201,6 +231,7 @@ bool MapGrid2D::getMapImage(yarp::sig::ImageOf<PixelRgb>& image) const
 
 bool MapGrid2D::setMapImage(yarp::sig::ImageOf<PixelRgb>& image)
 {
+    m_obstacles_distance.clear();
     if (image.width() != m_width ||
         image.height() != m_height)
     {
@@ -219,6 +250,7 @@ bool MapGrid2D::setMapImage(yarp::sig::ImageOf<PixelRgb>& image)
 
 bool MapGrid2D::enlargeObstacles(double size)
 {
+    m_obstacles_distance.clear();
     if (size <= 0)
     {
         for (size_t y = 0; y < m_height; y++)
@@ -233,69 +265,159 @@ bool MapGrid2D::enlargeObstacles(double size)
         }
         return true;
     }
-    auto repeat_num = (size_t)(std::ceil(size/ m_resolution));
-    for (size_t repeat = 0; repeat < repeat_num; repeat++)
+
+    //all the free cells closer than size to an obstacle become enlarged obstacles
+    auto radius = (size_t)(std::ceil(size / m_resolution));
+    auto max_dist2 = (std::uint32_t)(radius * radius);
+    std::vector<std::uint32_t> dist2;
+    computeSquaredDistanceTransform(dist2);
+    parallel_for(m_height, m_width, [&](size_t begin, size_t end)
     {
-        //contains the cells to be enlarged;
-        std::vector<XYCell> list_of_cells;
-        for (size_t y = 0; y < m_height; y++)
+        for (size_t y = begin; y < end; y++)
         {
+            unsigned char* row = m_map_flags.getRow(y);
+            const std::uint32_t* d2 = &dist2[y * m_width];
             for (size_t x = 0; x < m_width; x++)
             {
-                //this check could be optimized...
-                if (this->m_map_flags.safePixel(x, y) == MAP_CELL_KEEP_OUT ||
-                    this->m_map_flags.safePixel(x, y) == MAP_CELL_ENLARGED_OBSTACLE ||
-                    this->m_map_flags.safePixel(x, y) == MAP_CELL_WALL ||
-                    this->m_map_flags.safePixel(x, y) == MAP_CELL_UNKNOWN ||
-                    this->m_map_flags.safePixel(x, y) == MAP_CELL_TEMPORARY_OBSTACLE)
+                if (row[x] == MAP_CELL_FREE && d2[x] <= max_dist2)
                 {
-                    list_of_cells.emplace_back(x, y);
+                    row[x] = MAP_CELL_ENLARGED_OBSTACLE;
                 }
             }
         }
+    });
+    return true;
+}
+
+void MapGrid2D::computeSquaredDistanceTransform(std::vector<std::uint32_t>& dist2) const
+{
+    // Exact euclidean distance transform (Felzenszwalb and Huttenlocher), computed
+    // as a 1D transform along the columns, followed by a 1D transform along the rows.
+    constexpr std::uint32_t inf = std::numeric_limits<std::uint32_t>::max();
+    const size_t w = m_width;
+    const size_t h = m_height;
+    dist2.assign(w * h, inf);
+    if (w == 0 || h == 0)
+    {
+        return;
+    }
 
-        //process each cell of the list and enlarges it
-        for (auto& list_of_cell : list_of_cells)
+    // columns: distance from the closest obstacle in the same column.
+    // Each thread processes a block of columns, scanning the rows in memory order.
+    std::vector<std::uint32_t> col(w * h);
+    parallel_for(w, h, [&](size_t begin, size_t end)
+    {
+        for (size_t y = 0; y < h; y++)
         {
-            enlargeCell(list_of_cell);
+            const unsigned char* flags = m_map_flags.getRow(y);
+            std::uint32_t* g = &col[y * w];
+            const std::uint32_t* g_prev = (y > 0) ? &col[(y - 1) * w] : nullptr;
+            for (size_t x = begin; x < end; x++)
+            {
+                if (flags[x] != MAP_CELL_FREE) {
+                    g[x] = 0;
+                } else if (g_prev && g_prev[x] != inf) {
+                    g[x] = g_prev[x] + 1;
+                } else {
+                    g[x] = inf;
+                }
+            }
+        }
+        for (size_t y = h - 1; y-- > 0;)
+        {
+            std::uint32_t* g = &col[y * w];
+            const std::uint32_t* g_next = &col[(y + 1) * w];
+            for (size_t x = begin; x < end; x++)
+            {
+                if (g_next[x] != inf && g_next[x] + 1 < g[x]) {
+                    g[x] = g_next[x] + 1;
+                }
+            }
+        }
+    });
+
+    // rows: lower envelope of the parabolas centred in the cells with a finite column distance
+    parallel_for(h, w, [&](size_t begin, size_t end)
+    {
+        std::vector<size_t> v(w);
+        std::vector<double> z(w + 1);
+        for (size_t y = begin; y < end; y++)
+        {
+            const std::uint32_t* g = &col[y * w];
+            std::uint32_t* d = &dist2[y * w];
+            auto f = [g](size_t i) { return double(g[i]) * double(g[i]); };
+
+            size_t k = 0;
+            bool empty = true;
+            for (size_t q = 0; q < w; q++)
+            {
+                if (g[q] == inf) {
+                    continue;
+                }
+                if (empty)
+                {
+                    v[0] = q;
+                    z[0] = -std::numeric_limits<double>::infinity();
+                    z[1] = std::numeric_limits<double>::infinity();
+                    empty = false;
+                    continue;
+                }
+                double s = ((f(q) + double(q) * q) - (f(v[k]) + double(v[k]) * v[k])) / (2.0 * double(q - v[k]));
+                while (s <= z[k])
+                {
+                    k--;
+                    s = ((f(q) + double(q) * q) - (f(v[k]) + double(v[k]) * v[k])) / (2.0 * double(q - v[k]));
+                }
+                k++;
+                v[k] = q;
+                z[k] = s;
+                z[k + 1] = std::numeric_limits<double>::infinity();
+            }
+            if (empty)
+            {
+                continue;
+            }
+            k = 0;
+            for (size_t q = 0; q < w; q++)
+            {
+                while (z[k + 1] < double(q)) {
+                    k++;
+                }
+                double dx = double(q) - double(v[k]);
+                d[q] = (std::uint32_t)(std::min(dx * dx + f(v[k]), double(inf - 1)));
+            }
         }
+    });
+}
+
+bool MapGrid2D::computeObstaclesDistance()
+{
+    std::vector<std::uint32_t> dist2;
+    computeSquaredDistanceTransform(dist2);
+    m_obstacles_distance.resize(dist2.size());
+    for (size_t i = 0; i < dist2.size(); i++)
+    {
+        m_obstacles_distance[i] = (dist2[i] == std::numeric_limits<std::uint32_t>::max()) ?
+                                  std::numeric_limits<float>::infinity() :
+                                  std::sqrt((float)dist2[i]);
     }
     return true;
 }
 
-void MapGrid2D::enlargeCell(XYCell cell)
+bool MapGrid2D::getDistanceToObstacle(XYCell cell, double& distance) const
 {
-    size_t i = cell.x;
-    size_t j = cell.y;
-    size_t il = cell.x > 1 ? cell.x - 1 : 0;
-    size_t ir = cell.x + 1 < (m_width)-1 ? cell.x + 1 : (m_width)-1;
-    size_t ju = cell.y > 1 ? cell.y - 1 : 0;
-    size_t jd = cell.y + 1 < (m_height)-1 ? cell.y + 1 : (m_height)-1;
-
-    if (m_map_flags.pixel(il, j) == MAP_CELL_FREE) {
-        m_map_flags.pixel(il, j) = MAP_CELL_ENLARGED_OBSTACLE;
-    }
-    if (m_map_flags.pixel(ir, j) == MAP_CELL_FREE) {
-        m_map_flags.pixel(ir, j) = MAP_CELL_ENLARGED_OBSTACLE;
-    }
-    if (m_map_flags.pixel(i, ju) == MAP_CELL_FREE) {
-        m_map_flags.pixel(i, ju) = MAP_CELL_ENLARGED_OBSTACLE;
-    }
-    if (m_map_flags.pixel(i, jd) == MAP_CELL_FREE) {
-        m_map_flags.pixel(i, jd) = MAP_CELL_ENLARGED_OBSTACLE;
-    }
-    if (m_map_flags.pixel(il, ju) == MAP_CELL_FREE) {
-        m_map_flags.pixel(il, ju) = MAP_CELL_ENLARGED_OBSTACLE;
-    }
-    if (m_map_flags.pixel(il, jd) == MAP_CELL_FREE) {
-        m_map_flags.pixel(il, jd) = MAP_CELL_ENLARGED_OBSTACLE;
-    }
-    if (m_map_flags.pixel(ir, ju) == MAP_CELL_FREE) {
-        m_map_flags.pixel(ir, ju) = MAP_CELL_ENLARGED_OBSTACLE;
+    if (isInsideMap(cell) == false)
+    {
+        yError() << "Invalid cell requested " << cell.x << " " << cell.y;
+        return false;
     }
-    if (m_map_flags.pixel(ir, jd) == MAP_CELL_FREE) {
-        m_map_flags.pixel(ir, jd) = MAP_CELL_ENLARGED_OBSTACLE;
+    if (m_obstacles_distance.size() != m_width * m_height)
+    {
+        yError() << "Obstacles distance not available. Use method computeObstaclesDistance() first.";
+        return false;
     }
+    distance = m_obstacles_distance[cell.y * m_width + cell.x] * m_resolution;
+    return true;
 }
 
 bool MapGrid2D::loadROSParams(std::string ros_yaml_filename, std::string& pgm_occ_filename, double& resolution, double& orig_x, double& orig_y, double& orig_t )
@@ -555,6 +677,7 @@ bool MapGrid2D::parseMapParameters(const Property& mapfile)
 
 bool  MapGrid2D::loadFromFile(std::string map_file_with_path)
 {
+    m_obstacles_distance.clear();
     Property mapfile_prop;
     std::string mapfile_path = extractPathFromFile(map_file_with_path);
     if (mapfile_prop.fromConfigFile(map_file_with_path) == false)
@@ -706,6 +829,7 @@ MapGrid2D::CellOccupancyData MapGrid2D::PixelToCellOccupancyData(const yarp::sig
 
 bool  MapGrid2D::crop (int left, int top, int right, int bottom)
 {
+    m_obstacles_distance.clear();
     if (top < 0)
     {
         for (size_t j=0;j<height();j++){
@@ -868,6 +992,7 @@ bool  MapGrid2D::saveToFile(std::string map_file_with_path) const
 
 bool MapGrid2D::read(yarp::os::ConnectionReader& connection)
 {
+    m_obstacles_distance.clear();
     // auto-convert text mode interaction
     connection.convertTextMode();
 
@@ -1114,6 +1239,7 @@ bool MapGrid2D::setSize_in_cells(size_t x, size_t y)
     }
     m_map_occupancy.resize(x, y);
     m_map_flags.resize(x, y);
+    m_obstacles_distance.clear();
     m_map_occupancy.zero();
     m_map_flags.zero();
     m_width = x;
@@ -1141,6 +1267,7 @@ bool MapGrid2D::setMapFlag(XYCell cell, map_flags flag)
         return false;
     }
     m_map_flags.safePixel(cell.x, cell.y) = flag;
+    m_obstacles_distance.clear();
     return true;
 }
 
@@ -1209,8 +1336,47 @@ bool MapGrid2D::getOccupancyGrid(yarp::sig::ImageOf<yarp::sig::PixelMono>& image
     return true;
 }
 
+bool MapGrid2D::getRegion(size_t x, size_t y, size_t w, size_t h, std::string& occupancy, std::string& flags) const
+{
+    if (x + w > m_width || y + h > m_height)
+    {
+        yError() << "Invalid region requested " << x << " " << y << " " << w << " " << h;
+        return false;
+    }
+    occupancy.resize(w * h);
+    flags.resize(w * h);
+    for (size_t r = 0; r < h; r++)
+    {
+        memcpy(&occupancy[r * w], m_map_occupancy.getRow(y + r) + x, w);
+        memcpy(&flags[r * w], m_map_flags.getRow(y + r) + x, w);
+    }
+    return true;
+}
+
+bool MapGrid2D::setRegion(size_t x, size_t y, size_t w, size_t h, const std::string& occupancy, const std::string& flags)
+{
+    if (x + w > m_width || y + h > m_height)
+    {
+        yError() << "Invalid region requested " << x << " " << y << " " << w << " " << h;
+        return false;
+    }
+    if (occupancy.size() != w * h || flags.size() != w * h)
+    {
+        yError() << "The size of the given data does not correspond to the requested region";
+        return false;
+    }
+    m_obstacles_distance.clear();
+    for (size_t r = 0; r < h; r++)
+    {
+        memcpy(m_map_occupancy.getRow(y + r) + x, &occupancy[r * w], w);
+        memcpy(m_map_flags.getRow(y + r) + x, &flags[r * w], w);
+    }
+    return true;
+}
+
 void MapGrid2D::clearMapTemporaryFlags()
 {
+    m_obstacles_distance.clear();
     for (size_t y = 0; y < m_height; y++)
     {
         for (size_t x = 0; x < m_width; x++)
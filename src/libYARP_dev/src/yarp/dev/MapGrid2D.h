@@ -17,7 +17,9 @@
 
 #include <yarp/math/Vec2D.h>
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 /**
 * \file MapGrid2D.h contains the definition of a map type
@@ -49,6 +51,9 @@ private:
     double m_occupied_thresh;
     double m_free_thresh;
 
+    // distance (in cells) of each cell from the closest obstacle, see computeObstaclesDistance()
+    std::vector<float> m_obstacles_distance;
+
     // std::vector<map_link> links_to_other_maps;
 
 private:
@@ -58,8 +63,8 @@ public:
     bool enable_map_compression_over_network(bool val);
 
 private:
-    // performs an obstacles enlargement on the specified cell.
-    void enlargeCell(XYCell cell);
+    // computes the squared euclidean distance (in cells) of each cell from the closest obstacle.
+    void computeSquaredDistanceTransform(std::vector<std::uint32_t>& dist2) const;
 
     // conversion from pixel color to CellFlagData (yarp format) and viceversa
     CellFlagData PixelToCellFlagData(const yarp::sig::PixelRgb& pixin) const;
@@ -147,6 +152,26 @@ public:
     bool setOccupancyGrid(yarp::sig::ImageOf<yarp::sig::PixelMono>& image);
     bool getOccupancyGrid(yarp::sig::ImageOf<yarp::sig::PixelMono>& image) const;
 
+    /**
+     * Copies the occupancy data and the flags of a rectangular region of the map.
+     * The data is stored row by row, one byte per cell.
+     * @param x is the column of the top-left cell of the region.
+     * @param y is the row of the top-left cell of the region.
+     * @param w is the width of the region, in cells.
+     * @param h is the height of the region, in cells.
+     * @param occupancy the returned occupancy data of the region.
+     * @param flags the returned flags of the region.
+     * @return true if the region is fully inside the map, false otherwise.
+     */
+    bool getRegion(size_t x, size_t y, size_t w, size_t h, std::string& occupancy, std::string& flags) const;
+
+    /**
+     * Overwrites the occupancy data and the flags of a rectangular region of the map.
+     * The data is expected in the same format returned by getRegion().
+     * @return true if the region is fully inside the map and the size of the data is consistent, false otherwise.
+     */
+    bool setRegion(size_t x, size_t y, size_t w, size_t h, const std::string& occupancy, const std::string& flags);
+
     /**
      * Sets the origin of the map reference frame (according to ROS convention)
      * @param x,y,theta is the pose of the origin, expressed in [m], [deg] and referred to the bottom-left corner of the map, pointing outwards.
@@ -260,10 +285,27 @@ public:
      * In this way a navigation algorithm can easily check obstacle collision by comparing the location of the center of the robot with cell value (free/occupied etc)
      * @param size the size of the enlargement, in meters. If size>0 the requested enlargement is performed. If the function is called multiple times, the enlargement sums up.
      * If size <= 0 the enlargement stored in the map is cleaned up.
+     * The enlargement is computed with an euclidean distance transform, so its cost does not depend on size.
      * @return true always.
      */
     bool enlargeObstacles(double size);
 
+    /**
+     * Computes the distance of each cell of the map from the closest obstacle (i.e. any cell which is not free),
+     * using an exact euclidean distance transform. The result is stored together with the map and can be
+     * queried with getDistanceToObstacle(). It is discarded when the flags of the map are modified.
+     * @return true always.
+     */
+    bool computeObstaclesDistance();
+
+    /**
+     * Retrieves the distance of a cell from the closest obstacle, as computed by computeObstaclesDistance().
+     * @param cell is the cell location, referred to the top-left corner of the map.
+     * @param distance the distance from the closest obstacle, in meters. It is infinite if the map contains no obstacles.
+     * @return true if cell is valid cell inside the map and the distances are available, false otherwise.
+     */
+    bool getDistanceToObstacle(XYCell cell, double& distance) const;
+
     //-------------------------------file access functions-------------------------------
 
     /**
@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/dev/ControlBoardHelper.h>
+
+#include <vector>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::dev;
+
+namespace {
+
+using ScalarConversion = void (ControlBoardHelper::*)(double, int, double&, int&);
+using VectorConversion = void (ControlBoardHelper::*)(const double*, double*);
+
+// The vector conversions must give exactly the same results of the single joint ones
+void checkVectorConversion(ControlBoardHelper& helper, ScalarConversion scalar, VectorConversion vector, const std::vector<double>& input)
+{
+    int nj = helper.axes();
+    std::vector<double> expected(nj, 0.0);
+    for (int j = 0; j < nj; j++)
+    {
+        double value = 0.0;
+        int k = 0;
+        (helper.*scalar)(input[j], j, value, k);
+        expected[k] = value;
+    }
+
+    std::vector<double> output(nj, 0.0);
+    (helper.*vector)(input.data(), output.data());
+    for (int j = 0; j < nj; j++)
+    {
+        CHECK(output[j] == expected[j]);
+    }
+}
+
+void checkAllVectorConversions(ControlBoardHelper& helper, const std::vector<double>& input)
+{
+    checkVectorConversion(helper, &ControlBoardHelper::posA2E, &ControlBoardHelper::posA2E, input);
+    checkVectorConversion(helper, &ControlBoardHelper::posE2A, &ControlBoardHelper::posE2A, input);
+    checkVectorConversion(helper, &ControlBoardHelper::velA2E, &ControlBoardHelper::velA2E, input);
+    checkVectorConversion(helper, &ControlBoardHelper::velA2E_abs, &ControlBoardHelper::velA2E_abs, input);
+    checkVectorConversion(helper, &ControlBoardHelper::velE2A, &ControlBoardHelper::velE2A, input);
+    checkVectorConversion(helper, &ControlBoardHelper::velE2A_abs, &ControlBoardHelper::velE2A_abs, input);
+    checkVectorConversion(helper, &ControlBoardHelper::accA2E, &ControlBoardHelper::accA2E, input);
+    checkVectorConversion(helper, &ControlBoardHelper::accA2E_abs, &ControlBoardHelper::accA2E_abs, input);
+    checkVectorConversion(helper, &ControlBoardHelper::accE2A, &ControlBoardHelper::accE2A, input);
+    checkVectorConversion(helper, &ControlBoardHelper::accE2A_abs, &ControlBoardHelper::accE2A_abs, input);
+    checkVectorConversion(helper, &ControlBoardHelper::trqN2S, &ControlBoardHelper::trqN2S, input);
+    checkVectorConversion(helper, &ControlBoardHelper::trqS2N, &ControlBoardHelper::trqS2N, input);
+    checkVectorConversion(helper, &ControlBoardHelper::impN2S, &ControlBoardHelper::impN2S, input);
+    checkVectorConversion(helper, &ControlBoardHelper::impS2N, &ControlBoardHelper::impS2N, input);
+    checkVectorConversion(helper, &ControlBoardHelper::ampereA2S, &ControlBoardHelper::ampereA2S, input);
+    checkVectorConversion(helper, &ControlBoardHelper::ampereS2A, &ControlBoardHelper::ampereS2A, input);
+    checkVectorConversion(helper, &ControlBoardHelper::voltageV2S, &ControlBoardHelper::voltageV2S, input);
+    checkVectorConversion(helper, &ControlBoardHelper::voltageS2V, &ControlBoardHelper::voltageS2V, input);
+    checkVectorConversion(helper, &ControlBoardHelper::dutycycle2PWM, &ControlBoardHelper::dutycycle2PWM, input);
+    checkVectorConversion(helper, &ControlBoardHelper::PWM2dutycycle, &ControlBoardHelper::PWM2dutycycle, input);
+}
+
+} // namespace
+
+TEST_CASE("dev::ControlBoardHelper", "[yarp::dev]")
+{
+    const int nj = 7;
+    const double angleToEncoders[nj] = { 182.044, -182.044, 0.3, 1.0, -7.1, 1e5, 3.0 };
+    const double zeros[nj] = { 0.0, -90.0, 12.5, 0.1, -0.3, 45.0, 1e-3 };
+    const double newtons[nj] = { 1.0, 0.7, -3.0, 1000.0, 0.1, 2.0, -1.5 };
+    const double amps[nj] = { 1000.0, 0.3, 1.0, -2.0, 7.0, 0.01, 3.3 };
+    const double volts[nj] = { 1.5, 10.0, 0.25, 1.0, -1.0, 3.0, 8.0 };
+    const double dutycycles[nj] = { 32000.0 / 100.0, 1.0, 0.7, 13.0, 2.0, -5.0, 100.0 };
+    const std::vector<double> input = { 0.0, -1.25, 3.14159, 1e3, -7e-4, 42.0, 1.0 / 3.0 };
+
+    SECTION("Vector conversions with identity axis map")
+    {
+        const int axisMap[nj] = { 0, 1, 2, 3, 4, 5, 6 };
+        ControlBoardHelper helper(nj, axisMap, angleToEncoders, zeros, newtons, amps, volts, dutycycles);
+        checkAllVectorConversions(helper, input);
+    }
+
+    SECTION("Vector conversions with permuted axis map")
+    {
+        const int axisMap[nj] = { 3, 0, 6, 1, 5, 2, 4 };
+        ControlBoardHelper helper(nj, axisMap, angleToEncoders, zeros, newtons, amps, volts, dutycycles);
+        checkAllVectorConversions(helper, input);
+
+        // A copy of the helper converts in the same way
+        ControlBoardHelper copy(helper);
+        checkAllVectorConversions(copy, input);
+
+        std::vector<double> user(nj, 0.0);
+        std::vector<double> hw(nj, 0.0);
+        helper.toHw(input.data(), hw.data());
+        helper.toUser(hw.data(), user.data());
+        for (int j = 0; j < nj; j++)
+        {
+            CHECK(hw[axisMap[j]] == input[j]);
+            CHECK(user[j] == input[j]);
+        }
+    }
+}
@@ -13,6 +13,9 @@
 #include <yarp/dev/PolyDriver.h>
 #include <yarp/conf/filesystem.h>
 
+#include <cmath>
+#include <limits>
+
 #include <catch2/catch_amalgamated.hpp>
 #include <harness.h>
 #include <YarpBuildLocation.h>
@@ -115,6 +118,101 @@ TEST_CASE("dev::MapGrid2DTest", "[yarp::dev]")
         // MapGrid2D::isInsideMap() test successful
     }
 
+    SECTION("Test getRegion/setRegion MapGrid2D")
+    {
+        Nav2D::MapGrid2D src_map;
+        src_map.setResolution(1.0);
+        src_map.setSize_in_cells(70, 50);
+        src_map.setMapFlag(XYCell(3, 4), MapGrid2D::map_flags::MAP_CELL_KEEP_OUT);
+        src_map.setOccupancyData(XYCell(3, 4), 100);
+        src_map.setMapFlag(XYCell(69, 49), MapGrid2D::map_flags::MAP_CELL_WALL);
+
+        std::string occupancy;
+        std::string flags;
+        CHECK(src_map.getRegion(0, 0, 70, 50, occupancy, flags));
+        CHECK(occupancy.size() == 70 * 50);
+        CHECK(flags.size() == 70 * 50);
+        CHECK(flags[4 * 70 + 3] == MapGrid2D::map_flags::MAP_CELL_KEEP_OUT);
+        CHECK_FALSE(src_map.getRegion(60, 0, 11, 10, occupancy, flags));
+        CHECK_FALSE(src_map.getRegion(0, 45, 10, 6, occupancy, flags));
+
+        // copy the map region by region
+        Nav2D::MapGrid2D dst_map;
+        dst_map.setResolution(1.0);
+        dst_map.setSize_in_cells(70, 50);
+        CHECK_FALSE(src_map.isIdenticalTo(dst_map));
+        for (size_t y = 0; y < 50; y += 16)
+        {
+            for (size_t x = 0; x < 70; x += 16)
+            {
+                size_t w = std::min<size_t>(16, 70 - x);
+                size_t h = std::min<size_t>(16, 50 - y);
+                CHECK(src_map.getRegion(x, y, w, h, occupancy, flags));
+                CHECK(dst_map.setRegion(x, y, w, h, occupancy, flags));
+            }
+        }
+        CHECK(src_map.isIdenticalTo(dst_map));
+        CHECK_FALSE(dst_map.setRegion(0, 0, 2, 2, occupancy, flags));
+    }
+
+    SECTION("Test obstacles distance and enlargement MapGrid2D")
+    {
+        Nav2D::MapGrid2D test_map;
+        test_map.setResolution(0.1);
+        test_map.setSize_in_cells(60, 40);
+        std::vector<XYCell> obstacles { XYCell(0, 0), XYCell(30, 20), XYCell(31, 20), XYCell(45, 5), XYCell(10, 35) };
+        for (const auto& obs : obstacles)
+        {
+            test_map.setMapFlag(obs, MapGrid2D::map_flags::MAP_CELL_WALL);
+        }
+
+        double dist = 0;
+        CHECK_FALSE(test_map.getDistanceToObstacle(XYCell(5, 5), dist));
+        CHECK(test_map.computeObstaclesDistance());
+        CHECK_FALSE(test_map.getDistanceToObstacle(XYCell(60, 5), dist));
+
+        // compare with a brute force computation
+        bool all_ok = true;
+        for (size_t y = 0; y < 40; y++)
+        {
+            for (size_t x = 0; x < 60; x++)
+            {
+                double expected = std::numeric_limits<double>::infinity();
+                for (const auto& obs : obstacles)
+                {
+                    double dx = double(x) - obs.x;
+                    double dy = double(y) - obs.y;
+                    expected = std::min(expected, std::sqrt(dx * dx + dy * dy) * 0.1);
+                }
+                test_map.getDistanceToObstacle(XYCell(x, y), dist);
+                if (std::fabs(dist - expected) > 1e-5) {
+                    all_ok = false;
+                }
+            }
+        }
+        CHECK(all_ok);
+
+        // the distances are discarded when the map changes
+        test_map.setMapFlag(XYCell(5, 5), MapGrid2D::map_flags::MAP_CELL_KEEP_OUT);
+        CHECK_FALSE(test_map.getDistanceToObstacle(XYCell(5, 5), dist));
+
+        // the enlargement is a disc around each obstacle
+        Nav2D::MapGrid2D enlarged_map = test_map;
+        CHECK(enlarged_map.enlargeObstacles(0.3));
+        MapGrid2D::map_flags flag;
+        enlarged_map.getMapFlag(XYCell(30, 17), flag); CHECK(flag == MapGrid2D::map_flags::MAP_CELL_ENLARGED_OBSTACLE);
+        enlarged_map.getMapFlag(XYCell(32, 18), flag); CHECK(flag == MapGrid2D::map_flags::MAP_CELL_ENLARGED_OBSTACLE);
+        enlarged_map.getMapFlag(XYCell(30, 16), flag); CHECK(flag == MapGrid2D::map_flags::MAP_CELL_FREE);
+        enlarged_map.getMapFlag(XYCell(33, 17), flag); CHECK(flag == MapGrid2D::map_flags::MAP_CELL_FREE);
+        enlarged_map.getMapFlag(XYCell(30, 20), flag); CHECK(flag == MapGrid2D::map_flags::MAP_CELL_WALL);
+
+        // the enlargements sum up, and can be removed
+        CHECK(enlarged_map.enlargeObstacles(0.1));
+        enlarged_map.getMapFlag(XYCell(30, 16), flag); CHECK(flag == MapGrid2D::map_flags::MAP_CELL_ENLARGED_OBSTACLE);
+        CHECK(enlarged_map.enlargeObstacles(0));
+        CHECK(enlarged_map.isIdenticalTo(test_map));
+    }
+
     SECTION("Test copyPortable MapGrid2D")
     {
         {
@@ -14,14 +14,23 @@
 #include <yarp/manager/xmlresloader.h>
 #include <yarp/manager/xmlappsaver.h>
 #include <yarp/manager/singleapploader.h>
+#include <yarp/manager/portwatcher.h>
 #include <yarp/os/LogStream.h>
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <set>
+#include <thread>
+
 #include <yarp/os/impl/NameClient.h>
 
 
 #define RUN_TIMEOUT             10      // Run timeout in seconds
 #define STOP_TIMEOUT            30      // Stop timeout in seconds
 #define KILL_TIMEOUT            10      // kill timeout in seconds
+#define MAX_PARALLEL_STARTS     8       // modules started at the same time
+#define MAX_PARALLEL_CONNECTS   8       // connections established at the same time
 
 #define BROKER_LOCAL            "local"
 #define BROKER_YARPRUN          "yarprun"
@@ -860,10 +869,9 @@ bool Manager::run()
         } else {
             (*itr)->disableAutoConnect();
         }
-        (*itr)->start();
-        yarp::os::SystemClock::delaySystem(0.2);
         wait = (wait > (*itr)->getPostExecWait()) ? wait : (*itr)->getPostExecWait();
     }
+    startRunnables();
 
     // waiting for running
     double base = yarp::os::SystemClock::nowSystem();
@@ -916,6 +924,172 @@ bool Manager::run()
     return true;
 }
 
+/**
+ * Start all the runnables, following the dependencies among them:
+ * a module depending on a port of another module of the application is
+ * started only when that port is registered. Independent modules are
+ * started in parallel.
+ */
+void Manager::startRunnables()
+{
+    const size_t count = runnables.size();
+
+    // ports declared by the modules of the application
+    std::map<std::string, size_t> providers;
+    for (size_t i = 0; i < count; i++)
+    {
+        Module* module = runnables[i]->getModule();
+        if (module == nullptr) {
+            continue;
+        }
+        std::string prefix = module->getPrefix();
+        auto addPort = [&](const std::string& port) {
+            if (!port.empty()) {
+                providers.emplace(port, i);
+                if (!prefix.empty()) {
+                    providers.emplace(prefix + port, i);
+                }
+            }
+        };
+        for (int j = 0; j < module->outputCount(); j++) {
+            addPort(module->getOutputAt(j).getPort());
+        }
+        for (int j = 0; j < module->inputCount(); j++) {
+            addPort(module->getInputAt(j).getPort());
+        }
+    }
+
+    // required ports provided by other modules
+    std::vector<std::vector<std::string>> requiredPorts(count);
+    std::vector<std::set<size_t>> dependencies(count);
+    std::vector<double> waitTimeout(count, RUN_TIMEOUT);
+    for (size_t i = 0; i < count; i++)
+    {
+        for (auto& res : runnables[i]->getResources())
+        {
+            auto prov = providers.find(res.getPort());
+            if (prov != providers.end() && prov->second != i) {
+                requiredPorts[i].emplace_back(res.getPort());
+                dependencies[i].insert(prov->second);
+                waitTimeout[i] = std::max(waitTimeout[i], res.getTimeout());
+            }
+        }
+    }
+
+    // modules in a dependency cycle are started without waiting
+    std::vector<size_t> pendingDeps(count);
+    std::vector<size_t> sorted;
+    for (size_t i = 0; i < count; i++) {
+        pendingDeps[i] = dependencies[i].size();
+        if (pendingDeps[i] == 0) {
+            sorted.push_back(i);
+        }
+    }
+    for (size_t k = 0; k < sorted.size(); k++) {
+        for (size_t i = 0; i < count; i++) {
+            if (dependencies[i].count(sorted[k]) && --pendingDeps[i] == 0) {
+                sorted.push_back(i);
+            }
+        }
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        if (pendingDeps[i] != 0)
+        {
+            OSTRINGSTREAM msg;
+            msg<<runnables[i]->getCommand()<<" is part of a dependency cycle.";
+            logger->addWarning(msg);
+            requiredPorts[i].clear();
+        }
+    }
+
+    PortWatcher watcher;
+    bool needWatcher = std::any_of(requiredPorts.begin(), requiredPorts.end(),
+                                   [](const std::vector<std::string>& p) { return !p.empty(); });
+    if (needWatcher) {
+        watcher.open();
+    }
+
+    std::set<std::string> readyPorts;
+    std::vector<bool> started(count, false);
+    double base = yarp::os::SystemClock::nowSystem();
+    while (true)
+    {
+        double elapsed = yarp::os::SystemClock::nowSystem() - base;
+        std::vector<size_t> launchable;
+        std::vector<std::string> waitingPorts;
+        double nextTimeout = RUN_TIMEOUT;
+        for (size_t i = 0; i < count; i++)
+        {
+            if (started[i]) {
+                continue;
+            }
+            bool ready = true;
+            for (const auto& port : requiredPorts[i]) {
+                if (readyPorts.find(port) == readyPorts.end()) {
+                    ready = false;
+                    waitingPorts.push_back(port);
+                }
+            }
+            // on timeout, the module is started anyway and reports the missing resources
+            if (ready || elapsed >= waitTimeout[i]) {
+                launchable.push_back(i);
+                started[i] = true;
+            } else {
+                nextTimeout = std::min(nextTimeout, waitTimeout[i] - elapsed);
+            }
+        }
+
+        // starting the modules in parallel
+        std::atomic<size_t> next {0};
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < std::min<size_t>(launchable.size(), MAX_PARALLEL_STARTS); t++) {
+            workers.emplace_back([&]() {
+                for (size_t k = next++; k < launchable.size(); k = next++) {
+                    runnables[launchable[k]]->start();
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        if (std::all_of(started.begin(), started.end(), [](bool s) { return s; })) {
+            break;
+        }
+
+        for (const auto& port : watcher.waitAny(waitingPorts, nextTimeout)) {
+            readyPorts.insert(port);
+        }
+    }
+}
+
+bool Manager::connectInParallel(const std::function<bool(Connection&, YarpBroker&)>& func, bool stopOnError)
+{
+    std::atomic<size_t> next {0};
+    std::atomic<bool> ret {true};
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < std::min<size_t>(connections.size(), MAX_PARALLEL_CONNECTS); t++) {
+        workers.emplace_back([&]() {
+            // a broker for each thread, since the brokers keep the last error
+            YarpBroker broker;
+            for (size_t k = next++; k < connections.size(); k = next++)
+            {
+                if (stopOnError && !ret) {
+                    return;
+                }
+                if (!func(connections[k], broker)) {
+                    ret = false;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return ret;
+}
+
 bool Manager::stop(unsigned int id, bool async)
 {
     if(runnables.empty())
@@ -1089,31 +1263,28 @@ bool Manager::connect(unsigned int id)
 
 bool Manager::connect()
 {
-    //YarpBroker connector;
-    //connector.init();
-    CnnIterator cnn;
-    for(cnn=connections.begin(); cnn!=connections.end(); cnn++) {
-        if( !(*cnn).getFromExists() ||
-            !(*cnn).getToExists() ||
-            !connector.connect((*cnn).from(), (*cnn).to(),
-                               (*cnn).carrier(), (*cnn).isPersistent()) )
+    bool ret = connectInParallel([this](Connection& cnn, YarpBroker& connector) {
+        if( !cnn.getFromExists() ||
+            !cnn.getToExists() ||
+            !connector.connect(cnn.from(), cnn.to(),
+                               cnn.carrier(), cnn.isPersistent()) )
             {
                 logger->addError(connector.error());
-                //cout<<connector.error()<<endl;
                 if (bRestricted) {
                     return false;
                 }
             }
 
         // setting the connection Qos if specified
-        if(! connector.setQos((*cnn).from(), (*cnn).to(),
-                         (*cnn).qosFrom(), (*cnn).qosTo())) {
+        if(! connector.setQos(cnn.from(), cnn.to(),
+                         cnn.qosFrom(), cnn.qosTo())) {
             if (bRestricted) {
                 return false;
             }
         }
-    }
-    return true;
+        return true;
+    }, bRestricted);
+    return ret;
 }
 
 bool Manager::disconnect(unsigned int id)
@@ -1240,28 +1411,38 @@ bool Manager::connectExtraPorts()
     //YarpBroker connector;
     //connector.init();
 
-    double base = yarp::os::SystemClock::nowSystem();
-    while (!timeout(base, 10.0)) {
-        if (checkPortsAvailable(&connector)) {
-            break;
-        }
-    }
-
+    std::vector<std::string> ports;
     CnnIterator cnn;
     for(cnn=connections.begin(); cnn!=connections.end(); cnn++)
     {
-        //if(!(*cnn).owner() )
-        //{
-            if( !connector.connect((*cnn).from(), (*cnn).to(),
-                                   (*cnn).carrier()) )
-            {
-                logger->addError(connector.error());
-                //cout<<connector.error()<<endl;
-                return false;
-            }
-       //}
+        ports.emplace_back((*cnn).from());
+        ports.emplace_back((*cnn).to());
     }
-    return true;
+    std::sort(ports.begin(), ports.end());
+    ports.erase(std::unique(ports.begin(), ports.end()), ports.end());
+
+    // the connections to the missing ports are tried anyway and report their errors
+    PortWatcher watcher;
+    watcher.open();
+    std::vector<std::string> missing;
+    if (!watcher.waitAll(ports, 10.0, &missing))
+    {
+        for (const auto& port : missing)
+        {
+            OSTRINGSTREAM msg;
+            msg<<"Port "<<port<<" is not available.";
+            logger->addWarning(msg);
+        }
+    }
+
+    return connectInParallel([this](Connection& cnn, YarpBroker& connector) {
+        if( !connector.connect(cnn.from(), cnn.to(), cnn.carrier()) )
+        {
+            logger->addError(connector.error());
+            return false;
+        }
+        return true;
+    }, true);
 }
 
 bool Manager::running(unsigned int id)
@@ -12,6 +12,8 @@
 #include <yarp/manager/executable.h>
 #include <yarp/manager/yarpbroker.h>
 
+#include <functional>
+
 namespace yarp::manager {
 
 /**
@@ -113,6 +115,7 @@ protected:
     void onError(void* which) override;
     void onExecutableStdout(void* which, const char* msg) override;
 
+    virtual Broker* createBroker(Module* module);
 
 private:
     bool bWithWatchDog;
@@ -135,6 +138,8 @@ private:
     void clearExecutables();
     bool isServer(Module* module);
     bool connectExtraPorts();
+    void startRunnables();
+    bool connectInParallel(const std::function<bool(Connection&, YarpBroker&)>& func, bool stopOnError);
     bool checkPortsAvailable(Broker* broker);
     bool allRunning();
     bool oneRunning();
@@ -142,7 +147,6 @@ private:
     bool prepare(bool silent=true);
     bool timeout(double base, double t);
     bool updateResource(GenericResource* resource);
-    Broker* createBroker(Module* module);
     bool removeBroker(Executable* exe);
 };
 
@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/manager/portwatcher.h>
+
+#include <yarp/os/Network.h>
+#include <yarp/os/SystemClock.h>
+#include <yarp/os/Vocab.h>
+
+#include <algorithm>
+#include <chrono>
+
+#define CONNECTION_TIMEOUT      2.0         //seconds
+#define POLLING_PERIOD          0.2         //seconds, without name server events
+#define RECHECK_PERIOD          1.0         //seconds, with name server events
+
+using namespace yarp::manager;
+using namespace yarp::os;
+
+
+PortWatcher::~PortWatcher()
+{
+    close();
+}
+
+bool PortWatcher::open()
+{
+    close();
+    port.useCallback(*this);
+    if (!port.open("...")) {
+        return false;
+    }
+
+    ContactStyle style;
+    style.quiet = true;
+    style.timeout = CONNECTION_TIMEOUT;
+    bSubscribed = NetworkBase::connect(NetworkBase::getNameServerName(), port.getName(), style);
+    return bSubscribed;
+}
+
+void PortWatcher::close()
+{
+    if (!port.isClosed()) {
+        port.interrupt();
+        port.close();
+    }
+    bSubscribed = false;
+}
+
+void PortWatcher::onRead(Bottle& event)
+{
+    if (event.get(0).asVocab32() != yarp::os::createVocab32('a', 'd', 'd')) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    announced.insert(event.get(1).asString());
+    cond.notify_all();
+}
+
+bool PortWatcher::exists(const std::string& szport)
+{
+    ContactStyle style;
+    style.quiet = true;
+    style.timeout = CONNECTION_TIMEOUT;
+    return NetworkBase::exists(szport, style);
+}
+
+std::vector<std::string> PortWatcher::waitAny(const std::vector<std::string>& ports, double timeout)
+{
+    std::vector<std::string> found;
+    double base = SystemClock::nowSystem();
+    bool checkAll = true;
+    while (true)
+    {
+        std::vector<std::string> candidates;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (const auto& p : ports) {
+                if (checkAll || announced.count(p)) {
+                    candidates.push_back(p);
+                }
+                announced.erase(p);
+            }
+        }
+
+        for (const auto& p : candidates) {
+            if (exists(p)) {
+                found.push_back(p);
+            }
+        }
+        if (!found.empty()) {
+            return found;
+        }
+
+        double remaining = timeout - (SystemClock::nowSystem() - base);
+        if (remaining <= 0) {
+            return found;
+        }
+
+        // With the name server events, the ports are checked again as soon as
+        // one of them is announced, and periodically in case some event was lost.
+        double period = std::min(remaining, bSubscribed ? RECHECK_PERIOD : POLLING_PERIOD);
+        std::unique_lock<std::mutex> lock(mutex);
+        bool announcedPort = cond.wait_for(lock, std::chrono::duration<double>(period), [&]() {
+            return std::any_of(ports.begin(), ports.end(), [&](const std::string& p) { return announced.count(p) != 0; });
+        });
+        checkAll = !announcedPort;
+    }
+}
+
+bool PortWatcher::waitAll(const std::vector<std::string>& ports, double timeout,
+                          std::vector<std::string>* missing)
+{
+    std::vector<std::string> pending = ports;
+    double base = SystemClock::nowSystem();
+    while (!pending.empty())
+    {
+        double remaining = timeout - (SystemClock::nowSystem() - base);
+        std::vector<std::string> found = waitAny(pending, std::max(remaining, 0.0));
+        if (found.empty()) {
+            if (missing != nullptr) {
+                *missing = pending;
+            }
+            return false;
+        }
+        pending.erase(std::remove_if(pending.begin(), pending.end(), [&](const std::string& p) {
+                          return std::find(found.begin(), found.end(), p) != found.end();
+                      }),
+                      pending.end());
+    }
+    if (missing != nullptr) {
+        missing->clear();
+    }
+    return true;
+}
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_MANAGER_PORTWATCHER
+#define YARP_MANAGER_PORTWATCHER
+
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/BufferedPort.h>
+
+namespace yarp::manager {
+
+/**
+ * Class PortWatcher
+ *
+ * Waits for the registration of ports. When possible, it subscribes to the
+ * events of the name server (the name server writes an "add" event on its
+ * port whenever a port is registered), so that the ports are checked only
+ * when they are announced. Otherwise it falls back to polling.
+ */
+class PortWatcher : public yarp::os::TypedReaderCallback<yarp::os::Bottle>
+{
+public:
+    PortWatcher() = default;
+    ~PortWatcher() override;
+
+    bool open();
+    void close();
+    bool subscribed() const { return bSubscribed; }
+
+    /**
+     * Wait until at least one of the ports exists, or the timeout expires.
+     * @return the ports that exist.
+     */
+    std::vector<std::string> waitAny(const std::vector<std::string>& ports, double timeout);
+
+    /**
+     * Wait until all the ports exist.
+     * @param missing if not null, it is filled with the ports that do not
+     * exist when the timeout expires.
+     * @return false on timeout.
+     */
+    bool waitAll(const std::vector<std::string>& ports, double timeout,
+                 std::vector<std::string>* missing = nullptr);
+
+    using yarp::os::TypedReaderCallback<yarp::os::Bottle>::onRead;
+    void onRead(yarp::os::Bottle& event) override;
+
+private:
+    bool exists(const std::string& port);
+
+    yarp::os::BufferedPort<yarp::os::Bottle> port;
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::set<std::string> announced;
+    bool bSubscribed {false};
+};
+
+} // namespace yarp::manager
+
+#endif // YARP_MANAGER_PORTWATCHER
@@ -107,6 +107,7 @@ void ErrorLogger::addWarning(const char* szWarning) {
         std::string elapsedTime = getElapsedTimeString(clock.getStartTime());
         std::string timeinfo = "[time: " + elapsedTime + "] ";
         std::string szWarningWithTime = timeinfo + szWarning;
+        std::lock_guard<std::mutex> lock(mutex);
         warnings.emplace_back(szWarningWithTime);
     }
 }
@@ -116,6 +117,7 @@ void ErrorLogger::addWarning(const std::string &str) {
     std::string elapsedTime = getElapsedTimeString(clock.getStartTime());
     std::string timeinfo = "[time: " + elapsedTime + "] ";
     std::string strWithTime = timeinfo + str;
+    std::lock_guard<std::mutex> lock(mutex);
     warnings.push_back(strWithTime);
 }
 
@@ -129,6 +131,7 @@ void ErrorLogger::addError(const char* szError) {
         std::string elapsedTime = getElapsedTimeString(clock.getStartTime());
         std::string timeinfo = "[time: " + elapsedTime + "] ";
         std::string szErrorWithTime = timeinfo + szError;
+        std::lock_guard<std::mutex> lock(mutex);
         errors.emplace_back(szErrorWithTime);
     }
 }
@@ -138,6 +141,7 @@ void ErrorLogger::addError(const std::string &str) {
     std::string elapsedTime = getElapsedTimeString(clock.getStartTime());
     std::string timeinfo = "[time: " + elapsedTime + "] ";
     std::string strWithTime = timeinfo + str;
+    std::lock_guard<std::mutex> lock(mutex);
     errors.push_back(strWithTime);
 }
 
@@ -146,6 +150,7 @@ void ErrorLogger::addError(OSTRINGSTREAM &stream) {
 }
 
 const char* ErrorLogger::getLastError() {
+    std::lock_guard<std::mutex> lock(mutex);
     if (errors.empty()) {
         return nullptr;
     }
@@ -165,6 +170,7 @@ const char* ErrorLogger::getFormatedErrorString() {
 }
 
 const char* ErrorLogger::getLastWarning() {
+    std::lock_guard<std::mutex> lock(mutex);
     if (warnings.empty()) {
         return nullptr;
     }
@@ -185,15 +191,17 @@ const char* ErrorLogger::getFormatedWarningString() {
 
 
 void ErrorLogger::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
     errors.clear(); warnings.clear();
 }
 
 int ErrorLogger::errorCount() {
+    std::lock_guard<std::mutex> lock(mutex);
     return errors.size();
 }
 
 int ErrorLogger::warningCount() {
-
+    std::lock_guard<std::mutex> lock(mutex);
     return warnings.size();
 }
 
@@ -15,6 +15,7 @@
 #include <sstream>
 #include <chrono>
 #include <iomanip>
+#include <mutex>
 
 #include <yarp/manager/ymm-types.h>
 
@@ -78,6 +79,7 @@ private:
     ErrorLogger(ErrorLogger const&){}
     std::vector<std::string> errors;
     std::vector<std::string> warnings;
+    std::mutex mutex;
 };
 
 /**
@@ -0,0 +1,253 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/manager/broker.h>
+#include <yarp/manager/manager.h>
+
+#include <yarp/os/Network.h>
+#include <yarp/os/Port.h>
+#include <yarp/os/SystemClock.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace yarp::manager;
+using namespace yarp::os;
+
+namespace {
+
+// When the modules were started, and when their ports were opened
+struct Timeline
+{
+    std::mutex mutex;
+    std::map<std::string, double> started;
+    std::map<std::string, double> opened;
+};
+
+/**
+ * A broker that does not start any process: the module "runs" in this
+ * process and opens its ports after a delay.
+ */
+class FakeBroker : public Broker
+{
+public:
+    FakeBroker(Timeline& timeline, std::vector<std::string> ports, double delay) :
+            timeline(timeline),
+            ports(std::move(ports)),
+            delay(delay)
+    {
+    }
+
+    ~FakeBroker() override
+    {
+        stop();
+    }
+
+    bool init() override { return true; }
+    bool init(const char* szcmd, const char* /*szparam*/,
+              const char* /*szhost*/, const char* /*szstdio*/,
+              const char* /*szworkdir*/, const char* /*szenv*/) override
+    {
+        name = szcmd;
+        bInitialized = true;
+        return true;
+    }
+    void fini() override {}
+
+    bool start() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(timeline.mutex);
+            timeline.started[name] = SystemClock::nowSystem();
+        }
+        bRunning = true;
+        opener = std::thread([this]() {
+            SystemClock::delaySystem(delay);
+            for (const auto& port : ports) {
+                openPorts.push_back(std::make_unique<Port>());
+                openPorts.back()->open(port);
+            }
+            std::lock_guard<std::mutex> lock(timeline.mutex);
+            timeline.opened[name] = SystemClock::nowSystem();
+        });
+        return true;
+    }
+
+    bool stop() override
+    {
+        if (opener.joinable()) {
+            opener.join();
+        }
+        for (auto& port : openPorts) {
+            port->close();
+        }
+        openPorts.clear();
+        bRunning = false;
+        return true;
+    }
+    bool kill() override { return stop(); }
+
+    bool connect(const std::string& from, const std::string& to, const std::string& carrier, bool /*persist*/) override
+    {
+        return NetworkBase::connect(from, to, carrier);
+    }
+    bool disconnect(const std::string& from, const std::string& to, const std::string& carrier) override
+    {
+        return NetworkBase::disconnect(from, to, carrier);
+    }
+    int running() override { return bRunning ? 1 : 0; }
+    bool exists(const std::string& port) override
+    {
+        ContactStyle style;
+        style.quiet = true;
+        return NetworkBase::exists(port, style);
+    }
+    std::string requestRpc(const std::string& /*szport*/, const std::string& /*request*/, double /*timeout*/) override { return {}; }
+    bool connected(const std::string& from, const std::string& to, const std::string& carrier) override
+    {
+        return NetworkBase::isConnected(from, to, carrier);
+    }
+    std::string error() override { return {}; }
+    bool initialized() override { return bInitialized; }
+    bool attachStdout() override { return false; }
+    void detachStdout() override {}
+
+private:
+    Timeline& timeline;
+    std::vector<std::string> ports;
+    double delay;
+    std::string name;
+    std::atomic<bool> bRunning {false};
+    bool bInitialized {false};
+    std::thread opener;
+    std::vector<std::unique_ptr<Port>> openPorts;
+};
+
+class FakeManager : public Manager
+{
+public:
+    FakeManager(Timeline& timeline, std::map<std::string, double> delays) :
+            timeline(timeline),
+            delays(std::move(delays))
+    {
+    }
+
+    ~FakeManager() override
+    {
+        kill();
+    }
+
+protected:
+    Broker* createBroker(Module* module) override
+    {
+        std::vector<std::string> ports;
+        for (int i = 0; i < module->outputCount(); i++) {
+            ports.emplace_back(module->getOutputAt(i).getPort());
+        }
+        return new FakeBroker(timeline, ports, delays[module->getName()]);
+    }
+
+private:
+    Timeline& timeline;
+    std::map<std::string, double> delays;
+};
+
+void writeFile(const std::filesystem::path& filename, const std::string& content)
+{
+    std::ofstream f(filename);
+    f << content;
+}
+
+std::string moduleXml(const std::string& name, const std::string& port)
+{
+    return "<module>\n"
+           "  <name>" + name + "</name>\n"
+           "  <data>\n"
+           "    <output>\n"
+           "      <type>Bottle</type>\n"
+           "      <port>" + port + "</port>\n"
+           "    </output>\n"
+           "  </data>\n"
+           "</module>\n";
+}
+
+} // namespace
+
+TEST_CASE("manager::ManagerTest", "[yarp::manager]")
+{
+    NetworkBase::setLocalMode(true);
+
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / ("yarp_manager_test_" + std::to_string(std::rand()));
+    fs::create_directories(dir);
+
+    SECTION("test starting dependent modules in parallel")
+    {
+        writeFile(dir / "producer.xml", moduleXml("producer", "/managertest/producer/out"));
+        writeFile(dir / "consumer.xml", moduleXml("consumer", "/managertest/consumer/out"));
+        writeFile(dir / "other.xml", moduleXml("other", "/managertest/other/out"));
+        writeFile(dir / "app.xml",
+                  "<application>\n"
+                  "  <name>ManagerTestApp</name>\n"
+                  "  <module>\n"
+                  "    <name>consumer</name>\n"
+                  "    <node>localhost</node>\n"
+                  "    <dependencies>\n"
+                  "      <port timeout=\"5.0\">/managertest/producer/out</port>\n"
+                  "    </dependencies>\n"
+                  "  </module>\n"
+                  "  <module>\n"
+                  "    <name>producer</name>\n"
+                  "    <node>localhost</node>\n"
+                  "  </module>\n"
+                  "  <module>\n"
+                  "    <name>other</name>\n"
+                  "    <node>localhost</node>\n"
+                  "  </module>\n"
+                  "</application>\n");
+
+        Timeline timeline;
+        {
+            // the producer opens its port some time after it is started
+            FakeManager manager(timeline, {{"producer", 0.5}, {"consumer", 0.0}, {"other", 0.0}});
+            REQUIRE(manager.addModule((dir / "producer.xml").string().c_str()));
+            REQUIRE(manager.addModule((dir / "consumer.xml").string().c_str()));
+            REQUIRE(manager.addModule((dir / "other.xml").string().c_str()));
+            REQUIRE(manager.addApplication((dir / "app.xml").string().c_str()));
+            REQUIRE(manager.loadApplication("ManagerTestApp"));
+            REQUIRE(manager.getExecutables().size() == 3);
+
+            double base = SystemClock::nowSystem();
+            CHECK(manager.run());
+            CHECK(manager.running());
+
+            std::lock_guard<std::mutex> lock(timeline.mutex);
+            REQUIRE(timeline.started.size() == 3);
+            REQUIRE(timeline.opened.count("producer") == 1);
+
+            // the independent modules are started together, without waiting for each other
+            CHECK(timeline.started["producer"] - base < 0.4);
+            CHECK(timeline.started["other"] - base < 0.4);
+
+            // the consumer is started only when the port of the producer is available
+            CHECK(timeline.started["consumer"] >= timeline.opened["producer"]);
+        }
+    }
+
+    fs::remove_all(dir);
+
+    NetworkBase::setLocalMode(false);
+}
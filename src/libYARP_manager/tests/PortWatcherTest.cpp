@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/manager/portwatcher.h>
+
+#include <yarp/os/Network.h>
+#include <yarp/os/Port.h>
+#include <yarp/os/SystemClock.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace yarp::manager;
+using namespace yarp::os;
+
+TEST_CASE("manager::PortWatcherTest", "[yarp::manager]")
+{
+    NetworkBase::setLocalMode(true);
+
+    SECTION("test waiting for ports opened in parallel")
+    {
+        Port p1;
+        Port p2;
+        std::thread opener([&]() {
+            SystemClock::delaySystem(0.2);
+            p1.open("/portwatcher/test/p1");
+            SystemClock::delaySystem(0.2);
+            p2.open("/portwatcher/test/p2");
+        });
+
+        PortWatcher watcher;
+        watcher.open();
+        std::vector<std::string> ports {"/portwatcher/test/p1", "/portwatcher/test/p2"};
+
+        std::vector<std::string> found = watcher.waitAny(ports, 5.0);
+        CHECK_FALSE(found.empty());
+
+        std::vector<std::string> missing {"dummy"};
+        double base = SystemClock::nowSystem();
+        CHECK(watcher.waitAll(ports, 5.0, &missing));
+        CHECK(missing.empty());
+        CHECK(SystemClock::nowSystem() - base < 5.0);
+
+        opener.join();
+        p1.close();
+        p2.close();
+    }
+
+    SECTION("test reporting the missing ports")
+    {
+        Port p1;
+        REQUIRE(p1.open("/portwatcher/test/available"));
+
+        PortWatcher watcher;
+        watcher.open();
+        std::vector<std::string> missing;
+        CHECK_FALSE(watcher.waitAll({"/portwatcher/test/available", "/portwatcher/test/missing"}, 0.5, &missing));
+        REQUIRE(missing.size() == 1);
+        CHECK(missing[0] == "/portwatcher/test/missing");
+
+        CHECK(watcher.waitAny({"/portwatcher/test/missing"}, 0.2).empty());
+        p1.close();
+    }
+
+    NetworkBase::setLocalMode(false);
+}
@@ -6,6 +6,8 @@
 
 #include <yarp/os/Carriers.h>
 
+#include <yarp/conf/environment.h>
+
 #include <yarp/os/YarpPlugin.h>
 #include <yarp/os/impl/FakeFace.h>
 #include <yarp/os/impl/HttpCarrier.h>
@@ -19,6 +21,7 @@
 #include <yarp/os/impl/TextCarrier.h>
 #include <yarp/os/impl/UdpCarrier.h>
 
+#include <map>
 #include <vector>
 #include <mutex>
 
@@ -62,9 +65,11 @@ public:
 
     Carrier* chooseCarrier(const std::string& name,
                            bool load_if_needed = true,
-                           bool return_template = false);
+                           bool return_template = false,
+                           bool quiet = false);
     Carrier* chooseCarrier(const Bytes& header,
                            bool load_if_needed = true);
+    bool isCarrierAvailable(const std::string& name);
 
     static bool matchCarrier(const Bytes& header, Bottle& code);
     static bool checkForCarrier(const Bytes& header, Searchable& group);
@@ -77,11 +82,12 @@ std::mutex Carriers::Private::mutex{};
 
 Carrier* Carriers::Private::chooseCarrier(const std::string& name,
                                           bool load_if_needed,
-                                          bool return_template)
+                                          bool return_template,
+                                          bool quiet)
 {
     auto pos = name.find('+');
     if (pos != std::string::npos) {
-        return chooseCarrier(name.substr(0, pos), load_if_needed, return_template);
+        return chooseCarrier(name.substr(0, pos), load_if_needed, return_template, quiet);
     }
 
     for (auto& delegate : delegates) {
@@ -99,17 +105,34 @@ Carrier* Carriers::Private::chooseCarrier(const std::string& name,
         // let's try to register it, and see if a dll is found.
         if (NetworkBase::registerCarrier(name.c_str(), nullptr)) {
             // We made progress, let's try again...
-            return Carriers::Private::chooseCarrier(name, false);
+            return Carriers::Private::chooseCarrier(name, false, return_template, quiet);
         }
     }
 
-    yCError(CARRIERS,
-            "Could not find carrier \"%s\"",
-            (!name.empty()) ? name.c_str() : "[bytes]");
+    if (!quiet) {
+        yCError(CARRIERS,
+                "Could not find carrier \"%s\"",
+                (!name.empty()) ? name.c_str() : "[bytes]");
+    }
 
     return nullptr;
 }
 
+bool Carriers::Private::isCarrierAvailable(const std::string& name)
+{
+    if (chooseCarrier(name, false, true, true) != nullptr) {
+        return true;
+    }
+
+    // Look for the plugin without complaining if it is not installed
+    YarpPluginSelector selector;
+    selector.scan();
+    if (selector.getSelectedPlugins().findGroup(name.substr(0, name.find('+'))).isNull()) {
+        return false;
+    }
+    return chooseCarrier(name, true, true, true) != nullptr;
+}
+
 Carrier* Carriers::Private::chooseCarrier(const Bytes& header,
                                           bool load_if_needed)
 {
@@ -241,6 +264,38 @@ Carrier* Carriers::getCarrierTemplate(const std::string& name)
 }
 
 
+std::string Carriers::chooseLocalCarrier(const std::string& carrier)
+{
+    // The acknowledgement of the original carrier is preserved, so that the
+    // flow control of the connection does not change
+    static const std::map<std::string, std::string> localCarriers {
+        {"tcp", "unix_stream+ack"},
+        {"fast_tcp", "unix_stream"},
+    };
+
+    auto it = localCarriers.find(carrier);
+    if (it == localCarriers.end()) {
+        return {};
+    }
+
+    if (!yarp::conf::environment::get_bool("YARP_LOCAL_CARRIER_UPGRADE", true)) {
+        return {};
+    }
+
+    // Each plugin is searched only once
+    static std::mutex availableMutex;
+    static std::map<std::string, bool> available;
+    std::lock_guard<std::mutex> lock(availableMutex);
+    auto found = available.find(it->second);
+    if (found == available.end()) {
+        found = available.emplace(it->second, getInstance().mPriv->isCarrierAvailable(it->second)).first;
+    }
+    if (!found->second) {
+        return {};
+    }
+    return it->second;
+}
+
 Carrier* Carriers::chooseCarrier(const Bytes& bytes)
 {
     return getInstance().mPriv->chooseCarrier(bytes);
@@ -49,6 +49,21 @@ public:
      */
     static Carrier* getCarrierTemplate(const std::string& name);
 
+    /**
+     * Get the carrier that can replace the given one for a connection
+     * between two ports running on the same machine.
+     *
+     * The local carrier keeps the same semantics of the original one
+     * (e.g. "tcp" is replaced by "unix_stream+ack").
+     * The replacement can be disabled by setting the
+     * YARP_LOCAL_CARRIER_UPGRADE environment variable to 0.
+     *
+     * @param carrier the name of the carrier chosen for the connection.
+     * @return the name of the local carrier, or an empty string if
+     *         there is none available.
+     */
+    static std::string chooseLocalCarrier(const std::string& carrier);
+
     /**
      * Select a carrier by 8-byte header.
      *
@@ -15,6 +15,7 @@ yarp::os::ContactStyle::ContactStyle() :
         carrier(""),
         expectReply(true),
         persistent(false),
-        persistenceType(yarp::os::ContactStyle::OPENENDED)
+        persistenceType(yarp::os::ContactStyle::OPENENDED),
+        allowLocalCarrier(true)
 {
 }
@@ -79,6 +79,15 @@ public:
      */
     PersistenceType persistenceType;
 
+    /**
+     * Allow replacing the carrier of a connection between two ports
+     * running on the same machine with a faster local carrier (for
+     * example, "tcp" with "unix_stream+ack").
+     * The local carrier is never used when a carrier is explicitly
+     * requested for the connection.
+     */
+    bool allowLocalCarrier;
+
     /**
      * Constructor.  Sets all options to reasonable defaults.
      */
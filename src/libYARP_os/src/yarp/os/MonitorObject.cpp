@@ -47,6 +47,21 @@ yarp::os::Things& yarp::os::MonitorObject::update(yarp::os::Things& thing)
     return thing;
 }
 
+std::vector<yarp::os::Things*> yarp::os::MonitorObject::updateBatch(const std::vector<yarp::os::Things*>& things)
+{
+    std::vector<yarp::os::Things*> results;
+    results.reserve(things.size());
+    for (auto* thing : things) {
+        results.push_back(accept(*thing) ? &update(*thing) : nullptr);
+    }
+    return results;
+}
+
+bool yarp::os::MonitorObject::hasUpdateBatch() const
+{
+    return false;
+}
+
 yarp::os::Things& yarp::os::MonitorObject::updateReply(yarp::os::Things& thing)
 {
     YARP_UNUSED(thing);
@@ -9,6 +9,8 @@
 
 #include <yarp/os/api.h>
 
+#include <vector>
+
 namespace yarp::os {
 class Property;
 class Things;
@@ -79,6 +81,32 @@ public:
     virtual yarp::os::Things& update(yarp::os::Things& thing);
 
 
+    /**
+     * The updateBatch processes several messages in a single call, in place
+     * of accept() and update(). The portmonitor carrier uses it when
+     * hasUpdateBatch() returns true, passing all the messages that are
+     * waiting for the monitor object at the same time (e.g. the messages of
+     * the connections to the same port).
+     *
+     * @param things The messages in the order they were received. The
+     *        envelope of each message, if any, is available through
+     *        yarp::os::Things::getEnvelope().
+     * @return One entry for each message, in the same order: the message
+     *         possibly replaced by its modified version as in update(), or
+     *         nullptr if the message should not be delivered.
+     */
+    virtual std::vector<yarp::os::Things*> updateBatch(const std::vector<yarp::os::Things*>& things);
+
+    /**
+     * Monitor objects overriding updateBatch() should override this method
+     * as well, so that the portmonitor carrier calls updateBatch() in place
+     * of accept() and update().
+     *
+     * @return true if the messages should be passed to updateBatch()
+     */
+    virtual bool hasUpdateBatch() const;
+
+
     /**
      * The updateReply makes it possible to modify a reply from a port
      * when the portmonitor object is attached to a two-ways connection (e.g., RPC).
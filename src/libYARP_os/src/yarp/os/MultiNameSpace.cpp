@@ -191,6 +191,50 @@ public:
         return Contact();
     }
 
+    std::vector<Contact> queryNames(const std::vector<std::string>& names)
+    {
+        activate();
+        std::vector<Contact> result(names.size());
+        // indexes of the names not resolved yet
+        std::vector<size_t> missing(names.size());
+        for (size_t i = 0; i < names.size(); ++i) {
+            missing[i] = i;
+        }
+        // try query against each namespace in order, only asking for the
+        // names that previous namespaces did not know
+        for (auto ns : spaces) {
+            if (ns == nullptr) {
+                continue;
+            }
+            std::vector<size_t> todo;
+            std::vector<std::string> query;
+            for (auto i : missing) {
+                if (ns->getNameServerName() == names[i]) {
+                    result[i] = ns->getNameServerContact();
+                } else {
+                    todo.push_back(i);
+                    query.push_back(names[i]);
+                }
+            }
+            missing.clear();
+            if (query.empty()) {
+                break;
+            }
+            std::vector<Contact> found = ns->queryNames(query);
+            for (size_t j = 0; j < todo.size(); ++j) {
+                if (j < found.size() && found[j].isValid()) {
+                    result[todo[j]] = found[j];
+                } else {
+                    missing.push_back(todo[j]);
+                }
+            }
+            if (missing.empty()) {
+                break;
+            }
+        }
+        return result;
+    }
+
     // return one namespace, any namespace (in fact always first)
     NameSpace* getOne()
     {
@@ -280,6 +324,11 @@ Contact MultiNameSpace::queryName(const std::string& name)
     return HELPER(this).queryName(name);
 }
 
+std::vector<Contact> MultiNameSpace::queryNames(const std::vector<std::string>& names)
+{
+    return HELPER(this).queryNames(names);
+}
+
 bool MultiNameSpace::connectPortToTopic(const Contact& src,
                                         const Contact& dest,
                                         const ContactStyle& style)
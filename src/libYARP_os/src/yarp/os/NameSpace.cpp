@@ -61,6 +61,16 @@ bool NameSpace::checkNetwork(double timeout)
     return true;
 }
 
+std::vector<Contact> NameSpace::queryNames(const std::vector<std::string>& names)
+{
+    std::vector<Contact> result;
+    result.reserve(names.size());
+    for (const auto& name : names) {
+        result.push_back(queryName(name));
+    }
+    return result;
+}
+
 std::string NameSpace::getNameServerName() const
 {
     return getNameServerContact().getName();
@@ -11,6 +11,9 @@
 #include <yarp/os/Network.h>
 #include <yarp/os/Value.h>
 
+#include <string>
+#include <vector>
+
 namespace yarp::os {
 
 /**
@@ -59,6 +62,19 @@ public:
      */
     virtual Contact queryName(const std::string& name) = 0;
 
+    /**
+     * Map a list of port names to their contact information.
+     *
+     * Name spaces able to resolve several names with a single request
+     * should override this method, the default implementation calls
+     * queryName() for each name.
+     *
+     * @param names the names of the ports.
+     * @return the contacts, in the same order as the names (invalid if
+     *         the port is not known).
+     */
+    virtual std::vector<Contact> queryNames(const std::vector<std::string>& names);
+
     /**
      * Record contact information to tie to a port name.
      */
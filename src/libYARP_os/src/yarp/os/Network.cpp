@@ -23,6 +23,7 @@
 #include <yarp/os/impl/BufferedConnectionWriter.h>
 #include <yarp/os/impl/LogComponent.h>
 #include <yarp/os/impl/LogForwarder.h>
+#include <yarp/os/impl/NameCache.h>
 #include <yarp/os/impl/NameConfig.h>
 #include <yarp/os/impl/PlatformSignal.h>
 #include <yarp/os/impl/PlatformStdio.h>
@@ -40,10 +41,15 @@
 #    endif
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
+#include <map>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace yarp::os::impl;
 using namespace yarp::os;
@@ -99,6 +105,11 @@ static bool needsLookup(const Contact& contact)
     return true;
 }
 
+static std::string extractCarrierNameOnly(const std::string& carrier_name_with_params)
+{
+    return carrier_name_with_params.substr(0, carrier_name_with_params.find('+'));
+}
+
 static int noteDud(const Contact& src)
 {
     NameStore* store = getNameSpace().getQueryBypass();
@@ -122,7 +133,8 @@ static int enactConnection(const Contact& src,
                            const Contact& dest,
                            const ContactStyle& style,
                            int mode,
-                           bool reversed)
+                           bool reversed,
+                           const std::string& localCarrier = {})
 {
     ContactStyle rpc;
     rpc.admin = true;
@@ -179,6 +191,10 @@ static int enactConnection(const Contact& src,
                    carrier.c_str());
         }
         if (mode == YARP_ENACT_EXISTS) {
+            if (!localCarrier.empty() && extractCarrierNameOnly(carrier) == extractCarrierNameOnly(localCarrier)) {
+                // The connection was upgraded to a local carrier
+                return 0;
+            }
             return (carrier == style.carrier) ? 0 : 1;
         }
 
@@ -225,11 +241,42 @@ static int enactConnection(const Contact& src,
         c2 = NetworkBase::queryName(c2.getName());
     }
 
-    yCDebug(NETWORK, "** asking %s: %s", src.toString().c_str(), cmd.toString().c_str());
-    ok = NetworkBase::write(c2, cmd, reply, rpc);
-    if (!ok) {
-        noteDud(src);
-        return 1;
+    // When both ports run on the same machine, try the local carrier first,
+    // and fall back to the requested carrier if the connection fails.
+    bool connected = false;
+    if (mode == YARP_ENACT_CONNECT && !localCarrier.empty()) {
+        Bottle localCmd;
+        Contact lc = dest;
+        lc.setCarrier(localCarrier);
+        localCmd.addVocab32(act);
+        localCmd.addString(lc.toString());
+        yCDebug(NETWORK, "** asking %s: %s", src.toString().c_str(), localCmd.toString().c_str());
+        connected = NetworkBase::write(c2, localCmd, reply, rpc) && reply.get(0).isInt32() && reply.get(0).asInt32() == 0;
+        if (connected) {
+            yCDebug(NETWORK,
+                    "Connection between %s and %s upgraded from carrier %s to %s",
+                    src.getName().c_str(),
+                    dest.getName().c_str(),
+                    style.carrier.c_str(),
+                    localCarrier.c_str());
+        } else {
+            yCDebug(NETWORK,
+                    "Cannot connect %s and %s using carrier %s, falling back to %s",
+                    src.getName().c_str(),
+                    dest.getName().c_str(),
+                    localCarrier.c_str(),
+                    style.carrier.c_str());
+            reply.clear();
+        }
+    }
+
+    if (!connected) {
+        yCDebug(NETWORK, "** asking %s: %s", src.toString().c_str(), cmd.toString().c_str());
+        ok = NetworkBase::write(c2, cmd, reply, rpc);
+        if (!ok) {
+            noteDud(src);
+            return 1;
+        }
     }
     std::string msg;
     if (reply.get(0).isInt32()) {
@@ -267,11 +314,32 @@ static std::string collectParams(Contact& c)
     return {};
 }
 
-static std::string extractCarrierNameOnly(const std::string& carrier_name_with_params)
+// Check if the processes owning two ports see the same file system, as
+// reported by the "prop get" port command.
+// The namespace is not reported by older versions of YARP and on systems
+// other than Linux: in this case the file system is not considered shared.
+static bool shareFilesystem(const Contact& src, const Contact& dest)
 {
-    return carrier_name_with_params.substr(0, carrier_name_with_params.find('+'));
+    std::string ns[2];
+    const Contact* ports[2] = {&src, &dest};
+    for (size_t i = 0; i < 2; i++) {
+        Bottle cmd;
+        Bottle reply;
+        cmd.addString("prop");
+        cmd.addString("get");
+        cmd.addString(ports[i]->getName());
+        if (!NetworkBase::write(*ports[i], cmd, reply, true, true, 2.0)) {
+            return false;
+        }
+        Bottle* platform = reply.findGroup("platform").find("platform").asList();
+        if (platform != nullptr) {
+            ns[i] = platform->find("namespace").asString();
+        }
+    }
+    return !ns[0].empty() && ns[0] == ns[1];
 }
 
+
 /*
 
    Connect two ports, bearing in mind that one of them may not be
@@ -289,10 +357,23 @@ static std::string extractCarrierNameOnly(const std::string& carrier_name_with_p
 
 */
 
+static Contact queryResolvedName(const std::string& name,
+                                 const std::map<std::string, Contact>* resolved)
+{
+    if (resolved != nullptr) {
+        auto it = resolved->find(name);
+        if (it != resolved->end()) {
+            return it->second;
+        }
+    }
+    return NetworkBase::queryName(name);
+}
+
 static int metaConnect(const std::string& src,
                        const std::string& dest,
                        ContactStyle style,
-                       int mode)
+                       int mode,
+                       const std::map<std::string, Contact>* resolved = nullptr)
 {
     yCTrace(NETWORK,
             "working on connection %s to %s (%s)",
@@ -317,6 +398,7 @@ static int metaConnect(const std::string& src,
     // get the expressed contacts, without name server input
     Contact dynamicSrc = Contact::fromString(src);
     Contact dynamicDest = Contact::fromString(dest);
+    bool carrierRequested = !style.carrier.empty() || !dynamicSrc.getCarrier().empty() || !dynamicDest.getCarrier().empty();
 
     yCTrace(NETWORK,
             "DYNAMIC_SRC: name=%s, carrier=%s",
@@ -351,7 +433,7 @@ static int metaConnect(const std::string& src,
     Contact staticSrc;
     Contact staticDest;
     if (needsLookup(dynamicSrc) && (topicalNeedsLookup || !topical)) {
-        staticSrc = NetworkBase::queryName(dynamicSrc.getName());
+        staticSrc = queryResolvedName(dynamicSrc.getName(), resolved);
         if (!staticSrc.isValid()) {
             if (!style.persistent) {
                 if (!style.quiet) {
@@ -374,7 +456,7 @@ static int metaConnect(const std::string& src,
     }
 
     if (needsLookup(dynamicDest) && (topicalNeedsLookup || !topical)) {
-        staticDest = NetworkBase::queryName(dynamicDest.getName());
+        staticDest = queryResolvedName(dynamicDest.getName(), resolved);
         if (!staticDest.isValid()) {
             if (!style.persistent) {
                 if (!style.quiet) {
@@ -633,12 +715,30 @@ static int metaConnect(const std::string& src,
         }
     }
 
+    // If the user did not ask for a specific carrier, and both ports run on
+    // the same machine, a faster local carrier can be used instead.
+    // The same address is not enough (e.g. the ports could run in two
+    // containers using the network of the host), therefore the ports are
+    // asked which file system they see before trying to connect.
+    std::string localCarrier;
+    if (!carrierRequested && carrierConstraint.empty() && !topical && style.allowLocalCarrier && mode != YARP_ENACT_DISCONNECT && !staticSrc.getHost().empty() && staticSrc.getHost() == staticDest.getHost()) {
+        localCarrier = Carriers::chooseLocalCarrier(style.carrier);
+        if (mode == YARP_ENACT_CONNECT && !localCarrier.empty() && !shareFilesystem(staticSrc, staticDest)) {
+            yCDebug(NETWORK,
+                    "%s and %s do not share the same file system, carrier %s not used",
+                    src.c_str(),
+                    dest.c_str(),
+                    localCarrier.c_str());
+            localCarrier.clear();
+        }
+    }
+
     int result = -1;
     if ((srcIsCompetent && connectionIsPush) || topical) {
         // Classic case.
         Contact c = Contact::fromString(dest);
         delete connectionCarrier;
-        return enactConnection(staticSrc, c, style, mode, false);
+        return enactConnection(staticSrc, c, style, mode, false, localCarrier);
     }
     if (destIsCompetent && connectionIsPull) {
         Contact c = Contact::fromString(src);
@@ -679,6 +779,74 @@ static int metaConnect(const std::string& src,
     return 1;
 }
 
+static std::vector<bool> metaConnectMany(const std::vector<Route>& routes,
+                                        const ContactStyle& style,
+                                        int mode)
+{
+    constexpr size_t maxParallelConnections = 8;
+
+    // Resolve all the port names with as few requests as possible to the
+    // name server (the same shortcuts used by NetworkBase::queryName are
+    // applied here)
+    std::map<std::string, Contact> resolved;
+    std::vector<std::string> query;
+    std::string serverName = NetworkBase::getNameServerName();
+    for (const auto& route : routes) {
+        for (const auto& name : {route.getFromName(), route.getToName()}) {
+            Contact c = Contact::fromString(name);
+            if (!needsLookup(c) || resolved.find(c.getName()) != resolved.end()) {
+                continue;
+            }
+            if (c.getName() == serverName) {
+                resolved[c.getName()] = NetworkBase::getNameServerContact();
+                continue;
+            }
+            Contact direct = Contact::fromString(c.getName());
+            if (direct.isValid() && direct.getPort() > 0) {
+                resolved[c.getName()] = direct;
+                continue;
+            }
+            resolved[c.getName()] = Contact();
+            query.push_back(c.getName());
+        }
+    }
+    if (!query.empty()) {
+        yCDebug(NETWORK, "querying %zu names for %zu routes", query.size(), routes.size());
+        std::vector<Contact> contacts = getNameSpace().queryNames(query);
+        for (size_t i = 0; i < query.size() && i < contacts.size(); ++i) {
+            resolved[query[i]] = contacts[i];
+        }
+    }
+
+    // Send the commands to the ports in parallel
+    std::vector<int> results(routes.size(), 1);
+    std::atomic<size_t> next {0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < routes.size(); i = next++) {
+            ContactStyle routeStyle = style;
+            if (!routes[i].getCarrierName().empty()) {
+                routeStyle.carrier = routes[i].getCarrierName();
+            }
+            results[i] = metaConnect(routes[i].getFromName(), routes[i].getToName(), routeStyle, mode, &resolved);
+        }
+    };
+    size_t count = std::min(routes.size(), maxParallelConnections);
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < count; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : workers) {
+        t.join();
+    }
+
+    std::vector<bool> ret(routes.size());
+    for (size_t i = 0; i < routes.size(); ++i) {
+        ret[i] = (results[i] == 0);
+    }
+    return ret;
+}
+
 bool NetworkBase::connect(const std::string& src, const std::string& dest, const std::string& carrier, bool quiet)
 {
     ContactStyle style;
@@ -697,6 +865,12 @@ bool NetworkBase::connect(const std::string& src,
     return result == 0;
 }
 
+std::vector<bool> NetworkBase::connectMany(const std::vector<Route>& routes,
+                                          const ContactStyle& style)
+{
+    return metaConnectMany(routes, style, YARP_ENACT_CONNECT);
+}
+
 bool NetworkBase::disconnect(const std::string& src,
                              const std::string& dest,
                              bool quiet)
@@ -724,6 +898,12 @@ bool NetworkBase::disconnect(const std::string& src, const std::string& dest, co
     return disconnect(src, dest, style);
 }
 
+std::vector<bool> NetworkBase::disconnectMany(const std::vector<Route>& routes,
+                                             const ContactStyle& style)
+{
+    return metaConnectMany(routes, style, YARP_ENACT_DISCONNECT);
+}
+
 bool NetworkBase::isConnected(const std::string& src,
                               const std::string& dest,
                               bool quiet)
@@ -939,6 +1119,9 @@ void NetworkBase::initMinimum(yarp::os::yarpClockType clockType, yarp::os::Clock
 void NetworkBase::finiMinimum()
 {
     if (__yarp_is_initialized == 1) {
+        // The name cache port must be closed as well.
+        yarp::os::impl::NameCache::shutdown();
+
         // The log forwarder needs to be shut down in order to close the
         // internal port. The shutdown method will do nothing if the
         // LogForwarded was not used.
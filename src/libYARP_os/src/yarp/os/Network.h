@@ -17,9 +17,12 @@
 #include <yarp/os/Value.h>
 
 
+#include <vector>
+
 namespace yarp::os {
 class ContactStyle;
 class QosStyle;
+class Route;
 } // namespace yarp::os
 
 // Make plugins in a library available for use
@@ -137,6 +140,21 @@ public:
                         const std::string& dest,
                         const ContactStyle& style);
 
+    /**
+     * Request several connections between output and input ports.
+     *
+     * The port names are looked up with as few requests to the name server
+     * as possible, and the ports are contacted in parallel.
+     * The carrier of each route (if not empty) overrides the one in
+     * the style.
+     *
+     * @param routes the connections to make
+     * @param style options for the connections
+     * @return the result of each connection, in the same order as the routes
+     */
+    static std::vector<bool> connectMany(const std::vector<Route>& routes,
+                                         const ContactStyle& style = ContactStyle());
+
     /**
      * Request that an output port disconnect from an input port.
      * @param src the name of an output port
@@ -159,6 +177,16 @@ public:
                            const std::string& dest,
                            const ContactStyle& style);
 
+    /**
+     * Request several output ports to disconnect from input ports.
+     * @see connectMany()
+     * @param routes the connections to remove
+     * @param style options for the disconnections
+     * @return the result of each disconnection, in the same order as the routes
+     */
+    static std::vector<bool> disconnectMany(const std::vector<Route>& routes,
+                                            const ContactStyle& style = ContactStyle());
+
     /**
      * Request that an output port disconnect from an input port.
      * @param src the name of an output port
@@ -7,12 +7,23 @@
 #include <yarp/os/PeriodicThread.h>
 
 #include <yarp/os/SystemClock.h>
+#include <yarp/os/impl/LogComponent.h>
+#include <yarp/os/impl/PeriodicThreadExecutor.h>
 #include <yarp/os/impl/ThreadImpl.h>
 
 #include <cmath>
 #include <algorithm> // std::max
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+#    include <cerrno>
+#    include <ctime>
+#endif
 
 using namespace yarp::os::impl;
 using namespace yarp::os;
@@ -20,6 +31,40 @@ using namespace yarp::os;
 
 namespace
 {
+    YARP_OS_LOG_COMPONENT(PERIODICTHREAD, "yarp.os.PeriodicThread")
+
+    // Time of the monotonic clock [sec]
+    double monotonicNow()
+    {
+#if defined(__linux__)
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1e-9;
+#else
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    // Sleep until an absolute time of the monotonic clock [sec]
+    void monotonicSleepUntil(double deadline)
+    {
+#if defined(__linux__)
+        struct timespec ts;
+        ts.tv_sec = static_cast<time_t>(std::floor(deadline));
+        ts.tv_nsec = static_cast<long>((deadline - std::floor(deadline)) * 1e9);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+        }
+#else
+        std::chrono::steady_clock::time_point tp(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(deadline)));
+        std::this_thread::sleep_until(tp);
+#endif
+    }
+
+    void monotonicDelay(double seconds)
+    {
+        monotonicSleepUntil(monotonicNow() + seconds);
+    }
+
     class DelayEstimatorBase
     {
     public:
@@ -31,6 +76,7 @@ namespace
         virtual void onSchedule(unsigned int count, double now) {};
         virtual double computeDelay(unsigned int count, double now, double elapsed) const = 0;
         virtual void reset(unsigned int count, double now) {};
+        virtual void skip(unsigned int iterations) {};
 
     private:
         double adaptedPeriod;
@@ -72,6 +118,11 @@ namespace
             scheduleAdapt = false;
         }
 
+        void skip(unsigned int iterations) override
+        {
+            refTime += getPeriod() * iterations;
+        }
+
     private:
         unsigned int countOffset {0}; // iteration to count from for delay calculation
         double refTime {0.0};         // absolute reference time for delay calculation
@@ -92,12 +143,18 @@ namespace
     } // namespace
 
 
-class yarp::os::PeriodicThread::Private : public ThreadImpl
+class yarp::os::PeriodicThread::Private :
+        public ThreadImpl,
+        public PeriodicThreadExecutor::Task
 {
 private:
     PeriodicThread* owner;
     mutable std::mutex mutex;
 
+    bool sharedExecution {false};  // scheduled by the PeriodicThreadExecutor
+    bool usingExecutor {false};    // sharedExecution, for the current run
+    std::atomic<bool> sharedRunning {false};
+
     bool suspended;
     double totalUsed;    //total time taken iterations
     unsigned int count;  //number of iterations from last reset
@@ -106,8 +163,19 @@ private:
     double sumTSq;       //cumulative sum sq of estimated period dT
     double sumUsedSq;    //cumulative sum sq of estimated thread tun
     double previousRun;  //time when last iteration started
+    unsigned int overruns; //number of iterations ended after the next one was due
+    double maxOverrun;   //maximum delay with respect to the schedule
     bool scheduleReset;
 
+    // histogram of the wake up latency, bin 0 is [0, 1us), bin i is [2^(i-1), 2^i) us
+    static constexpr size_t jitterBins = 21;
+    std::array<unsigned int, jitterBins> jitterHistogram;
+    double maxJitter;
+    double expectedWakeUp; //time when the current iteration should have started
+    bool hasExpectedWakeUp;
+
+    const bool realTime; //sleep until absolute deadlines of the monotonic clock
+
     std::unique_ptr<DelayEstimatorBase> delayEstimator;
 
     using NowFuncPtr = double (*)();
@@ -123,9 +191,25 @@ private:
         totalT = 0;
         sumUsedSq = 0;
         sumTSq = 0;
+        overruns = 0;
+        maxOverrun = 0;
+        jitterHistogram.fill(0);
+        maxJitter = 0;
         scheduleReset = false;
     }
 
+    void recordJitter(double jitter)
+    {
+        jitter = std::fabs(jitter);
+        double us = jitter * 1e6;
+        size_t bin = 0;
+        if (us >= 1.0) {
+            bin = std::min(static_cast<size_t>(std::floor(std::log2(us))) + 1, jitterBins - 1);
+        }
+        jitterHistogram[bin]++;
+        maxJitter = std::max(maxJitter, jitter);
+    }
+
 public:
     Private(PeriodicThread* owner, double p, ShouldUseSystemClock useSystemClock, PeriodicThreadClock clockAccuracy) :
             owner(owner),
@@ -137,9 +221,16 @@ public:
             sumTSq(0),
             sumUsedSq(0),
             previousRun(0),
+            overruns(0),
+            maxOverrun(0),
             scheduleReset(false),
-            nowFunc(useSystemClock == ShouldUseSystemClock::Yes ? SystemClock::nowSystem : yarp::os::Time::now),
-            delayFunc(useSystemClock == ShouldUseSystemClock::Yes ? SystemClock::delaySystem : yarp::os::Time::delay)
+            jitterHistogram{},
+            maxJitter(0),
+            expectedWakeUp(0),
+            hasExpectedWakeUp(false),
+            realTime(clockAccuracy == PeriodicThreadClock::RealTime),
+            nowFunc(realTime ? monotonicNow : (useSystemClock == ShouldUseSystemClock::Yes ? SystemClock::nowSystem : yarp::os::Time::now)),
+            delayFunc(realTime ? monotonicDelay : (useSystemClock == ShouldUseSystemClock::Yes ? SystemClock::delaySystem : yarp::os::Time::delay))
     {
         if (clockAccuracy == PeriodicThreadClock::Relative) {
             delayEstimator = std::make_unique<RelativeDelayEstimator>(p);
@@ -148,6 +239,13 @@ public:
         }
     }
 
+    ~Private() override
+    {
+        if (usingExecutor) {
+            PeriodicThreadExecutor::instance().stop(this);
+        }
+    }
+
     void resetStat()
     {
         scheduleReset = true;
@@ -221,7 +319,44 @@ public:
         unlock();
     }
 
-    void step()
+    unsigned int getOverruns() const
+    {
+        lock();
+        unsigned int ret = overruns;
+        unlock();
+        return ret;
+    }
+
+    double getMaxOverrun() const
+    {
+        lock();
+        double ret = maxOverrun;
+        unlock();
+        return ret;
+    }
+
+    void getJitterHistogram(std::vector<double>& binEdges, std::vector<unsigned int>& counts) const
+    {
+        binEdges.resize(jitterBins);
+        counts.resize(jitterBins);
+        lock();
+        for (size_t i = 0; i < jitterBins; ++i) {
+            binEdges[i] = (i == 0) ? 0.0 : std::ldexp(1e-6, static_cast<int>(i) - 1);
+            counts[i] = jitterHistogram[i];
+        }
+        unlock();
+    }
+
+    double getMaxJitter() const
+    {
+        lock();
+        double ret = maxJitter;
+        unlock();
+        return ret;
+    }
+
+    // Execute one iteration, and return the time to wait before the next one
+    double runOnce()
     {
         lock();
         double currentRun = nowFunc();
@@ -232,6 +367,10 @@ public:
             delayEstimator->reset(count, currentRun);
         }
 
+        if (hasExpectedWakeUp) {
+            recordJitter(currentRun - expectedWakeUp);
+        }
+
         if (count > 0) {
             double dT = currentRun - previousRun;
             sumTSq += dT * dT;
@@ -261,9 +400,115 @@ public:
         //save last
         totalUsed += elapsed;
         sumUsedSq += elapsed * elapsed;
+        if (sleepPeriod < 0) {
+            overruns++;
+            maxOverrun = std::max(maxOverrun, -sleepPeriod);
+            double period = delayEstimator->getPeriod();
+            if (realTime && period > 0) {
+                // Skip the missed deadlines, keeping the phase of the schedule
+                auto missed = static_cast<unsigned int>(std::ceil(-sleepPeriod / period));
+                delayEstimator->skip(missed);
+                sleepPeriod += missed * period;
+            }
+        }
+        expectedWakeUp = now + sleepPeriod;
+        hasExpectedWakeUp = true;
         unlock();
 
-        delayFunc(sleepPeriod);
+        return sleepPeriod;
+    }
+
+    void step()
+    {
+        double sleepPeriod = runOnce();
+        if (realTime) {
+            monotonicSleepUntil(expectedWakeUp);
+        } else {
+            delayFunc(sleepPeriod);
+        }
+    }
+
+    double execute() override
+    {
+        return runOnce();
+    }
+
+    void release() override
+    {
+        threadRelease();
+        sharedRunning = false;
+    }
+
+    bool setSharedExecution(bool shared)
+    {
+        if (isRunning()) {
+            return false;
+        }
+        sharedExecution = shared;
+        return true;
+    }
+
+    bool isSharedExecution() const
+    {
+        return sharedExecution;
+    }
+
+    bool start() override
+    {
+        auto& executor = PeriodicThreadExecutor::instance();
+        // Wait for the release of a previous run
+        if (usingExecutor) {
+            executor.stop(this);
+        }
+
+        // The executor can only wait for the system clock, and it does not
+        // sleep until the absolute deadlines required by the real-time mode
+        usingExecutor = sharedExecution && !realTime && (nowFunc == SystemClock::nowSystem || Time::isSystemClock());
+        if (sharedExecution && !usingExecutor) {
+            if (realTime) {
+                yCWarning(PERIODICTHREAD, "The shared executor does not support the RealTime clock, using a dedicated thread");
+            } else {
+                yCWarning(PERIODICTHREAD, "The shared executor requires the system clock, using a dedicated thread");
+            }
+        }
+        if (!usingExecutor) {
+            return ThreadImpl::start();
+        }
+
+        beforeStart();
+        bool success = threadInit();
+        afterStart(success);
+        if (success) {
+            sharedRunning = true;
+            executor.start(this);
+        }
+        return success;
+    }
+
+    void close() override
+    {
+        if (!usingExecutor) {
+            ThreadImpl::close();
+            return;
+        }
+        PeriodicThreadExecutor::instance().stop(this);
+    }
+
+    void askToStop()
+    {
+        if (!usingExecutor) {
+            askToClose();
+            return;
+        }
+        PeriodicThreadExecutor::instance().askToStop(this);
+    }
+
+    bool isRunning()
+    {
+        if (!usingExecutor) {
+            return ThreadImpl::isRunning();
+        }
+        return sharedRunning;
     }
 
     void run() override
@@ -275,6 +520,7 @@ public:
 
     bool threadInit() override
     {
+        hasExpectedWakeUp = false;
         delayEstimator->onInit();
         return owner->threadInit();
     }
@@ -371,7 +617,7 @@ void PeriodicThread::stop()
 
 void PeriodicThread::askToStop()
 {
-    mPriv->askToClose();
+    mPriv->askToStop();
 }
 
 void PeriodicThread::step()
@@ -424,6 +670,36 @@ void PeriodicThread::getEstimatedUsed(double& av, double& std) const
     mPriv->getEstimatedUsed(av, std);
 }
 
+unsigned int PeriodicThread::getOverruns() const
+{
+    return mPriv->getOverruns();
+}
+
+double PeriodicThread::getMaxOverrun() const
+{
+    return mPriv->getMaxOverrun();
+}
+
+void PeriodicThread::getJitterHistogram(std::vector<double>& binEdges, std::vector<unsigned int>& counts) const
+{
+    mPriv->getJitterHistogram(binEdges, counts);
+}
+
+double PeriodicThread::getMaxJitter() const
+{
+    return mPriv->getMaxJitter();
+}
+
+bool PeriodicThread::setSharedExecution(bool shared)
+{
+    return mPriv->setSharedExecution(shared);
+}
+
+bool PeriodicThread::isSharedExecution() const
+{
+    return mPriv->isSharedExecution();
+}
+
 void PeriodicThread::resetStat()
 {
     mPriv->resetStat();
@@ -452,6 +728,16 @@ int PeriodicThread::setPriority(int priority, int policy)
     return mPriv->setPriority(priority, policy);
 }
 
+int PeriodicThread::setCpuAffinity(const std::vector<int>& cpus)
+{
+    return mPriv->setCpuAffinity(cpus);
+}
+
+std::vector<int> PeriodicThread::getCpuAffinity() const
+{
+    return mPriv->getCpuAffinity();
+}
+
 int PeriodicThread::getPriority() const
 {
     return mPriv->getPriority();
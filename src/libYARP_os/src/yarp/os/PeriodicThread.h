@@ -10,12 +10,24 @@
 #include <yarp/os/api.h>
 #include <yarp/os/Time.h>
 
+#include <vector>
+
 namespace yarp::os {
 
 enum class PeriodicThreadClock
 {
     Relative,
-    Absolute
+    Absolute,
+    /**
+     * Like Absolute, but the thread always uses the monotonic clock of the
+     * system (ignoring the network clock), and sleeps until the absolute
+     * deadline of the next step (using clock_nanosleep() with TIMER_ABSTIME
+     * where available). Missed deadlines are skipped instead of executing
+     * the late steps back to back.
+     * This mode is meant for real-time loops, possibly in conjunction with
+     * setPriority() and setCpuAffinity().
+     */
+    RealTime
 };
 
 /**
@@ -156,6 +168,65 @@ public:
      */
     void getEstimatedUsed(double& av, double& std) const;
 
+    /**
+     * @brief Return the number of iterations since last reset that ended
+     * after the next one was due (i.e. the run() function took longer than
+     * the period, or the thread is late with respect to its schedule).
+     */
+    unsigned int getOverruns() const;
+
+    /**
+     * @brief Return the maximum delay [sec] of the end of an iteration with
+     * respect to the start of the next one since last reset.
+     */
+    double getMaxOverrun() const;
+
+    /**
+     * @brief Return the histogram of the jitter (the absolute difference
+     * between the scheduled and the actual start time of the iterations)
+     * since last reset.
+     * The first bin contains the jitter below 1 microsecond, and each
+     * following bin doubles the range of the previous one, i.e. bin i
+     * contains the jitter in [2^(i-1), 2^i) microseconds. The last bin also
+     * contains all the larger values.
+     * @param[out] binEdges the lower bound of each bin [sec]
+     * @param[out] counts the number of iterations in each bin
+     */
+    void getJitterHistogram(std::vector<double>& binEdges, std::vector<unsigned int>& counts) const;
+
+    /**
+     * @brief Return the maximum jitter [sec] since last reset.
+     */
+    double getMaxJitter() const;
+
+    /**
+     * @brief Run the thread on the shared executor instead of a dedicated
+     * thread.
+     *
+     * The threads using the shared executor are scheduled on a timer wheel
+     * served by a small pool of worker threads (the size of the pool is set
+     * by the YARP_PERIODICTHREAD_WORKERS environment variable, by default it
+     * is the number of cores, at most 4).
+     * The run() function of a thread is never executed concurrently, but
+     * successive iterations can be executed by different workers, and it
+     * should never block, since it delays the other threads waiting for a
+     * worker.
+     * threadInit(), beforeStart() and afterStart() are executed by the thread
+     * calling start(), threadRelease() by one of the workers.
+     * The priority of the thread cannot be set.
+     * If the thread does not use the system clock, and the network clock is
+     * in use, or if it uses PeriodicThreadClock::RealTime, the thread falls
+     * back to a dedicated thread.
+     * @param shared true to use the shared executor.
+     * @return false if the thread is running.
+     */
+    bool setSharedExecution(bool shared);
+
+    /**
+     * @brief Return true if the thread will be run on the shared executor.
+     */
+    bool isSharedExecution() const;
+
     /**
      * @brief Set the priority and scheduling policy of the thread, if the OS supports that.
      * @param priority the new priority of the thread.
@@ -171,6 +242,21 @@ public:
      */
     int setPriority(int priority, int policy = -1);
 
+    /**
+     * @brief Set the CPUs the thread is allowed to run on, if the OS supports
+     * that. If the thread is not running, the affinity is applied when it
+     * starts.
+     * @param cpus the indices of the CPUs, an empty list does not change the
+     * current affinity.
+     * @return -1 if the affinity cannot be set.
+     */
+    int setCpuAffinity(const std::vector<int>& cpus);
+
+    /**
+     * @brief Return the CPUs set using setCpuAffinity().
+     */
+    std::vector<int> getCpuAffinity() const;
+
     /**
      * @brief Query the current priority of the thread, if the OS supports that.
      * @return the priority of the thread.
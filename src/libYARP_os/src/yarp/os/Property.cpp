@@ -21,8 +21,10 @@
 #include <cctype>
 #include <cstdio>
 #include <cstring>
+#include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 using namespace yarp::os::impl;
 using namespace yarp::os;
@@ -96,10 +98,120 @@ public:
     }
 };
 
+/*
+ * Open addressing (linear probing) hash index over the entries of a Property.
+ * The entries are still owned by a std::map, that keeps them sorted by key
+ * (this is the order used when the property is serialized) and at a stable
+ * address (references to the stored values are returned to the user), while
+ * the index avoids the O(log n) string comparisons on lookup.
+ */
+class PropertyIndex
+{
+public:
+    using entry_type = std::map<std::string, PropertyItem>::value_type;
+
+    // Smaller properties are not indexed, since a lookup in the map is cheap enough
+    static constexpr size_t min_indexed_entries = 16;
+
+    static size_t hashKey(const std::string& key)
+    {
+        return std::hash<std::string>{}(key);
+    }
+
+    bool empty() const
+    {
+        return slots.empty();
+    }
+
+    void clear()
+    {
+        slots.clear();
+        count = 0;
+    }
+
+    entry_type* find(const std::string& key, size_t hash) const
+    {
+        const size_t mask = slots.size() - 1;
+        for (size_t i = hash & mask;; i = (i + 1) & mask) {
+            const Slot& slot = slots[i];
+            if (slot.entry == nullptr) {
+                return nullptr;
+            }
+            if (slot.hash == hash && slot.entry->first == key) {
+                return slot.entry;
+            }
+        }
+    }
+
+    void insert(entry_type* entry, size_t hash)
+    {
+        if ((count + 1) * 2 > slots.size()) {
+            std::vector<Slot> old;
+            old.swap(slots);
+            slots.resize(std::max<size_t>(min_indexed_entries * 4, old.size() * 2));
+            count = 0;
+            for (const auto& slot : old) {
+                if (slot.entry != nullptr) {
+                    place(slot.entry, slot.hash);
+                }
+            }
+        }
+        place(entry, hash);
+    }
+
+    void erase(const std::string& key, size_t hash)
+    {
+        const size_t mask = slots.size() - 1;
+        size_t i = hash & mask;
+        while (slots[i].entry != nullptr && !(slots[i].hash == hash && slots[i].entry->first == key)) {
+            i = (i + 1) & mask;
+        }
+        if (slots[i].entry == nullptr) {
+            return;
+        }
+        // backward shift deletion: move back the following entries of the
+        // same cluster, so that no tombstones are needed
+        slots[i].entry = nullptr;
+        count--;
+        for (size_t j = (i + 1) & mask; slots[j].entry != nullptr; j = (j + 1) & mask) {
+            size_t k = slots[j].hash & mask;
+            bool in_place = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+            if (!in_place) {
+                slots[i] = slots[j];
+                slots[j].entry = nullptr;
+                i = j;
+            }
+        }
+    }
+
+private:
+    struct Slot
+    {
+        size_t hash {0};
+        entry_type* entry {nullptr};
+    };
+
+    std::vector<Slot> slots;
+    size_t count {0};
+
+    void place(entry_type* entry, size_t hash)
+    {
+        const size_t mask = slots.size() - 1;
+        size_t i = hash & mask;
+        while (slots[i].entry != nullptr) {
+            i = (i + 1) & mask;
+        }
+        slots[i].hash = hash;
+        slots[i].entry = entry;
+        count++;
+    }
+};
+
 class Property::Private
 {
 public:
     std::map<std::string, PropertyItem> data;
+    PropertyIndex index;
     Property* owner;
 
     explicit Private(Property* owner) :
@@ -107,8 +219,28 @@ public:
     {
     }
 
+    void rebuildIndex()
+    {
+        index.clear();
+        if (data.size() >= PropertyIndex::min_indexed_entries) {
+            for (auto& entry : data) {
+                index.insert(&entry, PropertyIndex::hashKey(entry.first));
+            }
+        }
+    }
+
+    void copyData(const Private& rhs)
+    {
+        data = rhs.data;
+        rebuildIndex();
+    }
+
     PropertyItem* getPropNoCreate(const std::string& key) const
     {
+        if (!index.empty()) {
+            auto* entry = index.find(key, PropertyIndex::hashKey(key));
+            return entry ? const_cast<PropertyItem*>(&(entry->second)) : nullptr;
+        }
         auto it = data.find(key);
         if (it == data.end()) {
             return nullptr;
@@ -118,15 +250,28 @@ public:
 
     PropertyItem* getProp(const std::string& key, bool create = true)
     {
-        auto entry = data.find(key);
-        if (entry == data.end()) {
-            if (!create) {
-                return nullptr;
+        size_t hash = 0;
+        if (!index.empty()) {
+            hash = PropertyIndex::hashKey(key);
+            if (auto* entry = index.find(key, hash)) {
+                return &(entry->second);
+            }
+        } else {
+            auto it = data.find(key);
+            if (it != data.end()) {
+                return &(it->second);
             }
-            data[key] = PropertyItem();
-            entry = data.find(key);
         }
+        if (!create) {
+            return nullptr;
+        }
+        auto entry = data.emplace(key, PropertyItem()).first;
         yCAssert(PROPERTY, entry != data.end());
+        if (!index.empty()) {
+            index.insert(&(*entry), hash);
+        } else if (data.size() >= PropertyIndex::min_indexed_entries) {
+            rebuildIndex();
+        }
         return &(entry->second);
     }
 
@@ -169,6 +314,9 @@ public:
 
     void unput(const std::string& key)
     {
+        if (!index.empty()) {
+            index.erase(key, PropertyIndex::hashKey(key));
+        }
         data.erase(key);
     }
 
@@ -229,6 +377,7 @@ public:
 
     void clear()
     {
+        index.clear();
         data.clear();
     }
 
@@ -968,7 +1117,7 @@ Property& Property::operator=(const Property& rhs)
     if (&rhs != this) {
         Searchable::operator=(static_cast<const Searchable&>(rhs));
         Portable::operator=(static_cast<const Portable&>(rhs));
-        mPriv->data = rhs.mPriv->data;
+        mPriv->copyData(*rhs.mPriv);
         mPriv->owner = this;
     }
     return *this;
@@ -51,6 +51,18 @@ bool Things::setConnectionReader(yarp::os::ConnectionReader& reader)
     return true;
 }
 
+std::string Things::getEnvelope()
+{
+    if (conReader == nullptr) {
+        return {};
+    }
+    Bytes envelope = conReader->readEnvelope();
+    if (envelope.get() == nullptr) {
+        return {};
+    }
+    return {envelope.get(), envelope.length()};
+}
+
 bool Things::write(yarp::os::ConnectionWriter& connection)
 {
     if (writer != nullptr) {
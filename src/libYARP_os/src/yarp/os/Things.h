@@ -9,6 +9,8 @@
 #include <yarp/os/ConnectionReader.h>
 #include <yarp/os/Portable.h>
 
+#include <string>
+
 namespace yarp::os {
 
 /**
@@ -40,6 +42,14 @@ public:
      */
     bool setConnectionReader(yarp::os::ConnectionReader& reader);
 
+    /**
+     * Get the envelope of the message, if available.
+     *
+     * @return The envelope read from the connection reader, or an empty
+     *         string if the message has no envelope
+     */
+    std::string getEnvelope();
+
     /*
      * Things writer
      */
@@ -44,6 +44,12 @@ Contact YarpNameSpace::queryName(const std::string& name)
     return nic.queryName(name);
 }
 
+std::vector<Contact> YarpNameSpace::queryNames(const std::vector<std::string>& names)
+{
+    NameClient& nic = HELPER(this);
+    return nic.queryNames(names);
+}
+
 
 Contact YarpNameSpace::registerName(const std::string& name)
 {
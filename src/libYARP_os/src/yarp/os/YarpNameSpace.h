@@ -26,6 +26,8 @@ public:
 
     Contact queryName(const std::string& name) override;
 
+    std::vector<Contact> queryNames(const std::vector<std::string>& names) override;
+
     Contact registerName(const std::string& name) override;
 
     Contact registerContact(const Contact& contact) override;
@@ -0,0 +1,207 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_OS_IDL_WIREPACKED_H
+#define YARP_OS_IDL_WIREPACKED_H
+
+#include <yarp/conf/numeric.h>
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/NetFloat32.h>
+#include <yarp/os/NetFloat64.h>
+#include <yarp/os/NetInt16.h>
+#include <yarp/os/NetInt32.h>
+#include <yarp/os/NetInt64.h>
+#include <yarp/os/NetInt8.h>
+#include <yarp/os/Vocab.h>
+#include <yarp/os/idl/WireReader.h>
+#include <yarp/os/idl/WireWriter.h>
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+
+namespace yarp::os::idl {
+
+/**
+ * IDL-friendly fixed size block of tagged values.  Used by YARP IDL tools,
+ * not intended for end-user.
+ *
+ * The values are encoded exactly as WireWriter writes them one by one, so
+ * that a sequence of fields with a fixed size can be written and read with
+ * a single operation.  The size of the block must be known at compile time.
+ */
+template <size_t N>
+class WirePacked
+{
+public:
+    bool write(const WireWriter& writer) const
+    {
+        return pos == N && writer.writeBlock(data, N);
+    }
+
+    /**
+     * Read a block of values from @p reader, whose expected tags are listed
+     * in @p tags.
+     */
+    bool read(WireReader& reader, std::initializer_list<std::int32_t> tags)
+    {
+        pos = 0;
+        return reader.readPacked(data, N, tags.begin(), static_cast<int>(tags.size()));
+    }
+
+    void writeBool(bool x)
+    {
+        put<NetInt32>(BOTTLE_TAG_VOCAB32);
+        put<NetInt32>(x ? VOCAB_OK : VOCAB_FAIL);
+    }
+
+    void writeI8(std::int8_t x)
+    {
+        put<NetInt32>(BOTTLE_TAG_INT8);
+        put<NetInt8>(x);
+    }
+
+    void writeI16(std::int16_t x)
+    {
+        put<NetInt32>(BOTTLE_TAG_INT16);
+        put<NetInt16>(x);
+    }
+
+    void writeI32(std::int32_t x)
+    {
+        put<NetInt32>(BOTTLE_TAG_INT32);
+        put<NetInt32>(x);
+    }
+
+    void writeI64(std::int64_t x)
+    {
+        put<NetInt32>(BOTTLE_TAG_INT64);
+        put<NetInt64>(x);
+    }
+
+    void writeFloat32(yarp::conf::float32_t x)
+    {
+        put<NetInt32>(BOTTLE_TAG_FLOAT32);
+        put<NetFloat32>(x);
+    }
+
+    void writeFloat64(yarp::conf::float64_t x)
+    {
+        put<NetInt32>(BOTTLE_TAG_FLOAT64);
+        put<NetFloat64>(x);
+    }
+
+    void writeUI8(std::uint8_t x) { writeI8(static_cast<std::int8_t>(x)); }
+    void writeUI16(std::uint16_t x) { writeI16(static_cast<std::int16_t>(x)); }
+    void writeUI32(std::uint32_t x) { writeI32(static_cast<std::int32_t>(x)); }
+    void writeUI64(std::uint64_t x) { writeI64(static_cast<std::int64_t>(x)); }
+    void writeSizeT(std::size_t x) { writeI32(static_cast<std::int32_t>(x)); }
+
+    void writeVocab32(yarp::conf::vocab32_t x)
+    {
+        put<NetInt32>(BOTTLE_TAG_VOCAB32);
+        put<NetInt32>(x);
+    }
+
+    bool readBool(bool& x)
+    {
+        std::int32_t tag = get<NetInt32>();
+        if (tag != BOTTLE_TAG_INT32 && tag != BOTTLE_TAG_VOCAB32) {
+            return false;
+        }
+        std::int32_t v = get<NetInt32>();
+        x = (v != 0) && (v != VOCAB_FAIL);
+        return true;
+    }
+
+    bool readI8(std::int8_t& x)
+    {
+        return expect(BOTTLE_TAG_INT8) && (x = get<NetInt8>(), true);
+    }
+
+    bool readI16(std::int16_t& x)
+    {
+        return expect(BOTTLE_TAG_INT16) && (x = get<NetInt16>(), true);
+    }
+
+    bool readI32(std::int32_t& x)
+    {
+        std::int32_t tag = get<NetInt32>();
+        if (tag != BOTTLE_TAG_INT32 && tag != BOTTLE_TAG_VOCAB32) {
+            return false;
+        }
+        x = get<NetInt32>();
+        return true;
+    }
+
+    bool readI64(std::int64_t& x)
+    {
+        return expect(BOTTLE_TAG_INT64) && (x = get<NetInt64>(), true);
+    }
+
+    bool readFloat32(yarp::conf::float32_t& x)
+    {
+        return expect(BOTTLE_TAG_FLOAT32) && (x = get<NetFloat32>(), true);
+    }
+
+    bool readFloat64(yarp::conf::float64_t& x)
+    {
+        return expect(BOTTLE_TAG_FLOAT64) && (x = get<NetFloat64>(), true);
+    }
+
+    bool readUI8(std::uint8_t& x) { return readI8(reinterpret_cast<std::int8_t&>(x)); }
+    bool readUI16(std::uint16_t& x) { return readI16(reinterpret_cast<std::int16_t&>(x)); }
+    bool readUI32(std::uint32_t& x) { return readI32(reinterpret_cast<std::int32_t&>(x)); }
+    bool readUI64(std::uint64_t& x) { return readI64(reinterpret_cast<std::int64_t&>(x)); }
+
+    bool readSizeT(std::size_t& x)
+    {
+        std::int32_t tmp;
+        if (!readI32(tmp)) {
+            return false;
+        }
+        x = static_cast<std::size_t>(tmp);
+        return true;
+    }
+
+    bool readVocab32(yarp::conf::vocab32_t& x)
+    {
+        return readI32(x);
+    }
+
+private:
+    static constexpr yarp::conf::vocab32_t VOCAB_OK = yarp::os::createVocab32('o', 'k');
+    static constexpr yarp::conf::vocab32_t VOCAB_FAIL = yarp::os::createVocab32('f', 'a', 'i', 'l');
+
+    template <typename NetT, typename T>
+    void put(T x)
+    {
+        NetT tmp = x;
+        std::memcpy(data + pos, &tmp, sizeof(NetT));
+        pos += sizeof(NetT);
+    }
+
+    template <typename NetT>
+    NetT get()
+    {
+        NetT tmp;
+        std::memcpy(&tmp, data + pos, sizeof(NetT));
+        pos += sizeof(NetT);
+        return tmp;
+    }
+
+    bool expect(std::int32_t tag)
+    {
+        return get<NetInt32>() == tag;
+    }
+
+    char data[N];
+    size_t pos {0};
+};
+
+} // namespace yarp::os::idl
+
+#endif // YARP_OS_IDL_WIREPACKED_H
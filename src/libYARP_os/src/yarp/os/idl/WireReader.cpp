@@ -5,12 +5,42 @@
 
 #include <yarp/os/idl/WireReader.h>
 
+#include <yarp/os/NetFloat32.h>
+#include <yarp/os/NetFloat64.h>
+#include <yarp/os/NetInt16.h>
+#include <yarp/os/NetInt32.h>
+#include <yarp/os/NetInt64.h>
+#include <yarp/os/NetInt8.h>
+
+#include <algorithm>
+#include <cstring>
+
 using namespace yarp::os::idl;
 using namespace yarp::os;
 
 namespace {
 constexpr yarp::conf::vocab32_t VOCAB_FAIL = yarp::os::createVocab32('f', 'a', 'i', 'l');
 constexpr yarp::conf::vocab32_t VOCAB_IS = yarp::os::createVocab32('i', 's');
+
+// The size on the wire of a value with a fixed size, without its tag
+size_t packedValueSize(std::int32_t tag)
+{
+    switch (tag) {
+    case BOTTLE_TAG_INT8:
+        return 1;
+    case BOTTLE_TAG_INT16:
+        return 2;
+    case BOTTLE_TAG_INT32:
+    case BOTTLE_TAG_VOCAB32:
+    case BOTTLE_TAG_FLOAT32:
+        return 4;
+    case BOTTLE_TAG_INT64:
+    case BOTTLE_TAG_FLOAT64:
+        return 8;
+    default:
+        return 0;
+    }
+}
 } // namespace
 
 WireReader::WireReader(ConnectionReader& reader) :
@@ -433,6 +463,162 @@ bool WireReader::readBlock(char* const data, size_t len)
     return !reader.isError();
 }
 
+bool WireReader::readPacked(char* const data, size_t len, const std::int32_t* tags, int count)
+{
+    // All the values must belong to this list
+    if (count <= 0 || (state->isValid() && state->len < count)) {
+        return false;
+    }
+    size_t expected = 0;
+    for (int i = 0; i < count; ++i) {
+        const size_t size = packedValueSize(tags[i]);
+        if (size == 0) {
+            return false;
+        }
+        expected += sizeof(NetInt32) + size;
+    }
+    if (expected != len) {
+        return false;
+    }
+    if (noMore()) {
+        return false;
+    }
+
+    if (state->code >= 0) {
+        if (std::all_of(tags, tags + count, [this](std::int32_t tag) { return tag == state->code; })) {
+            // The values in a typed list (e.g. a Bottle containing only
+            // doubles) are not tagged, therefore the tags are added here.
+            const size_t size = packedValueSize(state->code);
+            const size_t tagged_size = sizeof(NetInt32) + size;
+            reader.expectBlock(data, count * size);
+            const NetInt32 tag = state->code;
+            for (int i = count - 1; i >= 0; --i) {
+                std::memmove(data + i * tagged_size + sizeof(NetInt32), data + i * size, size);
+                std::memcpy(data + i * tagged_size, &tag, sizeof(NetInt32));
+            }
+            if (state->isValid()) {
+                state->len -= count;
+            }
+            return !reader.isError();
+        }
+        // A list of a different type (e.g. a Bottle containing only
+        // integers) is converted value by value.
+        size_t pos = 0;
+        for (int i = 0; i < count; ++i) {
+            if (!readPackedValue(data + pos, tags[i])) {
+                return false;
+            }
+            pos += sizeof(NetInt32) + packedValueSize(tags[i]);
+        }
+        return true;
+    }
+
+    // Each tag is checked before reading the value that follows it, so that
+    // a value with a different type (e.g. an integer written in text mode
+    // for a double field) is converted by the reader for a single field,
+    // without reading past the end of the list.
+    // When the tag matches, the value is read together with the tag of the
+    // next one, directly in its final position.
+    size_t pos = 0;
+    std::int32_t tag = reader.expectInt32();
+    for (int i = 0; i < count; ++i) {
+        const size_t size = packedValueSize(tags[i]);
+        const bool last = (i == count - 1);
+        if (tag == tags[i]) {
+            const NetInt32 nettag = tag;
+            std::memcpy(data + pos, &nettag, sizeof(NetInt32));
+            reader.expectBlock(data + pos + sizeof(NetInt32), size + (last ? 0 : sizeof(NetInt32)));
+            pos += sizeof(NetInt32) + size;
+            if (!last) {
+                NetInt32 next;
+                std::memcpy(&next, data + pos, sizeof(NetInt32));
+                tag = next;
+            }
+            if (state->isValid()) {
+                state->len--;
+            }
+        } else {
+            if (!reader.pushInt(tag) || !readPackedValue(data + pos, tags[i])) {
+                return false;
+            }
+            pos += sizeof(NetInt32) + size;
+            if (!last) {
+                tag = reader.expectInt32();
+            }
+        }
+        if (reader.isError()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool WireReader::readPackedValue(char* const data, std::int32_t tag)
+{
+    const NetInt32 nettag = tag;
+    std::memcpy(data, &nettag, sizeof(NetInt32));
+    char* const value = data + sizeof(NetInt32);
+    switch (tag) {
+    case BOTTLE_TAG_INT8: {
+        std::int8_t x;
+        if (!readI8(x)) {
+            return false;
+        }
+        const NetInt8 netx = x;
+        std::memcpy(value, &netx, sizeof(NetInt8));
+        return true;
+    }
+    case BOTTLE_TAG_INT16: {
+        std::int16_t x;
+        if (!readI16(x)) {
+            return false;
+        }
+        const NetInt16 netx = x;
+        std::memcpy(value, &netx, sizeof(NetInt16));
+        return true;
+    }
+    case BOTTLE_TAG_INT32:
+    case BOTTLE_TAG_VOCAB32: {
+        std::int32_t x;
+        if (!readI32(x)) {
+            return false;
+        }
+        const NetInt32 netx = x;
+        std::memcpy(value, &netx, sizeof(NetInt32));
+        return true;
+    }
+    case BOTTLE_TAG_INT64: {
+        std::int64_t x;
+        if (!readI64(x)) {
+            return false;
+        }
+        const NetInt64 netx = x;
+        std::memcpy(value, &netx, sizeof(NetInt64));
+        return true;
+    }
+    case BOTTLE_TAG_FLOAT32: {
+        yarp::conf::float32_t x;
+        if (!readFloat32(x)) {
+            return false;
+        }
+        const NetFloat32 netx = x;
+        std::memcpy(value, &netx, sizeof(NetFloat32));
+        return true;
+    }
+    case BOTTLE_TAG_FLOAT64: {
+        yarp::conf::float64_t x;
+        if (!readFloat64(x)) {
+            return false;
+        }
+        const NetFloat64 netx = x;
+        std::memcpy(value, &netx, sizeof(NetFloat64));
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
 
 bool WireReader::readBinary(std::string& str)
 {
@@ -118,6 +118,15 @@ public:
 
     bool readBlock(char* const data, size_t len);
 
+    /**
+     * Read a block of @p len bytes containing @p count tagged values, as
+     * written by WirePacked, whose expected tags are listed in @p tags.
+     * If the values belong to a typed list, the tags are added to the block.
+     * Values with a different tag are read and converted one by one, as for
+     * a single field.
+     */
+    bool readPacked(char* const data, size_t len, const std::int32_t* tags, int count);
+
     bool readBinary(std::string& str);
 
     template <typename EnumBase, typename ConverterType>
@@ -225,6 +234,8 @@ private:
 
 
     void scanString(std::string& str, bool is_vocab);
+
+    bool readPackedValue(char* const data, std::int32_t tag);
 };
 
 } // namespace yarp::os::idl
@@ -0,0 +1,209 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/impl/NameCache.h>
+
+#include <yarp/conf/environment.h>
+#include <yarp/os/Bottle.h>
+#include <yarp/os/ContactStyle.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/SystemClock.h>
+#include <yarp/os/impl/LogComponent.h>
+
+#include <algorithm>
+
+using yarp::os::impl::NameCache;
+
+namespace {
+YARP_OS_LOG_COMPONENT(NAMECACHE, "yarp.os.impl.NameCache")
+
+// Minimum time between two attempts to connect the name server to the cache
+constexpr double minSubscriptionRetry = 1.0; // [sec]
+} // namespace
+
+bool NameCache::started{false};
+
+NameCache& NameCache::getInstance()
+{
+    static NameCache instance;
+    return instance;
+}
+
+NameCache::NameCache() :
+        ttl(yarp::conf::environment::get_numeric<double>("YARP_NAMECLIENT_CACHE_TTL", 0.0))
+{
+    started = true;
+}
+
+NameCache::~NameCache()
+{
+    if (subscriber.joinable()) {
+        subscriber.join();
+    }
+}
+
+void NameCache::shutdown()
+{
+    if (started) {
+        NameCache& cache = getInstance();
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            cache.state = State::Closed;
+        }
+        if (cache.subscriber.joinable()) {
+            cache.subscriber.join();
+        }
+        if (!cache.listener.getName().empty()) {
+            cache.listener.interrupt();
+            cache.listener.close();
+        }
+        cache.clear();
+    }
+}
+
+void NameCache::setTimeout(double ttl)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    this->ttl = ttl;
+    if (ttl <= 0) {
+        entries.clear();
+    }
+}
+
+double NameCache::getTimeout() const
+{
+    return ttl;
+}
+
+void NameCache::checkSubscription()
+{
+    bool subscribed;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        subscribed = (state == State::Subscribed);
+    }
+    // The port is not checked with the mutex locked, since it might be
+    // calling read() at the same time
+    if (subscribed && listener.getInputCount() == 0) {
+        // The name server is gone, the events received so far might be
+        // incomplete
+        std::lock_guard<std::mutex> lock(mutex);
+        if (state == State::Subscribed) {
+            yCDebug(NAMECACHE, "Lost the connection with the name server");
+            entries.clear();
+            state = State::Unsubscribed;
+            nextSubscription = SystemClock::nowSystem() + std::max(ttl.load(), minSubscriptionRetry);
+        }
+    }
+}
+
+bool NameCache::find(const std::string& name, Contact& contact)
+{
+    if (ttl <= 0) {
+        return false;
+    }
+    checkSubscription();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(name);
+    if (it == entries.end()) {
+        return false;
+    }
+    if (it->second.expiry < SystemClock::nowSystem()) {
+        entries.erase(it);
+        return false;
+    }
+    contact = it->second.contact;
+    return true;
+}
+
+void NameCache::store(const std::string& name, const Contact& contact)
+{
+    // Multicast registrations are not notified by the name server
+    if (ttl <= 0 || !contact.isValid() || contact.getCarrier() == "mcast") {
+        return;
+    }
+
+    std::thread previous;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        double now = SystemClock::nowSystem();
+        entries[name] = Entry{contact, now + ttl};
+
+        if (state == State::Unsubscribed && now >= nextSubscription && !NetworkBase::getLocalMode() && NetworkBase::isNetworkInitialized()) {
+            // Opening the port and connecting it requires some name server
+            // queries, therefore it is done in a different thread
+            state = State::Subscribing;
+            previous = std::move(subscriber);
+            subscriber = std::thread(&NameCache::subscribe, this);
+        }
+    }
+    if (previous.joinable()) {
+        previous.join();
+    }
+}
+
+void NameCache::invalidate(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.erase(name);
+}
+
+void NameCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+}
+
+bool NameCache::isSubscribed()
+{
+    checkSubscription();
+    std::lock_guard<std::mutex> lock(mutex);
+    return state == State::Subscribed;
+}
+
+void NameCache::subscribe()
+{
+    bool ok = true;
+    if (listener.getName().empty()) {
+        listener.setReadOnly();
+        listener.setReader(*this);
+        ok = listener.open("...");
+    }
+    if (ok) {
+        ContactStyle style;
+        style.quiet = true;
+        ok = NetworkBase::connect(NetworkBase::getNameServerName(), listener.getName(), style);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (state != State::Subscribing) {
+        return;
+    }
+    if (ok) {
+        yCDebug(NAMECACHE, "Receiving the events of the name server on %s", listener.getName().c_str());
+        state = State::Subscribed;
+    } else {
+        yCDebug(NAMECACHE, "Cannot receive the events of the name server, the entries will only expire after %g seconds", ttl.load());
+        state = State::Unsubscribed;
+        nextSubscription = SystemClock::nowSystem() + std::max(ttl.load(), minSubscriptionRetry);
+    }
+}
+
+bool NameCache::read(yarp::os::ConnectionReader& reader)
+{
+    Bottle event;
+    if (!event.read(reader)) {
+        return false;
+    }
+    // The name server publishes [add] /port and [del] /port
+    if (event.size() >= 2 && event.get(1).isString()) {
+        yCTrace(NAMECACHE, "Invalidating %s", event.get(1).asString().c_str());
+        invalidate(event.get(1).asString());
+    } else {
+        clear();
+    }
+    return true;
+}
@@ -0,0 +1,120 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_OS_IMPL_NAMECACHE_H
+#define YARP_OS_IMPL_NAMECACHE_H
+
+#include <yarp/os/api.h>
+
+#include <yarp/os/Contact.h>
+#include <yarp/os/Port.h>
+#include <yarp/os/PortReader.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace yarp::os::impl {
+
+/**
+ * A cache of the contacts returned by the name server.
+ *
+ * The entries expire after a timeout, read from the
+ * YARP_NAMECLIENT_CACHE_TTL environment variable (in seconds, the cache is
+ * disabled by default).
+ * When the cache is enabled, a port is connected to the name server, that
+ * publishes an event every time a port is registered or unregistered, and
+ * the corresponding entry is removed from the cache.
+ * The cache is not used in local mode.
+ */
+class YARP_os_impl_API NameCache : public yarp::os::PortReader
+{
+public:
+    ~NameCache() override;
+    static NameCache& getInstance();
+
+    /**
+     * Close the port connected to the name server, if it was opened.
+     */
+    static void shutdown();
+
+    /**
+     * Set the time after which an entry expires [sec]. A timeout less or
+     * equal than 0 disables the cache.
+     */
+    void setTimeout(double ttl);
+    double getTimeout() const;
+
+    /**
+     * Look up a port in the cache.
+     * @param name the name of the port
+     * @param[out] contact the cached address
+     * @return true if a valid entry was found
+     */
+    bool find(const std::string& name, Contact& contact);
+
+    /**
+     * Store the address of a port returned by the name server.
+     * Invalid addresses are not stored.
+     */
+    void store(const std::string& name, const Contact& contact);
+
+    /**
+     * Remove a port from the cache.
+     */
+    void invalidate(const std::string& name);
+
+    /**
+     * Remove all the ports from the cache.
+     */
+    void clear();
+
+    /**
+     * @return true if the cache is receiving the events of the name server.
+     */
+    bool isSubscribed();
+
+    /**
+     * Read an event published by the name server.
+     */
+    bool read(yarp::os::ConnectionReader& reader) override;
+
+private:
+    NameCache();
+    NameCache(NameCache const&) = delete;
+    NameCache& operator=(NameCache const&) = delete;
+
+    void checkSubscription();
+    void subscribe();
+
+    struct Entry
+    {
+        Contact contact;
+        double expiry;
+    };
+
+    enum class State
+    {
+        Unsubscribed,
+        Subscribing,
+        Subscribed,
+        Closed
+    };
+
+    std::mutex mutex;
+    std::atomic<double> ttl {0.0};
+    std::unordered_map<std::string, Entry> entries;
+    State state {State::Unsubscribed};
+    double nextSubscription {0.0};
+    std::thread subscriber;
+    yarp::os::Port listener;
+    static bool started;
+};
+
+} // namespace yarp::os::impl
+
+#endif // YARP_OS_IMPL_NAMECACHE_H
@@ -16,6 +16,7 @@
 #include <yarp/os/Os.h>
 #include <yarp/os/impl/FallbackNameClient.h>
 #include <yarp/os/impl/LogComponent.h>
+#include <yarp/os/impl/NameCache.h>
 #include <yarp/os/impl/NameConfig.h>
 #include <yarp/os/impl/NameServer.h>
 #include <yarp/os/impl/TcpFace.h>
@@ -155,9 +156,71 @@ Contact NameClient::queryName(const std::string& name)
         return c;
     }
 
+    Contact c;
+    if (!isFakeMode() && NameCache::getInstance().find(name, c)) {
+        return c;
+    }
+
     std::string q("NAME_SERVER query ");
     q += name;
-    return probe(q);
+    c = probe(q);
+    if (!isFakeMode()) {
+        NameCache::getInstance().store(name, c);
+    }
+    return c;
+}
+
+std::vector<Contact> NameClient::queryNames(const std::vector<std::string>& names)
+{
+    std::vector<Contact> result(names.size());
+    std::vector<size_t> remote;
+    bool useCache = (altStore == nullptr && !isFakeMode());
+    for (size_t i = 0; i < names.size(); ++i) {
+        Contact c = c.fromString(names[i]);
+        if (names[i].find(':') != std::string::npos && c.isValid() && c.getPort() > 0) {
+            result[i] = c;
+        } else if (!useCache || !NameCache::getInstance().find(names[i], result[i])) {
+            remote.push_back(i);
+        }
+    }
+
+    if (altStore != nullptr || remote.size() < 2) {
+        for (auto i : remote) {
+            result[i] = queryName(names[i]);
+        }
+        return result;
+    }
+
+    // The name server replies with one registration for each name, in the
+    // same order
+    Bottle cmd;
+    Bottle reply;
+    cmd.addString("bot");
+    cmd.addString("query_many");
+    for (auto i : remote) {
+        cmd.addString(names[i]);
+    }
+    send(cmd, reply);
+    if (reply.get(0).asString() != "ports" || reply.size() != remote.size() + 1) {
+        // name servers without the query_many command
+        yCDebug(NAMECLIENT, "Name server does not support query_many, querying names one by one");
+        for (auto i : remote) {
+            result[i] = queryName(names[i]);
+        }
+        return result;
+    }
+
+    for (size_t k = 0; k < remote.size(); ++k) {
+        size_t i = remote[k];
+        Bottle* entry = reply.get(k + 1).asList();
+        if (entry != nullptr) {
+            result[i] = Contact::fromConfig(*entry);
+        }
+        if (useCache) {
+            NameCache::getInstance().store(names[i], result[i]);
+        }
+    }
+    return result;
 }
 
 Contact NameClient::registerName(const std::string& name)
@@ -167,6 +230,8 @@ Contact NameClient::registerName(const std::string& name)
 
 Contact NameClient::registerName(const std::string& name, const Contact& suggest)
 {
+    NameCache::getInstance().invalidate(name);
+
     Bottle cmd;
     cmd.addString("register");
     if (!name.empty()) {
@@ -256,6 +321,8 @@ Contact NameClient::registerName(const std::string& name, const Contact& suggest
 
 Contact NameClient::unregisterName(const std::string& name)
 {
+    NameCache::getInstance().invalidate(name);
+
     std::string q("NAME_SERVER unregister ");
     q += name;
     return probe(q);
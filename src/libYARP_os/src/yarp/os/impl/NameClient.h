@@ -10,6 +10,8 @@
 #include <yarp/os/Contact.h>
 #include <yarp/os/ContactStyle.h>
 
+#include <vector>
+
 namespace yarp::os {
 
 class Bottle;
@@ -64,6 +66,16 @@ public:
      */
     Contact queryName(const std::string& name);
 
+    /**
+     * Look up the addresses of several ports.
+     * When more than one port must be asked to the name server, they are
+     * looked up with a single query_many request. Name servers that do not
+     * support it are queried for each port.
+     * @param names the names of the ports
+     * @return the addresses associated with the ports, in the same order
+     */
+    std::vector<Contact> queryNames(const std::vector<std::string>& names);
+
     /**
      * Register a port with a given name.
      * @param name the name of the port
@@ -242,6 +242,7 @@ void NameServer::setup()
 
     ndispatcher.add("list", &NameServer::ncmdList);
     ndispatcher.add("query", &NameServer::ncmdQuery);
+    ndispatcher.add("query_many", &NameServer::ncmdQueryMany);
     ndispatcher.add("version", &NameServer::ncmdVersion);
     ndispatcher.add("set", &NameServer::ncmdSet);
     ndispatcher.add("get", &NameServer::ncmdGet);
@@ -572,6 +573,18 @@ yarp::os::Bottle NameServer::ncmdQuery(int argc, char* argv[])
 }
 
 
+yarp::os::Bottle NameServer::ncmdQueryMany(int argc, char* argv[])
+{
+    Bottle response;
+    response.addString("ports");
+    for (int i = 0; i < argc; i++) {
+        std::string portName = STR(argv[i]);
+        response.addList() = botify(queryName(portName));
+    }
+    return response;
+}
+
+
 yarp::os::Bottle NameServer::ncmdVersion(int argc, char* argv[])
 {
     YARP_UNUSED(argc);
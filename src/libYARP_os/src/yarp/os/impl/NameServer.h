@@ -444,6 +444,7 @@ private:
     // making a more easy to parse interface
     yarp::os::Bottle ncmdList(int argc, char* argv[]);
     yarp::os::Bottle ncmdQuery(int argc, char* argv[]);
+    yarp::os::Bottle ncmdQueryMany(int argc, char* argv[]);
     yarp::os::Bottle ncmdVersion(int argc, char* argv[]);
     yarp::os::Bottle ncmdSet(int argc, char* argv[]);
     yarp::os::Bottle ncmdGet(int argc, char* argv[]);
@@ -0,0 +1,316 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/impl/PeriodicThreadExecutor.h>
+
+#include <yarp/conf/environment.h>
+#include <yarp/os/impl/LogComponent.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+using yarp::os::impl::PeriodicThreadExecutor;
+
+namespace {
+YARP_OS_LOG_COMPONENT(PERIODICTHREADEXECUTOR, "yarp.os.impl.PeriodicThreadExecutor")
+
+constexpr double wheelResolution = 0.001; // [sec]
+constexpr size_t maxDefaultWorkers = 4;
+
+inline int64_t toTick(double t)
+{
+    return static_cast<int64_t>(std::floor(t / wheelResolution));
+}
+} // namespace
+
+
+PeriodicThreadExecutor& PeriodicThreadExecutor::instance()
+{
+    static PeriodicThreadExecutor executor;
+    return executor;
+}
+
+PeriodicThreadExecutor::PeriodicThreadExecutor() :
+        epoch(std::chrono::steady_clock::now())
+{
+    wheel[0].resize(size_t{1} << level0Bits);
+    for (size_t l = 1; l < levels; ++l) {
+        wheel[l].resize(size_t{1} << levelBits);
+    }
+
+    size_t defaultWorkers = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, maxDefaultWorkers);
+    workersCount = std::max<size_t>(yarp::conf::environment::get_numeric<size_t>("YARP_PERIODICTHREAD_WORKERS", defaultWorkers), 1);
+}
+
+PeriodicThreadExecutor::~PeriodicThreadExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closing = true;
+    }
+    dispatcherCond.notify_all();
+    workersCond.notify_all();
+    if (dispatcher.joinable()) {
+        dispatcher.join();
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t PeriodicThreadExecutor::getWorkers() const
+{
+    return workersCount;
+}
+
+double PeriodicThreadExecutor::now() const
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+void PeriodicThreadExecutor::startThreads()
+{
+    yCDebug(PERIODICTHREADEXECUTOR, "Starting the executor with %zu workers", workersCount);
+    currentTick = toTick(now());
+    plannedWakeUp = std::numeric_limits<double>::infinity();
+    dispatcher = std::thread(&PeriodicThreadExecutor::dispatcherLoop, this);
+    for (size_t i = 0; i < workersCount; ++i) {
+        workers.emplace_back(&PeriodicThreadExecutor::workerLoop, this);
+    }
+}
+
+void PeriodicThreadExecutor::start(Task* task)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (workers.empty()) {
+        startThreads();
+    }
+    task->closing = false;
+    makeReady(task);
+}
+
+void PeriodicThreadExecutor::askToStop(Task* task)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (task->state == Task::State::Stopped) {
+        return;
+    }
+    task->closing = true;
+    if (task->state == Task::State::Scheduled) {
+        // Let a worker release it
+        unlink(task);
+        makeReady(task);
+    }
+}
+
+void PeriodicThreadExecutor::stop(Task* task)
+{
+    askToStop(task);
+    std::unique_lock<std::mutex> lock(mutex);
+    stoppedCond.wait(lock, [task]() { return task->state == Task::State::Stopped; });
+}
+
+void PeriodicThreadExecutor::makeReady(Task* task)
+{
+    task->state = Task::State::Ready;
+    ready.push_back(task);
+    workersCond.notify_one();
+}
+
+void PeriodicThreadExecutor::insert(Task* task)
+{
+    int64_t tick = std::max(toTick(task->deadline), currentTick);
+    int64_t delta = tick - currentTick;
+
+    size_t level = 0;
+    size_t index = 0;
+    if (delta < (int64_t{1} << level0Bits)) {
+        index = tick & ((int64_t{1} << level0Bits) - 1);
+    } else {
+        for (level = 1; level < levels; ++level) {
+            size_t shift = level0Bits + levelBits * (level - 1);
+            int64_t range = int64_t{1} << (shift + levelBits);
+            if (delta < range || level == levels - 1) {
+                if (delta >= range) {
+                    // Too far in the future, it will be moved again when
+                    // this slot is cascaded
+                    tick = currentTick + range - 1;
+                }
+                index = (tick >> shift) & ((int64_t{1} << levelBits) - 1);
+                break;
+            }
+        }
+    }
+
+    auto& slot = wheel[level][index];
+    slot.push_back(task);
+    task->state = Task::State::Scheduled;
+    task->level = level;
+    task->slot = &slot;
+    task->slotPos = std::prev(slot.end());
+    levelCount[level]++;
+
+    if (task->deadline < plannedWakeUp) {
+        plannedWakeUp = task->deadline;
+        dispatcherCond.notify_one();
+    }
+}
+
+void PeriodicThreadExecutor::unlink(Task* task)
+{
+    task->slot->erase(task->slotPos);
+    task->slot = nullptr;
+    levelCount[task->level]--;
+}
+
+void PeriodicThreadExecutor::cascade()
+{
+    // Move the tasks of the slots that are now current to the lower levels,
+    // starting from the highest one
+    for (size_t level = levels - 1; level > 0; --level) {
+        size_t shift = level0Bits + levelBits * (level - 1);
+        if ((currentTick & ((int64_t{1} << shift) - 1)) != 0) {
+            continue;
+        }
+        auto& slot = wheel[level][(currentTick >> shift) & ((int64_t{1} << levelBits) - 1)];
+        while (!slot.empty()) {
+            Task* task = slot.front();
+            unlink(task);
+            insert(task);
+        }
+    }
+}
+
+void PeriodicThreadExecutor::advance(double t)
+{
+    const int64_t mask0 = (int64_t{1} << level0Bits) - 1;
+    const int64_t nowTick = toTick(t);
+
+    while (currentTick < nowTick) {
+        if (levelCount[0] == 0) {
+            // Nothing to expire, jump to the next cascade
+            bool empty = std::all_of(levelCount.begin(), levelCount.end(), [](size_t c) { return c == 0; });
+            int64_t boundary = ((currentTick >> level0Bits) + 1) << level0Bits;
+            if (empty || boundary > nowTick) {
+                currentTick = nowTick;
+                break;
+            }
+            currentTick = boundary;
+            cascade();
+            continue;
+        }
+
+        auto& slot = wheel[0][currentTick & mask0];
+        while (!slot.empty()) {
+            Task* task = slot.front();
+            unlink(task);
+            makeReady(task);
+        }
+        ++currentTick;
+        if ((currentTick & mask0) == 0) {
+            cascade();
+        }
+    }
+
+    // The current slot might contain tasks expiring later in this tick
+    auto& slot = wheel[0][currentTick & mask0];
+    for (auto it = slot.begin(); it != slot.end();) {
+        Task* task = *(it++);
+        if (task->deadline <= t) {
+            unlink(task);
+            makeReady(task);
+        }
+    }
+}
+
+double PeriodicThreadExecutor::nextWakeUp() const
+{
+    const int64_t mask0 = (int64_t{1} << level0Bits) - 1;
+    double wakeUp = std::numeric_limits<double>::infinity();
+
+    if (levelCount[0] > 0) {
+        for (int64_t i = 0; i <= mask0; ++i) {
+            const auto& slot = wheel[0][(currentTick + i) & mask0];
+            if (!slot.empty()) {
+                for (const auto* task : slot) {
+                    wakeUp = std::min(wakeUp, task->deadline);
+                }
+                break;
+            }
+        }
+    }
+
+    for (size_t level = 1; level < levels; ++level) {
+        if (levelCount[level] > 0) {
+            int64_t boundary = ((currentTick >> level0Bits) + 1) << level0Bits;
+            wakeUp = std::min(wakeUp, static_cast<double>(boundary) * wheelResolution);
+            break;
+        }
+    }
+
+    return wakeUp;
+}
+
+void PeriodicThreadExecutor::finish(Task* task, std::unique_lock<std::mutex>& lock)
+{
+    lock.unlock();
+    task->release();
+    lock.lock();
+    task->closing = false;
+    task->state = Task::State::Stopped;
+    stoppedCond.notify_all();
+}
+
+void PeriodicThreadExecutor::dispatcherLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!closing) {
+        advance(now());
+        plannedWakeUp = nextWakeUp();
+        if (std::isinf(plannedWakeUp)) {
+            dispatcherCond.wait(lock);
+        } else {
+            auto wakeUpTime = epoch + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(plannedWakeUp));
+            dispatcherCond.wait_until(lock, wakeUpTime);
+        }
+    }
+}
+
+void PeriodicThreadExecutor::workerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        workersCond.wait(lock, [this]() { return closing || !ready.empty(); });
+        if (closing) {
+            return;
+        }
+
+        Task* task = ready.front();
+        ready.pop_front();
+        if (task->closing) {
+            finish(task, lock);
+            continue;
+        }
+
+        task->state = Task::State::Running;
+        lock.unlock();
+        double delay = task->execute();
+        lock.lock();
+
+        if (task->closing) {
+            finish(task, lock);
+            continue;
+        }
+
+        task->deadline = now() + delay;
+        if (delay <= 0) {
+            makeReady(task);
+        } else {
+            insert(task);
+        }
+    }
+}
@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_OS_IMPL_PERIODICTHREADEXECUTOR_H
+#define YARP_OS_IMPL_PERIODICTHREADEXECUTOR_H
+
+#include <yarp/os/api.h>
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace yarp::os::impl {
+
+/**
+ * Executes many periodic tasks using a small pool of worker threads.
+ *
+ * The tasks waiting for their next iteration are stored in a hierarchical
+ * timer wheel (1 ms resolution, 4 levels) served by a dispatcher thread,
+ * that moves the expired tasks to a queue consumed by the workers.
+ * The dispatcher only wakes up when a task expires, or when a task must be
+ * moved to a lower level of the wheel.
+ *
+ * The number of workers is read from the YARP_PERIODICTHREAD_WORKERS
+ * environment variable when the executor is first used (by default, the
+ * number of cores, at most 4).
+ */
+class YARP_os_impl_API PeriodicThreadExecutor
+{
+public:
+    class YARP_os_impl_API Task
+    {
+    public:
+        virtual ~Task() = default;
+
+        /**
+         * Execute one iteration of the task.
+         * @return the delay before the next iteration [sec].
+         */
+        virtual double execute() = 0;
+
+        /**
+         * Called by a worker thread after the last iteration of the task.
+         */
+        virtual void release() = 0;
+
+    private:
+        friend class PeriodicThreadExecutor;
+
+        enum class State
+        {
+            Stopped,
+            Scheduled, // waiting in the timer wheel
+            Ready,     // waiting in the queue of the workers
+            Running
+        };
+
+        State state {State::Stopped};
+        bool closing {false};
+        double deadline {0.0};
+        size_t level {0};
+        std::list<Task*>* slot {nullptr};
+        std::list<Task*>::iterator slotPos;
+    };
+
+    static PeriodicThreadExecutor& instance();
+
+    /**
+     * Start executing a task. The first iteration is executed as soon as
+     * a worker is available.
+     */
+    void start(Task* task);
+
+    /**
+     * Ask a task to stop, without waiting for its release.
+     * Can be called by the task itself.
+     */
+    void askToStop(Task* task);
+
+    /**
+     * Stop a task, and wait until it is released.
+     * This will deadlock if called by the task itself, use askToStop()
+     * instead.
+     */
+    void stop(Task* task);
+
+    /**
+     * @return the number of worker threads.
+     */
+    size_t getWorkers() const;
+
+    PeriodicThreadExecutor(const PeriodicThreadExecutor&) = delete;
+    PeriodicThreadExecutor& operator=(const PeriodicThreadExecutor&) = delete;
+
+private:
+    PeriodicThreadExecutor();
+    ~PeriodicThreadExecutor();
+
+    static constexpr size_t levels = 4;
+    static constexpr size_t level0Bits = 8;
+    static constexpr size_t levelBits = 6;
+
+    double now() const;
+    void startThreads();
+    void insert(Task* task);
+    void unlink(Task* task);
+    void makeReady(Task* task);
+    void cascade();
+    void advance(double t);
+    double nextWakeUp() const;
+    void finish(Task* task, std::unique_lock<std::mutex>& lock);
+    void dispatcherLoop();
+    void workerLoop();
+
+    std::mutex mutex;
+    std::condition_variable dispatcherCond;
+    std::condition_variable workersCond;
+    std::condition_variable stoppedCond;
+
+    const std::chrono::steady_clock::time_point epoch;
+    int64_t currentTick {0};
+    double plannedWakeUp {0.0};
+    std::array<std::vector<std::list<Task*>>, levels> wheel;
+    std::array<size_t, levels> levelCount {};
+    std::deque<Task*> ready;
+
+    size_t workersCount {1};
+    bool closing {false};
+    std::thread dispatcher;
+    std::vector<std::thread> workers;
+};
+
+} // namespace yarp::os::impl
+
+#endif // YARP_OS_IMPL_PERIODICTHREADEXECUTOR_H
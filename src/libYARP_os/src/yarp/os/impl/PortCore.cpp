@@ -26,6 +26,7 @@
 #include <yarp/os/impl/StreamConnectionReader.h>
 
 #include <cstdio>
+#include <fstream>
 #include <functional>
 #include <random>
 #include <regex>
@@ -53,6 +54,29 @@ using namespace yarp;
 
 namespace {
 YARP_OS_LOG_COMPONENT(PORTCORE, "yarp.os.impl.PortCore")
+
+// Identifies the machine and the file system seen by this process, so that
+// it is possible to tell if two ports with the same address can also share
+// a unix socket (e.g. they could run in two containers using the network
+// of the host).
+std::string getFilesystemNamespace()
+{
+#if defined(__linux__)
+    static const std::string ns = []() -> std::string {
+        std::string boot_id;
+        std::ifstream("/proc/sys/kernel/random/boot_id") >> boot_id;
+        char mnt[64];
+        ssize_t len = ::readlink("/proc/self/ns/mnt", mnt, sizeof(mnt));
+        if (boot_id.empty() || len <= 0) {
+            return {};
+        }
+        return boot_id + '/' + std::string(mnt, static_cast<size_t>(len));
+    }();
+    return ns;
+#else
+    return {};
+#endif
+}
 } // namespace
 
 PortCore::PortCore() = default;
@@ -1251,15 +1275,15 @@ bool PortCore::send(const PortWriter& writer,
     // check if there is any modifier
     // we need to protect this part while the modifier
     // plugin is loading or unloading!
-    m_modifier.outputMutex.lock();
+    m_modifier.outputMutex.lock_shared();
     if (m_modifier.outputModifier != nullptr) {
         if (!m_modifier.outputModifier->acceptOutgoingData(writer)) {
-            m_modifier.outputMutex.unlock();
+            m_modifier.outputMutex.unlock_shared();
             return false;
         }
         m_modifier.outputModifier->modifyOutgoingData(writer);
     }
-    m_modifier.outputMutex.unlock();
+    m_modifier.outputMutex.unlock_shared();
     if (!m_logNeeded) {
         return sendHelper(writer, PORTCORE_SEND_NORMAL, reader, callback);
     }
@@ -2175,6 +2199,7 @@ bool PortCore::adminBlock(ConnectionReader& reader,
                         Property& platform_prop = platform.addDict();
                         platform_prop.put("os", pinfo.name);
                         platform_prop.put("hostname", m_address.getHost());
+                        platform_prop.put("namespace", getFilesystemNamespace());
 
                         unsigned int f = getFlags();
                         bool is_input = (f & PORTCORE_IS_INPUT) != 0;
@@ -25,6 +25,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
+#include <shared_mutex>
 #include <vector>
 
 namespace yarp::os::impl {
@@ -134,8 +135,11 @@ public:
 public:
     yarp::os::Carrier* outputModifier;
     yarp::os::Carrier* inputModifier;
-    std::mutex outputMutex;
-    std::mutex inputMutex;
+    // The modifiers are used with a shared lock, so that the messages of
+    // several connections can reach them together, and replaced with an
+    // exclusive lock
+    std::shared_mutex outputMutex;
+    std::shared_mutex inputMutex;
 };
 
 class YARP_os_impl_API PortCore :
@@ -286,18 +286,18 @@ void PortCoreInputUnit::run()
                 if (ip->getReceiver().acceptIncomingData(br)) {
                     ConnectionReader* cr = &(ip->getReceiver().modifyIncomingData(br));
                     yarp::os::impl::PortDataModifier& modifier = getOwner().getPortModifier();
-                    modifier.inputMutex.lock();
+                    modifier.inputMutex.lock_shared();
                     if (modifier.inputModifier != nullptr) {
                         if (modifier.inputModifier->acceptIncomingData(*cr)) {
                             cr = &(modifier.inputModifier->modifyIncomingData(*cr));
-                            modifier.inputMutex.unlock();
+                            modifier.inputMutex.unlock_shared();
                             man.readBlock(*cr, id, os);
                         } else {
-                            modifier.inputMutex.unlock();
+                            modifier.inputMutex.unlock_shared();
                             skipIncomingData(*cr);
                         }
                     } else {
-                        modifier.inputMutex.unlock();
+                        modifier.inputMutex.unlock_shared();
                         man.readBlock(*cr, id, os);
                     }
                 } else {
@@ -24,6 +24,8 @@
 #endif
 
 #if defined(__linux__) // Use the POSIX syscalls for the gettid()
+#    include <pthread.h>
+#    include <sched.h>
 #    include <sys/syscall.h>
 #    include <unistd.h>
 #endif
@@ -78,6 +80,7 @@ void theExecutiveBranch(void* args)
 #endif
 
         thread->setPriority();
+        thread->applyCpuAffinity();
         thread->run();
         thread->threadRelease();
     }
@@ -274,6 +277,43 @@ int ThreadImpl::setPriority(int priority, int policy)
     return 0;
 }
 
+int ThreadImpl::setCpuAffinity(const std::vector<int>& cpus)
+{
+    defaultAffinity = cpus;
+    return applyCpuAffinity();
+}
+
+std::vector<int> ThreadImpl::getCpuAffinity() const
+{
+    return defaultAffinity;
+}
+
+int ThreadImpl::applyCpuAffinity()
+{
+    if (!active || defaultAffinity.empty()) {
+        return 0;
+    }
+#if defined(__linux__)
+    if (std::is_same<std::thread::native_handle_type, pthread_t>::value) {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        for (int cpu : defaultAffinity) {
+            if (cpu < 0 || cpu >= CPU_SETSIZE) {
+                yCError(THREADIMPL, "Invalid CPU %d", cpu);
+                return -1;
+            }
+            CPU_SET(cpu, &cpuset);
+        }
+        int ret = pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuset);
+        return (ret != 0) ? -1 : 0;
+    }
+    yCError(THREADIMPL, "Cannot set CPU affinity as std::thread::native_handle_type is not pthread_t");
+#else
+    yCError(THREADIMPL, "Cannot set CPU affinity on this platform");
+#endif
+    return -1;
+}
+
 int ThreadImpl::getPriority()
 {
     int prio = defaultPriority;
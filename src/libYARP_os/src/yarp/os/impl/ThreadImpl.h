@@ -11,6 +11,7 @@
 
 #include <atomic>
 #include <thread>
+#include <vector>
 
 namespace yarp::os::impl {
 
@@ -59,6 +60,10 @@ public:
     int setPriority(int priority = -1, int policy = -1);
     int getPriority();
     int getPolicy();
+
+    int setCpuAffinity(const std::vector<int>& cpus);
+    std::vector<int> getCpuAffinity() const;
+    int applyCpuAffinity();
     long getTid();
 
     long tid{-1};
@@ -69,6 +74,7 @@ public:
 private:
     int defaultPriority{-1};
     int defaultPolicy{-1};
+    std::vector<int> defaultAffinity;
     YARP_SUPPRESS_DLL_INTERFACE_WARNING_ARG(std::thread) thread;
     YARP_SUPPRESS_DLL_INTERFACE_WARNING_ARG(std::atomic<bool>) active{false};
     bool opened{false};
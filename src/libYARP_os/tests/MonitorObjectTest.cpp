@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/MonitorObject.h>
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/Things.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::os;
+
+namespace {
+
+// Accepts the even numbers, and multiplies them by 10
+class EvenMonitor : public MonitorObject
+{
+public:
+    bool accept(Things& thing) override
+    {
+        auto* bottle = thing.cast_as<Bottle>();
+        return bottle != nullptr && bottle->get(0).asInt32() % 2 == 0;
+    }
+
+    Things& update(Things& thing) override
+    {
+        auto* bottle = thing.cast_as<Bottle>();
+        int32_t value = bottle->get(0).asInt32();
+        bottle->clear();
+        bottle->addInt32(value * 10);
+        return thing;
+    }
+};
+
+// Replaces all the messages with the same one
+class BatchMonitor : public MonitorObject
+{
+public:
+    bool hasUpdateBatch() const override
+    {
+        return true;
+    }
+
+    std::vector<Things*> updateBatch(const std::vector<Things*>& things) override
+    {
+        replacement.clear();
+        replacement.addString("batch");
+        result.reset();
+        result.setPortWriter(&replacement);
+        return std::vector<Things*>(things.size(), &result);
+    }
+
+    Bottle replacement;
+    Things result;
+};
+
+} // namespace
+
+TEST_CASE("os::MonitorObjectTest", "[yarp::os]")
+{
+    SECTION("default updateBatch calls accept and update")
+    {
+        EvenMonitor monitor;
+        Bottle bottles[4];
+        Things things[4];
+        std::vector<Things*> batch;
+        for (int i = 0; i < 4; i++) {
+            bottles[i].addInt32(i + 1);
+            things[i].setPortWriter(&bottles[i]);
+            batch.push_back(&things[i]);
+        }
+
+        std::vector<Things*> results = monitor.updateBatch(batch);
+        REQUIRE(results.size() == 4);
+        CHECK(results[0] == nullptr);
+        CHECK(results[1] == &things[1]);
+        CHECK(results[2] == nullptr);
+        CHECK(results[3] == &things[3]);
+        CHECK(bottles[0].get(0).asInt32() == 1);
+        CHECK(bottles[1].get(0).asInt32() == 20);
+        CHECK(bottles[2].get(0).asInt32() == 3);
+        CHECK(bottles[3].get(0).asInt32() == 40);
+
+        CHECK(monitor.updateBatch({}).empty());
+    }
+
+    SECTION("overridden updateBatch replaces the messages")
+    {
+        BatchMonitor monitor;
+        Bottle bottle("1");
+        Things thing;
+        thing.setPortWriter(&bottle);
+
+        std::vector<Things*> results = monitor.updateBatch({&thing, &thing});
+        REQUIRE(results.size() == 2);
+        REQUIRE(results[0] != nullptr);
+        auto* replaced = results[0]->cast_as<Bottle>();
+        REQUIRE(replaced != nullptr);
+        CHECK(replaced->toString() == "batch");
+        CHECK(bottle.toString() == "1");
+    }
+
+    SECTION("hasUpdateBatch is false unless overridden")
+    {
+        MonitorObject monitor;
+        CHECK_FALSE(monitor.hasUpdateBatch());
+
+        EvenMonitor evenMonitor;
+        CHECK_FALSE(evenMonitor.hasUpdateBatch());
+
+        BatchMonitor batchMonitor;
+        CHECK(batchMonitor.hasUpdateBatch());
+    }
+}
@@ -12,7 +12,9 @@
 #include <string>
 #include <yarp/os/Time.h>
 #include <yarp/os/Bottle.h>
+#include <yarp/os/Carriers.h>
 #include <yarp/os/QosStyle.h>
+#include <yarp/os/Route.h>
 
 #include <yarp/os/impl/TcpFace.h>
 
@@ -126,6 +128,106 @@ TEST_CASE("os::NetworkTest", "[yarp::os]")
     }
 
 
+    SECTION("checking connectMany and disconnectMany")
+    {
+        const size_t count = 10;
+        std::vector<Port> outputs(count);
+        std::vector<Port> inputs(count);
+        std::vector<Route> routes;
+        for (size_t i = 0; i < count; i++) {
+            std::string out = "/many/out" + std::to_string(i);
+            std::string in = "/many/in" + std::to_string(i);
+            REQUIRE(outputs[i].open(out));
+            REQUIRE(inputs[i].open(in));
+            routes.emplace_back(out, in, (i % 2 == 0) ? "" : "udp");
+        }
+        routes.emplace_back("/many/out0", "/many/missing", ""); // not existing destination
+        routes.emplace_back("/many/out0 /p2", "/many/in0", ""); // invalid source
+
+        std::vector<bool> results = Network::connectMany(routes);
+        REQUIRE(results.size() == routes.size());
+        for (size_t i = 0; i < count; i++) {
+            CHECK(results[i]);
+            CHECK(Network::isConnected(routes[i].getFromName(), routes[i].getToName(), routes[i].getCarrierName()));
+        }
+        CHECK_FALSE(results[count]);
+        CHECK_FALSE(results[count + 1]);
+
+        routes.resize(count);
+        results = Network::disconnectMany(routes);
+        for (size_t i = 0; i < count; i++) {
+            CHECK(results[i]);
+            CHECK_FALSE(Network::isConnected(routes[i].getFromName(), routes[i].getToName(), routes[i].getCarrierName()));
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            outputs[i].close();
+            inputs[i].close();
+        }
+    }
+
+
+    SECTION("checking local carrier selection")
+    {
+        CHECK(Carriers::chooseLocalCarrier("udp").empty());
+        CHECK(Carriers::chooseLocalCarrier("mcast").empty());
+        std::string local = Carriers::chooseLocalCarrier("tcp");
+        CHECK((local.empty() || local == "unix_stream+ack"));
+        // the availability of each local carrier is checked separately
+        std::string localFast = Carriers::chooseLocalCarrier("fast_tcp");
+        CHECK((localFast.empty() || localFast == "unix_stream"));
+        CHECK(Carriers::chooseLocalCarrier("tcp") == local);
+
+        Port p1;
+        Port p2;
+        REQUIRE(p1.open("/local/p1"));
+        REQUIRE(p2.open("/local/p2"));
+
+        // both ports belong to this process, hence they see the same file system
+        Bottle propCmd;
+        Bottle props[2];
+        ContactStyle propStyle;
+        propStyle.admin = true;
+        propCmd.fromString("prop get /local/p1");
+        REQUIRE(Network::write(Network::queryName("/local/p1"), propCmd, props[0], propStyle));
+        propCmd.fromString("prop get /local/p2");
+        REQUIRE(Network::write(Network::queryName("/local/p2"), propCmd, props[1], propStyle));
+        Bottle* platform1 = props[0].findGroup("platform").find("platform").asList();
+        Bottle* platform2 = props[1].findGroup("platform").find("platform").asList();
+        REQUIRE(platform1 != nullptr);
+        REQUIRE(platform2 != nullptr);
+        CHECK(platform1->check("namespace"));
+        CHECK(platform1->find("namespace").asString() == platform2->find("namespace").asString());
+
+        // the connection is found whatever carrier was chosen
+        CHECK(Network::connect("/local/p1", "/local/p2"));
+        CHECK(Network::isConnected("/local/p1", "/local/p2"));
+
+        // the local carrier is not used when disabled, or when a carrier
+        // is requested explicitly
+        ContactStyle style;
+        style.allowLocalCarrier = false;
+        style.quiet = true;
+        CHECK(Network::connect("/local/p1", "/local/p2", style));
+        Bottle cmd;
+        Bottle reply;
+        cmd.addVocab32("list");
+        cmd.addVocab32("out");
+        cmd.addString("/local/p2");
+        ContactStyle admin;
+        admin.admin = true;
+        REQUIRE(Network::write(Network::queryName("/local/p1"), cmd, reply, admin));
+        CHECK(reply.find("carrier").asString() == "tcp");
+
+        CHECK(Network::connect("/local/p1", "tcp://local/p2"));
+        CHECK(Network::isConnected("/local/p1", "/local/p2"));
+        CHECK(Network::isConnected("/local/p1", "tcp://local/p2"));
+
+        p2.close();
+        p1.close();
+    }
+
+
     SECTION("checking port synchronization")
     {
         Port p1;
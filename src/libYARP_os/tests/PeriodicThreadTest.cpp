@@ -14,7 +14,11 @@
 
 #include <catch2/catch_amalgamated.hpp>
 #include <harness.h>
+#include <atomic>
 #include <cmath> // std::floor, std::ceil
+#include <memory>
+#include <thread>
+#include <vector>
 
 using namespace yarp::os;
 using namespace yarp::os::impl;
@@ -244,6 +248,61 @@ public:
     }
 };
 
+class SharedThread : public PeriodicThread
+{
+public:
+    std::atomic<int> count {0};
+    std::atomic<int> released {0};
+    int stopAfter {-1};
+    double busy {0.0};
+
+    SharedThread(double r) : PeriodicThread(r, ShouldUseSystemClock::Yes)
+    {
+        setSharedExecution(true);
+    }
+
+    void run() override
+    {
+        if (busy > 0) {
+            SystemClock::delaySystem(busy);
+        }
+        if (++count == stopAfter) {
+            askToStop();
+        }
+    }
+
+    void threadRelease() override
+    {
+        released++;
+    }
+};
+
+class RealTimeThread : public PeriodicThread
+{
+public:
+    std::vector<double> starts;
+    size_t busyIteration {0};
+    double busy {0.0};
+
+    std::thread::id initThread;
+
+    RealTimeThread(double r) : PeriodicThread(r, PeriodicThreadClock::RealTime) {}
+
+    bool threadInit() override
+    {
+        initThread = std::this_thread::get_id();
+        return true;
+    }
+
+    void run() override
+    {
+        starts.push_back(SystemClock::nowSystem());
+        if (starts.size() == busyIteration) {
+            SystemClock::delaySystem(busy);
+        }
+    }
+};
+
 } // namespace harness_os::periodicThread
 
 using namespace harness_os::periodicThread;
@@ -439,6 +498,120 @@ TEST_CASE("os::PeriodicThreadTest", "[yarp::os]")
         CHECK(Time::getClockType() == YARP_CLOCK_SYSTEM); // getClockType is YARP_CLOCK_SYSTEM
     }
 
+    SECTION("testing overrun statistics")
+    {
+        SharedThread thread(0.010);
+        thread.setSharedExecution(false);
+        thread.busy = 0.020;
+        thread.start();
+        SystemClock::delaySystem(0.2);
+        thread.stop();
+        CHECK(thread.getOverruns() > 0);
+        CHECK(thread.getMaxOverrun() > 0.005);
+        thread.resetStat();
+        thread.step();
+        CHECK(thread.getIterations() == 1);
+    }
+
+    SECTION("testing real-time mode")
+    {
+        RealTimeThread thread(0.001);
+        CHECK(thread.setCpuAffinity({0}) == 0);
+        thread.start();
+        SystemClock::delaySystem(0.5);
+        thread.stop();
+        CHECK(thread.getCpuAffinity() == std::vector<int>{0});
+
+        double av;
+        double std;
+        thread.getEstimatedPeriod(av, std);
+        CHECK(av == Catch::Approx(0.001).margin(0.0002));
+
+        std::vector<double> edges;
+        std::vector<unsigned int> counts;
+        thread.getJitterHistogram(edges, counts);
+        REQUIRE(edges.size() == counts.size());
+        CHECK(edges[0] == 0.0);
+        CHECK(edges[1] == Catch::Approx(1e-6));
+        CHECK(edges[2] == Catch::Approx(2e-6));
+        unsigned int total = 0;
+        for (auto c : counts) {
+            total += c;
+        }
+        // all the iterations but the first
+        CHECK(total + 1 == thread.getIterations());
+        CHECK(thread.getMaxJitter() >= 0.0);
+
+        // a late iteration does not cause a burst of iterations
+        RealTimeThread late(0.010);
+        late.busyIteration = 5;
+        late.busy = 0.025;
+        late.start();
+        SystemClock::delaySystem(0.2);
+        late.stop();
+        REQUIRE(late.starts.size() > 6);
+        CHECK(late.getOverruns() == 1);
+        CHECK(late.starts[5] - late.starts[4] == Catch::Approx(0.030).margin(0.005));
+        CHECK(late.starts[6] - late.starts[5] == Catch::Approx(0.010).margin(0.005));
+
+        // the shared executor is not used in real-time mode, threadInit() is
+        // called by the dedicated thread instead of the one calling start()
+        RealTimeThread shared(0.010);
+        CHECK(shared.setSharedExecution(true));
+        CHECK(shared.start());
+        SystemClock::delaySystem(0.05);
+        shared.stop();
+        CHECK(shared.initThread != std::thread::id());
+        CHECK(shared.initThread != std::this_thread::get_id());
+        CHECK(!shared.starts.empty());
+    }
+
+    SECTION("testing shared executor")
+    {
+        // Many low rate threads sharing a few workers
+        const size_t threads = 60;
+        std::vector<std::unique_ptr<SharedThread>> pool;
+        for (size_t i = 0; i < threads; ++i) {
+            pool.push_back(std::make_unique<SharedThread>((i % 2 == 0) ? 0.010 : 0.050));
+            CHECK(pool.back()->isSharedExecution());
+            CHECK(pool.back()->start());
+        }
+        CHECK(!pool.front()->setSharedExecution(false)); // cannot change while running
+        SystemClock::delaySystem(1.0);
+
+        for (size_t i = 0; i < threads; ++i) {
+            double period = pool[i]->getPeriod();
+            CHECK(pool[i]->isRunning());
+            CHECK(pool[i]->getEstimatedPeriod() == Catch::Approx(period).margin(period * 0.2));
+            CHECK(pool[i]->getIterations() >= static_cast<unsigned int>(0.8 / period));
+        }
+
+        for (auto& thread : pool) {
+            thread->stop();
+            CHECK(!thread->isRunning());
+            CHECK(thread->released == 1);
+        }
+
+        // askToStop() from run()
+        SharedThread selfStopping(0.005);
+        selfStopping.stopAfter = 10;
+        selfStopping.start();
+        for (int i = 0; i < 100 && selfStopping.isRunning(); ++i) {
+            SystemClock::delaySystem(0.01);
+        }
+        CHECK(!selfStopping.isRunning());
+        CHECK(selfStopping.count == 10);
+        CHECK(selfStopping.released == 1);
+
+        // restart after a stop
+        selfStopping.stopAfter = -1;
+        selfStopping.start();
+        SystemClock::delaySystem(0.1);
+        selfStopping.stop();
+        CHECK(selfStopping.count > 10);
+        CHECK(selfStopping.released == 2);
+    }
+
     SECTION("testing start() askForStop() start() sequence...")
     {
         AskForStopThread test;
@@ -13,6 +13,8 @@
 #include <cstdlib>
 #include <cstdio>
 #include <cfloat>
+#include <string>
+#include <vector>
 
 #include <catch2/catch_amalgamated.hpp>
 #include <harness.h>
@@ -625,6 +627,128 @@ check $x $y\n\
         CHECK(pCopy.toString() == p.toString()); // test if addGroup works fine with Property copy operator
     }
 
+    SECTION("checking large properties")
+    {
+        Property p;
+        for (int i = 0; i < 1000; i++) {
+            p.put("key" + std::to_string(i), i);
+        }
+        for (int i = 0; i < 1000; i += 3) {
+            p.unput("key" + std::to_string(i));
+        }
+        bool ok = true;
+        for (int i = 0; i < 1000; i++) {
+            bool expected = (i % 3 != 0);
+            if (p.check("key" + std::to_string(i)) != expected) {
+                ok = false;
+            }
+            if (expected && p.find("key" + std::to_string(i)).asInt32() != i) {
+                ok = false;
+            }
+        }
+        CHECK(ok); // lookups after insertions and removals
+
+        Property pCopy;
+        pCopy = p;
+        CHECK(pCopy.toString() == p.toString()); // copy of a large property
+        CHECK(pCopy.find("key998").asInt32() == 998);
+        CHECK(pCopy.check("key999") == false);
+
+        Bottle b(p.toString());
+        CHECK(b.size() == 666);
+        CHECK(b.get(0).asList()->get(0).asString() == "key1"); // entries are still sorted by key
+        CHECK(b.get(1).asList()->get(0).asString() == "key10");
+
+        p.clear();
+        CHECK(p.check("key1") == false);
+        p.put("key1", 1);
+        CHECK(p.find("key1").asInt32() == 1);
+    }
+
+    SECTION("checking lookups of colliding keys")
+    {
+        // many keys in a small index share the same slots: removing them in
+        // any order must not hide the keys stored after them
+        Property p;
+        std::vector<std::string> keys;
+        for (int i = 0; i < 200; i++) {
+            keys.push_back("k" + std::to_string(i * 7919 % 1000));
+            p.put(keys.back(), i);
+        }
+        std::vector<bool> removed(keys.size(), false);
+        bool ok = true;
+        for (size_t step = 0; step < keys.size(); step += 2) {
+            size_t r = (step * 37) % keys.size();
+            p.unput(keys[r]);
+            removed[r] = true;
+            for (size_t i = 0; i < keys.size(); i++) {
+                if (p.check(keys[i]) == removed[i]) {
+                    ok = false;
+                }
+                if (!removed[i] && p.find(keys[i]).asInt32() != static_cast<int>(i)) {
+                    ok = false;
+                }
+            }
+        }
+        CHECK(ok); // lookups after removing colliding keys
+    }
+
+    SECTION("checking rehash after unput")
+    {
+        Property p;
+        for (int i = 0; i < 40; i++) {
+            p.put("key" + std::to_string(i), i);
+        }
+        // fewer entries than the indexed ones, the index must still be valid
+        for (int i = 0; i < 35; i++) {
+            p.unput("key" + std::to_string(i));
+        }
+        CHECK(p.check("key0") == false);
+        CHECK(p.find("key39").asInt32() == 39);
+
+        // grow the index again, the remaining and the removed keys must survive the rehash
+        for (int i = 100; i < 400; i++) {
+            p.put("key" + std::to_string(i), i);
+        }
+        bool ok = true;
+        for (int i = 0; i < 400; i++) {
+            bool expected = (i >= 35 && i < 40) || i >= 100;
+            if (p.check("key" + std::to_string(i)) != expected) {
+                ok = false;
+            }
+            if (expected && p.find("key" + std::to_string(i)).asInt32() != i) {
+                ok = false;
+            }
+        }
+        CHECK(ok); // lookups after a rehash
+        CHECK(Bottle(p.toString()).size() == 305);
+
+        // a key removed and added again is found with its new value
+        p.unput("key200");
+        p.put("key200", -200);
+        CHECK(p.find("key200").asInt32() == -200);
+    }
+
+    SECTION("checking case sensitivity of indexed lookups")
+    {
+        Property p;
+        for (int i = 0; i < 20; i++) {
+            p.put("key" + std::to_string(i), i);
+        }
+        p.put("Key", 1);
+        p.put("KEY", 2);
+        p.put("key", 3);
+        CHECK(p.find("Key").asInt32() == 1);
+        CHECK(p.find("KEY").asInt32() == 2);
+        CHECK(p.find("key").asInt32() == 3);
+        CHECK(p.check("kEy") == false);
+        CHECK(p.check("KEY0") == false);
+        p.unput("KEY");
+        CHECK(p.check("KEY") == false);
+        CHECK(p.find("Key").asInt32() == 1);
+        CHECK(p.find("key").asInt32() == 3);
+    }
+
     SECTION("checking initializer_list constructor")
     {
         Property p {{"one", Value(1)},
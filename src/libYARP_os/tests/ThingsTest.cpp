@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/Things.h>
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/DummyConnector.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/Port.h>
+#include <yarp/os/Semaphore.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::os;
+
+namespace {
+
+// Reads the messages as a port monitor does
+class ThingsReader : public PortReader
+{
+public:
+    bool read(ConnectionReader& connection) override
+    {
+        Things thing;
+        thing.setConnectionReader(connection);
+        envelope = thing.getEnvelope();
+        auto* bottle = thing.cast_as<Bottle>();
+        if (bottle != nullptr) {
+            data = *bottle;
+        }
+        received.post();
+        return bottle != nullptr;
+    }
+
+    std::string envelope;
+    Bottle data;
+    Semaphore received {0};
+};
+
+} // namespace
+
+TEST_CASE("os::ThingsTest", "[yarp::os]")
+{
+    SECTION("message without connection reader")
+    {
+        Bottle bottle("1 2 3");
+        Things thing;
+        thing.setPortWriter(&bottle);
+        CHECK(thing.getEnvelope().empty());
+    }
+
+    SECTION("message without envelope")
+    {
+        Bottle bottle("1 2 3");
+        DummyConnector con;
+        bottle.write(con.getWriter());
+        Things thing;
+        thing.setConnectionReader(con.getReader());
+        CHECK(thing.getEnvelope().empty());
+        auto* data = thing.cast_as<Bottle>();
+        REQUIRE(data != nullptr);
+        CHECK(data->toString() == "1 2 3");
+    }
+
+    SECTION("envelope of a message received by a port")
+    {
+        Network::setLocalMode(true);
+
+        ThingsReader reader;
+        Port in;
+        in.setReader(reader);
+        REQUIRE(in.open("/things/in"));
+        Port out;
+        REQUIRE(out.open("/things/out"));
+        REQUIRE(Network::connect(out.getName(), in.getName(), "tcp"));
+
+        Bottle envelope("10 hello");
+        out.setEnvelope(envelope);
+        Bottle bottle("1 2 3");
+        REQUIRE(out.write(bottle));
+        reader.received.wait();
+
+        CHECK(Bottle(reader.envelope).toString() == "10 hello");
+        CHECK(reader.data.toString() == "1 2 3");
+
+        out.close();
+        in.close();
+
+        Network::setLocalMode(false);
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// first include: stuff under test
+#include <yarp/os/impl/NameCache.h>
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/DummyConnector.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/SystemClock.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::os;
+using namespace yarp::os::impl;
+
+TEST_CASE("os::impl::NameCacheTest", "[yarp::os][yarp::os::impl]")
+{
+    // No subscription to the name server in local mode
+    NetworkBase::setLocalMode(true);
+    NameCache& cache = NameCache::getInstance();
+    double ttl = cache.getTimeout();
+    Contact address("/cache/foo", "tcp", "127.0.0.1", 10010);
+    Contact found;
+
+    SECTION("check disabled cache")
+    {
+        cache.setTimeout(0);
+        cache.store("/cache/foo", address);
+        CHECK_FALSE(cache.find("/cache/foo", found));
+    }
+
+    SECTION("check store and expiry")
+    {
+        cache.setTimeout(0.5);
+        cache.store("/cache/foo", address);
+        REQUIRE(cache.find("/cache/foo", found));
+        CHECK(found.getName() == "/cache/foo");
+        CHECK(found.getPort() == 10010);
+        CHECK_FALSE(cache.find("/cache/bar", found));
+
+        // invalid and multicast addresses are not cached
+        cache.store("/cache/bar", Contact());
+        CHECK_FALSE(cache.find("/cache/bar", found));
+        cache.store("/cache/bar", Contact("/cache/bar", "mcast", "224.1.1.1", 10011));
+        CHECK_FALSE(cache.find("/cache/bar", found));
+
+        SystemClock::delaySystem(0.6);
+        CHECK_FALSE(cache.find("/cache/foo", found));
+        CHECK_FALSE(cache.isSubscribed());
+    }
+
+    SECTION("check invalidation from name server events")
+    {
+        cache.setTimeout(60);
+        cache.store("/cache/foo", address);
+        cache.store("/cache/bar", address);
+        REQUIRE(cache.find("/cache/foo", found));
+
+        Bottle event;
+        event.addVocab32("del");
+        event.addString("/cache/foo");
+        DummyConnector con;
+        event.write(con.getWriter());
+        CHECK(cache.read(con.getReader()));
+        CHECK_FALSE(cache.find("/cache/foo", found));
+        CHECK(cache.find("/cache/bar", found));
+
+        cache.invalidate("/cache/bar");
+        CHECK_FALSE(cache.find("/cache/bar", found));
+    }
+
+    cache.setTimeout(ttl);
+    NetworkBase::setLocalMode(false);
+}
@@ -10,6 +10,7 @@
 #include <yarp/robotinterface/Param.h>
 
 #include <yarp/os/LogStream.h>
+#include <yarp/os/SystemClock.h>
 
 #include <yarp/dev/PolyDriver.h>
 #include <yarp/dev/PolyDriverList.h>
@@ -17,8 +18,14 @@
 #include <yarp/dev/IDeviceDriverParams.h>
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_set>
 
 #include <yarp/dev/IRobotDescription.h>
@@ -73,6 +80,13 @@ public:
     // open all the devices and return true if all the open calls were successful
     bool openDevices();
 
+    // open all the devices using a pool of threads, following the dependencies
+    // between the devices, and store the result of each open call
+    void openDevicesInParallel(std::vector<bool>& opened);
+
+    // register an opened device in the robotDescriptionStorage
+    void registerDevice(const Device& device);
+
     // close all the devices and return true if all the close calls were successful
     bool closeDevices();
 
@@ -114,6 +128,7 @@ public:
     unsigned int currentLevel {0};
     bool dryrun {false};
     bool reverseShutdownActionOrder {false};
+    unsigned int parallelOpen {1};
     yarp::dev::PolyDriver m_ddstorage;
     std::string yriDescriptionStorageName = "yriDescriptionStorage";
     yarp::dev::IRobotDescription* m_istorage = nullptr;
@@ -209,56 +224,34 @@ bool yarp::robotinterface::Robot::Private::openDevices()
     m_ddstorage.view(m_istorage);
 
     bool ret = true;
-    for (auto& device : devices) {
-        yCInfo(YRI_ROBOT) << "Opening device" << device.name() << "with parameters" << device.params();
+    std::vector<bool> opened(devices.size(), false);
+    if (parallelOpen > 1 && !dryrun) {
+        openDevicesInParallel(opened);
+    } else {
+        for (size_t i = 0; i < devices.size(); ++i) {
+            auto& device = devices[i];
+            yCInfo(YRI_ROBOT) << "Opening device" << device.name() << "with parameters" << device.params();
 
-        if (dryrun) {
-            continue;
+            if (dryrun) {
+                opened[i] = true;
+                continue;
+            }
+
+            opened[i] = device.open();
+            if (!opened[i]) {
+                yCWarning(YRI_ROBOT) << "Cannot open device" << device.name();
+            }
         }
+    }
 
-        if (!device.open()) {
-            yCWarning(YRI_ROBOT) << "Cannot open device" << device.name();
+    for (size_t i = 0; i < devices.size(); ++i) {
+        if (!opened[i]) {
             ret = false;
-        }
-        else
-        {
-            if (m_istorage)
-            {
-                std::vector<std::string> stp;
-                std::string scfg;
-                yarp::dev::PolyDriver* pddrv = device.driver();
-                yarp::dev::IDeviceDriverParams* dparams = nullptr;
-                if (pddrv)
-                {
-                    pddrv->view(dparams);
-                    if (dparams)
-                    {
-                        stp = dparams->getListOfParams();
-                        scfg = dparams->getConfiguration();
-                    }
-                    else
-                    {
-                        yCWarning(YRI_ROBOT) << "Device" << device.name() << "does not derive from IDeviceDriverParams.";
-                    }
-                }
-                if (!pddrv || scfg.empty())
-                {
-                    yCWarning(YRI_ROBOT) << "Unable to get device" << device.name() << "configuration. yarprobotinterface will continue, but some features for inspecting the device parameters will be disabled.";
-                    yCDebug(YRI_ROBOT) << "It is recommended that devices used by yarprobinterface implement the `yarp::dev::IDeviceDriverParams` interface.";
-                    yCDebug(YRI_ROBOT) << "See yarprobotinterface documentation page.";
-                }
-                yarp::dev::DeviceDescription devdesc;
-                devdesc.device_name = device.name();
-                devdesc.device_type = device.type();
-                devdesc.device_configuration = scfg;
-                yarp::dev::ReturnValue ret = m_istorage->registerDevice(devdesc);
-                if (!ret)
-                {
-                    yCError(YRI_ROBOT) << "Unable to register device" << device.name() << "in robotDescriptionStorage";
-                }
-            }
+        } else if (!dryrun) {
+            registerDevice(devices[i]);
         }
     }
+
     if (ret)
     {
         if (m_istorage)
@@ -283,6 +276,163 @@ bool yarp::robotinterface::Robot::Private::openDevices()
     return ret;
 }
 
+void yarp::robotinterface::Robot::Private::registerDevice(const yarp::robotinterface::Device& device)
+{
+    if (!m_istorage) {
+        return;
+    }
+
+    std::vector<std::string> stp;
+    std::string scfg;
+    yarp::dev::PolyDriver* pddrv = device.driver();
+    yarp::dev::IDeviceDriverParams* dparams = nullptr;
+    if (pddrv)
+    {
+        pddrv->view(dparams);
+        if (dparams)
+        {
+            stp = dparams->getListOfParams();
+            scfg = dparams->getConfiguration();
+        }
+        else
+        {
+            yCWarning(YRI_ROBOT) << "Device" << device.name() << "does not derive from IDeviceDriverParams.";
+        }
+    }
+    if (!pddrv || scfg.empty())
+    {
+        yCWarning(YRI_ROBOT) << "Unable to get device" << device.name() << "configuration. yarprobotinterface will continue, but some features for inspecting the device parameters will be disabled.";
+        yCDebug(YRI_ROBOT) << "It is recommended that devices used by yarprobinterface implement the `yarp::dev::IDeviceDriverParams` interface.";
+        yCDebug(YRI_ROBOT) << "See yarprobotinterface documentation page.";
+    }
+    yarp::dev::DeviceDescription devdesc;
+    devdesc.device_name = device.name();
+    devdesc.device_type = device.type();
+    devdesc.device_configuration = scfg;
+    yarp::dev::ReturnValue ret = m_istorage->registerDevice(devdesc);
+    if (!ret)
+    {
+        yCError(YRI_ROBOT) << "Unable to register device" << device.name() << "in robotDescriptionStorage";
+    }
+}
+
+void yarp::robotinterface::Robot::Private::openDevicesInParallel(std::vector<bool>& opened)
+{
+    const size_t n = devices.size();
+
+    // A device is opened after the devices that are referred by its actions
+    // (e.g. the targets of attach and calibrate actions), if they precede it
+    // in the configuration file. Considering only the devices that precede it
+    // keeps the order of the sequential opening and avoids cycles.
+    std::map<std::string, size_t> indices;
+    for (size_t i = 0; i < n; ++i) {
+        indices[devices[i].name()] = i;
+    }
+    std::vector<std::vector<size_t>> dependencies(n);
+    std::vector<std::vector<size_t>> dependents(n);
+    auto addDependency = [&](size_t i, size_t j) {
+        if (j < i && std::find(dependencies[i].begin(), dependencies[i].end(), j) == dependencies[i].end()) {
+            dependencies[i].push_back(j);
+            dependents[j].push_back(i);
+        }
+    };
+    for (size_t i = 0; i < n; ++i) {
+        for (const auto& action : devices[i].actions()) {
+            for (const auto& param : action.params()) {
+                if (action.type() == ActionTypeAttach && param.name() == "all") {
+                    for (size_t j = 0; j < i; ++j) {
+                        addDependency(i, j);
+                    }
+                    continue;
+                }
+                auto it = indices.find(param.value());
+                if (it != indices.end()) {
+                    addDependency(i, it->second);
+                }
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<size_t> ready;
+    std::vector<size_t> missing(n);
+    std::vector<double> start(n, 0.0);
+    std::vector<double> end(n, 0.0);
+    size_t done = 0;
+    for (size_t i = 0; i < n; ++i) {
+        missing[i] = dependencies[i].size();
+        if (missing[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+
+    const double t0 = yarp::os::SystemClock::nowSystem();
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cv.wait(lock, [&]() { return !ready.empty() || done == n; });
+            if (ready.empty()) {
+                return;
+            }
+            size_t i = ready.front();
+            ready.pop_front();
+            lock.unlock();
+
+            auto& device = devices[i];
+            yCInfo(YRI_ROBOT) << "Opening device" << device.name() << "with parameters" << device.params();
+            double t_start = yarp::os::SystemClock::nowSystem() - t0;
+            bool ok = device.open();
+            double t_end = yarp::os::SystemClock::nowSystem() - t0;
+            if (!ok) {
+                yCWarning(YRI_ROBOT) << "Cannot open device" << device.name();
+            }
+
+            lock.lock();
+            start[i] = t_start;
+            end[i] = t_end;
+            opened[i] = ok;
+            done++;
+            for (size_t d : dependents[i]) {
+                if (--missing[d] == 0) {
+                    ready.push_back(d);
+                }
+            }
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < std::min<size_t>(parallelOpen, n); ++t) {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (n == 0) {
+        return;
+    }
+
+    // Report the critical path, i.e. the chain of dependencies ending with the
+    // last device that was opened.
+    double total = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        total += end[i] - start[i];
+    }
+    size_t last = std::max_element(end.begin(), end.end()) - end.begin();
+    std::vector<size_t> path {last};
+    while (!dependencies[path.back()].empty()) {
+        const auto& deps = dependencies[path.back()];
+        path.push_back(*std::max_element(deps.begin(), deps.end(), [&](size_t a, size_t b) { return end[a] < end[b]; }));
+    }
+    std::ostringstream oss;
+    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+        oss << "\n- " << devices[*it].name() << ": opened in " << end[*it] - start[*it] << " s, after " << start[*it] << " s";
+    }
+    yCInfo(YRI_ROBOT) << n << "devices opened in" << end[last] << "s using" << threads.size() << "threads (" << total << "s if opened sequentially). Critical path:" << oss.str();
+}
+
 bool yarp::robotinterface::Robot::Private::closeDevices()
 {
     bool ret = true;
@@ -564,6 +714,7 @@ yarp::robotinterface::Robot::Robot(const yarp::robotinterface::Robot& other) :
     mPriv->currentLevel = other.mPriv->currentLevel;
     mPriv->dryrun = other.mPriv->dryrun;
     mPriv->reverseShutdownActionOrder = other.mPriv->reverseShutdownActionOrder;
+    mPriv->parallelOpen = other.mPriv->parallelOpen;
     mPriv->devices = other.mPriv->devices;
     mPriv->params = other.mPriv->params;
 }
@@ -578,6 +729,7 @@ yarp::robotinterface::Robot& yarp::robotinterface::Robot::operator=(const yarp::
         mPriv->currentLevel = other.mPriv->currentLevel;
         mPriv->dryrun = other.mPriv->dryrun;
         mPriv->reverseShutdownActionOrder = other.mPriv->reverseShutdownActionOrder;
+        mPriv->parallelOpen = other.mPriv->parallelOpen;
 
         mPriv->devices.clear();
         mPriv->devices = other.mPriv->devices;
@@ -641,6 +793,11 @@ void yarp::robotinterface::Robot::setReverseShutdownActionOrder(bool reverseShut
     mPriv->reverseShutdownActionOrder = reverseShutdownActionOrder;
 }
 
+void yarp::robotinterface::Robot::setParallelOpen(unsigned int threads)
+{
+    mPriv->parallelOpen = threads;
+}
+
 yarp::robotinterface::ParamList& yarp::robotinterface::Robot::params()
 {
     return mPriv->params;
@@ -30,6 +30,7 @@ public:
     void setAllowDeprecatedDevices(bool allowDeprecatedDevices);
     void setDryRun(bool dryrun);
     void setReverseShutdownActionOrder(bool reverseShutdownActionOrder);
+    void setParallelOpen(unsigned int threads);
 
     ParamList& params();
     DeviceList& devices();
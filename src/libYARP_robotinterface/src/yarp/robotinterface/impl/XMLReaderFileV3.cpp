@@ -393,6 +393,14 @@ yarp::robotinterface::XMLReaderResult yarp::robotinterface::impl::XMLReaderFileV
     }
     result.robot.setReverseShutdownActionOrder(reverse);
 
+    // Number of threads used to open the devices (1 = open the devices sequentially)
+    int parallelOpen = 1;
+    if (robotElem->QueryIntAttribute("parallel-open", &parallelOpen) == TIXML_WRONG_TYPE || parallelOpen < 0) {
+        SYNTAX_ERROR(robotElem->Row()) << R"(The "parallel-open" attribute in the "robot" element should be an unsigned int.)";
+        return yarp::robotinterface::XMLReaderResult::ParsingFailed();
+    }
+    result.robot.setParallelOpen(static_cast<unsigned>(parallelOpen));
+
     // yDebug() << "Found robot [" << robot.name() << "] build [" << robot.build() << "] portprefix [" << robot.portprefix() << "]";
 
     for (TiXmlElement* childElem = robotElem->FirstChildElement(); childElem != nullptr; childElem = childElem->NextSiblingElement()) {
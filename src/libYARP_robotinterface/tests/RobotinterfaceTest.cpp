@@ -12,6 +12,11 @@
 
 #include <yarp/os/LogStream.h>
 #include <yarp/os/ResourceFinder.h>
+#include <yarp/os/SystemClock.h>
+
+#include <map>
+#include <mutex>
+#include <string>
 
 #include <catch2/catch_amalgamated.hpp>
 #include <harness.h>
@@ -36,6 +41,7 @@ TEST_CASE("robotinterface::ParamTest", "[yarp::robotinterface]")
 namespace yarp::dev {
 class RobotInterfaceTestMockDriver;
 class RobotInterfaceTestMockWrapper;
+class RobotInterfaceTestMockSlowDriver;
 }
 
 struct GlobalState
@@ -62,6 +68,10 @@ struct GlobalState
 
 GlobalState globalState;
 
+// Open times (start, end) of the slow devices, by name
+std::mutex slowDevicesMutex;
+std::map<std::string, std::pair<double, double>> slowDevicesOpenTimes;
+
 class yarp::dev::RobotInterfaceTestMockDriver :
         public yarp::dev::DeviceDriver
 {
@@ -135,6 +145,26 @@ bool yarp::dev::RobotInterfaceTestMockWrapper::detachAll()
 }
 
 
+// Device that takes some time to open, used in "Check parallel opening of devices" test
+class yarp::dev::RobotInterfaceTestMockSlowDriver :
+        public yarp::dev::DeviceDriver
+{
+public:
+    bool open(yarp::os::Searchable& config) override
+    {
+        double start = yarp::os::SystemClock::nowSystem();
+        yarp::os::SystemClock::delaySystem(config.check("delay", yarp::os::Value(0.2)).asFloat64());
+        double end = yarp::os::SystemClock::nowSystem();
+        std::lock_guard<std::mutex> lock(slowDevicesMutex);
+        slowDevicesOpenTimes[config.find("id").asString()] = {start, end};
+        return true;
+    }
+
+    bool close() override
+    {
+        return true;
+    }
+};
 
 TEST_CASE("robotinterface::XMLReaderTest", "[yarp::robotinterface]")
 {
@@ -529,6 +559,54 @@ TEST_CASE("robotinterface::XMLReaderTest", "[yarp::robotinterface]")
         CHECK(globalState.mockDriverWasClosed);
     }
 
+    SECTION("Check parallel opening of devices")
+    {
+        // Reset test flags
+        globalState.reset();
+        slowDevicesOpenTimes.clear();
+
+        // Add dummy devices to YARP drivers factory
+        yarp::dev::Drivers::factory().add(new yarp::dev::DriverCreatorOf<yarp::dev::RobotInterfaceTestMockSlowDriver>("robotinterface_test_mock_slow_device", "", "RobotInterfaceTestMockSlowDriver"));
+        yarp::dev::Drivers::factory().add(new yarp::dev::DriverCreatorOf<yarp::dev::RobotInterfaceTestMockWrapper>("robotinterface_test_mock_wrapper", "", "RobotInterfaceTestMockWrapper"));
+
+        // Four independent slow devices, and a fifth one that must wait for the first one
+        std::string XMLString = "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n"
+                                "<!DOCTYPE robot PUBLIC \"-//YARP//DTD yarprobotinterface 3.0//EN\" \"http://www.yarp.it/DTD/yarprobotinterfaceV3.0.dtd\">\n"
+                                "<robot name=\"RobotWithSlowDevices\" prefix=\"RobotWithSlowDevices\" parallel-open=\"4\">\n"
+                                "  <devices>\n"
+                                "    <device name=\"slow_device_1\" type=\"robotinterface_test_mock_slow_device\"> <param name=\"id\"> slow_device_1 </param> </device>\n"
+                                "    <device name=\"slow_device_2\" type=\"robotinterface_test_mock_slow_device\"> <param name=\"id\"> slow_device_2 </param> </device>\n"
+                                "    <device name=\"slow_device_3\" type=\"robotinterface_test_mock_slow_device\"> <param name=\"id\"> slow_device_3 </param> </device>\n"
+                                "    <device name=\"slow_device_4\" type=\"robotinterface_test_mock_slow_device\"> <param name=\"id\"> slow_device_4 </param> </device>\n"
+                                "    <device name=\"slow_wrapper\" type=\"robotinterface_test_mock_slow_device\">\n"
+                                "      <param name=\"id\"> slow_wrapper </param>\n"
+                                "      <action phase=\"startup\" level=\"5\" type=\"attach\">\n"
+                                "        <param name=\"device\"> slow_device_1 </param>\n"
+                                "      </action>\n"
+                                "    </device>\n"
+                                "  </devices>\n"
+                                "</robot>\n";
+
+        yarp::robotinterface::XMLReader reader;
+        yarp::robotinterface::XMLReaderResult result = reader.getRobotFromString(XMLString);
+        CHECK(result.parsingIsSuccessful);
+        CHECK(result.robot.devices().size() == 5);
+
+        // Start the robot. The attach action fails, since the mock device is not a wrapper
+        double start = yarp::os::SystemClock::nowSystem();
+        result.robot.enterPhase(yarp::robotinterface::ActionPhaseStartup);
+        double elapsed = yarp::os::SystemClock::nowSystem() - start;
+
+        REQUIRE(slowDevicesOpenTimes.size() == 5);
+        // the four independent devices are opened at the same time (sequentially it would take 1 s)
+        CHECK(elapsed < 0.8);
+        // slow_wrapper is opened after slow_device_1
+        CHECK(slowDevicesOpenTimes["slow_wrapper"].first >= slowDevicesOpenTimes["slow_device_1"].second);
+
+        bool ok = result.robot.enterPhase(yarp::robotinterface::ActionPhaseShutdown);
+        CHECK(ok);
+    }
+
     SECTION("Check valid robot file with one device attaching to an external device")
     {
         // Reset test flags
@@ -192,6 +192,27 @@ bool NameServiceOnTriples::cmdQuery(NameTripleState& act, bool nested)
     return true;
 }
 
+bool NameServiceOnTriples::cmdQueryMany(NameTripleState& act)
+{
+    // one entry for each port, in the same order, so that the client does
+    // not need to download the whole list of registrations
+    if (!act.bottleMode) {
+        act.reply.addString("old");
+    } else {
+        act.reply.addString("ports");
+    }
+    Bottle names = act.cmd.tail();
+    act.nestedMode = true;
+    for (size_t i = 0; i < names.size(); i++) {
+        act.cmd.clear();
+        act.cmd.addString("query");
+        act.cmd.addString(names.get(i).asString());
+        act.mem.reset();
+        cmdQuery(act);
+    }
+    return true;
+}
+
 bool NameServiceOnTriples::cmdRegister(NameTripleState& act)
 {
     std::string port = act.cmd.get(1).asString();
@@ -639,6 +660,7 @@ bool NameServiceOnTriples::cmdHelp(NameTripleState& act)
     bot.addString("  (if you want a field set automatically, write '...')");
     bot.addString("+ unregister $portname");
     bot.addString("+ query $portname");
+    bot.addString("+ query_many $portname1 $portname2 ...");
     bot.addString("+ set $portname $property $value");
     bot.addString("+ get $portname $property");
     bot.addString("+ check $portname $property");
@@ -702,6 +724,9 @@ bool NameServiceOnTriples::apply(yarp::os::Bottle& cmd,
     if (key=="query") {
         return cmdQuery(act);
     }
+    if (key=="query_many") {
+        return cmdQueryMany(act);
+    }
     if (key=="list") {
         return cmdList(act);
     }
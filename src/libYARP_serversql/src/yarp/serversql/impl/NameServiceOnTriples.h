@@ -108,6 +108,8 @@ public:
 
     bool cmdQuery(NameTripleState& act, bool nested = false);
 
+    bool cmdQueryMany(NameTripleState& act);
+
     bool cmdRegister(NameTripleState& act);
 
     bool cmdUnregister(NameTripleState& act);
@@ -6,12 +6,17 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <vector>
 
+#include <yarp/os/Bottle.h>
 #include <yarp/os/Contact.h>
+#include <yarp/os/NameStore.h>
 #include <yarp/os/Network.h>
 #include <yarp/os/Port.h>
 #include <yarp/os/impl/NameClient.h>
 
+#include <yarp/name/NameServerManager.h>
+
 #include <catch2/catch_amalgamated.hpp>
 #include <harness.h>
 
@@ -117,5 +122,51 @@ TEST_CASE("serversql::ServerTest", "[yarp::serversql]")
         CHECK(result.find(target)!=std::string::npos); // answer found
     }
 
+    SECTION("check query many")
+    {
+        INFO("checking query_many...");
+        NameClient& nic = NameClient::getNameClient();
+        Contact addr1("tcp", "192.168.1.100", 9001);
+        Contact addr2("tcp", "192.168.1.100", 9002);
+        nic.registerName("/check/many/a", addr1);
+        nic.registerName("/check/many/b", addr2);
+
+        // The name server of the test is reached through the network, as
+        // yarpserver, instead of being called directly
+        NameStore* store = Network::getQueryBypass();
+        auto* ns = dynamic_cast<yarp::name::NameService*>(store);
+        REQUIRE(ns != nullptr);
+        yarp::name::NameServerManager manager(*ns);
+        Port server;
+        manager.setPort(server);
+        server.setReaderCreator(manager);
+        REQUIRE(server.open(Contact("/check/many/server", "tcp", "127.0.0.1", 10290), false));
+        Network::queryBypass(nullptr);
+        nic.setFakeMode(false);
+        nic.setContact(server.where());
+
+        Bottle cmd("bot query_many /check/many/a /check/many/missing /check/many/b");
+        Bottle reply;
+        CHECK(nic.send(cmd, reply));
+        REQUIRE(reply.size() == 4);
+        CHECK(reply.get(0).asString() == "ports");
+        CHECK(reply.get(2).toString() == "port (error -2 \"port not known\")");
+
+        std::vector<Contact> contacts = nic.queryNames({"/check/many/a", "/check/many/missing", "/check/many/b"});
+        REQUIRE(contacts.size() == 3);
+        CHECK(contacts[0].getName() == "/check/many/a");
+        CHECK(contacts[0].getHost() == addr1.getHost());
+        CHECK(contacts[0].getPort() == addr1.getPort());
+        CHECK_FALSE(contacts[1].isValid());
+        CHECK(contacts[2].getName() == "/check/many/b");
+        CHECK(contacts[2].getPort() == addr2.getPort());
+
+        nic.setFakeMode(true);
+        Network::queryBypass(store);
+        server.close();
+        nic.unregisterName("/check/many/a");
+        nic.unregisterName("/check/many/b");
+    }
+
     Network::setLocalMode(false);
 }
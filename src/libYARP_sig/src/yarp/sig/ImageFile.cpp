@@ -8,9 +8,16 @@
 #include <yarp/os/LogComponent.h>
 #include <yarp/os/LogStream.h>
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
 #include <cstdlib>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #if defined (YARP_HAS_JPEG)
 #include "jpeglib.h"
@@ -49,85 +56,75 @@ namespace
     bool ImageReadFloat_CompressedHeaderless(ImageOf<PixelFloat>& dest, const std::string& filename);
 #endif
 
-    bool SaveJPG(char* src, const char* filename, size_t h, size_t w, size_t rowSize);
+    bool SaveJPG(char* src, const char* filename, size_t h, size_t w, size_t rowSize, int pixelCode, int quality);
     bool SavePGM(char* src, const char* filename, size_t h, size_t w, size_t rowSize);
     bool SavePPM(char* src, const char* filename, size_t h, size_t w, size_t rowSize);
 #if defined (YARP_HAS_PNG)
-    bool SavePNG(char* src, const char* filename, size_t h, size_t w, size_t rowSize, png_byte color_type, png_byte bit_depth);
+    bool SavePNG(char* src, const char* filename, size_t h, size_t w, size_t rowSize, png_byte color_type, png_byte bit_depth, bool bgr, const file::image_write_options& options);
 #endif
     bool SaveFloatRaw(char* src, const char* filename, size_t h, size_t w, size_t rowSize);
 #if defined (YARP_HAS_ZLIB)
     bool SaveFloatCompressed(char* src, const char* filename, size_t h, size_t w, size_t rowSize);
 #endif
 
-    bool ImageWriteJPG(ImageOf<PixelRgb>& img, const char* filename);
-    bool ImageWritePNG(ImageOf<PixelRgb>& img, const char* filename);
-    bool ImageWritePNG(ImageOf<PixelMono>& img, const char* filename);
-    bool ImageWriteRGB(ImageOf<PixelRgb>& img, const char* filename);
-    bool ImageWriteMono(ImageOf<PixelMono>& img, const char* filename);
+    bool ImageWriteJPG(const Image& img, const char* filename, int quality);
+    bool ImageWritePNG(const Image& img, const char* filename, const file::image_write_options& options);
+    bool ImageWriteRGB(const Image& img, const char* filename);
+    bool ImageWriteMono(const Image& img, const char* filename);
 
-    bool ImageWriteFloat_PlainHeaderless(ImageOf<PixelFloat>& img, const char* filename);
-    bool ImageWriteFloat_CompressedHeaderless(ImageOf<PixelFloat>& img, const char* filename);
+    bool ImageWriteFloat_PlainHeaderless(const Image& img, const char* filename);
+    bool ImageWriteFloat_CompressedHeaderless(const Image& img, const char* filename);
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // private read methods for JPG Files
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-bool ImageReadRGB_JPG(ImageOf<PixelRgb>& img, const char* filename)
-{
 #if defined (YARP_HAS_JPEG)
-
-    struct jpeg_decompress_struct cinfo;
-    struct jpeg_error_mgr jerr;
-    jpeg_create_decompress(&cinfo);
-    cinfo.err = jpeg_std_error(&jerr);
-
+bool ReadJPG(Image& img, const char* filename, J_COLOR_SPACE color_space)
+{
     FILE* fp = fopen(filename, "rb");
-    if (fp == NULL)
+    if (fp == nullptr)
     {
         yCError(IMAGEFILE) << "Error: failed to open" << filename;
         return false;
     }
 
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+
     jpeg_stdio_src(&cinfo, fp);
     jpeg_read_header(&cinfo, TRUE);
-    jpeg_start_decompress(&cinfo);
 
-    uint32_t j_width = cinfo.image_width;
-    uint32_t j_height = cinfo.image_height;
-    uint32_t j_ch = cinfo.num_components;
-
-    uint8_t* j_data = NULL;
-    j_data = (uint8_t*)malloc(sizeof(uint8_t) * j_width * j_height * j_ch);
+    // libjpeg converts the pixels to the format of the image
+    cinfo.out_color_space = color_space;
+    jpeg_start_decompress(&cinfo);
 
-    //read line by line
-    uint8_t* j_row = j_data;
-    const uint32_t j_stride = j_width * j_ch;
-    for (size_t y = 0; y < j_height; y++)
+    // Decode directly into the rows of the image, libjpeg can return more
+    // than one row with each call
+    img.resize(cinfo.output_width, cinfo.output_height);
+    std::vector<JSAMPROW> rows(cinfo.output_height);
+    for (size_t y = 0; y < rows.size(); y++)
+    {
+        rows[y] = img.getRow(y);
+    }
+    while (cinfo.output_scanline < cinfo.output_height)
     {
-        jpeg_read_scanlines(&cinfo, &j_row, 1);
-        j_row += j_stride;
+        jpeg_read_scanlines(&cinfo, rows.data() + cinfo.output_scanline, cinfo.output_height - cinfo.output_scanline);
     }
 
     jpeg_finish_decompress(&cinfo);
     jpeg_destroy_decompress(&cinfo);
     fclose(fp);
 
-    img.resize(j_width, j_height);
-    for (size_t y = 0; y < j_height; y++)
-    {
-        for (size_t x = 0; x < j_width; x++)
-        {
-            unsigned char* address = img.getPixelAddress(x, y);
-            address[0] = j_data[y * j_width * j_ch + x * j_ch + 0];
-            address[1] = j_data[y * j_width * j_ch + x * j_ch + 1];
-            address[2] = j_data[y * j_width * j_ch + x * j_ch + 2];
-        }
-    }
-
-    free(j_data);
-    j_data = nullptr;
-
     return true;
+}
+#endif
+
+bool ImageReadRGB_JPG(ImageOf<PixelRgb>& img, const char* filename)
+{
+#if defined (YARP_HAS_JPEG)
+    return ReadJPG(img, filename, JCS_RGB);
 #else
     yCError(IMAGEFILE) << "JPG library not available/not found";
     return false;
@@ -137,8 +134,18 @@ bool ImageReadRGB_JPG(ImageOf<PixelRgb>& img, const char* filename)
 bool ImageReadBGR_JPG(ImageOf<PixelBgr>& img, const char* filename)
 {
 #if defined (YARP_HAS_JPEG)
-    yCError(IMAGEFILE) << "Not yet implemented";
-    return false;
+#  if defined (JCS_EXTENSIONS)
+    // libjpeg-turbo can decode to bgr
+    return ReadJPG(img, filename, JCS_EXT_BGR);
+#  else
+    ImageOf<PixelRgb> img2;
+    if (!ReadJPG(img2, filename, JCS_RGB))
+    {
+        return false;
+    }
+    img.copy(img2);
+    return true;
+#  endif
 #else
     yCError(IMAGEFILE) << "JPG library not available/not found";
     return false;
@@ -148,8 +155,7 @@ bool ImageReadBGR_JPG(ImageOf<PixelBgr>& img, const char* filename)
 bool ImageReadMono_JPG(ImageOf<PixelMono>& img, const char* filename)
 {
 #if defined (YARP_HAS_JPEG)
-    yCError(IMAGEFILE) << "Not yet implemented";
-    return false;
+    return ReadJPG(img, filename, JCS_GRAYSCALE);
 #else
     yCError(IMAGEFILE) << "JPG library not available/not found";
     return false;
@@ -159,10 +165,15 @@ bool ImageReadMono_JPG(ImageOf<PixelMono>& img, const char* filename)
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // private read methods for PNG Files
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-bool ImageReadRGB_PNG(ImageOf<PixelRgb>& img, const char* filename)
-{
 #if defined (YARP_HAS_PNG)
+bool ReadPNG(Image& img, const char* filename)
+{
     FILE* fp = fopen(filename, "rb");
+    if (fp == nullptr)
+    {
+        yCError(IMAGEFILE) << "Error: failed to open" << filename;
+        return false;
+    }
 
     png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
     if (!png)
@@ -175,13 +186,16 @@ bool ImageReadRGB_PNG(ImageOf<PixelRgb>& img, const char* filename)
     png_infop info = png_create_info_struct(png);
     if (!info)
     {
+        png_destroy_read_struct(&png, NULL, NULL);
         fclose(fp);
         yCError(IMAGEFILE) << "PNG internal error";
         return false;
     }
 
+    std::vector<png_bytep> row_pointers;
     if (setjmp(png_jmpbuf(png)))
     {
+        png_destroy_read_struct(&png, &info, NULL);
         fclose(fp);
         yCError(IMAGEFILE) << "PNG internal error";
         return false;
@@ -196,7 +210,8 @@ bool ImageReadRGB_PNG(ImageOf<PixelRgb>& img, const char* filename)
     png_byte color_type = png_get_color_type(png, info);
     png_byte bit_depth = png_get_bit_depth(png, info);
 
-    // Read any color_type into 8bit depth, RGBA format.
+    // Read any color_type into 8bit depth, in the format of the image, so
+    // that the rows can be decoded directly into the image.
     // See http://www.libpng.org/pub/png/libpng-manual.txt
 
     if (bit_depth == 16) {
@@ -212,51 +227,48 @@ bool ImageReadRGB_PNG(ImageOf<PixelRgb>& img, const char* filename)
         png_set_expand_gray_1_2_4_to_8(png);
     }
 
-    if (png_get_valid(png, info, PNG_INFO_tRNS)) {
-        png_set_tRNS_to_alpha(png);
+    if (color_type & PNG_COLOR_MASK_ALPHA) {
+        png_set_strip_alpha(png);
     }
 
-    // These color_type don't have an alpha channel then fill it with 0xff.
-    if (color_type == PNG_COLOR_TYPE_RGB || color_type == PNG_COLOR_TYPE_GRAY || color_type == PNG_COLOR_TYPE_PALETTE) {
-        png_set_filler(png, 0xFF, PNG_FILLER_AFTER);
+    if (img.getPixelCode() == VOCAB_PIXEL_MONO)
+    {
+        if (color_type & PNG_COLOR_MASK_COLOR) {
+            png_set_rgb_to_gray_fixed(png, 1, -1, -1);
+        }
     }
-
-    if (color_type == PNG_COLOR_TYPE_GRAY || color_type == PNG_COLOR_TYPE_GRAY_ALPHA) {
-        png_set_gray_to_rgb(png);
+    else
+    {
+        if (!(color_type & PNG_COLOR_MASK_COLOR)) {
+            png_set_gray_to_rgb(png);
+        }
+        if (img.getPixelCode() == VOCAB_PIXEL_BGR) {
+            png_set_bgr(png);
+        }
     }
 
     png_read_update_info(png, info);
 
-    png_bytep* row_pointers = (png_bytep*)malloc(sizeof(png_bytep) * height);
+    img.resize(width, height);
+    row_pointers.resize(height);
     for (int y = 0; y < height; y++)
     {
-        row_pointers[y] = (png_byte*)malloc(png_get_rowbytes(png, info));
+        row_pointers[y] = img.getRow(y);
     }
 
-    png_read_image(png, row_pointers);
-    fclose(fp);
-
-    img.resize(width,height);
-    for (int y = 0; y < height; y++)
-    {
-        png_bytep row = row_pointers[y];
-        for (int x = 0; x < width; x++)
-            {
-                png_bytep px = &(row[x * 4]);
-                unsigned char* address = img.getPixelAddress(x,y);
-                address[0] = px[0];
-                address[1] = px[1];
-                address[2] = px[2];
-            }
-    }
+    png_read_image(png, row_pointers.data());
+    png_read_end(png, NULL);
 
     png_destroy_read_struct(&png, &info, NULL);
-    for (int y = 0; y < height; y++)
-    {
-        free(row_pointers[y]);
-    }
-    free(row_pointers);
+    fclose(fp);
     return true;
+}
+#endif
+
+bool ImageReadRGB_PNG(ImageOf<PixelRgb>& img, const char* filename)
+{
+#if defined (YARP_HAS_PNG)
+    return ReadPNG(img, filename);
 #else
     yCError(IMAGEFILE) << "PNG library not available/not found";
     return false;
@@ -266,8 +278,7 @@ bool ImageReadRGB_PNG(ImageOf<PixelRgb>& img, const char* filename)
 bool ImageReadBGR_PNG(ImageOf<PixelBgr>& img, const char* filename)
 {
 #if defined (YARP_HAS_PNG)
-    yCError(IMAGEFILE) << "Not yet implemented";
-    return false;
+    return ReadPNG(img, filename);
 #else
     yCError(IMAGEFILE) << "PNG library not available/not found";
     return false;
@@ -277,8 +288,7 @@ bool ImageReadBGR_PNG(ImageOf<PixelBgr>& img, const char* filename)
 bool ImageReadMono_PNG(ImageOf<PixelMono>& img, const char* filename)
 {
 #if defined (YARP_HAS_PNG)
-    yCError(IMAGEFILE) << "Not yet implemented";
-    return false;
+    return ReadPNG(img, filename);
 #else
     yCError(IMAGEFILE) << "PNG library not available/not found";
     return false;
@@ -596,7 +606,7 @@ bool ImageReadMono_PxM(ImageOf<PixelMono> &img, const char *filename)
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #if defined (YARP_HAS_PNG)
-bool SavePNG(char *src, const char *filename, size_t h, size_t w, size_t rowSize, png_byte color_type, png_byte bit_depth)
+bool SavePNG(char *src, const char *filename, size_t h, size_t w, size_t rowSize, png_byte color_type, png_byte bit_depth, bool bgr, const file::image_write_options& options)
 {
     // create file
     if (src == nullptr)
@@ -644,6 +654,21 @@ bool SavePNG(char *src, const char *filename, size_t h, size_t w, size_t rowSize
     }
     png_init_io(png_ptr, fp);
 
+    if (options.png_compression_level >= 0)
+    {
+        png_set_compression_level(png_ptr, options.png_compression_level);
+    }
+    if (options.png_fast_filter)
+    {
+        // The adaptive selection of the filter for each row is the most
+        // expensive part of the encoding after zlib
+        png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB);
+    }
+    if (bgr)
+    {
+        png_set_bgr(png_ptr);
+    }
+
     // write header
     if (setjmp(png_jmpbuf(png_ptr)))
     {
@@ -697,41 +722,72 @@ bool SavePNG(char *src, const char *filename, size_t h, size_t w, size_t rowSize
 }
 #endif
 
-bool SaveJPG(char *src, const char *filename, size_t h, size_t w, size_t rowSize)
+bool SaveJPG(char *src, const char *filename, size_t h, size_t w, size_t rowSize, int pixelCode, int quality)
 {
 #if defined (YARP_HAS_JPEG)
-    int quality = 100;
-    struct jpeg_compress_struct cinfo;
-    struct jpeg_error_mgr jerr;
-    FILE * outfile = nullptr;
-    JSAMPROW row_pointer[1];
-    int row_stride;
-
-    cinfo.err = jpeg_std_error(&jerr);
-    jpeg_create_compress(&cinfo);
+    J_COLOR_SPACE color_space;
+    int components;
+    switch (pixelCode)
+    {
+    case VOCAB_PIXEL_MONO:
+        color_space = JCS_GRAYSCALE;
+        components = 1;
+        break;
+    case VOCAB_PIXEL_RGB:
+        color_space = JCS_RGB;
+        components = 3;
+        break;
+#  if defined (JCS_EXTENSIONS)
+    // libjpeg-turbo can encode these formats without converting them first
+    case VOCAB_PIXEL_BGR:
+        color_space = JCS_EXT_BGR;
+        components = 3;
+        break;
+    case VOCAB_PIXEL_RGBA:
+        color_space = JCS_EXT_RGBX;
+        components = 4;
+        break;
+    case VOCAB_PIXEL_BGRA:
+        color_space = JCS_EXT_BGRX;
+        components = 4;
+        break;
+#  endif
+    default:
+        yCError(IMAGEFILE, "pixel format not supported by the jpeg encoder");
+        return false;
+    }
 
-    if ((outfile = fopen(filename, "wb")) == nullptr)
+    FILE* outfile = fopen(filename, "wb");
+    if (outfile == nullptr)
     {
         yCError(IMAGEFILE, "can't write file: %s\n", filename);
         return false;
     }
+
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
     jpeg_stdio_dest(&cinfo, outfile);
 
     cinfo.image_width = w;
     cinfo.image_height = h;
-    cinfo.input_components = 3;
-    cinfo.in_color_space = JCS_RGB;
+    cinfo.input_components = components;
+    cinfo.in_color_space = color_space;
     jpeg_set_defaults(&cinfo);
     jpeg_set_quality(&cinfo, quality, TRUE);
 
     jpeg_start_compress(&cinfo, TRUE);
 
-    row_stride = w * 3;
-
+    // Pass all the rows at once, the rows of the image can be padded
+    std::vector<JSAMPROW> rows(h);
+    for (size_t y = 0; y < h; y++)
+    {
+        rows[y] = reinterpret_cast<JSAMPROW>(src + y * rowSize);
+    }
     while (cinfo.next_scanline < cinfo.image_height)
     {
-        row_pointer[0] = (JSAMPROW)&src[cinfo.next_scanline * row_stride];
-        (void)jpeg_write_scanlines(&cinfo, row_pointer, 1);
+        jpeg_write_scanlines(&cinfo, rows.data() + cinfo.next_scanline, cinfo.image_height - cinfo.next_scanline);
     }
 
     jpeg_finish_compress(&cinfo);
@@ -757,10 +813,17 @@ bool SavePGM(char *src, const char *filename, size_t h, size_t w, size_t rowSize
         const int inc = rowSize; ////YARPSimpleOperation::ComputePadding (w, YarpImageAlign) + w;
 
         fprintf(fp, "P5\n%zu %zu\n%d\n", w, h, 255);
-        for (size_t i = 0; i < h; i++)
+        if (rowSize == w)
         {
-            fwrite((void *)src, 1, (size_t)w, fp);
-            src += inc;
+            fwrite((void *)src, 1, h * w, fp);
+        }
+        else
+        {
+            for (size_t i = 0; i < h; i++)
+            {
+                fwrite((void *)src, 1, (size_t)w, fp);
+                src += inc;
+            }
         }
 
         fclose(fp);
@@ -783,13 +846,18 @@ bool SavePPM(char *src, const char *filename, size_t h, size_t w, size_t rowSize
         const int inc = rowSize;//YARPSimpleOperation::ComputePadding (w*3, YarpImageAlign) + w * 3;
 
         fprintf(fp, "P6\n%zu %zu\n%d\n", w, h, 255);
-        for (size_t i = 0; i < h; i++)
+        if (rowSize == w * 3)
         {
-            fwrite((void *)src, 1, (size_t)(w * 3), fp);
-            src += inc;
+            fwrite((void *)src, 1, h * w * 3, fp);
+        }
+        else
+        {
+            for (size_t i = 0; i < h; i++)
+            {
+                fwrite((void *)src, 1, (size_t)(w * 3), fp);
+                src += inc;
+            }
         }
-
-        ///fwrite((void *) src, 1, (size_t) (h*w*3), fp);
         fclose(fp);
     }
 
@@ -860,47 +928,73 @@ bool SaveFloatRaw(char* src, const char* filename, size_t h, size_t w, size_t ro
     return (bw > 0);
 }
 
-bool ImageWriteJPG(ImageOf<PixelRgb>& img, const char *filename)
+bool ImageWriteJPG(const Image& img, const char *filename, int quality)
 {
-    return SaveJPG((char*)img.getRawImage(), filename, img.height(), img.width(), img.getRowSize());
-}
-
-bool ImageWritePNG(ImageOf<PixelRgb>& img, const char *filename)
-{
-#if defined (YARP_HAS_PNG)
-    return SavePNG((char*)img.getRawImage(), filename, img.height(), img.width(), img.getRowSize(), PNG_COLOR_TYPE_RGB, 8);
-#else
-    yCError(IMAGEFILE) << "YARP was not built with png support";
-    return false;
+    switch (img.getPixelCode())
+    {
+    case VOCAB_PIXEL_MONO:
+    case VOCAB_PIXEL_RGB:
+#if defined (JCS_EXTENSIONS)
+    case VOCAB_PIXEL_BGR:
+    case VOCAB_PIXEL_RGBA:
+    case VOCAB_PIXEL_BGRA:
 #endif
+        return SaveJPG((char*)img.getRawImage(), filename, img.height(), img.width(), img.getRowSize(), img.getPixelCode(), quality);
+    default:
+    {
+        ImageOf<PixelRgb> imgRGB;
+        imgRGB.copy(img);
+        return SaveJPG((char*)imgRGB.getRawImage(), filename, imgRGB.height(), imgRGB.width(), imgRGB.getRowSize(), VOCAB_PIXEL_RGB, quality);
+    }
+    }
 }
 
-bool ImageWritePNG(ImageOf<PixelMono>& img, const char *filename)
+bool ImageWritePNG(const Image& img, const char *filename, const file::image_write_options& options)
 {
 #if defined (YARP_HAS_PNG)
-    return SavePNG((char*)img.getRawImage(), filename, img.height(), img.width(), img.getRowSize(), PNG_COLOR_TYPE_GRAY, 8);
+    switch (img.getPixelCode())
+    {
+    case VOCAB_PIXEL_MONO:
+        return SavePNG((char*)img.getRawImage(), filename, img.height(), img.width(), img.getRowSize(), PNG_COLOR_TYPE_GRAY, 8, false, options);
+    case VOCAB_PIXEL_RGB:
+        return SavePNG((char*)img.getRawImage(), filename, img.height(), img.width(), img.getRowSize(), PNG_COLOR_TYPE_RGB, 8, false, options);
+    case VOCAB_PIXEL_BGR:
+        return SavePNG((char*)img.getRawImage(), filename, img.height(), img.width(), img.getRowSize(), PNG_COLOR_TYPE_RGB, 8, true, options);
+    default:
+    {
+        ImageOf<PixelRgb> imgRGB;
+        imgRGB.copy(img);
+        return SavePNG((char*)imgRGB.getRawImage(), filename, imgRGB.height(), imgRGB.width(), imgRGB.getRowSize(), PNG_COLOR_TYPE_RGB, 8, false, options);
+    }
+    }
 #else
     yCError(IMAGEFILE) << "YARP was not built with png support";
     return false;
 #endif
 }
 
-bool ImageWriteRGB(ImageOf<PixelRgb>& img, const char *filename)
+bool ImageWriteRGB(const Image& img, const char *filename)
 {
+    if (img.getPixelCode() != VOCAB_PIXEL_RGB)
+    {
+        ImageOf<PixelRgb> imgRGB;
+        imgRGB.copy(img);
+        return SavePPM((char*)imgRGB.getRawImage(), filename, imgRGB.height(), imgRGB.width(), imgRGB.getRowSize());
+    }
     return SavePPM((char*)img.getRawImage(),filename,img.height(),img.width(),img.getRowSize());
 }
 
-bool ImageWriteMono(ImageOf<PixelMono>& img, const char *filename)
+bool ImageWriteMono(const Image& img, const char *filename)
 {
     return SavePGM((char*)img.getRawImage(), filename, img.height(), img.width(), img.getRowSize());
 }
 
-bool ImageWriteFloat_PlainHeaderless(ImageOf<PixelFloat>& img, const char *filename)
+bool ImageWriteFloat_PlainHeaderless(const Image& img, const char *filename)
 {
     return SaveFloatRaw((char*)img.getRawImage(), filename, img.height(), img.width(), img.getRowSize());
 }
 
-bool ImageWriteFloat_CompressedHeaderless(ImageOf<PixelFloat>& img, const char* filename)
+bool ImageWriteFloat_CompressedHeaderless(const Image& img, const char* filename)
 {
 #if defined (YARP_HAS_ZLIB)
     return SaveFloatCompressed((char*)img.getRawImage(), filename, img.height(), img.width(), img.getRowSize());
@@ -1093,137 +1187,244 @@ bool file::read(ImageOf<PixelFloat>& dest, const std::string& src, image_filefor
 
 bool file::write(const ImageOf<PixelRgb> & src, const std::string& dest, image_fileformat format)
 {
-    if (format == FORMAT_PPM)
-    {
-        return ImageWriteRGB(const_cast<ImageOf<PixelRgb> &>(src), dest.c_str());
-    }
-    else  if (format == FORMAT_JPG)
-    {
-        return ImageWriteJPG(const_cast<ImageOf<PixelRgb> &>(src), dest.c_str());
-    }
-    else  if (format == FORMAT_PNG)
-    {
-        return ImageWritePNG(const_cast<ImageOf<PixelRgb> &>(src), dest.c_str());
-    }
-    else
-    {
-        yCError(IMAGEFILE) << "Invalid format, operation not supported";
-        return false;
-    }
+    return write(static_cast<const Image&>(src), dest, format, image_write_options());
 }
 
 bool file::write(const ImageOf<PixelBgr> & src, const std::string& dest, image_fileformat format)
 {
-    ImageOf<PixelRgb> imgRGB;
-    imgRGB.copy(src);
-    if (format == FORMAT_PPM)
-    {
-        return ImageWriteRGB(const_cast<ImageOf<PixelRgb> &>(imgRGB), dest.c_str());
-    }
-    else  if (format == FORMAT_JPG)
-    {
-        return ImageWriteJPG(const_cast<ImageOf<PixelRgb> &>(imgRGB), dest.c_str());
-    }
-    else  if (format == FORMAT_PNG)
-    {
-        return ImageWritePNG(const_cast<ImageOf<PixelRgb> &>(imgRGB), dest.c_str());
-    }
-    else
-    {
-        yCError(IMAGEFILE) << "Invalid format, operation not supported";
-        return false;
-    }
+    return write(static_cast<const Image&>(src), dest, format, image_write_options());
 }
 
-
 bool file::write(const ImageOf<PixelRgba> & src, const std::string& dest, image_fileformat format)
 {
-    ImageOf<PixelRgb> imgRGB;
-    imgRGB.copy(src);
-    if (format == FORMAT_PPM)
-    {
-        return ImageWriteRGB(const_cast<ImageOf<PixelRgb> &>(imgRGB), dest.c_str());
-    }
-    else  if (format == FORMAT_JPG)
-    {
-        return ImageWriteJPG(const_cast<ImageOf<PixelRgb> &>(imgRGB), dest.c_str());
-    }
-    else  if (format == FORMAT_PNG)
-    {
-        return ImageWritePNG(const_cast<ImageOf<PixelRgb> &>(imgRGB), dest.c_str());
-    }
-    else
-    {
-        yCError(IMAGEFILE) << "Invalid format, operation not supported";
-        return false;
-    }
+    return write(static_cast<const Image&>(src), dest, format, image_write_options());
 }
 
-
 bool file::write(const ImageOf<PixelMono> & src, const std::string& dest, image_fileformat format)
 {
-    if (format == FORMAT_PGM)
-    {
-        return ImageWriteMono(const_cast<ImageOf<PixelMono> &>(src), dest.c_str());
-    }
-    else  if (format == FORMAT_PNG)
-    {
-        return ImageWritePNG(const_cast<ImageOf<PixelMono> &>(src), dest.c_str());
-    }
-    else
-    {
-        yCError(IMAGEFILE) << "Invalid format, operation not supported";
-        return false;
-    }
+    return write(static_cast<const Image&>(src), dest, format, image_write_options());
 }
 
 bool file::write(const ImageOf<PixelFloat>& src, const std::string& dest, image_fileformat format)
 {
-    if (format == FORMAT_NUMERIC)
+    return write(static_cast<const Image&>(src), dest, format, image_write_options());
+}
+
+bool file::write(const Image& src, const std::string& dest, image_fileformat format)
+{
+    return write(src, dest, format, image_write_options());
+}
+
+bool file::write(const Image& src, const std::string& dest, image_fileformat format, const image_write_options& options)
+{
+    int code=src.getPixelCode();
+    if (code == VOCAB_PIXEL_MONO)
+    {
+        if (format == FORMAT_PGM)
+        {
+            return ImageWriteMono(src, dest.c_str());
+        }
+        else if (format == FORMAT_JPG)
+        {
+            return ImageWriteJPG(src, dest.c_str(), options.jpeg_quality);
+        }
+        else if (format == FORMAT_PNG)
+        {
+            return ImageWritePNG(src, dest.c_str(), options);
+        }
+    }
+    else if (code == VOCAB_PIXEL_MONO_FLOAT)
     {
-        return ImageWriteFloat_PlainHeaderless(const_cast<ImageOf<PixelFloat> &>(src), dest.c_str());
+        if (format == FORMAT_NUMERIC)
+        {
+            return ImageWriteFloat_PlainHeaderless(src, dest.c_str());
+        }
+        else if (format == FORMAT_NUMERIC_COMPRESSED)
+        {
+            return ImageWriteFloat_CompressedHeaderless(src, dest.c_str());
+        }
     }
-    else if (format == FORMAT_NUMERIC_COMPRESSED)
+    else if (code == VOCAB_PIXEL_RGB || code == VOCAB_PIXEL_BGR || code == VOCAB_PIXEL_RGBA || code == VOCAB_PIXEL_BGRA)
     {
-        return ImageWriteFloat_CompressedHeaderless(const_cast<ImageOf<PixelFloat>&>(src), dest.c_str());
+        if (format == FORMAT_PPM)
+        {
+            return ImageWriteRGB(src, dest.c_str());
+        }
+        else if (format == FORMAT_JPG)
+        {
+            return ImageWriteJPG(src, dest.c_str(), options.jpeg_quality);
+        }
+        else if (format == FORMAT_PNG)
+        {
+            return ImageWritePNG(src, dest.c_str(), options);
+        }
     }
     else
     {
-        yCError(IMAGEFILE) << "Invalid format, operation not supported";
-        return false;
+        ImageOf<PixelRgb> img;
+        img.copy(src);
+        return write(img, dest, format, options);
     }
+
+    yCError(IMAGEFILE) << "Invalid format, operation not supported";
+    return false;
 }
 
-bool file::write(const Image& src, const std::string& dest, image_fileformat format)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// asynchronous writer
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class file::AsyncImageWriter::Private
 {
-    int code=src.getPixelCode();
-    if (code == VOCAB_PIXEL_MONO)
-    {
-        return write(static_cast<const ImageOf<PixelMono>&>(src), dest, format);
+public:
+    struct Job
+    {
+        size_t index;
+        Image image;
+        std::string dest;
+        image_fileformat format;
+        image_write_options options;
+    };
+
+    struct Result
+    {
+        std::string dest;
+        bool ok;
+    };
+
+    size_t maxPending {0};
+    image_write_options options;
+    Callback callback;
+
+    std::mutex mutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable jobReported;
+    std::deque<Job> jobs;
+    // Completed jobs, waiting for the previous ones to be reported
+    std::map<size_t, Result> results;
+    size_t submitted {0};
+    size_t reported {0};
+    bool reporting {false};
+    bool failed {false};
+    bool closing {false};
+    std::vector<std::thread> workers;
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            jobAvailable.wait(lock, [this]() { return closing || !jobs.empty(); });
+            if (jobs.empty())
+            {
+                return;
+            }
+            Job job = std::move(jobs.front());
+            jobs.pop_front();
+
+            lock.unlock();
+            bool ok = file::write(job.image, job.dest, job.format, job.options);
+            lock.lock();
+
+            results.emplace(job.index, Result{std::move(job.dest), ok});
+            report(lock);
+        }
     }
-    else if (code == VOCAB_PIXEL_MONO_FLOAT)
+
+    // Invoke the callback for the completed jobs, in the order they were
+    // submitted. Only one thread reports the results at a time, the
+    // callback is invoked with the mutex unlocked.
+    void report(std::unique_lock<std::mutex>& lock)
     {
-        return write(static_cast<const ImageOf<PixelFloat>&>(src), dest, format);
+        if (reporting)
+        {
+            return;
+        }
+        reporting = true;
+        while (!results.empty() && results.begin()->first == reported)
+        {
+            Result result = std::move(results.begin()->second);
+            results.erase(results.begin());
+            if (!result.ok)
+            {
+                failed = true;
+            }
+            if (callback)
+            {
+                Callback cb = callback;
+                lock.unlock();
+                cb(reported, result.dest, result.ok);
+                lock.lock();
+            }
+            reported++;
+            jobReported.notify_all();
+        }
+        reporting = false;
     }
-    else if (code == VOCAB_PIXEL_BGR)
+};
+
+file::AsyncImageWriter::AsyncImageWriter(size_t threads, size_t maxPending) :
+        mPriv(new Private)
+{
+    if (threads == 0)
     {
-        return write(static_cast<const ImageOf<PixelBgr>&>(src), dest, format);
+        threads = std::max(1U, std::thread::hardware_concurrency());
     }
-    else if (code == VOCAB_PIXEL_RGB)
+    mPriv->maxPending = (maxPending == 0 ? 4 * threads : maxPending);
+    for (size_t i = 0; i < threads; i++)
     {
-        return write(static_cast<const ImageOf<PixelRgb>&>(src), dest, format);
+        mPriv->workers.emplace_back(&Private::run, mPriv);
     }
-    else if (code == VOCAB_PIXEL_RGBA)
+}
+
+file::AsyncImageWriter::~AsyncImageWriter()
+{
     {
-        return write(static_cast<const ImageOf<PixelRgba>&>(src), dest, format);
+        std::lock_guard<std::mutex> lock(mPriv->mutex);
+        mPriv->closing = true;
     }
-    else
+    mPriv->jobAvailable.notify_all();
+    for (auto& worker : mPriv->workers)
     {
-        ImageOf<PixelRgb> img;
-        img.copy(src);
-        return write(img,dest);
+        worker.join();
     }
+    delete mPriv;
+}
+
+void file::AsyncImageWriter::setOptions(const image_write_options& options)
+{
+    std::lock_guard<std::mutex> lock(mPriv->mutex);
+    mPriv->options = options;
 }
 
+void file::AsyncImageWriter::setCallback(Callback callback)
+{
+    std::lock_guard<std::mutex> lock(mPriv->mutex);
+    mPriv->callback = std::move(callback);
+}
 
-//////////////////////////////////////////////////////////////////////////////////////////
+size_t file::AsyncImageWriter::write(const Image& src, const std::string& dest, image_fileformat format)
+{
+    // The image is copied before waiting for a free slot
+    return write(Image(src), dest, format);
+}
+
+size_t file::AsyncImageWriter::write(Image&& src, const std::string& dest, image_fileformat format)
+{
+    std::unique_lock<std::mutex> lock(mPriv->mutex);
+    mPriv->jobReported.wait(lock, [this]() { return mPriv->submitted - mPriv->reported < mPriv->maxPending; });
+    size_t index = mPriv->submitted++;
+    mPriv->jobs.push_back(Private::Job{index, std::move(src), dest, format, mPriv->options});
+    lock.unlock();
+    mPriv->jobAvailable.notify_one();
+    return index;
+}
+
+bool file::AsyncImageWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(mPriv->mutex);
+    mPriv->jobReported.wait(lock, [this]() { return mPriv->reported == mPriv->submitted; });
+    bool ok = !mPriv->failed;
+    mPriv->failed = false;
+    return ok;
+}
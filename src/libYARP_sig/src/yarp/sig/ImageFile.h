@@ -7,6 +7,7 @@
 #ifndef YARP_SIG_IMAGEFILE_H
 #define YARP_SIG_IMAGEFILE_H
 
+#include <functional>
 #include <string>
 #include <yarp/sig/Image.h>
 
@@ -23,6 +24,19 @@ enum image_fileformat
     FORMAT_PNG
 };
 
+/**
+ * Options used to encode the images.
+ */
+struct image_write_options
+{
+    /** Quality of the jpeg compression [1-100] */
+    int jpeg_quality {100};
+    /** zlib compression level of the png files [0-9], -1 uses the zlib default */
+    int png_compression_level {-1};
+    /** Use only the "sub" filter for png files: faster, but the files are usually larger */
+    bool png_fast_filter {false};
+};
+
 // read methods
 bool YARP_sig_API read(ImageOf<PixelRgb>& dest,   const std::string& src, image_fileformat format = FORMAT_ANY);
 bool YARP_sig_API read(ImageOf<PixelBgr>& dest,   const std::string& src, image_fileformat format = FORMAT_ANY);
@@ -37,6 +51,70 @@ bool YARP_sig_API write(const ImageOf<PixelRgba>& src,  const std::string& dest,
 bool YARP_sig_API write(const ImageOf<PixelMono>& src,  const std::string& dest, image_fileformat format = FORMAT_PGM);
 bool YARP_sig_API write(const ImageOf<PixelFloat>& src, const std::string& dest, image_fileformat format = FORMAT_NUMERIC);
 bool YARP_sig_API write(const Image& src,               const std::string& dest, image_fileformat format = FORMAT_PPM);
+bool YARP_sig_API write(const Image& src,               const std::string& dest, image_fileformat format, const image_write_options& options);
+
+/**
+ * Writes images to files using a pool of threads.
+ *
+ * The images are copied, and encoded in parallel. The callback is invoked
+ * in the same order as the images were submitted, regardless of the order
+ * in which the encoding is completed.
+ * If too many images are waiting to be written, write() blocks until one
+ * of them is completed.
+ */
+class YARP_sig_API AsyncImageWriter
+{
+public:
+    /**
+     * Function called when an image was written.
+     * The arguments are the index returned by write(), the name of the file,
+     * and whether the image was written successfully.
+     */
+    using Callback = std::function<void(size_t, const std::string&, bool)>;
+
+    /**
+     * Constructor.
+     * @param threads number of encoding threads (0 uses the number of cores)
+     * @param maxPending maximum number of images waiting to be written
+     *                   (0 uses 4 images per thread)
+     */
+    explicit AsyncImageWriter(size_t threads = 0, size_t maxPending = 0);
+    AsyncImageWriter(const AsyncImageWriter&) = delete;
+    AsyncImageWriter& operator=(const AsyncImageWriter&) = delete;
+
+    /**
+     * Destructor. Waits until all the images are written.
+     */
+    ~AsyncImageWriter();
+
+    /**
+     * Set the options used for the images submitted after this call.
+     */
+    void setOptions(const image_write_options& options);
+
+    /**
+     * Set the function called when an image was written.
+     */
+    void setCallback(Callback callback);
+
+    /**
+     * Queue an image to be written.
+     * @return the index of the image, starting from 0
+     */
+    size_t write(const Image& src, const std::string& dest, image_fileformat format);
+    size_t write(Image&& src, const std::string& dest, image_fileformat format);
+
+    /**
+     * Wait until all the images submitted are written.
+     * @return false if at least one image could not be written since the
+     *         previous call
+     */
+    bool flush();
+
+private:
+    class Private;
+    Private* mPriv;
+};
 } // namespace yarp::sig::file
 
 #endif // YARP_SIG_IMAGEFILE_H
@@ -570,6 +570,45 @@ std::vector<std::reference_wrapper<Sound::audio_sample>> Sound::getNonInterleave
     return vec;
 }
 
+Sound::audio_sample* Sound::getNonInterleavedAudioRawPointer() const
+{
+    if (m_bytesPerSample != sizeof(audio_sample)) {
+        return nullptr;
+    }
+    return reinterpret_cast<audio_sample*>(getRawData());
+}
+
+void Sound::setInterleavedAudioRawData(const audio_sample* data)
+{
+    if (m_bytesPerSample != sizeof(audio_sample))
+    {
+        for (size_t t = 0; t < this->m_samples; t++)
+        {
+            for (size_t c = 0; c < this->m_channels; c++)
+            {
+                set(data[t * m_channels + c], t, c);
+            }
+        }
+        return;
+    }
+
+    auto* pp = reinterpret_cast<audio_sample*>(((std::vector<NetUint16>*)(implementation))->data());
+    if (this->m_channels == 1)
+    {
+        memcpy(pp, data, this->m_samples * sizeof(audio_sample));
+        return;
+    }
+    for (size_t c = 0; c < this->m_channels; c++)
+    {
+        audio_sample* dst = pp + c * m_samples;
+        const audio_sample* src = data + c;
+        for (size_t t = 0; t < this->m_samples; t++)
+        {
+            dst[t] = src[t * m_channels];
+        }
+    }
+}
+
 std::string Sound::toString() const
 {
     std::string s;
@@ -235,6 +235,26 @@ public:
      */
     std::vector<std::reference_wrapper<audio_sample>> getNonInterleavedAudioRawData() const;
 
+    /**
+     * Fills the sound with a block of samples stored in interleaved format,
+     * e.g. for a sound composed by 3 channels, x samples:
+     * 1 11 21, 2 12 22, 3 13 23, 4 14 24 etc
+     * The sound must have been already resized to the correct number of samples/channels.
+     * @param data pointer to getSamples()*getChannels() interleaved samples
+     */
+    void setInterleavedAudioRawData(const audio_sample* data);
+
+    /**
+     * Returns a pointer to the samples of the sound, stored in non-interleaved
+     * format, i.e. the getSamples() samples of the first channel, followed by
+     * the samples of the second channel, and so on.
+     * The samples are stored in little endian order, and the pointer is
+     * invalidated when the sound is resized.
+     * @return a pointer to the samples, or nullptr if the sound does not use
+     *         getBytesPerSample() == sizeof(audio_sample)
+     */
+    audio_sample* getNonInterleavedAudioRawPointer() const;
+
     /**
      * Print matrix to a string. Useful for debugging.
      * The output string is represented in non-interleaved format
@@ -8,6 +8,12 @@
 #include <yarp/os/Log.h>
 #include <yarp/os/LogStream.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
 using namespace yarp::os;
 using namespace yarp::sig;
 using namespace yarp::sig::soundfilters;
@@ -51,8 +57,25 @@ bool yarp::sig::soundfilters::resample(yarp::sig::Sound& snd, size_t frequency)
     }
 
 #if !defined (YARP_HAS_SOXR)
-    yCError(SOUNDFILTERS) << "libsoxr not available";
-    return false;
+    //libsoxr not available, use the (streaming) polyphase resampler on the whole sound
+    Resampler resampler(snd.getFrequency(), frequency, snd.getChannels());
+    size_t osmp = (size_t)(snd.getSamples() * double(frequency) / snd.getFrequency() + .5);
+    yarp::sig::Sound out;
+    yarp::sig::Sound tail;
+    if (!resampler.process(snd, out)) {
+        return false;
+    }
+    //flush the samples retained for the filter look-ahead
+    yarp::sig::Sound silence;
+    silence.resize(size_t(std::ceil(resampler.getLatency() * snd.getFrequency())) + 1, snd.getChannels());
+    silence.setFrequency(snd.getFrequency());
+    if (!resampler.process(silence, tail)) {
+        return false;
+    }
+    out += tail;
+    snd = out.subSound(0, std::min(osmp, out.getSamples()));
+    snd.setFrequency(frequency);
+    return true;
 #else
     //configuration
     soxr_io_spec_t tit;
@@ -116,3 +139,235 @@ bool yarp::sig::soundfilters::resample(yarp::sig::Sound& snd, size_t frequency)
     return true;
 #endif
 }
+
+//#######################################################################################################
+
+namespace {
+constexpr size_t c_max_phases = 512;
+constexpr double c_kaiser_beta = 8.6;
+constexpr double c_rolloff = 0.95;
+
+// zeroth order modified Bessel function of the first kind
+double bessel_i0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    double hx = x / 2.0;
+    for (size_t k = 1; k < 50; k++)
+    {
+        term *= hx / double(k);
+        double t2 = term * term;
+        sum += t2;
+        if (t2 < sum * 1e-12) {
+            break;
+        }
+    }
+    return sum;
+}
+
+double sinc(double x)
+{
+    if (std::fabs(x) < 1e-9) {
+        return 1.0;
+    }
+    return std::sin(M_PI * x) / (M_PI * x);
+}
+
+yarp::sig::Sound::audio_sample to_audio_sample(float v)
+{
+    constexpr float vmax = std::numeric_limits<yarp::sig::Sound::audio_sample>::max();
+    constexpr float vmin = std::numeric_limits<yarp::sig::Sound::audio_sample>::min();
+    v = std::round(v);
+    if (v > vmax) { return static_cast<yarp::sig::Sound::audio_sample>(vmax); }
+    if (v < vmin) { return static_cast<yarp::sig::Sound::audio_sample>(vmin); }
+    return static_cast<yarp::sig::Sound::audio_sample>(v);
+}
+} // namespace
+
+class Resampler::Private
+{
+public:
+    size_t input_frequency = 0;
+    size_t output_frequency = 0;
+    size_t channels = 0;
+
+    // output_frequency / input_frequency == up / down
+    size_t up = 1;
+    size_t down = 1;
+
+    size_t half_taps = 0;
+    size_t taps = 0;
+    size_t phases = 0;
+    // (phases+1) filters of length taps, each one stored contiguously
+    std::vector<float> bank;
+
+    // per channel input history + new samples
+    std::vector<std::vector<float>> work;
+    // time of the next output sample (in input samples), relative to work[c][0]
+    size_t pos_int = 0;
+    size_t pos_frac = 0; // numerator, over up
+
+    void buildFilterBank(size_t quality)
+    {
+        double cutoff = std::min(1.0, double(up) / double(down)) * c_rolloff;
+        half_taps = size_t(std::ceil(double(quality) / cutoff));
+        taps = 2 * half_taps;
+        phases = std::min(up, c_max_phases);
+        bank.resize((phases + 1) * taps);
+
+        double i0_beta = bessel_i0(c_kaiser_beta);
+        for (size_t p = 0; p <= phases; p++)
+        {
+            double frac = double(p) / double(phases);
+            float* h = &bank[p * taps];
+            double sum = 0;
+            for (size_t j = 0; j < taps; j++)
+            {
+                double t = frac - (double(j) - double(half_taps) + 1.0);
+                double x = t / double(half_taps);
+                double w = (std::fabs(x) <= 1.0) ? bessel_i0(c_kaiser_beta * std::sqrt(1.0 - x * x)) / i0_beta : 0.0;
+                double v = cutoff * sinc(cutoff * t) * w;
+                h[j] = static_cast<float>(v);
+                sum += v;
+            }
+            // unity gain at DC for every phase
+            for (size_t j = 0; j < taps; j++) {
+                h[j] = static_cast<float>(h[j] / sum);
+            }
+        }
+    }
+
+    void reset()
+    {
+        work.assign(channels, std::vector<float>(half_taps - 1, 0.0f));
+        pos_int = half_taps - 1;
+        pos_frac = 0;
+    }
+
+    const float* filterFor(size_t frac) const
+    {
+        size_t p = (up == phases) ? frac : (frac * phases + up / 2) / up;
+        return &bank[p * taps];
+    }
+};
+
+Resampler::Resampler(size_t input_frequency, size_t output_frequency, size_t channels, size_t quality) :
+        mPriv(new Private)
+{
+    yAssert(input_frequency > 0 && output_frequency > 0 && channels > 0 && quality > 0);
+    mPriv->input_frequency = input_frequency;
+    mPriv->output_frequency = output_frequency;
+    mPriv->channels = channels;
+    size_t g = std::gcd(input_frequency, output_frequency);
+    mPriv->up = output_frequency / g;
+    mPriv->down = input_frequency / g;
+    mPriv->buildFilterBank(quality);
+    mPriv->reset();
+}
+
+Resampler::~Resampler()
+{
+    delete mPriv;
+}
+
+void Resampler::reset()
+{
+    mPriv->reset();
+}
+
+size_t Resampler::getInputFrequency() const
+{
+    return mPriv->input_frequency;
+}
+
+size_t Resampler::getOutputFrequency() const
+{
+    return mPriv->output_frequency;
+}
+
+size_t Resampler::getChannels() const
+{
+    return mPriv->channels;
+}
+
+double Resampler::getLatency() const
+{
+    return double(mPriv->half_taps) / double(mPriv->input_frequency);
+}
+
+bool Resampler::process(const yarp::sig::Sound& input, yarp::sig::Sound& output)
+{
+    if (input.getChannels() != mPriv->channels)
+    {
+        yCError(SOUNDFILTERS) << "Resampler configured for" << mPriv->channels << "channels, received" << input.getChannels();
+        return false;
+    }
+    if (input.getFrequency() != 0 && static_cast<size_t>(input.getFrequency()) != mPriv->input_frequency)
+    {
+        yCError(SOUNDFILTERS) << "Resampler configured for" << mPriv->input_frequency << "Hz, received" << input.getFrequency();
+        return false;
+    }
+
+    // append the new samples to the history
+    const size_t in_samples = input.getSamples();
+    for (size_t c = 0; c < mPriv->channels; c++)
+    {
+        auto& w = mPriv->work[c];
+        size_t old_size = w.size();
+        w.resize(old_size + in_samples);
+        for (size_t t = 0; t < in_samples; t++) {
+            w[old_size + t] = input.get(t, c);
+        }
+    }
+    const size_t available = mPriv->work[0].size();
+
+    // count the output samples which can be computed with the available look-ahead
+    size_t out_samples = 0;
+    size_t pos_int = mPriv->pos_int;
+    size_t pos_frac = mPriv->pos_frac;
+    while (pos_int + mPriv->half_taps < available)
+    {
+        out_samples++;
+        pos_frac += mPriv->down;
+        pos_int += pos_frac / mPriv->up;
+        pos_frac %= mPriv->up;
+    }
+
+    if (output.getSamples() != out_samples || output.getChannels() != mPriv->channels) {
+        output.resize(out_samples, mPriv->channels);
+    }
+    output.setFrequency(static_cast<int>(mPriv->output_frequency));
+
+    const size_t taps = mPriv->taps;
+    for (size_t c = 0; c < mPriv->channels; c++)
+    {
+        const float* x = mPriv->work[c].data();
+        size_t pi = mPriv->pos_int;
+        size_t pf = mPriv->pos_frac;
+        for (size_t n = 0; n < out_samples; n++)
+        {
+            // contiguous dot product, vectorized by the compiler
+            const float* h = mPriv->filterFor(pf);
+            const float* xs = x + pi + 1 - mPriv->half_taps;
+            float acc = 0.0f;
+            for (size_t j = 0; j < taps; j++) {
+                acc += xs[j] * h[j];
+            }
+            output.set(to_audio_sample(acc), n, c);
+
+            pf += mPriv->down;
+            pi += pf / mPriv->up;
+            pf %= mPriv->up;
+        }
+    }
+
+    // drop the samples which are not needed anymore, keeping the filter history
+    size_t consumed = std::min(pos_int + 1 - mPriv->half_taps, available);
+    for (auto& w : mPriv->work) {
+        w.erase(w.begin(), w.begin() + consumed);
+    }
+    mPriv->pos_int = pos_int - consumed;
+    mPriv->pos_frac = pos_frac;
+
+    return true;
+}
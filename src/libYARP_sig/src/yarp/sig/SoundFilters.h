@@ -16,6 +16,68 @@ namespace yarp::sig::soundfilters {
  * @return true on success
  */
 bool YARP_sig_API resample(yarp::sig::Sound& snd, size_t frequency);
+
+/**
+ * \brief Streaming resampler for sounds.
+ *
+ * Differently from resample(), this class keeps the filter history across
+ * calls to process(), so that a continuous audio stream split into several
+ * chunks (e.g. the packets received by a port) can be resampled without
+ * artefacts at the chunk boundaries.
+ * The resampling is performed through a polyphase bank of Kaiser-windowed
+ * sinc filters, computed only once at construction time.
+ * The output is delayed by the filter look-ahead (see getLatency()), i.e.
+ * the last input samples of each chunk are used only when the next chunk
+ * is received.
+ */
+class YARP_sig_API Resampler
+{
+public:
+    /**
+     * Constructor.
+     * @param input_frequency the frequency of the sounds passed to process()
+     * @param output_frequency the frequency of the resampled sounds
+     * @param channels the number of channels of the sounds
+     * @param quality the number of zero crossings of the sinc filter on each side.
+     *        Higher values improve the stop-band attenuation, at the price of a larger computational cost.
+     */
+    Resampler(size_t input_frequency, size_t output_frequency, size_t channels = 1, size_t quality = 16);
+    Resampler(const Resampler&) = delete;
+    Resampler(Resampler&&) = delete;
+    Resampler& operator=(const Resampler&) = delete;
+    Resampler& operator=(Resampler&&) = delete;
+    virtual ~Resampler();
+
+    /**
+     * Resamples a chunk of the stream.
+     * @param input the sound to resample. Its frequency and number of channels must match the ones passed to the constructor.
+     * @param output the resampled sound. Its number of samples depends on the number of input samples received so far.
+     * @return true on success
+     */
+    bool process(const yarp::sig::Sound& input, yarp::sig::Sound& output);
+
+    /**
+     * Clears the filter history, e.g. when a new (discontinuous) stream starts.
+     */
+    void reset();
+
+    size_t getInputFrequency() const;
+    size_t getOutputFrequency() const;
+    size_t getChannels() const;
+
+    /**
+     * Returns the delay introduced by the filter look-ahead.
+     * @return the latency, in seconds
+     */
+    double getLatency() const;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+private:
+    class Private;
+    Private* mPriv;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+};
+
 } // namespace yarp::sig::soundfilters
 
 #endif // YARP_SIG_SOUNDFILTERS_H
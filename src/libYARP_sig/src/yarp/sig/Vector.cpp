@@ -70,6 +70,9 @@ bool VectorBase::read(yarp::os::ConnectionReader& connection) {
         if (!ok) {
             return false;
         }
+    } else if (header.listLen == 0 && (header.listTag & BOTTLE_TAG_LIST) != 0) {
+        // empty vectors are written with no elements
+        resize(0);
     } else {
         return false;
     }
@@ -0,0 +1,294 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/sig/Image.h>
+#include <yarp/sig/ImageFile.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace yarp::sig;
+
+namespace {
+
+// Fills the image with a pattern that is different on each channel
+template <typename T>
+void fillPattern(ImageOf<T>& img, size_t w, size_t h)
+{
+    img.resize(w, h);
+    auto* raw = img.getRawImage();
+    for (size_t y = 0; y < h; y++) {
+        for (size_t x = 0; x < img.getRowSize(); x++) {
+            raw[y * img.getRowSize() + x] = static_cast<unsigned char>((x * 7 + y * 13) % 251);
+        }
+    }
+}
+
+template <typename T>
+bool samePixels(const ImageOf<T>& a, const ImageOf<T>& b, int tolerance)
+{
+    if (a.width() != b.width() || a.height() != b.height()) {
+        return false;
+    }
+    for (size_t y = 0; y < a.height(); y++) {
+        const unsigned char* ra = a.getRow(y);
+        const unsigned char* rb = b.getRow(y);
+        for (size_t x = 0; x < a.width() * a.getPixelSize(); x++) {
+            if (std::abs(ra[x] - rb[x]) > tolerance) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::vector<unsigned char> fileHeader(const std::string& filename, size_t size)
+{
+    std::vector<unsigned char> header(size);
+    std::ifstream f(filename, std::ios::binary);
+    f.read(reinterpret_cast<char*>(header.data()), static_cast<std::streamsize>(size));
+    header.resize(static_cast<size_t>(f.gcount()));
+    return header;
+}
+
+bool isJpeg(const std::string& filename)
+{
+    return fileHeader(filename, 2) == std::vector<unsigned char>{0xFF, 0xD8};
+}
+
+bool isPng(const std::string& filename)
+{
+    return fileHeader(filename, 4) == std::vector<unsigned char>{0x89, 'P', 'N', 'G'};
+}
+
+} // namespace
+
+TEST_CASE("sig::ImageFileTest", "[yarp::sig]")
+{
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / ("yarp_imagefile_test_" + std::to_string(std::rand()));
+    fs::create_directories(dir);
+    auto path = [&dir](const std::string& name) { return (dir / name).string(); };
+
+    SECTION("test ppm and pgm round trip")
+    {
+        ImageOf<PixelRgb> rgb;
+        fillPattern(rgb, 17, 9);
+        REQUIRE(file::write(rgb, path("rgb.ppm")));
+        ImageOf<PixelRgb> rgb2;
+        REQUIRE(file::read(rgb2, path("rgb.ppm")));
+        CHECK(samePixels(rgb, rgb2, 0));
+
+        ImageOf<PixelBgr> bgr;
+        fillPattern(bgr, 17, 9);
+        REQUIRE(file::write(bgr, path("bgr.ppm")));
+        ImageOf<PixelBgr> bgr2;
+        REQUIRE(file::read(bgr2, path("bgr.ppm")));
+        CHECK(samePixels(bgr, bgr2, 0));
+
+        ImageOf<PixelMono> mono;
+        fillPattern(mono, 17, 9);
+        REQUIRE(file::write(mono, path("mono.pgm")));
+        ImageOf<PixelMono> mono2;
+        REQUIRE(file::read(mono2, path("mono.pgm")));
+        CHECK(samePixels(mono, mono2, 0));
+    }
+
+#if defined(YARP_HAS_PNG)
+    SECTION("test png round trip")
+    {
+        ImageOf<PixelRgb> rgb;
+        fillPattern(rgb, 17, 9);
+        REQUIRE(file::write(rgb, path("rgb.png"), file::FORMAT_PNG));
+        CHECK(isPng(path("rgb.png")));
+        ImageOf<PixelRgb> rgb2;
+        REQUIRE(file::read(rgb2, path("rgb.png")));
+        CHECK(samePixels(rgb, rgb2, 0));
+
+        // a bgr image is stored as rgb and read back in its own order
+        ImageOf<PixelBgr> bgr;
+        fillPattern(bgr, 17, 9);
+        REQUIRE(file::write(bgr, path("bgr.png"), file::FORMAT_PNG));
+        ImageOf<PixelBgr> bgr2;
+        REQUIRE(file::read(bgr2, path("bgr.png")));
+        CHECK(samePixels(bgr, bgr2, 0));
+        ImageOf<PixelRgb> bgrAsRgb;
+        REQUIRE(file::read(bgrAsRgb, path("bgr.png")));
+        CHECK(bgrAsRgb.pixel(3, 2).r == bgr.pixel(3, 2).r);
+        CHECK(bgrAsRgb.pixel(3, 2).b == bgr.pixel(3, 2).b);
+
+        ImageOf<PixelMono> mono;
+        fillPattern(mono, 17, 9);
+        REQUIRE(file::write(mono, path("mono.png"), file::FORMAT_PNG));
+        ImageOf<PixelMono> mono2;
+        REQUIRE(file::read(mono2, path("mono.png")));
+        CHECK(samePixels(mono, mono2, 0));
+    }
+
+    SECTION("test png compression level")
+    {
+        ImageOf<PixelRgb> rgb;
+        fillPattern(rgb, 64, 64);
+        file::image_write_options options;
+        options.png_compression_level = 0;
+        REQUIRE(file::write(rgb, path("level0.png"), file::FORMAT_PNG, options));
+        options.png_compression_level = 9;
+        REQUIRE(file::write(rgb, path("level9.png"), file::FORMAT_PNG, options));
+        CHECK(fs::file_size(path("level9.png")) < fs::file_size(path("level0.png")));
+
+        ImageOf<PixelRgb> rgb2;
+        REQUIRE(file::read(rgb2, path("level9.png")));
+        CHECK(samePixels(rgb, rgb2, 0));
+    }
+
+    SECTION("test png from bgra")
+    {
+        ImageOf<PixelBgra> bgra;
+        bgra.resize(5, 4);
+        bgra.zero();
+        bgra.pixel(1, 1) = PixelBgra(30, 20, 10, 255);
+        REQUIRE(file::write(bgra, path("bgra.png"), file::FORMAT_PNG, file::image_write_options()));
+        CHECK(isPng(path("bgra.png")));
+        ImageOf<PixelRgb> rgb;
+        REQUIRE(file::read(rgb, path("bgra.png")));
+        CHECK(rgb.pixel(1, 1).r == 30);
+        CHECK(rgb.pixel(1, 1).g == 20);
+        CHECK(rgb.pixel(1, 1).b == 10);
+    }
+#endif
+
+#if defined(YARP_HAS_JPEG)
+    SECTION("test jpeg round trip")
+    {
+        ImageOf<PixelRgb> rgb;
+        rgb.resize(16, 16);
+        rgb.zero();
+        for (size_t y = 0; y < 16; y++) {
+            for (size_t x = 0; x < 16; x++) {
+                rgb.pixel(x, y) = PixelRgb(200, 40, 90);
+            }
+        }
+        REQUIRE(file::write(rgb, path("rgb.jpg"), file::FORMAT_JPG));
+        CHECK(isJpeg(path("rgb.jpg")));
+        ImageOf<PixelRgb> rgb2;
+        REQUIRE(file::read(rgb2, path("rgb.jpg")));
+        CHECK(samePixels(rgb, rgb2, 4));
+
+        // the bgr reader returns the same colors in its own order
+        ImageOf<PixelBgr> bgr;
+        REQUIRE(file::read(bgr, path("rgb.jpg")));
+        REQUIRE(bgr.width() == 16);
+        REQUIRE(bgr.height() == 16);
+        CHECK(std::abs(bgr.pixel(5, 5).r - 200) <= 4);
+        CHECK(std::abs(bgr.pixel(5, 5).b - 90) <= 4);
+
+        // and the bgr writer stores them in the right order
+        REQUIRE(file::write(bgr, path("bgr.jpg"), file::FORMAT_JPG));
+        ImageOf<PixelRgb> rgb3;
+        REQUIRE(file::read(rgb3, path("bgr.jpg")));
+        CHECK(samePixels(rgb, rgb3, 8));
+
+        ImageOf<PixelMono> mono;
+        mono.resize(16, 16);
+        mono.zero();
+        for (size_t y = 0; y < 16; y++) {
+            for (size_t x = 0; x < 16; x++) {
+                mono.pixel(x, y) = 120;
+            }
+        }
+        REQUIRE(file::write(mono, path("mono.jpg"), file::FORMAT_JPG));
+        CHECK(isJpeg(path("mono.jpg")));
+        ImageOf<PixelMono> mono2;
+        REQUIRE(file::read(mono2, path("mono.jpg")));
+        CHECK(samePixels(mono, mono2, 2));
+    }
+
+    SECTION("test jpeg from bgra")
+    {
+        ImageOf<PixelBgra> bgra;
+        bgra.resize(16, 16);
+        for (size_t y = 0; y < 16; y++) {
+            for (size_t x = 0; x < 16; x++) {
+                bgra.pixel(x, y) = PixelBgra(200, 40, 90, 255);
+            }
+        }
+        REQUIRE(file::write(bgra, path("bgra.jpg"), file::FORMAT_JPG, file::image_write_options()));
+        CHECK(isJpeg(path("bgra.jpg")));
+        ImageOf<PixelRgb> rgb;
+        REQUIRE(file::read(rgb, path("bgra.jpg")));
+        CHECK(std::abs(rgb.pixel(5, 5).r - 200) <= 4);
+        CHECK(std::abs(rgb.pixel(5, 5).g - 40) <= 4);
+        CHECK(std::abs(rgb.pixel(5, 5).b - 90) <= 4);
+    }
+
+    SECTION("test jpeg quality")
+    {
+        ImageOf<PixelRgb> rgb;
+        fillPattern(rgb, 64, 64);
+        file::image_write_options options;
+        options.jpeg_quality = 100;
+        REQUIRE(file::write(rgb, path("q100.jpg"), file::FORMAT_JPG, options));
+        options.jpeg_quality = 10;
+        REQUIRE(file::write(rgb, path("q10.jpg"), file::FORMAT_JPG, options));
+        CHECK(fs::file_size(path("q10.jpg")) < fs::file_size(path("q100.jpg")));
+    }
+#endif
+
+    SECTION("test asynchronous image writer")
+    {
+        const size_t count = 8;
+        std::vector<size_t> reported;
+        bool all_ok = true;
+        {
+            file::AsyncImageWriter writer(2, 2);
+            writer.setCallback([&](size_t index, const std::string& /*dest*/, bool ok) {
+                reported.push_back(index);
+                all_ok = all_ok && ok;
+            });
+
+            ImageOf<PixelRgb> img;
+            img.setQuantum(8);
+            img.resize(13, 7);
+            for (size_t i = 0; i < count; i++)
+            {
+                img.zero();
+                img.pixel(i, i % 7) = PixelRgb(static_cast<unsigned char>(i), 2, 3);
+                CHECK(writer.write(img, path("asyncwriter" + std::to_string(i) + ".ppm"), file::FORMAT_PPM) == i);
+            }
+            CHECK(writer.flush());
+
+            // write errors are returned by the next flush
+            writer.write(img, path("asyncwriter_no_such_dir/img.ppm"), file::FORMAT_PPM);
+            CHECK_FALSE(writer.flush());
+            CHECK(writer.flush());
+        }
+
+        // images are reported in the order they were submitted
+        REQUIRE(reported.size() == count + 1);
+        for (size_t i = 0; i < reported.size(); i++)
+        {
+            CHECK(reported[i] == i);
+        }
+        CHECK_FALSE(all_ok);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            ImageOf<PixelRgb> img;
+            REQUIRE(file::read(img, path("asyncwriter" + std::to_string(i) + ".ppm")));
+            CHECK(img.width() == 13);
+            CHECK(img.height() == 7);
+            CHECK(img.pixel(i, i % 7).r == i);
+            CHECK(img.pixel(i, i % 7).b == 3);
+        }
+    }
+
+    fs::remove_all(dir);
+}
@@ -8,6 +8,7 @@
 #include <yarp/os/impl/BufferedConnectionWriter.h>
 #include <yarp/sig/Image.h>
 #include <yarp/sig/ImageDraw.h>
+#include <yarp/sig/ImageFile.h>
 #include <yarp/sig/ImageUtils.h>
 #include <yarp/os/Network.h>
 #include <yarp/os/PortReaderBuffer.h>
@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: 2006-2021 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/sig/Sound.h>
+#include <yarp/sig/SoundFilters.h>
+
+#include <cmath>
+#include <vector>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::sig;
+using namespace yarp::sig::soundfilters;
+
+namespace {
+
+void generate_sine(Sound& snd, size_t samples, size_t channels, int frequency, double tone_frequency, size_t offset = 0)
+{
+    snd.resize(samples, channels);
+    snd.setFrequency(frequency);
+    for (size_t ch = 0; ch < channels; ch++)
+    {
+        for (size_t s = 0; s < samples; s++)
+        {
+            double t = double(s + offset) / frequency;
+            snd.set((Sound::audio_sample)(10000 * std::sin(2 * M_PI * tone_frequency * (ch + 1) * t)), s, ch);
+        }
+    }
+}
+
+// ratio between the power of the error and the power of the expected signal, in dB
+double compute_snr(const Sound& snd, int frequency, double tone_frequency, size_t channel, double delay_s, size_t skip)
+{
+    double signal = 0;
+    double noise = 0;
+    for (size_t s = skip; s < snd.getSamples() - skip; s++)
+    {
+        double t = double(s) / frequency - delay_s;
+        double expected = 10000 * std::sin(2 * M_PI * tone_frequency * (channel + 1) * t);
+        double err = snd.get(s, channel) - expected;
+        signal += expected * expected;
+        noise += err * err;
+    }
+    return 10 * std::log10(signal / noise);
+}
+
+} // namespace
+
+TEST_CASE("sig::SoundFiltersTest", "[yarp::sig]")
+{
+    SECTION("check streaming resampler quality.")
+    {
+        const std::vector<std::pair<size_t, size_t>> rates { {44100, 16000}, {16000, 44100}, {48000, 44100}, {8000, 16000} };
+        for (const auto& rate : rates)
+        {
+            Resampler resampler(rate.first, rate.second, 2);
+            CHECK(resampler.getInputFrequency() == rate.first);
+            CHECK(resampler.getOutputFrequency() == rate.second);
+            CHECK(resampler.getChannels() == 2);
+
+            Sound in;
+            Sound out;
+            generate_sine(in, rate.first, 2, rate.first, 440);
+            REQUIRE(resampler.process(in, out));
+            CHECK(out.getFrequency() == (int)rate.second);
+            CHECK(out.getChannels() == 2);
+            // the last samples are retained for the filter look-ahead
+            size_t expected_samples = size_t(rate.second * (1.0 - resampler.getLatency()));
+            CHECK(out.getSamples() + 2 >= expected_samples);
+            CHECK(out.getSamples() <= rate.second);
+
+            for (size_t ch = 0; ch < 2; ch++)
+            {
+                double snr = compute_snr(out, rate.second, 440, ch, 0.0, 100);
+                INFO(rate.first << "Hz -> " << rate.second << "Hz, channel " << ch << ": SNR = " << snr << "dB");
+                CHECK(snr > 60.0);
+            }
+        }
+    }
+
+    SECTION("check streaming resampler continuity across chunks.")
+    {
+        const size_t in_freq = 44100;
+        const size_t out_freq = 16000;
+        Sound whole;
+        generate_sine(whole, in_freq, 1, in_freq, 440);
+
+        Resampler oneshot(in_freq, out_freq);
+        Sound ref;
+        REQUIRE(oneshot.process(whole, ref));
+
+        // the same stream, split into chunks of different sizes
+        Resampler streaming(in_freq, out_freq);
+        Sound streamed;
+        streamed.setFrequency(out_freq);
+        size_t offset = 0;
+        size_t chunk = 1;
+        while (offset < in_freq)
+        {
+            size_t len = std::min(chunk, in_freq - offset);
+            Sound in;
+            generate_sine(in, len, 1, in_freq, 440, offset);
+            Sound out;
+            REQUIRE(streaming.process(in, out));
+            streamed += out;
+            offset += len;
+            chunk = chunk * 3 + 1;
+        }
+
+        REQUIRE(streamed.getSamples() == ref.getSamples());
+        bool ok = (streamed == ref);
+        CHECK(ok);
+
+        // after a reset, the stream restarts from scratch
+        streaming.reset();
+        Sound out2;
+        REQUIRE(streaming.process(whole, out2));
+        ok = (out2 == ref);
+        CHECK(ok);
+    }
+
+    SECTION("check streaming resampler input validation.")
+    {
+        Resampler resampler(44100, 16000, 1);
+        Sound in;
+        Sound out;
+        generate_sine(in, 100, 2, 44100, 440);
+        CHECK_FALSE(resampler.process(in, out));
+        generate_sine(in, 100, 1, 48000, 440);
+        CHECK_FALSE(resampler.process(in, out));
+    }
+
+    SECTION("check one-shot resample.")
+    {
+        Sound snd;
+        generate_sine(snd, 44100, 1, 44100, 440);
+        REQUIRE(resample(snd, 16000));
+        CHECK(snd.getFrequency() == 16000);
+        CHECK(snd.getSamples() == 16000);
+        double snr = compute_snr(snd, 16000, 440, 0, 0.0, 100);
+        INFO("SNR = " << snr << "dB");
+        CHECK(snr > 60.0);
+    }
+}
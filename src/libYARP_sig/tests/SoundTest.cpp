@@ -175,6 +175,30 @@ TEST_CASE("sig::SoundTest", "[yarp::sig]")
         }
     }
 
+    SECTION("check setInterleavedAudioRawData.")
+    {
+        for (size_t channels = 1; channels <= 3; channels++)
+        {
+            Sound snd1;
+            snd1.resize(10, channels);
+            std::vector<Sound::audio_sample> data(10 * channels);
+            for (size_t s = 0; s < 10; s++)
+            {
+                for (size_t ch = 0; ch < channels; ch++)
+                {
+                    data[s * channels + ch] = (Sound::audio_sample)(ch * 100 + s);
+                }
+            }
+            snd1.setInterleavedAudioRawData(data.data());
+
+            Sound snd2;
+            snd2.resize(10, channels);
+            generate_test_sound(snd2, 10, channels);
+            bool ok = (snd1 == snd2);
+            CHECK(ok);
+        }
+    }
+
     SECTION("check amplify.")
     {
         double gain = 2;
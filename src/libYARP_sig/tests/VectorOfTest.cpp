@@ -53,8 +53,8 @@ TEST_CASE("sig::VectorOfTest", "[yarp::sig]")
             bool success = true;
             portOut.write(vector);
 
-            VectorOf<int> tmp;
-            portIn.read(tmp);
+            VectorOf<int> tmp(3);
+            CHECK(portIn.read(tmp));
 
             //compare vector and tmp
             if (tmp.size() != vector.size())
@@ -97,8 +97,8 @@ TEST_CASE("sig::VectorOfTest", "[yarp::sig]")
             bool success = true;
             portOut.write(vector);
 
-            VectorOf<int> tmp;
-            portIn.read(tmp);
+            VectorOf<int> tmp(3);
+            CHECK(portIn.read(tmp));
 
             //compare vector and tmp
             if (tmp.size() != vector.size())
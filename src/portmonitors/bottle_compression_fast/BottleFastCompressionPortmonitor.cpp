@@ -0,0 +1,559 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "BottleFastCompressionPortmonitor.h"
+
+#include <yarp/os/LogComponent.h>
+#include <yarp/os/LogStream.h>
+#include <yarp/os/Time.h>
+#include <yarp/os/Vocab.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+
+#ifdef YARP_HAS_LZ4
+#include <lz4.h>
+#include <lz4hc.h>
+#endif
+
+#ifdef YARP_HAS_ZSTD
+#include <zstd.h>
+#include <zdict.h>
+#endif
+
+using namespace yarp::os;
+
+namespace {
+YARP_LOG_COMPONENT(BOTTLE_FAST_MONITOR,
+                   "yarp.carrier.portmonitor.bottle_fast",
+                   yarp::os::Log::minimumPrintLevel(),
+                   yarp::os::Log::LogTypeReserved,
+                   yarp::os::Log::printCallback(),
+                   nullptr)
+
+constexpr yarp::conf::vocab32_t VOCAB_LZ4 = yarp::os::createVocab32('l', 'z', '4');
+constexpr yarp::conf::vocab32_t VOCAB_ZSTD = yarp::os::createVocab32('z', 's', 't', 'd');
+
+// Zstandard suggests about 100 times the size of the dictionary as training
+// data, there is no point in collecting more than that
+constexpr size_t maxSamplesPerDictByte = 100;
+
+// Connectionless carriers might lose the message carrying the dictionary
+constexpr size_t defaultDictResendConnectionless = 100;
+
+// LZ4 uses at most the last 64 KiB of the dictionary
+constexpr size_t lz4MaxDictSize = 65536;
+
+// A LZ4 sequence cannot expand more than 255 times, a message declaring a
+// larger uncompressed size is corrupted
+constexpr size_t lz4MaxRatio = 255;
+
+// LZ4 dictionaries are raw content without an identifier, the id sent with
+// the messages is a hash of the content (FNV-1a)
+unsigned int lz4DictId(const char* dict, size_t dict_size)
+{
+    std::uint32_t hash = 2166136261U;
+    for (size_t i = 0; i < dict_size; i++) {
+        hash = (hash ^ static_cast<unsigned char>(dict[i])) * 16777619U;
+    }
+    return (hash != 0) ? hash : 1;
+}
+
+void split(const std::string& s, char delim, std::vector<std::string>& elements)
+{
+    std::istringstream iss(s);
+    std::string item;
+    while (std::getline(iss, item, delim))
+    {
+        elements.push_back(item);
+    }
+}
+
+} //anonymous namespace
+
+
+bool BottleFastCompressionMonitorObject::create(const yarp::os::Property& options)
+{
+    m_shouldCompress = (options.find("sender_side").asBool());
+
+    //parse the user parameters
+    yarp::os::Property m_user_params;
+    std::string str = options.find("carrier").asString();
+    getParamsFromCommandLine(str, m_user_params);
+    m_debug_compression_size = m_user_params.check("debug_compression_info");
+
+#ifdef YARP_HAS_LZ4
+    m_algorithm = Algorithm::LZ4;
+#else
+    m_algorithm = Algorithm::Zstd;
+#endif
+    if (m_user_params.check("algorithm")) {
+        std::string algorithm = m_user_params.find("algorithm").asString();
+        if (algorithm == "lz4") {
+            m_algorithm = Algorithm::LZ4;
+        } else if (algorithm == "zstd") {
+            m_algorithm = Algorithm::Zstd;
+        } else {
+            yCError(BOTTLE_FAST_MONITOR, "Unknown algorithm '%s', use lz4 or zstd", algorithm.c_str());
+            return false;
+        }
+    }
+#ifndef YARP_HAS_LZ4
+    if (m_algorithm == Algorithm::LZ4) {
+        yCError(BOTTLE_FAST_MONITOR, "YARP was compiled without LZ4 support");
+        return false;
+    }
+#endif
+#ifndef YARP_HAS_ZSTD
+    if (m_algorithm == Algorithm::Zstd) {
+        yCError(BOTTLE_FAST_MONITOR, "YARP was compiled without Zstandard support");
+        return false;
+    }
+#endif
+    m_level = m_user_params.check("level", Value(1)).asInt32();
+
+    m_useDictionary = m_user_params.check("dictionary") && m_user_params.find("dictionary").asBool();
+    if (m_user_params.check("dict_samples")) {
+        m_dictSamples = std::max(1, m_user_params.find("dict_samples").asInt32());
+    }
+    if (m_user_params.check("dict_size")) {
+        m_dictMaxSize = std::max(256, m_user_params.find("dict_size").asInt32());
+    }
+    if (m_algorithm == Algorithm::LZ4) {
+        m_dictMaxSize = std::min(m_dictMaxSize, lz4MaxDictSize);
+    }
+    std::string carrier = str.substr(0, str.find('+'));
+    if (carrier == "udp" || carrier == "mcast") {
+        m_dictResend = defaultDictResendConnectionless;
+    }
+    if (m_user_params.check("dict_resend")) {
+        m_dictResend = std::max(0, m_user_params.find("dict_resend").asInt32());
+    }
+    if (m_user_params.check("max_size")) {
+        m_maxSize = static_cast<size_t>(std::max<std::int64_t>(0, m_user_params.find("max_size").asInt64()));
+    }
+
+#ifdef YARP_HAS_LZ4
+    if (m_shouldCompress && m_algorithm == Algorithm::LZ4) {
+        m_lz4State.resize(m_level > 1 ? LZ4_sizeofStateHC() : LZ4_sizeofState());
+        if (m_level > 1) {
+            // the level is kept by LZ4_loadDictHC()
+            LZ4_resetStreamHC_fast(LZ4_initStreamHC(m_lz4State.data(), m_lz4State.size()), m_level);
+        }
+    }
+#endif
+#ifdef YARP_HAS_ZSTD
+    // The receiver accepts both algorithms, the context is created anyway
+    if (m_shouldCompress && m_algorithm == Algorithm::Zstd) {
+        m_cctx = ZSTD_createCCtx();
+        if (m_cctx == nullptr) {
+            yCError(BOTTLE_FAST_MONITOR, "Cannot create the zstd compression context");
+            return false;
+        }
+    } else if (!m_shouldCompress) {
+        m_dctx = ZSTD_createDCtx();
+        if (m_dctx == nullptr) {
+            yCError(BOTTLE_FAST_MONITOR, "Cannot create the zstd decompression context");
+            return false;
+        }
+    }
+#endif
+
+    return true;
+}
+
+void BottleFastCompressionMonitorObject::destroy()
+{
+#ifdef YARP_HAS_ZSTD
+    ZSTD_freeCDict(m_cdict);
+    m_cdict = nullptr;
+    ZSTD_freeDDict(m_ddict);
+    m_ddict = nullptr;
+    ZSTD_freeCCtx(m_cctx);
+    m_cctx = nullptr;
+    ZSTD_freeDCtx(m_dctx);
+    m_dctx = nullptr;
+#endif
+    m_buffer.clear();
+    m_lz4State.clear();
+    m_dict.clear();
+    m_samples.clear();
+    m_sampleSizes.clear();
+}
+
+void BottleFastCompressionMonitorObject::getParamsFromCommandLine(std::string carrierString, yarp::os::Property& prop)
+{
+    // Split command line string using '+' delimiter
+    std::vector<std::string> parameters;
+    split(carrierString, '+', parameters);
+
+    // Iterate over result strings
+    for (std::string param : parameters) {
+        // If there is no '.', then the param is bad formatted, skip it.
+        auto pointPosition = param.find('.');
+        if (pointPosition == std::string::npos) {
+            continue;
+        }
+
+        // Otherwise, separate key and value
+        std::string paramKey = param.substr(0, pointPosition);
+        yarp::os::Value paramValue;
+        std::string s = param.substr(pointPosition + 1, param.length());
+        paramValue.fromString(s.c_str());
+
+        // and append to the returned property
+        prop.put(paramKey, paramValue);
+    }
+}
+
+bool BottleFastCompressionMonitorObject::setparam(const yarp::os::Property& params)
+{
+    return false;
+}
+
+bool BottleFastCompressionMonitorObject::getparam(yarp::os::Property& params)
+{
+    return false;
+}
+
+bool BottleFastCompressionMonitorObject::accept(yarp::os::Things& thing)
+{
+    if (m_shouldCompress) {
+        return true;
+    }
+
+    // receiver side / decompressor
+    // The message is decompressed here, so that messages that cannot be
+    // decompressed (e.g. the dictionary was lost) are dropped
+    auto* b = thing.cast_as<yarp::os::Bottle>();
+    if (b == nullptr || b->size() < 4 || !b->get(3).isBlob() || b->get(1).asInt32() < 0) {
+        yCError(BOTTLE_FAST_MONITOR, "Expected a compressed bottle in receiver side, but got wrong data type!");
+        return false;
+    }
+
+    yarp::conf::vocab32_t algorithm = b->get(0).asVocab32();
+    if (algorithm == VOCAB_LZ4) {
+        m_algorithm = Algorithm::LZ4;
+    } else if (algorithm == VOCAB_ZSTD) {
+        m_algorithm = Algorithm::Zstd;
+    } else {
+        yCError(BOTTLE_FAST_MONITOR, "Unknown compression algorithm %s", yarp::os::Vocab32::decode(algorithm).c_str());
+        return false;
+    }
+
+    auto sizeUncompressed = static_cast<size_t>(b->get(1).asInt32());
+    auto dictId = static_cast<unsigned int>(b->get(2).asInt32());
+    size_t sizeCompressed = b->get(3).asBlobLength();
+    const char* compressedData = b->get(3).asBlob();
+
+    if (b->size() > 4 && b->get(4).isBlob()) {
+        if (!loadDictionary(b->get(4).asBlob(), b->get(4).asBlobLength())) {
+            return false;
+        }
+    }
+    if (dictId != 0 && dictId != m_dictId) {
+        yCWarning(BOTTLE_FAST_MONITOR, "Dictionary %u not received yet, dropping the message", dictId);
+        return false;
+    }
+    if (!checkUncompressedSize(compressedData, sizeCompressed, sizeUncompressed)) {
+        return false;
+    }
+
+    double start_time = yarp::os::Time::now();
+    bool ret = decompressData(compressedData, sizeCompressed, sizeUncompressed, dictId != 0);
+    double end_time = yarp::os::Time::now();
+    if (!ret) {
+        yCError(BOTTLE_FAST_MONITOR, "Failed to decompress, dropping the message");
+        return false;
+    }
+
+    m_data.fromBinary(m_buffer.data(), sizeUncompressed);
+    m_th.setPortWriter(&m_data);
+
+    if (m_debug_compression_size) {
+        yCDebug(BOTTLE_FAST_MONITOR) << "uncompressed size:" << sizeUncompressed
+                                     << "compressed size" << sizeCompressed
+                                     << "ratio:" << (double)sizeUncompressed / (double)sizeCompressed << ":1"
+                                     << "time:" << end_time - start_time;
+    }
+
+    return true;
+}
+
+yarp::os::Things& BottleFastCompressionMonitorObject::update(yarp::os::Things& thing)
+{
+    if (!m_shouldCompress) {
+        // receiver side, the message was already decompressed in accept()
+        return m_th;
+    }
+
+    // sender side / compressor
+    yarp::os::PortWriter* pwrite = thing.getPortWriter();
+    if (pwrite == nullptr) {
+        yCError(BOTTLE_FAST_MONITOR, "Expected type Bottle in sender side, but got wrong data type!");
+        return thing;
+    }
+
+    // Bottles are serialized directly, other types are converted first
+    auto* b = dynamic_cast<yarp::os::Bottle*>(pwrite);
+    if (b == nullptr) {
+        yarp::os::Portable::copyPortable(*pwrite, m_input);
+        b = &m_input;
+    }
+
+    size_t sizeUncompressed = 0;
+    const char* uncompressedData = b->toBinary(&sizeUncompressed);
+
+    if (m_useDictionary) {
+        addDictionarySample(uncompressedData, sizeUncompressed);
+    }
+
+    size_t sizeCompressed = 0;
+    double start_time = yarp::os::Time::now();
+    bool ret = compressData(uncompressedData, sizeUncompressed, sizeCompressed);
+    double end_time = yarp::os::Time::now();
+    if (!ret) {
+        yCError(BOTTLE_FAST_MONITOR, "Failed to compress, exiting...");
+        return thing;
+    }
+
+    bool withDictionary = (m_dictId != 0);
+
+    m_data.clear();
+    m_data.addVocab32(m_algorithm == Algorithm::LZ4 ? VOCAB_LZ4 : VOCAB_ZSTD);
+    m_data.addInt32(static_cast<std::int32_t>(sizeUncompressed));
+    m_data.addInt32(withDictionary ? static_cast<std::int32_t>(m_dictId) : 0);
+    m_data.add(Value(m_buffer.data(), static_cast<int>(sizeCompressed)));
+    if (withDictionary) {
+        if (m_sinceDictSent == 0) {
+            m_data.add(Value(m_dict.data(), static_cast<int>(m_dict.size())));
+        }
+        ++m_sinceDictSent;
+        if (m_dictResend > 0 && m_sinceDictSent >= m_dictResend) {
+            m_sinceDictSent = 0;
+        }
+    }
+    m_th.setPortWriter(&m_data);
+
+    if (m_debug_compression_size) {
+        yCDebug(BOTTLE_FAST_MONITOR) << "uncompressed size:" << sizeUncompressed
+                                     << "compressed size" << sizeCompressed
+                                     << "ratio:" << (double)sizeUncompressed / (double)sizeCompressed << ":1"
+                                     << "time:" << end_time - start_time;
+    }
+
+    return m_th;
+}
+
+bool BottleFastCompressionMonitorObject::compressData(const char* in, size_t in_size, size_t& out_size)
+{
+    if (m_algorithm == Algorithm::LZ4) {
+#ifdef YARP_HAS_LZ4
+        int bound = LZ4_compressBound(static_cast<int>(in_size));
+        if (bound <= 0) {
+            yCError(BOTTLE_FAST_MONITOR, "lz4 compression: input too large");
+            return false;
+        }
+        m_buffer.resize(bound);
+        int ret = 0;
+        int acceleration = (m_level < 0) ? -m_level : 1;
+        if (m_dictId != 0 && m_level > 1) {
+            // each message is an independent block that can refer to the dictionary
+            auto* stream = static_cast<LZ4_streamHC_t*>(static_cast<void*>(m_lz4State.data()));
+            LZ4_loadDictHC(stream, m_dict.data(), static_cast<int>(m_dict.size()));
+            ret = LZ4_compress_HC_continue(stream, in, m_buffer.data(), static_cast<int>(in_size), bound);
+        } else if (m_dictId != 0) {
+            auto* stream = static_cast<LZ4_stream_t*>(static_cast<void*>(m_lz4State.data()));
+            LZ4_loadDict(stream, m_dict.data(), static_cast<int>(m_dict.size()));
+            ret = LZ4_compress_fast_continue(stream, in, m_buffer.data(), static_cast<int>(in_size), bound, acceleration);
+        } else if (m_level > 1) {
+            ret = LZ4_compress_HC_extStateHC(m_lz4State.data(), in, m_buffer.data(), static_cast<int>(in_size), bound, m_level);
+        } else {
+            ret = LZ4_compress_fast_extState(m_lz4State.data(), in, m_buffer.data(), static_cast<int>(in_size), bound, acceleration);
+        }
+        if (ret <= 0) {
+            yCError(BOTTLE_FAST_MONITOR, "lz4 compression: output buffer wasn't large enough");
+            return false;
+        }
+        out_size = static_cast<size_t>(ret);
+        return true;
+#endif
+    } else {
+#ifdef YARP_HAS_ZSTD
+        size_t bound = ZSTD_compressBound(in_size);
+        m_buffer.resize(bound);
+        size_t ret = 0;
+        if (m_cdict != nullptr) {
+            ret = ZSTD_compress_usingCDict(m_cctx, m_buffer.data(), bound, in, in_size, m_cdict);
+        } else {
+            ret = ZSTD_compressCCtx(m_cctx, m_buffer.data(), bound, in, in_size, m_level);
+        }
+        if (ZSTD_isError(ret)) {
+            yCError(BOTTLE_FAST_MONITOR, "zstd compression: %s", ZSTD_getErrorName(ret));
+            return false;
+        }
+        out_size = ret;
+        return true;
+#endif
+    }
+    return false;
+}
+
+bool BottleFastCompressionMonitorObject::decompressData(const char* in, size_t in_size, size_t out_size, bool useDictionary)
+{
+    m_buffer.resize(out_size);
+    if (m_algorithm == Algorithm::LZ4) {
+#ifdef YARP_HAS_LZ4
+        int ret = 0;
+        if (useDictionary) {
+            ret = LZ4_decompress_safe_usingDict(in, m_buffer.data(), static_cast<int>(in_size), static_cast<int>(out_size), m_dict.data(), static_cast<int>(m_dict.size()));
+        } else {
+            ret = LZ4_decompress_safe(in, m_buffer.data(), static_cast<int>(in_size), static_cast<int>(out_size));
+        }
+        if (ret < 0 || static_cast<size_t>(ret) != out_size) {
+            yCError(BOTTLE_FAST_MONITOR, "lz4 decompression: data is corrupted");
+            return false;
+        }
+        return true;
+#else
+        yCError(BOTTLE_FAST_MONITOR, "YARP was compiled without LZ4 support");
+#endif
+    } else {
+#ifdef YARP_HAS_ZSTD
+        size_t ret = 0;
+        if (useDictionary) {
+            ret = ZSTD_decompress_usingDDict(m_dctx, m_buffer.data(), out_size, in, in_size, m_ddict);
+        } else {
+            ret = ZSTD_decompressDCtx(m_dctx, m_buffer.data(), out_size, in, in_size);
+        }
+        if (ZSTD_isError(ret)) {
+            yCError(BOTTLE_FAST_MONITOR, "zstd decompression: %s", ZSTD_getErrorName(ret));
+            return false;
+        }
+        if (ret != out_size) {
+            yCError(BOTTLE_FAST_MONITOR, "zstd decompression: data is corrupted");
+            return false;
+        }
+        return true;
+#else
+        yCError(BOTTLE_FAST_MONITOR, "YARP was compiled without Zstandard support");
+#endif
+    }
+    return false;
+}
+
+void BottleFastCompressionMonitorObject::addDictionarySample(const char* in, size_t in_size)
+{
+    m_samples.insert(m_samples.end(), in, in + in_size);
+    m_sampleSizes.push_back(in_size);
+    if (m_sampleSizes.size() >= m_dictSamples || m_samples.size() >= maxSamplesPerDictByte * m_dictMaxSize) {
+        trainDictionary();
+        // Trained or not, the samples are not collected anymore
+        m_useDictionary = false;
+        std::vector<char>().swap(m_samples);
+        std::vector<size_t>().swap(m_sampleSizes);
+    }
+}
+
+bool BottleFastCompressionMonitorObject::trainDictionary()
+{
+    if (m_algorithm == Algorithm::LZ4) {
+        // LZ4 has no dictionary trainer, the most recent messages are used
+        // as they are, since LZ4 finds the closest matches first
+        size_t size = std::min(m_samples.size(), m_dictMaxSize);
+        m_dict.assign(m_samples.end() - static_cast<std::ptrdiff_t>(size), m_samples.end());
+        m_dictId = lz4DictId(m_dict.data(), m_dict.size());
+        m_sinceDictSent = 0;
+        yCDebug(BOTTLE_FAST_MONITOR, "Built dictionary %u (%zu bytes) from %zu messages", m_dictId, m_dict.size(), m_sampleSizes.size());
+        return true;
+    }
+
+#ifdef YARP_HAS_ZSTD
+    m_dict.resize(m_dictMaxSize);
+    size_t size = ZDICT_trainFromBuffer(m_dict.data(), m_dict.size(), m_samples.data(), m_sampleSizes.data(), static_cast<unsigned int>(m_sampleSizes.size()));
+    if (ZDICT_isError(size)) {
+        yCWarning(BOTTLE_FAST_MONITOR, "Cannot train the dictionary (%s), compressing without it", ZDICT_getErrorName(size));
+        m_dict.clear();
+        return false;
+    }
+    m_dict.resize(size);
+
+    m_cdict = ZSTD_createCDict(m_dict.data(), m_dict.size(), m_level);
+    if (m_cdict == nullptr) {
+        yCWarning(BOTTLE_FAST_MONITOR, "Cannot load the dictionary, compressing without it");
+        m_dict.clear();
+        return false;
+    }
+    m_dictId = ZSTD_getDictID_fromDict(m_dict.data(), m_dict.size());
+    m_sinceDictSent = 0;
+    yCDebug(BOTTLE_FAST_MONITOR, "Trained dictionary %u (%zu bytes) from %zu messages", m_dictId, m_dict.size(), m_sampleSizes.size());
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool BottleFastCompressionMonitorObject::loadDictionary(const char* dict, size_t dict_size)
+{
+    if (m_algorithm == Algorithm::LZ4) {
+        if (dict_size == 0 || dict_size > lz4MaxDictSize) {
+            yCError(BOTTLE_FAST_MONITOR, "Invalid dictionary received (%zu bytes)", dict_size);
+            m_dictId = 0;
+            return false;
+        }
+        unsigned int id = lz4DictId(dict, dict_size);
+        if (id != m_dictId) {
+            m_dict.assign(dict, dict + dict_size);
+            m_dictId = id;
+        }
+        return true;
+    }
+
+#ifdef YARP_HAS_ZSTD
+    unsigned int id = ZSTD_getDictID_fromDict(dict, dict_size);
+    if (m_ddict != nullptr && id == m_dictId) {
+        return true;
+    }
+    ZSTD_freeDDict(m_ddict);
+    m_ddict = ZSTD_createDDict(dict, dict_size);
+    if (m_ddict == nullptr) {
+        yCError(BOTTLE_FAST_MONITOR, "Cannot load the dictionary received");
+        m_dictId = 0;
+        return false;
+    }
+    m_dictId = id;
+    return true;
+#else
+    yCError(BOTTLE_FAST_MONITOR, "YARP was compiled without Zstandard support");
+    return false;
+#endif
+}
+
+bool BottleFastCompressionMonitorObject::checkUncompressedSize(const char* in, size_t in_size, size_t out_size)
+{
+    // The size comes from the network, the buffer is not resized before
+    // checking that the compressed data can actually produce it
+    if (out_size > m_maxSize) {
+        yCError(BOTTLE_FAST_MONITOR, "The message declares %zu uncompressed bytes, more than the maximum %zu, dropping it", out_size, m_maxSize);
+        return false;
+    }
+    if (m_algorithm == Algorithm::LZ4) {
+        if (out_size > in_size * lz4MaxRatio) {
+            yCError(BOTTLE_FAST_MONITOR, "lz4 decompression: %zu compressed bytes cannot produce %zu bytes, dropping the message", in_size, out_size);
+            return false;
+        }
+        return true;
+    }
+#ifdef YARP_HAS_ZSTD
+    unsigned long long frameSize = ZSTD_getFrameContentSize(in, in_size);
+    if (frameSize != out_size) {
+        yCError(BOTTLE_FAST_MONITOR, "zstd decompression: the frame does not match the declared size, dropping the message");
+        return false;
+    }
+#endif
+    return true;
+}
@@ -0,0 +1,120 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_BOTTLE_FAST_COMPRESSION_PORTMONITOR_H
+#define YARP_BOTTLE_FAST_COMPRESSION_PORTMONITOR_H
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/MonitorObject.h>
+#include <yarp/os/Things.h>
+
+#include <string>
+#include <vector>
+
+#ifdef YARP_HAS_ZSTD
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+#endif
+
+/**
+ * @ingroup portmonitors_lists
+ * \brief `bottle_compression_fast_portmonitor`: Portmonitor plugin for
+ * compression and decompression of bottles (or yarp data types castable to
+ * bottle) using the LZ4 or the Zstandard library.
+ *
+ * Compression contexts and buffers are allocated once for each connection and
+ * reused for all the messages.
+ * A dictionary can be built from the first messages sent on the connection,
+ * which improves the compression of small repetitive messages.
+ * The dictionary is sent to the receiver together with the first message
+ * compressed with it.
+ *
+ * Parameters:
+ * - `algorithm.lz4` or `algorithm.zstd` (default `lz4`, or `zstd` if LZ4 is
+ *   not available)
+ * - `level.<n>`: compression level. For LZ4, levels greater than 1 use the
+ *   high compression mode, negative levels increase the acceleration. For
+ *   Zstandard, the default is 1.
+ * - `dictionary.1`: use a dictionary. Zstandard trains it from the first
+ *   messages, LZ4 uses the content of the last ones.
+ * - `dict_samples.<n>`: number of messages used to build the dictionary
+ *   (default 100)
+ * - `dict_size.<n>`: maximum size of the dictionary in bytes (default 16384,
+ *   at most 65536 for LZ4)
+ * - `dict_resend.<n>`: send the dictionary again every `n` messages (default
+ *   0 for tcp connections, 100 for udp and mcast connections)
+ * - `max_size.<n>`: on the receiver side, the largest uncompressed message
+ *   accepted in bytes (default 268435456)
+ * - `debug_compression_info`
+ *
+ * Example usage:
+ * yarp connect /src /dest tcp+send.portmonitor+file.bottle_compression_fast+recv.portmonitor+file.bottle_compression_fast+type.dll
+ * yarp connect /src /dest tcp+send.portmonitor+file.bottle_compression_fast+recv.portmonitor+file.bottle_compression_fast+type.dll+algorithm.zstd+level.3+dictionary.1
+ */
+class BottleFastCompressionMonitorObject : public yarp::os::MonitorObject
+{
+public:
+    bool create(const yarp::os::Property& options) override;
+    void destroy() override;
+
+    bool setparam(const yarp::os::Property& params) override;
+    bool getparam(yarp::os::Property& params) override;
+
+    bool accept(yarp::os::Things& thing) override;
+    yarp::os::Things& update(yarp::os::Things& thing) override;
+
+private:
+    enum class Algorithm
+    {
+        LZ4,
+        Zstd
+    };
+
+    void getParamsFromCommandLine(std::string carrierString, yarp::os::Property& prop);
+
+    bool compressData(const char* in, size_t in_size, size_t& out_size);
+    bool decompressData(const char* in, size_t in_size, size_t out_size, bool useDictionary);
+
+    void addDictionarySample(const char* in, size_t in_size);
+    bool trainDictionary();
+    bool loadDictionary(const char* dict, size_t dict_size);
+    bool checkUncompressedSize(const char* in, size_t in_size, size_t out_size);
+
+    yarp::os::Things m_th;
+    yarp::os::Bottle m_data;
+    yarp::os::Bottle m_input;
+    bool             m_shouldCompress = false;
+    bool             m_debug_compression_size = false;
+
+    Algorithm m_algorithm = Algorithm::LZ4;
+    int       m_level = 1;
+    size_t    m_maxSize = 268435456;
+
+    // Reused for all the messages of the connection
+    std::vector<char> m_buffer;
+    std::vector<char> m_lz4State;
+
+    // Dictionary training and transmission
+    bool                m_useDictionary = false;
+    size_t              m_dictSamples = 100;
+    size_t              m_dictMaxSize = 16384;
+    size_t              m_dictResend = 0;
+    size_t              m_sinceDictSent = 0;
+    unsigned int        m_dictId = 0;
+    std::vector<char>   m_dict;
+    std::vector<char>   m_samples;
+    std::vector<size_t> m_sampleSizes;
+
+#ifdef YARP_HAS_ZSTD
+    ZSTD_CCtx_s*  m_cctx = nullptr;
+    ZSTD_DCtx_s*  m_dctx = nullptr;
+    ZSTD_CDict_s* m_cdict = nullptr;
+    ZSTD_DDict_s* m_ddict = nullptr;
+#endif
+};
+
+#endif // YARP_BOTTLE_FAST_COMPRESSION_PORTMONITOR_H
@@ -0,0 +1,223 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2025 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_PORTMONITORS_COMMON_TILEDIMAGE_H
+#define YARP_PORTMONITORS_COMMON_TILEDIMAGE_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Header only helpers shared by the port monitors compressing images in
+// independent tiles.
+// Everything is defined inline, since the port monitors are linked in the
+// same library.
+
+/**
+ * Rectangular region of an image, in pixels.
+ */
+struct ImageTile
+{
+    size_t x {0};
+    size_t y {0};
+    size_t width {0};
+    size_t height {0};
+};
+
+/**
+ * Split an image of @p width x @p height pixels in tiles of at most
+ * @p tileSize x @p tileSize pixels, row by row.
+ */
+inline std::vector<ImageTile> splitInTiles(size_t width, size_t height, size_t tileSize)
+{
+    std::vector<ImageTile> tiles;
+    if (tileSize == 0) {
+        tileSize = std::max(width, height);
+    }
+    for (size_t y = 0; y < height; y += tileSize) {
+        for (size_t x = 0; x < width; x += tileSize) {
+            tiles.push_back({x, y, std::min(tileSize, width - x), std::min(tileSize, height - y)});
+        }
+    }
+    return tiles;
+}
+
+/**
+ * Check whether a tile has the same content in two images with the same row
+ * size.
+ */
+inline bool isTileEqual(const unsigned char* a, const unsigned char* b, size_t rowSize, size_t pixelSize, const ImageTile& tile)
+{
+    const size_t offset = tile.y * rowSize + tile.x * pixelSize;
+    const size_t length = tile.width * pixelSize;
+    for (size_t r = 0; r < tile.height; ++r) {
+        if (std::memcmp(a + offset + r * rowSize, b + offset + r * rowSize, length) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Copy a tile between two images with the same row size.
+ */
+inline void copyTile(unsigned char* dst, const unsigned char* src, size_t rowSize, size_t pixelSize, const ImageTile& tile)
+{
+    const size_t offset = tile.y * rowSize + tile.x * pixelSize;
+    const size_t length = tile.width * pixelSize;
+    for (size_t r = 0; r < tile.height; ++r) {
+        std::memcpy(dst + offset + r * rowSize, src + offset + r * rowSize, length);
+    }
+}
+
+/**
+ * Fixed set of threads running the jobs of the port monitor connections.
+ *
+ * All the connections share the pool returned by instance(), whose threads
+ * are started the first time it is used, and wait for the next call to run().
+ * Several connections can call run() at the same time: their jobs are queued,
+ * and the thread calling run() processes its own job as well, so that it never
+ * waits for a free worker.
+ */
+class TileWorkerPool
+{
+public:
+    /**
+     * The pool shared by all the connections, with one thread for each core.
+     */
+    static TileWorkerPool& instance()
+    {
+        static TileWorkerPool pool;
+        return pool;
+    }
+
+    /**
+     * @param threads total number of threads processing the jobs, including
+     *                the thread calling run(). 0 uses one thread for each
+     *                core.
+     */
+    explicit TileWorkerPool(size_t threads = 0)
+    {
+        if (threads == 0) {
+            threads = std::max(1U, std::thread::hardware_concurrency());
+        }
+        for (size_t i = 1; i < threads; ++i) {
+            m_threads.emplace_back(&TileWorkerPool::work, this);
+        }
+    }
+
+    ~TileWorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_start.notify_all();
+        for (auto& t : m_threads) {
+            t.join();
+        }
+    }
+
+    TileWorkerPool(const TileWorkerPool&) = delete;
+    TileWorkerPool& operator=(const TileWorkerPool&) = delete;
+
+    size_t size() const
+    {
+        return m_threads.size() + 1;
+    }
+
+    /**
+     * Call @p job for each index in [0, count), and wait for all of them to
+     * return.
+     * @param maxThreads maximum number of threads processing the job,
+     *                   including the calling thread. 0 uses all the threads
+     *                   of the pool.
+     */
+    void run(size_t count, const std::function<void(size_t)>& job, size_t maxThreads = 0)
+    {
+        size_t helpers = std::min(m_threads.size(), count > 0 ? count - 1 : 0);
+        if (maxThreads > 0) {
+            helpers = std::min(helpers, maxThreads - 1);
+        }
+        if (helpers == 0) {
+            for (size_t i = 0; i < count; ++i) {
+                job(i);
+            }
+            return;
+        }
+
+        Batch batch;
+        batch.job = &job;
+        batch.count = count;
+        batch.helpers = helpers;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.push_back(&batch);
+        }
+        m_start.notify_all();
+        process(batch);
+
+        // The workers that did not join the batch yet will not find any index
+        // left to process
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_queue.erase(std::remove(m_queue.begin(), m_queue.end(), &batch), m_queue.end());
+        batch.done.wait(lock, [&batch] { return batch.busy == 0; });
+    }
+
+private:
+    struct Batch
+    {
+        const std::function<void(size_t)>* job {nullptr};
+        size_t count {0};
+        std::atomic<size_t> next {0};
+        size_t helpers {0}; // workers that can still join
+        size_t busy {0};    // workers processing the batch
+        std::condition_variable done;
+    };
+
+    static void process(Batch& batch)
+    {
+        for (size_t i = batch.next++; i < batch.count; i = batch.next++) {
+            (*batch.job)(i);
+        }
+    }
+
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_start.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+            if (m_stop) {
+                return;
+            }
+            Batch* batch = m_queue.front();
+            batch->busy++;
+            if (--batch->helpers == 0) {
+                m_queue.pop_front();
+            }
+            lock.unlock();
+            process(*batch);
+            lock.lock();
+            if (--batch->busy == 0) {
+                batch->done.notify_all();
+            }
+        }
+    }
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_start;
+    std::deque<Batch*> m_queue;
+    bool m_stop {false};
+};
+
+#endif // YARP_PORTMONITORS_COMMON_TILEDIMAGE_H
@@ -11,6 +11,7 @@
 #include <cstring>
 #include <cmath>
 #include <algorithm>
+#include <sstream>
 
 extern "C" {
     #include "zfp.h"
@@ -26,35 +27,79 @@ YARP_LOG_COMPONENT(ZFPMONITOR,
                    yarp::os::Log::LogTypeReserved,
                    yarp::os::Log::printCallback(),
                    nullptr)
+
+constexpr size_t pixelSize = sizeof(float);
+constexpr float tolerance = 1e-3;
+
+enum TileStatus : char
+{
+    TileUnchanged = 0,
+    TileCompressed = 1,
+    TileFailed = 2
+};
+
+void split(const std::string& s, char delim, std::vector<std::string>& elements)
+{
+    std::istringstream iss(s);
+    std::string item;
+    while (std::getline(iss, item, delim))
+    {
+        elements.push_back(item);
+    }
+}
 }
 
 
 bool ZfpMonitorObject::create(const yarp::os::Property& options)
 {
     shouldCompress = (options.find("sender_side").asBool());
-    compressed = nullptr;
-    decompressed = nullptr;
-    buffer = nullptr;
-    sizeToAllocate = 0;
-    sizeToAllocateB = 0;
+
+    //parse the user parameters
+    yarp::os::Property user_params;
+    std::string str = options.find("carrier").asString();
+    getParamsFromCommandLine(str, user_params);
+
+    if (user_params.check("tile_size")) {
+        // zfp compresses blocks of 4x4 values
+        tileSize = std::max(16, user_params.find("tile_size").asInt32() / 4 * 4);
+    }
+    skipUnchanged = user_params.check("skip_unchanged") && user_params.find("skip_unchanged").asBool();
+    if (user_params.check("keyframe_interval")) {
+        keyframeInterval = std::max(0, user_params.find("keyframe_interval").asInt32());
+    }
+    threads = std::max(0, user_params.check("threads", Value(0)).asInt32());
+
     return true;
 }
 
 void ZfpMonitorObject::destroy()
 {
-    if(compressed){
-        free(compressed);
-        compressed = nullptr;
-    }
+    tileBuffers.clear();
+    reference.clear();
+}
 
-    if(buffer){
-        free(buffer);
-        buffer = nullptr;
-    }
+void ZfpMonitorObject::getParamsFromCommandLine(std::string carrierString, yarp::os::Property& prop)
+{
+    // Split command line string using '+' delimiter
+    std::vector<std::string> parameters;
+    split(carrierString, '+', parameters);
+
+    // Iterate over result strings
+    for (std::string param : parameters) {
+        // If there is no '.', then the param is bad formatted, skip it.
+        auto pointPosition = param.find('.');
+        if (pointPosition == std::string::npos) {
+            continue;
+        }
+
+        // Otherwise, separate key and value
+        std::string paramKey = param.substr(0, pointPosition);
+        yarp::os::Value paramValue;
+        std::string s = param.substr(pointPosition + 1, param.length());
+        paramValue.fromString(s.c_str());
 
-    if(decompressed){
-        free(decompressed);
-        decompressed = nullptr;
+        // and append to the returned property
+        prop.put(paramKey, paramValue);
     }
 }
 
@@ -95,19 +140,62 @@ yarp::os::Things& ZfpMonitorObject::update(yarp::os::Things& thing)
 
    if(shouldCompress) {
         ImageOf<PixelFloat>* img = thing.cast_as< ImageOf<PixelFloat> >();
-        // .... buffer, len
-        int sizeCompressed;
-        compress((float*)img->getRawImage(), compressed, sizeCompressed, img->width(),img->height(),1e-3);
-        if(!compressed){
-            yCError(ZFPMONITOR, "Failed to compress, exiting...");
-            return thing;
+
+        size_t w = img->width();
+        size_t h = img->height();
+        size_t rowSize = img->getRowSize();
+        const unsigned char* image = img->getRawImage();
+
+        bool keyframe = !skipUnchanged || sinceKeyframe == 0;
+        if (w != width || h != height || reference.size() != rowSize * h) {
+            width = w;
+            height = h;
+            tiles = splitInTiles(w, h, tileSize);
+            tileBuffers.resize(tiles.size());
+            tileSizes.resize(tiles.size());
+            tileStatus.resize(tiles.size());
+            reference.assign(skipUnchanged ? rowSize * h : 0, 0);
+            keyframe = true;
+        }
+
+        // The tiles are compressed directly from the image, using its row size
+        // as stride
+        TileWorkerPool::instance().run(tiles.size(), [&](size_t i) {
+            const ImageTile& tile = tiles[i];
+            if (!keyframe && isTileEqual(image, reference.data(), rowSize, pixelSize, tile)) {
+                tileStatus[i] = TileUnchanged;
+                return;
+            }
+            if (skipUnchanged) {
+                copyTile(reference.data(), image, rowSize, pixelSize, tile);
+            }
+            const auto* start = reinterpret_cast<const float*>(image + tile.y * rowSize + tile.x * pixelSize);
+            int status = compress(start, tileBuffers[i], tileSizes[i], tile.width, tile.height, rowSize / pixelSize, tolerance);
+            tileStatus[i] = (status == 0) ? TileCompressed : TileFailed;
+        }, threads);
+
+        if (skipUnchanged) {
+            sinceKeyframe = (keyframeInterval > 0) ? (sinceKeyframe + 1) % keyframeInterval : 1;
         }
+
         data.clear();
-        data.addInt32(img->width());
-        data.addInt32(img->height());
-        data.addInt32(sizeCompressed);
-        Value v(compressed, sizeCompressed);
-        data.add(v);
+        data.addInt32(w);
+        data.addInt32(h);
+        data.addInt32(tileSize);
+        Bottle& compressedTiles = data.addList();
+        for (size_t i = 0; i < tiles.size(); ++i) {
+            if (tileStatus[i] == TileFailed) {
+                yCError(ZFPMONITOR, "Failed to compress, exiting...");
+                // Send all the tiles again with the next image
+                sinceKeyframe = 0;
+                return thing;
+            }
+            if (tileStatus[i] == TileUnchanged) {
+                compressedTiles.addInt32(0);
+            } else {
+                compressedTiles.add(Value(tileBuffers[i].data(), tileSizes[i]));
+            }
+        }
         th.setPortWriter(&data);
    }
    else
@@ -115,18 +203,45 @@ yarp::os::Things& ZfpMonitorObject::update(yarp::os::Things& thing)
 
        Bottle* compressedbt= thing.cast_as<Bottle>();
 
-       int width=compressedbt->get(0).asInt32();
-       int height=compressedbt->get(1).asInt32();
-       int sizeCompressed=compressedbt->get(2).asInt32();
-       // cast thing to compressed.
-       decompress((float*)compressedbt->get(3).asBlob(), decompressed, sizeCompressed, width, height,1e-3);
+       size_t w = compressedbt->get(0).asInt32();
+       size_t h = compressedbt->get(1).asInt32();
+       size_t size = compressedbt->get(2).asInt32();
+       Bottle* compressedTiles = compressedbt->get(3).asList();
+
+       if (w != width || h != height || size != tileSize) {
+           width = w;
+           height = h;
+           tileSize = size;
+           tiles = splitInTiles(w, h, tileSize);
+           tileStatus.resize(tiles.size());
+           imageOut.resize(w, h);
+           imageOut.zero();
+       }
+       if (compressedTiles == nullptr || compressedTiles->size() != tiles.size()) {
+           yCError(ZFPMONITOR, "Invalid data received: wrong number of tiles?");
+           return thing;
+       }
 
-       if(!decompressed){
+       // The tiles are decompressed directly in the image
+       size_t rowSize = imageOut.getRowSize();
+       unsigned char* image = imageOut.getRawImage();
+       TileWorkerPool::instance().run(tiles.size(), [&](size_t i) {
+           const Value& v = compressedTiles->get(i);
+           if (!v.isBlob()) {
+               // unchanged since the previous image
+               tileStatus[i] = TileUnchanged;
+               return;
+           }
+           const ImageTile& tile = tiles[i];
+           auto* start = reinterpret_cast<float*>(image + tile.y * rowSize + tile.x * pixelSize);
+           int status = decompress(reinterpret_cast<const unsigned char*>(v.asBlob()), start, v.asBlobLength(), tile.width, tile.height, rowSize / pixelSize, tolerance);
+           tileStatus[i] = (status == 0) ? TileCompressed : TileFailed;
+       }, threads);
+
+       if (std::find(tileStatus.begin(), tileStatus.end(), TileFailed) != tileStatus.end()) {
            yCError(ZFPMONITOR, "Failed to decompress, exiting...");
            return thing;
        }
-       imageOut.resize(width,height);
-       memcpy(imageOut.getRawImage(),decompressed,width*height*4);
        th.setPortWriter(&imageOut);
 
    }
@@ -134,26 +249,7 @@ yarp::os::Things& ZfpMonitorObject::update(yarp::os::Things& thing)
     return th;
 }
 
-void ZfpMonitorObject::resizeF(float *&array, int newSize){
-    if(newSize>sizeToAllocate){
-        sizeToAllocate=newSize;
-        free(array);
-        array=(float*) malloc(sizeToAllocate);
-    }
-
-
-}
-void ZfpMonitorObject::resizeV(void *&array, int newSize){
-    if(newSize>sizeToAllocateB){
-        sizeToAllocateB=newSize;
-        free(array);
-        array=(void*) malloc(sizeToAllocateB);
-    }
-
-
-}
-
-int ZfpMonitorObject::compress(float* array, float* &compressed, int &zfpsize, int nx, int ny, float tolerance){
+int ZfpMonitorObject::compress(const float* array, std::vector<unsigned char>& compressed, size_t& zfpsize, int nx, int ny, int stride, float tolerance){
     int status = 0;    /* return value: 0 = success */
     zfp_type type;     /* array scalar type */
     zfp_field* field;  /* array meta data */
@@ -162,7 +258,8 @@ int ZfpMonitorObject::compress(float* array, float* &compressed, int &zfpsize, i
     bitstream* stream; /* bit stream to write to or read from */
 
     type = zfp_type_float;
-    field = zfp_field_2d(array, type, nx, ny);
+    field = zfp_field_2d(const_cast<float*>(array), type, nx, ny);
+    zfp_field_set_stride_2d(field, 1, stride);
 
     /* allocate meta data for a compressed stream */
     zfp = zfp_stream_open(nullptr);
@@ -172,17 +269,17 @@ int ZfpMonitorObject::compress(float* array, float* &compressed, int &zfpsize, i
     /*  zfp_stream_set_precision(zfp, precision); */
     zfp_stream_set_accuracy(zfp, tolerance);
 
-    /* allocate buffer for compressed data */
+    /* the buffer for compressed data only grows */
     bufsize = zfp_stream_maximum_size(zfp, field);
+    if (compressed.size() < bufsize) {
+        compressed.resize(bufsize);
+    }
 
-    resizeV(buffer,bufsize);
-
-    /* associate bit stream with allocated buffer */
-    stream = stream_open(buffer, bufsize);
+    /* associate bit stream with the buffer */
+    stream = stream_open(compressed.data(), compressed.size());
     zfp_stream_set_bit_stream(zfp, stream);
     zfp_stream_rewind(zfp);
 
-    /* compress entire array */
     /* compress array and output compressed stream */
     zfpsize = zfp_compress(zfp, field);
     if (!zfpsize) {
@@ -190,9 +287,6 @@ int ZfpMonitorObject::compress(float* array, float* &compressed, int &zfpsize, i
       status = 1;
     }
 
-    resizeF(compressed,zfpsize);
-    memcpy(compressed,(float*) stream_data(zfp->stream),zfpsize);
-
     /* clean up */
     zfp_field_free(field);
     zfp_stream_close(zfp);
@@ -201,17 +295,16 @@ int ZfpMonitorObject::compress(float* array, float* &compressed, int &zfpsize, i
     return status;
 }
 
-int ZfpMonitorObject::decompress(float* array, float* &decompressed, int zfpsize, int nx, int ny, float tolerance){
+int ZfpMonitorObject::decompress(const unsigned char* array, float* decompressed, size_t zfpsize, int nx, int ny, int stride, float tolerance){
     int status = 0;    /* return value: 0 = success */
     zfp_type type;     /* array scalar type */
     zfp_field* field;  /* array meta data */
     zfp_stream* zfp;   /* compressed stream */
-    size_t bufsize;    /* byte size of compressed buffer */
     bitstream* stream; /* bit stream to write to or read from */
 
     type = zfp_type_float;
-    resizeF(decompressed,nx*ny*sizeof(float));
     field = zfp_field_2d(decompressed, type, nx, ny);
+    zfp_field_set_stride_2d(field, 1, stride);
 
     /* allocate meta data for a compressed stream */
     zfp = zfp_stream_open(nullptr);
@@ -221,13 +314,8 @@ int ZfpMonitorObject::decompress(float* array, float* &decompressed, int zfpsize
     /*  zfp_stream_set_precision(zfp, precision, type); */
     zfp_stream_set_accuracy(zfp, tolerance);
 
-    /* allocate buffer for compressed data */
-    bufsize = zfp_stream_maximum_size(zfp, field);
-    resizeV(buffer,bufsize);
-    memcpy(buffer,array,zfpsize);
-
-    /* associate bit stream with allocated buffer */
-    stream = stream_open(buffer, zfpsize);
+    /* the bit stream is only read, the received data is used directly */
+    stream = stream_open(const_cast<unsigned char*>(array), zfpsize);
     zfp_stream_set_bit_stream(zfp, stream);
     zfp_stream_rewind(zfp);
 
@@ -11,10 +11,28 @@
 #include <yarp/sig/Image.h>
 #include <yarp/os/MonitorObject.h>
 
+#include <TiledImage.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
  /**
   * @ingroup portmonitors_lists
   * \brief `ZfpMonitorObject`: Portmonitor plugin for compression and decompression of floating point values using zfp library.
   *
+  * The image is split in tiles, that are compressed independently by a pool
+  * of threads shared by all the connections.
+  * Optionally, the tiles that did not change since the previous image are
+  * not sent.
+  *
+  * Parameters (sender side):
+  * - `tile_size.<n>`: size of the square tiles in pixels (default 256)
+  * - `threads.<n>`: maximum number of threads used by the connection (default one for each core)
+  * - `skip_unchanged.1`: do not send the tiles that did not change
+  * - `keyframe_interval.<n>`: send all the tiles every `n` images when
+  *   skipping the unchanged ones (default 30, 0 only sends the first image)
+  *
   */
 class ZfpMonitorObject : public yarp::os::MonitorObject
 {
@@ -28,20 +46,29 @@ public:
     bool accept(yarp::os::Things& thing) override;
     yarp::os::Things& update(yarp::os::Things& thing) override;
 protected:
-    int compress(float* array, float* &compressed, int &zfpsize, int nx, int ny, float tolerance);
-    int decompress(float* array, float* &decompressed, int zfpsize, int nx, int ny, float tolerance);
-    void resizeF(float* &array, int newSize);
-    void resizeV(void* &array, int newSize);
+    int compress(const float* array, std::vector<unsigned char>& compressed, size_t& zfpsize, int nx, int ny, int stride, float tolerance);
+    int decompress(const unsigned char* array, float* decompressed, size_t zfpsize, int nx, int ny, int stride, float tolerance);
 private:
+    void getParamsFromCommandLine(std::string carrierString, yarp::os::Property& prop);
+
     yarp::os::Things th;
     yarp::os::Bottle data;
     yarp::sig::ImageOf<yarp::sig::PixelFloat> imageOut;
     bool shouldCompress;
-    void  *buffer;
-    float *compressed;
-    float *decompressed;
-    int sizeToAllocate;
-    int sizeToAllocateB;
+
+    // Tiling, the buffers are reused for all the images of the connection
+    size_t tileSize = 256;
+    bool skipUnchanged = false;
+    size_t keyframeInterval = 30;
+    size_t sinceKeyframe = 0;
+    size_t width = 0;
+    size_t height = 0;
+    std::vector<ImageTile> tiles;
+    std::vector<std::vector<unsigned char>> tileBuffers;
+    std::vector<size_t> tileSizes;
+    std::vector<char> tileStatus;
+    std::vector<unsigned char> reference;
+    size_t threads = 0; // threads used from the shared pool, 0 = all
 };
 
 #endif
@@ -12,6 +12,7 @@
 #include <cstring>
 #include <cmath>
 #include <algorithm>
+#include <sstream>
 
 #include <zlib.h>
 
@@ -25,17 +26,82 @@ YARP_LOG_COMPONENT(DEPTHIMAGE_ZLIB_MONITOR,
                    yarp::os::Log::LogTypeReserved,
                    yarp::os::Log::printCallback(),
                    nullptr)
+
+constexpr size_t pixelSize = sizeof(float);
+
+enum TileStatus : char
+{
+    TileUnchanged = 0,
+    TileCompressed = 1,
+    TileFailed = 2
+};
+
+void split(const std::string& s, char delim, std::vector<std::string>& elements)
+{
+    std::istringstream iss(s);
+    std::string item;
+    while (std::getline(iss, item, delim))
+    {
+        elements.push_back(item);
+    }
 }
+} //anonymous namespace
 
 
 bool DepthImageZlibMonitorObject::create(const yarp::os::Property& options)
 {
     m_shouldCompress = (options.find("sender_side").asBool());
+
+    //parse the user parameters
+    yarp::os::Property m_user_params;
+    std::string str = options.find("carrier").asString();
+    getParamsFromCommandLine(str, m_user_params);
+
+    if (m_user_params.check("tile_size")) {
+        m_tileSize = std::max(16, m_user_params.find("tile_size").asInt32());
+    }
+    if (m_user_params.check("level")) {
+        m_level = std::clamp(m_user_params.find("level").asInt32(), 0, 9);
+    }
+    m_skipUnchanged = m_user_params.check("skip_unchanged") && m_user_params.find("skip_unchanged").asBool();
+    if (m_user_params.check("keyframe_interval")) {
+        m_keyframeInterval = std::max(0, m_user_params.find("keyframe_interval").asInt32());
+    }
+    m_threads = std::max(0, m_user_params.check("threads", Value(0)).asInt32());
+
     return true;
 }
 
 void DepthImageZlibMonitorObject::destroy()
 {
+    m_tileInput.clear();
+    m_tileOutput.clear();
+    m_reference.clear();
+}
+
+void DepthImageZlibMonitorObject::getParamsFromCommandLine(std::string carrierString, yarp::os::Property& prop)
+{
+    // Split command line string using '+' delimiter
+    std::vector<std::string> parameters;
+    split(carrierString, '+', parameters);
+
+    // Iterate over result strings
+    for (std::string param : parameters) {
+        // If there is no '.', then the param is bad formatted, skip it.
+        auto pointPosition = param.find('.');
+        if (pointPosition == std::string::npos) {
+            continue;
+        }
+
+        // Otherwise, separate key and value
+        std::string paramKey = param.substr(0, pointPosition);
+        yarp::os::Value paramValue;
+        std::string s = param.substr(pointPosition + 1, param.length());
+        paramValue.fromString(s.c_str());
+
+        // and append to the returned property
+        prop.put(paramKey, paramValue);
+    }
 }
 
 bool DepthImageZlibMonitorObject::setparam(const yarp::os::Property& params)
@@ -78,33 +144,78 @@ yarp::os::Things& DepthImageZlibMonitorObject::update(yarp::os::Things& thing)
    if(m_shouldCompress)
    {
         //sender side / compressor
-       //it receives an image, it sends a bottle to the network
+        //it receives an image, it sends a bottle to the network
         auto* b = thing.cast_as<ImageOf<PixelFloat>>();
 
-        size_t sizeUncompressed= b->getRawImageSize();
-        const unsigned char* uncompressedData = b->getRawImage();
+        size_t w = b->width();
+        size_t h = b->height();
+        size_t rowSize = b->getRowSize();
+        const unsigned char* image = b->getRawImage();
 
-        size_t sizeCompressed = (sizeUncompressed * 1.1) + 12;
-        unsigned char* compressedData = (unsigned char*) malloc (sizeCompressed);
-
-        bool ret= compressData(uncompressedData, sizeUncompressed, compressedData, sizeCompressed);
-        if(!ret)
+        bool keyframe = !m_skipUnchanged || m_sinceKeyframe == 0;
+        if (w != m_width || h != m_height || m_reference.size() != rowSize * h)
         {
-            yCError(DEPTHIMAGE_ZLIB_MONITOR, "Failed to compress, exiting...");
-            free(compressedData);
-            return thing;
+            m_width = w;
+            m_height = h;
+            m_tiles = splitInTiles(w, h, m_tileSize);
+            m_tileInput.resize(m_tiles.size());
+            m_tileOutput.resize(m_tiles.size());
+            m_tileSizes.resize(m_tiles.size());
+            m_tileStatus.resize(m_tiles.size());
+            m_reference.assign(m_skipUnchanged ? rowSize * h : 0, 0);
+            keyframe = true;
+        }
+
+        TileWorkerPool::instance().run(m_tiles.size(), [&](size_t i) {
+            const ImageTile& tile = m_tiles[i];
+            if (!keyframe && isTileEqual(image, m_reference.data(), rowSize, pixelSize, tile)) {
+                m_tileStatus[i] = TileUnchanged;
+                return;
+            }
+            if (m_skipUnchanged) {
+                copyTile(m_reference.data(), image, rowSize, pixelSize, tile);
+            }
+
+            // zlib needs the tile in contiguous memory
+            std::vector<unsigned char>& in = m_tileInput[i];
+            in.resize(tile.width * tile.height * pixelSize);
+            for (size_t r = 0; r < tile.height; ++r) {
+                memcpy(in.data() + r * tile.width * pixelSize,
+                       image + (tile.y + r) * rowSize + tile.x * pixelSize,
+                       tile.width * pixelSize);
+            }
+
+            std::vector<unsigned char>& out = m_tileOutput[i];
+            out.resize(compressBound(in.size()));
+            m_tileSizes[i] = out.size();
+            m_tileStatus[i] = compressData(in.data(), in.size(), out.data(), m_tileSizes[i]) ? TileCompressed : TileFailed;
+        }, m_threads);
+
+        if (m_skipUnchanged) {
+            m_sinceKeyframe = (m_keyframeInterval > 0) ? (m_sinceKeyframe + 1) % m_keyframeInterval : 1;
         }
 
         m_data.clear();
-        Value v(compressedData, sizeCompressed);
-        m_data.addInt32(b->width());
-        m_data.addInt32(b->height());
-        m_data.addInt32(sizeCompressed);
-        m_data.addInt32(sizeUncompressed);
-        m_data.add(v);
+        m_data.addInt32(w);
+        m_data.addInt32(h);
+        m_data.addInt32(m_tileSize);
+        Bottle& tiles = m_data.addList();
+        for (size_t i = 0; i < m_tiles.size(); ++i)
+        {
+            if (m_tileStatus[i] == TileFailed)
+            {
+                yCError(DEPTHIMAGE_ZLIB_MONITOR, "Failed to compress, exiting...");
+                // Send all the tiles again with the next image
+                m_sinceKeyframe = 0;
+                return thing;
+            }
+            if (m_tileStatus[i] == TileUnchanged) {
+                tiles.addInt32(0);
+            } else {
+                tiles.add(Value(m_tileOutput[i].data(), m_tileSizes[i]));
+            }
+        }
         m_th.setPortWriter(&m_data);
-
-        free(compressedData);
    }
    else
    {
@@ -114,33 +225,58 @@ yarp::os::Things& DepthImageZlibMonitorObject::update(yarp::os::Things& thing)
 
        size_t w = b->get(0).asInt32();
        size_t h = b->get(1).asInt32();
-       size_t check_sizeCompressed = b->get(2).asInt32();
-       size_t check_sizeUncompressed = b->get(3).asInt32();
-       size_t sizeCompressed=b->get(4).asBlobLength();
-       const unsigned char* CompressedData = (const unsigned char*) b->get(4).asBlob();
-
-       size_t sizeUncompressed = w * h * 4;
-       if (check_sizeUncompressed != sizeUncompressed ||
-           check_sizeCompressed != sizeCompressed)
+       size_t tileSize = b->get(2).asInt32();
+       Bottle* tiles = b->get(3).asList();
+
+       if (w != m_width || h != m_height || tileSize != m_tileSize)
        {
-           yCError(DEPTHIMAGE_ZLIB_MONITOR, "Invalid data received: wrong blob size?");
+           m_width = w;
+           m_height = h;
+           m_tileSize = tileSize;
+           m_tiles = splitInTiles(w, h, tileSize);
+           m_tileInput.resize(m_tiles.size());
+           m_tileStatus.resize(m_tiles.size());
+           m_imageOut.resize(w, h);
+           m_imageOut.zero();
+       }
+       if (tiles == nullptr || tiles->size() != m_tiles.size())
+       {
+           yCError(DEPTHIMAGE_ZLIB_MONITOR, "Invalid data received: wrong number of tiles?");
            return thing;
        }
-       unsigned char* uncompressedData = (unsigned char*)malloc(sizeUncompressed);
 
-       bool ret = decompressData(CompressedData, sizeCompressed, uncompressedData, sizeUncompressed);
-       if(!ret)
+       size_t rowSize = m_imageOut.getRowSize();
+       unsigned char* image = m_imageOut.getRawImage();
+       TileWorkerPool::instance().run(m_tiles.size(), [&](size_t i) {
+           const Value& v = tiles->get(i);
+           if (!v.isBlob()) {
+               // unchanged since the previous image
+               m_tileStatus[i] = TileUnchanged;
+               return;
+           }
+           const ImageTile& tile = m_tiles[i];
+           std::vector<unsigned char>& out = m_tileInput[i];
+           size_t sizeUncompressed = tile.width * tile.height * pixelSize;
+           out.resize(sizeUncompressed);
+           if (!decompressData(reinterpret_cast<const unsigned char*>(v.asBlob()), v.asBlobLength(), out.data(), sizeUncompressed) ||
+               sizeUncompressed != out.size()) {
+               m_tileStatus[i] = TileFailed;
+               return;
+           }
+           for (size_t r = 0; r < tile.height; ++r) {
+               memcpy(image + (tile.y + r) * rowSize + tile.x * pixelSize,
+                      out.data() + r * tile.width * pixelSize,
+                      tile.width * pixelSize);
+           }
+           m_tileStatus[i] = TileCompressed;
+       }, m_threads);
+
+       if (std::find(m_tileStatus.begin(), m_tileStatus.end(), TileFailed) != m_tileStatus.end())
        {
            yCError(DEPTHIMAGE_ZLIB_MONITOR, "Failed to decompress, exiting...");
-           free(uncompressedData);
            return thing;
        }
-
-       m_imageOut.resize(w, h);
-       memcpy(m_imageOut.getRawImage(), uncompressedData, sizeUncompressed);
        m_th.setPortWriter(&m_imageOut);
-
-       free(uncompressedData);
    }
 
     return m_th;
@@ -148,7 +284,9 @@ yarp::os::Things& DepthImageZlibMonitorObject::update(yarp::os::Things& thing)
 
 int DepthImageZlibMonitorObject::compressData(const unsigned char* in, const size_t& in_size, unsigned char* out, size_t& out_size)
 {
-    int z_result = compress((Bytef*)out, (uLongf*)&out_size, (Bytef*)in, in_size);
+    uLongf size = out_size;
+    int z_result = compress2((Bytef*)out, &size, (const Bytef*)in, in_size, m_level);
+    out_size = size;
     switch (z_result)
     {
     case Z_OK:
@@ -170,7 +308,9 @@ int DepthImageZlibMonitorObject::compressData(const unsigned char* in, const siz
 
 int DepthImageZlibMonitorObject::decompressData(const unsigned char* in, const size_t& in_size, unsigned char* out, size_t& out_size)
 {
-    int z_result = uncompress((Bytef*)out, (uLongf*)&out_size, (const Bytef*)in, in_size);
+    uLongf size = out_size;
+    int z_result = uncompress((Bytef*)out, &size, (const Bytef*)in, in_size);
+    out_size = size;
     switch (z_result)
     {
     case Z_OK:
@@ -11,11 +11,32 @@
 #include <yarp/sig/Image.h>
 #include <yarp/os/MonitorObject.h>
 
+#include <TiledImage.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
  /**
   * @ingroup portmonitors_lists
   * \brief `depthimage_compression_zlib_portmonitor`: Portmonitor plugin for compression and decompression of depth images using zlib library.
+  *
+  * The image is split in tiles, that are compressed independently by a pool
+  * of threads shared by all the connections.
+  * Optionally, the tiles that did not change since the previous image are
+  * not sent.
+  *
+  * Parameters (sender side):
+  * - `tile_size.<n>`: size of the square tiles in pixels (default 256)
+  * - `threads.<n>`: maximum number of threads used by the connection (default one for each core)
+  * - `level.<n>`: zlib compression level (default 6)
+  * - `skip_unchanged.1`: do not send the tiles that did not change
+  * - `keyframe_interval.<n>`: send all the tiles every `n` images when
+  *   skipping the unchanged ones (default 30, 0 only sends the first image)
+  *
   * Example usage:
   * yarp connect /depthCamera/depthImage:o /view tcp+send.portmonitor+file.depthimage_compression_zlib+recv.portmonitor+file.depthimage_compression_zlib+type.dll
+  * yarp connect /depthCamera/depthImage:o /view tcp+send.portmonitor+file.depthimage_compression_zlib+recv.portmonitor+file.depthimage_compression_zlib+type.dll+skip_unchanged.1
   */
 class DepthImageZlibMonitorObject : public yarp::os::MonitorObject
 {
@@ -34,10 +55,28 @@ protected:
     int decompressData(const unsigned char* in, const size_t& in_size, unsigned char* out, size_t& out_size);
 
 private:
+    void getParamsFromCommandLine(std::string carrierString, yarp::os::Property& prop);
+
     yarp::os::Things m_th;
     yarp::os::Bottle m_data;
     bool             m_shouldCompress;
     yarp::sig::ImageOf<yarp::sig::PixelFloat> m_imageOut;
+
+    // Tiling, the buffers are reused for all the images of the connection
+    size_t                          m_tileSize = 256;
+    int                             m_level = 6;
+    bool                            m_skipUnchanged = false;
+    size_t                          m_keyframeInterval = 30;
+    size_t                          m_sinceKeyframe = 0;
+    size_t                          m_width = 0;
+    size_t                          m_height = 0;
+    std::vector<ImageTile>          m_tiles;
+    std::vector<std::vector<unsigned char>> m_tileInput;
+    std::vector<std::vector<unsigned char>> m_tileOutput;
+    std::vector<size_t>             m_tileSizes;
+    std::vector<char>               m_tileStatus;
+    std::vector<unsigned char>      m_reference;
+    size_t                          m_threads = 0; // threads used from the shared pool, 0 = all
 };
 
 #endif
@@ -87,6 +87,24 @@ static const std::string FFMPEGPORTMONITOR_CL_FRAME_RATE_KEY = "frame_rate";
  */
 static const std::string FFMPEGPORTMONITOR_CL_PRINT_STATISTICS_KEY = "print_statistics";
 
+/**
+ * @brief This string is the "key" value for the group of pictures size parameter
+ *
+ */
+static const std::string FFMPEGPORTMONITOR_CL_GOP_SIZE_KEY = "gop_size";
+
+/**
+ * @brief This string is the "key" value for the maximum number of B-frames parameter
+ *
+ */
+static const std::string FFMPEGPORTMONITOR_CL_MAX_B_FRAMES_KEY = "max_b_frames";
+
+/**
+ * @brief This string is the "key" value to enable the low latency tuning of the codec
+ *
+ */
+static const std::string FFMPEGPORTMONITOR_CL_LOW_LATENCY_KEY = "low_latency";
+
 /**
  * @brief This vector contains the codec ids corresponding to the codecs of the FFMPEGPORTMONITOR_CL_CODECS vector.
  *
@@ -33,6 +33,7 @@ extern "C" {
     #include <libavcodec/avcodec.h>
     #include <libavutil/opt.h>
     #include <libavutil/imgutils.h>
+    #include <libavutil/pixdesc.h>
     #include <libavformat/avformat.h>
     #include <libswscale/swscale.h>
 }
@@ -78,7 +79,6 @@ bool FfmpegMonitorObject::create(const yarp::os::Property& options)
 
     // Parse command line parameters and set them into global variable "paramsMap"
     std::string str = options.find("carrier").asString();
-    int frameRate = 15;
     if (!getParamsFromCommandLine(str, codec, pixelFormat, frameRate)) {
         return false;
     }
@@ -151,12 +151,20 @@ bool FfmpegMonitorObject::create(const yarp::os::Property& options)
     }
 
     firstTime = true;
+    waitingKeyFrame = true;
+    nextPts = 0;
 
-    // Set time base parameter
-    codecContext->time_base.num = 1;
-    codecContext->time_base.den = frameRate;
-    // Set command line params
-    if (setCommandLineParams() == -1) {
+    // Set codec parameters
+    if (configureCodecContext() == -1) {
+        return false;
+    }
+
+    // Allocate the frames and the packet, that are reused for all the images
+    codecFrame = av_frame_alloc();
+    decodedFrame = av_frame_alloc();
+    packet = av_packet_alloc();
+    if (codecFrame == NULL || decodedFrame == NULL || packet == NULL) {
+        yCError(FFMPEGMONITOR, "Cannot allocate frames and packet!");
         return false;
     }
 
@@ -167,6 +175,16 @@ void FfmpegMonitorObject::destroy(void)
 {
     paramsMap.clear();
 
+    {
+        std::lock_guard<std::mutex> lock(instances_mutex);
+        sws_freeContext(swsContext);
+        swsContext = NULL;
+    }
+
+    av_frame_free(&codecFrame);
+    av_frame_free(&decodedFrame);
+    av_packet_free(&packet);
+
     // Check if codec context is freeable, if yes free it.
     if (codecContext != NULL) {
 #if LIBAVCODEC_VERSION_MAJOR < 61
@@ -217,6 +235,23 @@ bool FfmpegMonitorObject::accept(yarp::os::Things& thing)
             yCError(FFMPEGMONITOR, "Expected type Bottle in receiver side, but got wrong data type!");
             return false;
         }
+
+        // The packets are decoded here, since the decoder might need more
+        // packets before returning a frame, and in that case there is no
+        // image to deliver.
+        double startTime = yarp::os::Time::now();
+        int ret = decompress(*bt);
+        if (ret < 0) {
+            yCError(FFMPEGMONITOR, "Error in decompression");
+            return false;
+        }
+
+        if (printStatistics)
+        {
+            updateStatistics(*bt, yarp::os::Time::now() - startTime);
+        }
+
+        return ret == 1;
     }
     return true;
 }
@@ -275,19 +310,6 @@ yarp::os::Things& FfmpegMonitorObject::update(yarp::os::Things& thing)
             img = &imageBottleBuffer;
         }
 
-        // Allocate memory for packet
-        AVPacket *packet = av_packet_alloc();
-        if (packet == NULL) {
-            yCError(FFMPEGMONITOR, "Error in packet allocation");
-            success = false;
-        }
-
-        // Call compress function
-        if (success && compress(img, packet) != 0) {
-            yCError(FFMPEGMONITOR, "Error in compression");
-            success = false;
-        }
-
         // Insert compressed image into a Bottle to be sent
         data.clear();
 
@@ -298,26 +320,11 @@ yarp::os::Things& FfmpegMonitorObject::update(yarp::os::Things& thing)
         data.addInt32(img->getPixelCode());
         data.addInt32(img->getPixelSize());
 
-        if (success) {  // If compression was successful, insert also compressed data
-            // Packet
-            Value p(packet, sizeof(*packet));
-            data.add(p);
-            // Packet data
-            Value d(packet->data, packet->size);
-            data.add(d);
-            // Buffer size
-            data.addInt32(packet->buf->size);
-            // Buffer data
-            Value bd(packet->buf->data, packet->buf->size);
-            data.add(bd);
-
-            // Side data elements
-            for (int i = 0; i < packet->side_data_elems; i++) {
-                data.addInt32(packet->side_data[i].size);
-                data.addInt32(packet->side_data[i].type);
-                Value sd(packet->side_data[i].data, packet->side_data[i].size);
-                data.add(sd);
-            }
+        // Call compress function, that appends the compressed packets (if any)
+        Bottle& packets = data.addList();
+        if (success && compress(img, packets) != 0) {
+            yCError(FFMPEGMONITOR, "Error in compression");
+            packets.clear();
         }
 
         if (printStatistics)
@@ -326,382 +333,349 @@ yarp::os::Things& FfmpegMonitorObject::update(yarp::os::Things& thing)
         }
 
         th.setPortWriter(&data);
-        // Free the memory allocated for the packet
-        av_packet_unref(packet);
     }
     else {
-
         yCTrace(FFMPEGMONITOR, "update - receiver");
-        // Cast the Thin as a Bottle
-        Bottle* compressedBottle = thing.cast_as<Bottle>();
-        // Fill the final image with zeros
-        imageOut.zero();
-        // Extract decompression data from the Bottle
-        int width = compressedBottle->get(1).asInt32();
-        int height = compressedBottle->get(2).asInt32();
-        int pixelCode = compressedBottle->get(3).asInt32();
-        int pixelSize = compressedBottle->get(4).asInt32();
-        // Set information into final image
-
-        if (pixelCode != VOCAB_PIXEL_INVALID)
-        {
-            imageOut.setPixelCode(pixelCode);
-            imageOut.setPixelSize(pixelSize);
-            imageOut.resize(width, height);
-        }
-        else
-        {
-            yCError(FFMPEGMONITOR, "Invalid input pixel code");
-        }
-
-        // Check if compression was successful
-        if (compressedBottle->get(0).asInt32() == 1) {
-            bool success = true;
-            // Get compressed image from Bottle
-            AVPacket* tmp = (AVPacket*) compressedBottle->get(5).asBlob();
-            // Allocate memory for packet
-            AVPacket* packet = av_packet_alloc();
-            // Set all packet parameters
-            packet->dts = tmp->dts;
-            packet->duration = tmp->duration;
-            packet->flags = tmp->flags;
-            packet->pos = tmp->pos;
-            packet->pts = tmp->pts;
-            packet->side_data_elems = 0;
-            packet->stream_index = tmp->stream_index;
-            packet->size = tmp->size;
-            // Image data
-            packet->data = (uint8_t *) compressedBottle->get(6).asBlob();
-            // Buffer data
-            packet->buf = av_buffer_create((uint8_t *) compressedBottle->get(8).asBlob(),
-                                            compressedBottle->get(7).asInt32(), av_buffer_default_free,
-                                            nullptr, AV_BUFFER_FLAG_READONLY);
-
-            // Packet side data
-            for (int i = 0; i < tmp->side_data_elems; i++) {
-
-                int ret = av_packet_add_side_data(packet,
-                                                    (AVPacketSideDataType) compressedBottle->get(10).asInt32(),     // Type
-                                                    (uint8_t *) compressedBottle->get(11).asBlob(),                 // Data
-                                                    compressedBottle->get(9).asInt32());                            // Size
-                if (ret < 0) {
-                    success = false;
-                    break;
-                }
-            }
+        // The image was already decompressed by the "accept" function
+        th.setPortWriter(&imageOut);
+    }
+    return th;
+}
 
-            // Call to decompress function
-            if (success && decompress(packet, width, height, pixelCode) != 0) {
-                yCError(FFMPEGMONITOR, "Error in decompression");
-            }
+int FfmpegMonitorObject::configureCodecContext()
+{
+    // Set time base parameter
+    codecContext->time_base.num = 1;
+    codecContext->time_base.den = frameRate;
+    codecContext->framerate.num = frameRate;
+    codecContext->framerate.den = 1;
 
-            if (printStatistics)
-            {
-                updateStatistics(*compressedBottle, yarp::os::Time::now() - startTime);
-            }
+    // Set group of pictures parameters
+    if (gopSize >= 0) {
+        codecContext->gop_size = gopSize;
+    }
+    if (maxBFrames >= 0) {
+        codecContext->max_b_frames = maxBFrames;
+    } else if (lowLatency) {
+        // B-frames delay the output of the encoder
+        codecContext->max_b_frames = 0;
+    }
 
-            // Free memory allocated for side data and packet
-            av_freep(&packet->side_data);
-            av_freep(&packet);
+    // Let ffmpeg choose the number of threads. Frame threading delays the
+    // output by one frame for each thread, therefore it is used only when the
+    // latency is not a concern.
+    codecContext->thread_count = 0;
+    codecContext->thread_type = lowLatency ? FF_THREAD_SLICE : (FF_THREAD_FRAME | FF_THREAD_SLICE);
 
+    if (lowLatency) {
+        codecContext->flags |= AV_CODEC_FLAG_LOW_DELAY;
+        if (senderSide && codecContext->priv_data != NULL) {
+            // Supported by libx264 and libx265, ignored by the other encoders
+            av_opt_set(codecContext->priv_data, "tune", "zerolatency", 0);
         }
+    }
 
-        th.setPortWriter(&imageOut);
+    // Set command line params (they override the values above)
+    return setCommandLineParams();
+}
 
+int FfmpegMonitorObject::openCodec(int w, int h)
+{
+    if (!firstTime && codecContext->width == w && codecContext->height == h) {
+        return 0;
     }
-    return th;
+
+    if (!firstTime) {
+        // The size of the images changed, the codec must be created again
+        yCInfo(FFMPEGMONITOR, "The image size changed to %dx%d, reopening the codec", w, h);
+#if LIBAVCODEC_VERSION_MAJOR < 61
+        avcodec_close(codecContext);
+#endif
+        avcodec_free_context(&codecContext);
+        codecContext = avcodec_alloc_context3(codec);
+        if (!codecContext) {
+            yCError(FFMPEGMONITOR, "Could not allocate video codec context");
+            return -1;
+        }
+        firstTime = true;
+        waitingKeyFrame = true;
+        nextPts = 0;
+        if (configureCodecContext() == -1) {
+            return -1;
+        }
+    }
+
+    // Set codec context parameters
+    codecContext->width = w;
+    codecContext->height = h;
+    codecContext->pix_fmt = pixelFormat;
+
+    // Open codec
+    int ret = avcodec_open2(codecContext, codec, NULL);
+    if (ret < 0) {
+        yCError(FFMPEGMONITOR, "Could not open codec");
+        return -1;
+    }
+    firstTime = false;
+    return 0;
 }
 
-int FfmpegMonitorObject::compress(Image* img, AVPacket *pkt) {
+int FfmpegMonitorObject::compress(Image* img, Bottle& packets) {
 
     yCTrace(FFMPEGMONITOR, "compress");
-    AVFrame *startFrame;
-    AVFrame *endFrame;
 
     // Get width and height
     int w = img->width();
     int h = img->height();
 
-    // Allocate video frame for original frames
-    startFrame = av_frame_alloc();
-    if (startFrame == NULL) {
-        yCError(FFMPEGMONITOR, "Cannot allocate starting frame!");
+    auto inputFormatIt = FFMPEGPORTMONITOR_PIXELMAP.find(img->getPixelCode());
+    if (inputFormatIt == FFMPEGPORTMONITOR_PIXELMAP.end()) {
+        yCError(FFMPEGMONITOR, "Unsupported pixel code %s", yarp::os::Vocab32::decode(img->getPixelCode()).c_str());
         return -1;
     }
+    AVPixelFormat inputFormat = (AVPixelFormat) inputFormatIt->second;
 
-    // Allocate a video frame for end frame
-    endFrame = av_frame_alloc();
-    if (endFrame == NULL) {
-        yCError(FFMPEGMONITOR, "Cannot allocate end frame!");
-        av_frame_free(&startFrame);
+    // Open the codec (again, if the size of the images changed)
+    if (openCodec(w, h) != 0) {
         return -1;
     }
 
-    // Allocate space into start frame to contain data
-    int success = av_image_alloc(startFrame->data, startFrame->linesize,
-                    w, h,
-                    (AVPixelFormat) FFMPEGPORTMONITOR_PIXELMAP[img->getPixelCode()], 16);
-
-    if (success < 0) {
-        yCError(FFMPEGMONITOR, "Cannot allocate starting frame buffer!");
-        av_frame_free(&startFrame);
-        av_frame_free(&endFrame);
-        return -1;
+    // Allocate the buffer of the frame sent to the encoder, only if the size
+    // of the images changed
+    if (codecFrame->width != w || codecFrame->height != h || codecFrame->format != pixelFormat) {
+        av_frame_unref(codecFrame);
+        codecFrame->width = w;
+        codecFrame->height = h;
+        codecFrame->format = pixelFormat;
+        if (av_frame_get_buffer(codecFrame, 0) < 0) {
+            yCError(FFMPEGMONITOR, "Cannot allocate end frame buffer!");
+            av_frame_unref(codecFrame);
+            return -1;
+        }
     }
 
-    // Set Image data into AVFrame
-    startFrame->linesize[0] = img->getRowSize();
-    // Free old pointer (because we will use the buffer contained into img)
-    av_freep(&startFrame->data[0]);
-    startFrame->data[0] = img->getRawImage();
-    startFrame->height = h;
-    startFrame->width = w;
-    startFrame->format = (AVPixelFormat) FFMPEGPORTMONITOR_PIXELMAP[img->getPixelCode()];
-
-    // Allocate memory for end frame data
-    success = av_image_alloc(endFrame->data, endFrame->linesize,
-                    w, h, pixelFormat, 16);
-
-    if (success < 0) {
-        yCError(FFMPEGMONITOR, "Cannot allocate end frame buffer!");
-        av_frame_free(&startFrame);
-        av_frame_free(&endFrame);
+    // The encoder might still hold a reference to the previous frame
+    if (av_frame_make_writable(codecFrame) < 0) {
+        yCError(FFMPEGMONITOR, "Cannot make the end frame writable!");
         return -1;
     }
 
-    // Set end frame parameters
-    endFrame->height = h;
-    endFrame->width = w;
-    endFrame->format = pixelFormat;
+    // Use the buffer of the image without copying it
+    uint8_t* inputData[4];
+    int inputLinesize[4];
+    av_image_fill_arrays(inputData, inputLinesize, img->getRawImage(), inputFormat, w, h, 1);
+    if (av_pix_fmt_count_planes(inputFormat) == 1) {
+        // Rows might be padded
+        inputLinesize[0] = img->getRowSize();
+    }
 
     {
         std::lock_guard<std::mutex> lock(instances_mutex);
 
-        // Convert the image from start format into end format
-        static struct SwsContext *img_convert_ctx;
-
-        // Allocate context for conversion
-        img_convert_ctx = sws_getContext(w, h,
-                                         (AVPixelFormat) FFMPEGPORTMONITOR_PIXELMAP[img->getPixelCode()],
-                w, h,
-                pixelFormat,
-                SWS_BICUBIC,
-                NULL, NULL, NULL);
-        if (img_convert_ctx == NULL) {
+        // The conversion context is allocated again only if the parameters
+        // of the conversion changed
+        swsContext = sws_getCachedContext(swsContext,
+                                          w, h, inputFormat,
+                                          w, h, pixelFormat,
+                                          SWS_BICUBIC,
+                                          NULL, NULL, NULL);
+        if (swsContext == NULL) {
             yCError(FFMPEGMONITOR, "Cannot initialize pixel format conversion context!");
-            av_freep(&endFrame->data[0]);
-            av_frame_free(&startFrame);
-            av_frame_free(&endFrame);
             return -1;
         }
 
         // Perform conversion
-        int ret = sws_scale(img_convert_ctx, startFrame->data, startFrame->linesize, 0,
-                            h, endFrame->data, endFrame->linesize);
-
+        int ret = sws_scale(swsContext, inputData, inputLinesize, 0,
+                            h, codecFrame->data, codecFrame->linesize);
         if (ret < 0) {
             yCError(FFMPEGMONITOR, "Could not convert pixel format!");
-            sws_freeContext(img_convert_ctx);
-            av_freep(&endFrame->data[0]);
-            av_frame_free(&startFrame);
-            av_frame_free(&endFrame);
             return -1;
         }
+    }
 
-        if (firstTime) {
-            // If this is the first compression
+    // Set presentation timestamp
+    codecFrame->pts = nextPts++;
 
-            // Set codec context parameters
-            codecContext->width = w;
-            codecContext->height = h;
-            codecContext->pix_fmt = pixelFormat;
+    // Send image frame to codec
+    int ret = avcodec_send_frame(codecContext, codecFrame);
+    if (ret < 0) {
+        yCError(FFMPEGMONITOR, "Error sending a frame for encoding");
+        return -1;
+    }
 
-            // Open codec
-            ret = avcodec_open2(codecContext, codec, NULL);
-            if (ret < 0) {
-                yCError(FFMPEGMONITOR, "Could not open codec");
-                sws_freeContext(img_convert_ctx);
-                av_freep(&endFrame->data[0]);
-                av_frame_free(&startFrame);
-                av_frame_free(&endFrame);
-                return -1;
-            }
-            firstTime = false;
-        }
+    // Receive all the packets ready. The encoder might return no packets (if
+    // it is buffering frames for inter-frame coding), or more than one.
+    while ((ret = avcodec_receive_packet(codecContext, packet)) == 0) {
+        Bottle& p = packets.addList();
+        p.addInt64(packet->pts);
+        p.addInt64(packet->dts);
+        p.addInt64(packet->duration);
+        p.addInt32(packet->flags);
+        p.add(Value(packet->data, packet->size));
 
-        // Set presentation timestamp
-#if LIBAVCODEC_VERSION_MAJOR >= 61
-        // See https://github.com/FFmpeg/FFmpeg/commit/6b6f7db81932f94876ff4bcfd2da0582b8ab897e
-        endFrame->pts = codecContext->frame_num;
-#else
-        endFrame->pts = codecContext->frame_number;
-#endif
-
-        // Send image frame to codec
-        ret = avcodec_send_frame(codecContext, endFrame);
-        if (ret < 0) {
-            yCError(FFMPEGMONITOR, "Error sending a frame for encoding");
-            sws_freeContext(img_convert_ctx);
-            av_freep(&endFrame->data[0]);
-            av_frame_free(&startFrame);
-            av_frame_free(&endFrame);
-            return -1;
+        // Side data elements
+        for (int i = 0; i < packet->side_data_elems; i++) {
+            p.addInt32(packet->side_data[i].type);
+            p.add(Value(packet->side_data[i].data, static_cast<int>(packet->side_data[i].size)));
         }
+        av_packet_unref(packet);
+    }
 
-        // Receive compressed data into packet
-        ret = avcodec_receive_packet(codecContext, pkt);
-        sws_freeContext(img_convert_ctx);
-        av_freep(&endFrame->data[0]);
-        av_frame_free(&startFrame);
-        av_frame_free(&endFrame);
-
-
-        if (ret == AVERROR(EAGAIN)) {
-            // Not enough data
-            yCError(FFMPEGMONITOR, "Error EAGAIN");
-            return -1;
-        } else if (ret == AVERROR_EOF) {
-            // End of file reached
-            yCError(FFMPEGMONITOR, "Error EOF");
-            return -1;
-        } else if (ret < 0) {
-            yCError(FFMPEGMONITOR, "Error during encoding");
-            return -1;
-        }
+    if (ret == AVERROR_EOF) {
+        // End of file reached
+        yCError(FFMPEGMONITOR, "Error EOF");
+        return -1;
+    } else if (ret != AVERROR(EAGAIN)) {
+        yCError(FFMPEGMONITOR, "Error during encoding");
+        return -1;
     }
 
     return 0;
 }
 
-int FfmpegMonitorObject::decompress(AVPacket* pkt, int w, int h, int pixelCode) {
+int FfmpegMonitorObject::decompress(Bottle& compressedBottle) {
 
     yCTrace(FFMPEGMONITOR, "decompress");
-    AVFrame *startFrame;
-    AVFrame *endFrame;
-
-    if (firstTime) {
-        // If this is the first decompression
-
-        // Set codec context parameters
-        codecContext->width = w;
-        codecContext->height = h;
-        codecContext->pix_fmt = pixelFormat;
 
-        // Open codec
-        int ret = avcodec_open2(codecContext, codec, NULL);
-        if (ret < 0) {
-            yCError(FFMPEGMONITOR, "Could not open codec");
-            return -1;
-        }
-        firstTime = false;
+    // Check if compression was successful
+    if (compressedBottle.get(0).asInt32() != 1) {
+        return 0;
     }
 
-    // Allocate video frame
-    startFrame = av_frame_alloc();
-    if (startFrame == NULL) {
-        yCError(FFMPEGMONITOR, "Could not allocate start frame!");
-        return -1;
-    }
+    // Extract decompression data from the Bottle
+    int w = compressedBottle.get(1).asInt32();
+    int h = compressedBottle.get(2).asInt32();
+    int pixelCode = compressedBottle.get(3).asInt32();
+    int pixelSize = compressedBottle.get(4).asInt32();
+    Bottle* packets = compressedBottle.get(5).asList();
 
-    // Send compressed packet to codec
-    int ret = avcodec_send_packet(codecContext, pkt);
-    if (ret < 0) {
-        yCError(FFMPEGMONITOR, "Error sending a frame for decoding");
-        av_frame_free(&startFrame);
+    auto outputFormatIt = FFMPEGPORTMONITOR_PIXELMAP.find(pixelCode);
+    if (outputFormatIt == FFMPEGPORTMONITOR_PIXELMAP.end()) {
+        yCError(FFMPEGMONITOR, "Invalid input pixel code");
         return -1;
     }
+    AVPixelFormat outputFormat = (AVPixelFormat) outputFormatIt->second;
 
-    // Receive decompressed image into an AVFrame
-    ret = avcodec_receive_frame(codecContext, startFrame);
-    if (ret == AVERROR(EAGAIN)) {
-        // No enough data
-        yCError(FFMPEGMONITOR, "Error EAGAIN");
-        av_frame_free(&startFrame);
+    if (packets == nullptr) {
+        yCError(FFMPEGMONITOR, "Invalid compressed data");
         return -1;
     }
-    else if (ret == AVERROR_EOF) {
-        // End of file reached
-        yCError(FFMPEGMONITOR, "Error EOF");
-        av_frame_free(&startFrame);
-        return -1;
-    }
-    else if (ret < 0) {
-        yCError(FFMPEGMONITOR, "Error during decoding");
-        av_frame_free(&startFrame);
+
+    // Open the codec (again, if the size of the images changed)
+    if (openCodec(w, h) != 0) {
         return -1;
     }
 
-    // Allocate a video frame for end frame
-    endFrame = av_frame_alloc();
-    if (endFrame == NULL) {
-        yCError(FFMPEGMONITOR, "Could not allocate start frame!");
-        av_frame_free(&startFrame);
-        return -1;
+    bool newFrame = false;
+    for (size_t i = 0; i < packets->size(); i++) {
+        Bottle* p = packets->get(i).asList();
+        if (p == nullptr || p->size() < 5 || !p->get(4).isBlob()) {
+            yCError(FFMPEGMONITOR, "Invalid compressed packet");
+            return -1;
+        }
+
+        // After an error, the packets are discarded until the next key frame,
+        // since the following frames cannot be decoded without it
+        int flags = p->get(3).asInt32();
+        if (waitingKeyFrame) {
+            if ((flags & AV_PKT_FLAG_KEY) == 0) {
+                continue;
+            }
+            waitingKeyFrame = false;
+        }
+
+        // Set all packet parameters
+        const Value& packetData = p->get(4);
+        if (av_new_packet(packet, static_cast<int>(packetData.asBlobLength())) < 0) {
+            yCError(FFMPEGMONITOR, "Error in packet allocation");
+            return -1;
+        }
+        memcpy(packet->data, packetData.asBlob(), packetData.asBlobLength());
+        packet->pts = p->get(0).asInt64();
+        packet->dts = p->get(1).asInt64();
+        packet->duration = p->get(2).asInt64();
+        packet->flags = flags;
+
+        // Packet side data
+        for (size_t j = 5; j + 1 < p->size(); j += 2) {
+            const Value& sideData = p->get(j + 1);
+            uint8_t* dst = av_packet_new_side_data(packet,
+                                                   (AVPacketSideDataType) p->get(j).asInt32(),
+                                                   sideData.asBlobLength());
+            if (dst != NULL) {
+                memcpy(dst, sideData.asBlob(), sideData.asBlobLength());
+            }
+        }
+
+        // Send compressed packet to codec
+        int ret = avcodec_send_packet(codecContext, packet);
+        av_packet_unref(packet);
+        if (ret < 0) {
+            yCWarning(FFMPEGMONITOR, "Error sending a packet for decoding, waiting for the next key frame");
+            avcodec_flush_buffers(codecContext);
+            waitingKeyFrame = true;
+            continue;
+        }
+
+        // Receive all the decompressed images ready, keeping only the last one
+        while ((ret = avcodec_receive_frame(codecContext, codecFrame)) == 0) {
+            av_frame_unref(decodedFrame);
+            av_frame_move_ref(decodedFrame, codecFrame);
+            newFrame = true;
+        }
+        if (ret != AVERROR(EAGAIN)) {
+            yCWarning(FFMPEGMONITOR, "Error during decoding, waiting for the next key frame");
+            avcodec_flush_buffers(codecContext);
+            waitingKeyFrame = true;
+        }
     }
 
-    // Allocate memory into end frame to contain data
-    int success = av_image_alloc(endFrame->data, endFrame->linesize,
-                    w, h,
-                    (AVPixelFormat) FFMPEGPORTMONITOR_PIXELMAP[pixelCode], 16);
+    if (!newFrame) {
+        // The decoder needs more packets
+        return 0;
+    }
 
-    if (success < 0) {
-        yCError(FFMPEGMONITOR, "Error allocating end frame buffer!");
-        av_frame_free(&startFrame);
-        av_frame_free(&endFrame);
-        return -1;
+    // Set information into final image
+    if (imageOut.getPixelCode() != pixelCode || imageOut.width() != static_cast<size_t>(w) || imageOut.height() != static_cast<size_t>(h)) {
+        imageOut.setPixelCode(pixelCode);
+        imageOut.setPixelSize(pixelSize);
+        imageOut.resize(w, h);
     }
 
-    // Set end frame parameters
-    endFrame->height = h;
-    endFrame->width = w;
-    endFrame->format = (AVPixelFormat) FFMPEGPORTMONITOR_PIXELMAP[pixelCode];
+    // Write the converted image directly into imageOut
+    uint8_t* outputData[4];
+    int outputLinesize[4];
+    av_image_fill_arrays(outputData, outputLinesize, imageOut.getRawImage(), outputFormat, w, h, 1);
+    if (av_pix_fmt_count_planes(outputFormat) == 1) {
+        // Rows might be padded
+        outputLinesize[0] = imageOut.getRowSize();
+    }
 
     {
         std::lock_guard<std::mutex> lock(instances_mutex);
 
-        // Convert the image into RGB format
-        static struct SwsContext *img_convert_ctx;
-
-        // Allocate conversion context
-        img_convert_ctx = sws_getContext(w, h,
-                                         pixelFormat,
-                                         w, h,
-                                         (AVPixelFormat) FFMPEGPORTMONITOR_PIXELMAP[pixelCode],
-                                         SWS_BICUBIC,
-                                         NULL, NULL, NULL);
-        if (img_convert_ctx == NULL) {
+        // The conversion context is allocated again only if the parameters
+        // of the conversion changed
+        swsContext = sws_getCachedContext(swsContext,
+                                          decodedFrame->width, decodedFrame->height, (AVPixelFormat) decodedFrame->format,
+                                          w, h, outputFormat,
+                                          SWS_BICUBIC,
+                                          NULL, NULL, NULL);
+        if (swsContext == NULL) {
             yCError(FFMPEGMONITOR, "Cannot initialize the pixel format conversion context!");
-            av_freep(&endFrame->data[0]);
-            av_frame_free(&endFrame);
-            av_frame_free(&startFrame);
             return -1;
         }
 
         // Perform conversion
-        ret = sws_scale(img_convert_ctx, startFrame->data, startFrame->linesize, 0,
-                        h, endFrame->data, endFrame->linesize);
-
+        int ret = sws_scale(swsContext, decodedFrame->data, decodedFrame->linesize, 0,
+                            decodedFrame->height, outputData, outputLinesize);
         if (ret < 0) {
             yCError(FFMPEGMONITOR, "Could not convert pixel format!");
-            av_freep(&endFrame->data[0]);
-            av_frame_free(&endFrame);
-            av_frame_free(&startFrame);
-            sws_freeContext(img_convert_ctx);
             return -1;
         }
-
-        // Copy decompressed data from end frame to imageOut
-        memcpy(imageOut.getRawImage(), endFrame->data[0], success);
-
-        // Free allocated memory
-        av_freep(&endFrame->data[0]);
-        av_frame_free(&endFrame);
-        av_frame_free(&startFrame);
-        sws_freeContext(img_convert_ctx);
     }
 
-    return 0;
-
+    return 1;
 }
 
 bool FfmpegMonitorObject::getParamsFromCommandLine(std::string carrierString, const AVCodec*& codecOut, AVPixelFormat& pixelFormatOut, int& frameRate) {
@@ -854,6 +828,21 @@ bool FfmpegMonitorObject::getParamsFromCommandLine(std::string carrierString, co
             printStatistics = std::atoi(paramValue.c_str());
             continue;  //avoid to add this parameter to paramsMap
         }
+        else if (paramKey == FFMPEGPORTMONITOR_CL_GOP_SIZE_KEY)
+        {
+            gopSize = std::atoi(paramValue.c_str());
+            continue;  //avoid to add this parameter to paramsMap
+        }
+        else if (paramKey == FFMPEGPORTMONITOR_CL_MAX_B_FRAMES_KEY)
+        {
+            maxBFrames = std::atoi(paramValue.c_str());
+            continue;  //avoid to add this parameter to paramsMap
+        }
+        else if (paramKey == FFMPEGPORTMONITOR_CL_LOW_LATENCY_KEY)
+        {
+            lowLatency = std::atoi(paramValue.c_str());
+            continue;  //avoid to add this parameter to paramsMap
+        }
 
         // Save param into params map
         paramsMap.insert( std::pair<std::string, std::string>(paramKey, paramValue) );
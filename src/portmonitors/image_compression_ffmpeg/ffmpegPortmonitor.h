@@ -25,6 +25,8 @@ extern "C" {
     #include <libavcodec/avcodec.h>
 }
 
+struct SwsContext;
+
 /**
  * @ingroup portmonitors_lists
  * @brief `image_compression_ffmpeg`: This portmonitor uses Ffmpeg to compress and decompress video streams with a specified codec.
@@ -52,16 +54,16 @@ class FfmpegMonitorObject : public yarp::os::MonitorObject
         bool getparam(yarp::os::Property& params) override;
 
         /**
-         * @brief This function is used by the port monitor to decide if an incoming packet can be accepted (it tries to cast it to the right type). The accepted packets are then handled by the function "update"; the others are discarded.
+         * @brief This function is used by the port monitor to decide if an incoming packet can be accepted (it tries to cast it to the right type). The accepted packets are then handled by the function "update"; the others are discarded. In receiver side, the compressed packets are also sent to the decoder, and the Bottle is accepted only if a new frame was decoded (the decoder might need more packets before returning a frame).
          *
          * @param thing The incoming packet; must be a yarp::sig::Image in sender side, must be a yarp::sig::Bottle in receiver side.
-         * @return true If the packet was successfully cast.
+         * @return true If the packet was successfully cast (and decoded, in receiver side).
          * @return false Otherwise.
          */
         bool accept(yarp::os::Things& thing) override;
 
         /**
-         * @brief This function is the one that manipulates the incoming packet. In sender side, it takes the Image and sends it to the "compress" function. Then it fills a Bottle containing the compressed Image and all the information needed for decompression. In receiver side, it takes the incoming Bottle and unpacks it; then it sends all compressed data to the "decompress" function; it finally creates a new Image object filled with decompressed data.
+         * @brief This function is the one that manipulates the incoming packet. In sender side, it takes the Image and sends it to the "compress" function. Then it fills a Bottle containing the compressed packets returned by the encoder (possibly none, if the encoder is buffering frames) and all the information needed for decompression. In receiver side, it returns the Image decoded by the "accept" function.
          *
          * @param thing The incoming packet; it is a yarp::sig::Image in sender side, a yarp::sig::Bottle in receiver side.
          * @return yarp::os::Things& The newly created object; it is a yarp::sig::Bottle in sender side (containing compressed data to be sent to receiver); it is a yarp::sig::FlexImage in receiver side (to be sent to the original destination).
@@ -70,24 +72,37 @@ class FfmpegMonitorObject : public yarp::os::MonitorObject
 
     protected:
         /**
-         * @brief This function performs all the compression actions on the incoming Image and saves the resulting compressed data into the AVPacket passed as parameter.
+         * @brief This function converts the incoming Image, sends it to the encoder and appends all the packets returned by the encoder to the Bottle passed as parameter.
          *
          * @param img The incoming image.
-         * @param pkt The packet containing all the compressed data.
+         * @param packets The bottle where the compressed packets are appended.
          * @return int 0 on success, -1 otherwise.
          */
-        int compress(yarp::sig::Image* img, AVPacket* pkt);
+        int compress(yarp::sig::Image* img, yarp::os::Bottle& packets);
 
         /**
-         * @brief This function decompresses the incoming AVPacket passed as parameter and saves decompressed data into the attribute imageOut (yarp::sig::FlexImage).
+         * @brief This function sends the compressed packets contained in the Bottle to the decoder and saves the last decompressed frame into the attribute imageOut (yarp::sig::FlexImage).
+         *
+         * @param compressedBottle The incoming Bottle containing all the compressed data.
+         * @return int 1 if a new frame was decoded, 0 if the decoder needs more packets, -1 on error.
+         */
+        int decompress(yarp::os::Bottle& compressedBottle);
+
+        /**
+         * @brief This function sets the frame rate, the latency and threading defaults and the command line parameters into the attribute codecContext.
+         *
+         * @return int  0 on success, -1 otherwise.
+         */
+        int configureCodecContext();
+
+        /**
+         * @brief This function opens the codec for images of the given size. If the codec was already opened with a different size, the codec context is created again.
          *
-         * @param pkt The incoming packet containing all the compressed data.
          * @param w   The width of the image (in pixels).
          * @param h   The height of the image (in pixels).
-         * @param pixelCode The YARP pixel format code of the image.
          * @return int 0 on success, -1 otherwise.
          */
-        int decompress(AVPacket* pkt, int w, int h, int pixelCode);
+        int openCodec(int w, int h);
 
         /**
          * @brief This function parses the command line parameters from a string containing the entire command used to execute the program and saves the parameters into the attribute paramsMap (std::map<std::string, std::string>).
@@ -165,6 +180,66 @@ class FfmpegMonitorObject : public yarp::os::MonitorObject
          */
         bool firstTime;
 
+        /**
+         * @brief Frame rate of the stream, used as time base of the codec.
+         *
+         */
+        int frameRate{15};
+
+        /**
+         * @brief Group of pictures size (-1 to use the codec default).
+         *
+         */
+        int gopSize{-1};
+
+        /**
+         * @brief Maximum number of B-frames between two non-B-frames (-1 to use the default).
+         *
+         */
+        int maxBFrames{-1};
+
+        /**
+         * @brief Boolean variable used to check whether the codec should be tuned to minimize the latency.
+         *
+         */
+        bool lowLatency{true};
+
+        /**
+         * @brief Boolean variable used (in receiver side) to discard the packets until a key frame is received.
+         *
+         */
+        bool waitingKeyFrame{true};
+
+        /**
+         * @brief Presentation timestamp of the next frame sent to the encoder.
+         *
+         */
+        int64_t nextPts{0};
+
+        /**
+         * @brief Pixel format conversion context, kept for the whole lifetime of the connection.
+         *
+         */
+        struct SwsContext* swsContext{nullptr};
+
+        /**
+         * @brief Frame exchanged with the codec (encoder input in sender side, decoder output in receiver side).
+         *
+         */
+        AVFrame* codecFrame{nullptr};
+
+        /**
+         * @brief Last frame returned by the decoder (receiver side only).
+         *
+         */
+        AVFrame* decodedFrame{nullptr};
+
+        /**
+         * @brief Packet used to exchange compressed data with the codec.
+         *
+         */
+        AVPacket* packet{nullptr};
+
         /**
          * @brief Boolean variable used to check whether the bandwidth statistics should be printed
          *
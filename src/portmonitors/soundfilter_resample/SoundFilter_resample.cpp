@@ -105,6 +105,7 @@ bool SoundFilter_resample::create(const yarp::os::Property &options)
 
 void SoundFilter_resample::destroy()
 {
+    m_resampler.reset();
 }
 
 bool SoundFilter_resample::setparam(const yarp::os::Property &params)
@@ -123,35 +124,29 @@ bool SoundFilter_resample::getparam(yarp::os::Property &params)
 
 bool SoundFilter_resample::accept(yarp::os::Things &thing)
 {
-    yarp::sig::Sound *bt = thing.cast_as<yarp::sig::Sound>();
-    if (bt == NULL)
+    yarp::sig::Sound *s = thing.cast_as<yarp::sig::Sound>();
+    if (s == NULL)
     {
         yCWarning(SOUNDFILTER_RESAMPLE, "expected type Sound but got wrong data type!\n");
         return false;
     }
 
-    return true;
+    // The sound is processed here, so that a packet that cannot be resampled
+    // is dropped instead of being sent
+    return process(*s);
 }
 
-yarp::os::Things & SoundFilter_resample::update(yarp::os::Things &thing)
+bool SoundFilter_resample::process(const yarp::sig::Sound& s)
 {
-    //get data to process
-    yarp::sig::Sound *s = thing.cast_as<yarp::sig::Sound>();
-    if (s == NULL)
-    {
-        yCWarning(SOUNDFILTER_RESAMPLE, "expected type Sound but got wrong data type!\n");
-        return thing;
-    }
-
     //extract one channel
     m_s2.clear();
     if (m_channel >=0)
     {
-        m_s2 = s->extractChannelAsSound(m_channel);
+        m_s2 = s.extractChannelAsSound(m_channel);
     }
     else
     {
-        m_s2 = *s;
+        m_s2 = s;
     }
 
     if (m_gain >= 0)
@@ -159,13 +154,41 @@ yarp::os::Things & SoundFilter_resample::update(yarp::os::Things &thing)
         m_s2.amplify(m_gain);
     }
 
+    m_output = &m_s2;
     if (m_output_freq>0)
     {
-        yarp::sig::soundfilters::resample (m_s2,m_output_freq);
+        //the resampler keeps the filter history between consecutive packets of the stream,
+        //and it is re-created only if the format of the stream changes
+        size_t in_freq = m_s2.getFrequency();
+        if (!m_resampler ||
+            m_resampler->getInputFrequency() != in_freq ||
+            m_resampler->getOutputFrequency() != static_cast<size_t>(m_output_freq) ||
+            m_resampler->getChannels() != m_s2.getChannels())
+        {
+            if (in_freq == 0 || m_s2.getChannels() == 0)
+            {
+                yCWarning(SOUNDFILTER_RESAMPLE, "received a sound with invalid frequency/channels!\n");
+                return true;
+            }
+            yCDebug(SOUNDFILTER_RESAMPLE) << "creating resampler" << in_freq << "Hz ->" << m_output_freq << "Hz," << m_s2.getChannels() << "channels";
+            m_resampler = std::make_unique<yarp::sig::soundfilters::Resampler>(in_freq, m_output_freq, m_s2.getChannels());
+        }
+        if (!m_resampler->process(m_s2, m_s3))
+        {
+            yCError(SOUNDFILTER_RESAMPLE, "resampling failed, the sound is dropped");
+            m_resampler.reset();
+            return false;
+        }
+        m_output = &m_s3;
     }
 
-    //send data
-    m_th.setPortWriter(&m_s2);
+    return true;
+}
+
+yarp::os::Things & SoundFilter_resample::update(yarp::os::Things &thing)
+{
+    //the sound was already processed by accept()
+    m_th.setPortWriter(m_output);
     return m_th;
 }
 
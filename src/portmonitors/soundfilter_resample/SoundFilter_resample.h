@@ -9,11 +9,14 @@
 #include <yarp/os/Things.h>
 #include <yarp/os/MonitorObject.h>
 #include <yarp/sig/Sound.h>
+#include <yarp/sig/SoundFilters.h>
 #include <yarp/os/Bottle.h>
 #include <yarp/os/Log.h>
 #include <yarp/os/LogComponent.h>
 #include <yarp/os/LogStream.h>
 
+#include <memory>
+
  /**
   * @ingroup portmonitors_lists
   * \brief `soundfilter_resample`:  Documentation to be added
@@ -22,6 +25,9 @@ class SoundFilter_resample : public yarp::os::MonitorObject
 {
     yarp::os::Things m_th;
     yarp::sig::Sound m_s2;
+    yarp::sig::Sound m_s3;
+    yarp::sig::Sound* m_output = &m_s2;
+    std::unique_ptr<yarp::sig::soundfilters::Resampler> m_resampler;
     int m_channel = -1;
     int m_output_freq = -1;
     double m_gain = -1;
@@ -39,6 +45,9 @@ public:
 
     bool accept(yarp::os::Things &thing) override;
     yarp::os::Things &update(yarp::os::Things &thing) override;
+
+private:
+    bool process(const yarp::sig::Sound& s);
 };
 
 #endif
@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/BufferedPort.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/Time.h>
+#include <yarp/sig/Image.h>
+
+#include <gst/gst.h>
+#include <gst/app/gstappsink.h>
+#include <gst/video/video.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace yarp::os;
+using namespace yarp::sig;
+
+namespace {
+
+bool hasElements(std::initializer_list<const char*> names)
+{
+    for (const auto* name : names) {
+        GstElementFactory* factory = gst_element_factory_find(name);
+        if (!factory) {
+            return false;
+        }
+        gst_object_unref(factory);
+    }
+    return true;
+}
+
+bool isGreen(const guint8* pixel)
+{
+    constexpr int tolerance = 16;
+    return pixel[0] < tolerance && pixel[1] > 255 - tolerance && pixel[2] < tolerance;
+}
+
+} // namespace
+
+TEST_CASE("gstreamerplugins::yarpvideosource", "[gstreamerplugins]")
+{
+    gst_init(nullptr, nullptr);
+    GError* error = nullptr;
+    GstPlugin* plugin = gst_plugin_load_file(YARP_VIDEOSOURCE_PLUGIN_PATH, &error);
+    if (!plugin) {
+        g_clear_error(&error);
+        YARP_SKIP_TEST("Cannot load the yarpvideosource plugin")
+    }
+    gst_object_unref(plugin);
+
+    if (!hasElements({"videoconvert", "x264enc", "h264parse", "avdec_h264", "appsink"})) {
+        YARP_SKIP_TEST("The gstreamer elements used by the test are not available")
+    }
+
+    Network::setLocalMode(true);
+
+    SECTION("test encoding of the received images")
+    {
+        BufferedPort<ImageOf<PixelRgb>> out;
+        REQUIRE(out.open("/yarpvideosource/test:o"));
+
+        // x264enc keeps a few tens of frames for its lookahead, so the frames
+        // must be given back to the element once they are encoded
+        GstElement* pipeline = gst_parse_launch("yarpvideosource localPortname=/yarpvideosource/test:i "
+                                                "remotePortname=/yarpvideosource/test:o connectionProtocol=tcp do-timestamp=true ! "
+                                                "videoconvert ! x264enc ! h264parse ! avdec_h264 ! videoconvert ! "
+                                                "video/x-raw,format=RGB ! appsink name=sink sync=false",
+                                                &error);
+        REQUIRE(pipeline != nullptr);
+        REQUIRE(error == nullptr);
+        REQUIRE(gst_element_set_state(pipeline, GST_STATE_PLAYING) != GST_STATE_CHANGE_FAILURE);
+
+        std::atomic<bool> writing {true};
+        std::thread writer([&]() {
+            while (writing) {
+                // The images are sent when the element is connected
+                ImageOf<PixelRgb>& image = out.prepare();
+                image.resize(640, 480);
+                image.zero();
+                for (size_t y = 0; y < image.height(); y++) {
+                    for (size_t x = 0; x < image.width(); x++) {
+                        image.pixel(x, y).g = 255;
+                    }
+                }
+                out.write();
+                Time::delay(0.01);
+            }
+        });
+
+        GstElement* sink = gst_bin_get_by_name(GST_BIN(pipeline), "sink");
+        REQUIRE(sink != nullptr);
+        for (int i = 0; i < 10; i++) {
+            GstSample* sample = gst_app_sink_try_pull_sample(GST_APP_SINK(sink), 20 * GST_SECOND);
+            REQUIRE(sample != nullptr);
+
+            GstVideoInfo info;
+            REQUIRE(gst_video_info_from_caps(&info, gst_sample_get_caps(sample)));
+            CHECK(GST_VIDEO_INFO_WIDTH(&info) == 640);
+            CHECK(GST_VIDEO_INFO_HEIGHT(&info) == 480);
+
+            GstMapInfo map;
+            REQUIRE(gst_buffer_map(gst_sample_get_buffer(sample), &map, GST_MAP_READ));
+            size_t stride = GST_VIDEO_INFO_PLANE_STRIDE(&info, 0);
+            CHECK(isGreen(map.data));
+            CHECK(isGreen(map.data + stride * 240 + 320 * 3));
+            CHECK(isGreen(map.data + stride * 479 + 639 * 3));
+            gst_buffer_unmap(gst_sample_get_buffer(sample), &map);
+            gst_sample_unref(sample);
+        }
+        gst_object_unref(sink);
+
+        // The element is stopped while the encoder still holds some of its
+        // frames, which are released afterwards
+        gst_element_set_state(pipeline, GST_STATE_NULL);
+        gst_object_unref(pipeline);
+
+        writing = false;
+        writer.join();
+        out.interrupt();
+        out.close();
+    }
+
+    Network::setLocalMode(false);
+}
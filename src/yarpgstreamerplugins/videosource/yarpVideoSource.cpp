@@ -36,7 +36,7 @@ G_DEFINE_TYPE(GstYarpVideoSource, gst_yarp_video_source, GST_TYPE_PUSH_SRC);
 
 
 /* Yarp stuff */
-yarp_handler_class* yarp_handler = nullptr;
+std::shared_ptr<yarp_handler_class> yarp_handler;
 
 enum
 {
@@ -56,8 +56,7 @@ static gboolean gst_yarp_video_source_set_caps(GstBaseSrc* src, GstCaps* caps);
 static gboolean gst_yarp_video_source_start(GstBaseSrc* src);
 static gboolean gst_yarp_video_source_stop(GstBaseSrc* src);
 
-static GstFlowReturn gst_yarp_video_source_fill(GstPushSrc* src, GstBuffer* buf);
-static GstFlowReturn gst_yarp_video_source_alloc(GstPushSrc* src, GstBuffer** buf);
+static GstFlowReturn gst_yarp_video_source_create(GstPushSrc* src, GstBuffer** buf);
 
 
 #define MY_SOURCE_CAPS           \
@@ -120,9 +119,7 @@ static void gst_yarp_video_source_class_init(GstYarpVideoSourceClass* klass)
     gstbasesrc_class->start = gst_yarp_video_source_start;
     gstbasesrc_class->stop = gst_yarp_video_source_stop;
 
-    //gstpushsrc_class->create = gst_yarp_video_source_create;
-    gstpushsrc_class->fill = gst_yarp_video_source_fill;
-    gstpushsrc_class->alloc = gst_yarp_video_source_alloc;
+    gstpushsrc_class->create = gst_yarp_video_source_create;
 
     g_object_class_install_property(gobject_class, PROP_LOCAL_PORTNAME, g_param_spec_string("localPortname",        "localPortname (string)",      "Name of the local port", NULL, G_PARAM_READWRITE));
     g_object_class_install_property(gobject_class, PROP_REMOTE_PORTNAME, g_param_spec_string("remotePortname",      "remotePortname (string)",     "Name of the remote port to perform automatic connection (disabled by default)", NULL, G_PARAM_READWRITE));
@@ -137,7 +134,7 @@ static void gst_yarp_video_source_class_init(GstYarpVideoSourceClass* klass)
 
 static void gst_yarp_video_source_init(GstYarpVideoSource* src)
 {
-    yarp_handler = new yarp_handler_class;
+    yarp_handler = std::make_shared<yarp_handler_class>();
     yTrace();
     gst_base_src_set_format(GST_BASE_SRC(src), GST_FORMAT_TIME);
 }
@@ -274,86 +271,75 @@ static gboolean gst_yarp_video_source_stop(GstBaseSrc* src)
     // Close YARP port
     yarp_handler->input_port.close();
 
-    if (yarp_handler)
-    {
-        delete yarp_handler;
-        yarp_handler = nullptr;
-    }
+    // the buffers still held by the downstream elements keep the handler alive
+    yarp_handler.reset();
     return TRUE;
 }
 
 /* Frame methods */
-static GstFlowReturn gst_yarp_video_source_fill(GstPushSrc* src, GstBuffer* buf)
+static void gst_yarp_video_source_release_frame(gpointer data)
 {
-    //yCInfo(YVS_COMP) << ">>Fill";
-    GstMapInfo map;
-    gst_buffer_map(buf, &map, GST_MAP_WRITE);
+    auto* frame = static_cast<yarp_handler_class::frame*>(data);
+    // the handler may be destroyed together with the frame once it is released
+    std::shared_ptr<yarp_handler_class> owner = std::move(frame->owner);
+    owner->input_port_reader.release_frame(frame);
+}
+
+static GstFlowReturn gst_yarp_video_source_create(GstPushSrc* src, GstBuffer** buf)
+{
+    if (yarp_handler->input_port.getInputCount() == 0)
+    {
+        yCInfo(YVS_COMP) << "Waiting port connection..";
+    }
+    {
+        std::unique_lock lk(yarp_handler->input_port_reader.cvar_mutex);
+        yarp_handler->input_port_reader.cvar.wait(lk, []
+                                                  { return yarp_handler->input_port_reader.frame_ready; });
+        yarp_handler->input_port_reader.frame_ready = false;
+    }
 
     GstYarpVideoSource* yarp_src = (GstYarpVideoSource*)(src);
+    yarp_src->info.width=640;   //<<<<<<<<<<<<<<<<<<<<<<<<
+    yarp_src->info.height=480;  //<<<<<<<<<<<<<<<<<<<<<<<<
     guint gst_size = yarp_src->info.width * yarp_src->info.height * 3; // RGB format
 
-    yarp_handler->input_port_reader.image_mutex.lock();
-    if (yarp_handler->input_port_reader.get_port_type() == yarp_handler_class::port_type_enum::RGB_TYPE)
-    {
-        if (yarp_handler->input_port_reader.image_size == gst_size)
-        {
-            //yCDebug(YVS_COMP) << "bcopy" << yarp_handler->input_port_reader.image_size << gst_size;
-            memcpy(map.data, yarp_handler->input_port_reader.image_buffer, yarp_handler->input_port_reader.image_size);
-            //yCDebug(YVS_COMP) << "acopy";
-        }
-        else if (yarp_handler->input_port_reader.image_size == 0)
-        {
-            yCError(YVS_COMP) << "No image received yet (rgb image mode)";
-        }
-        else
-        {
-            yCError(YVS_COMP) << "size mismatch! gst:" << gst_size << "vs yarp:" << yarp_handler->input_port_reader.image_size;
-        }
-    }
-    else if (yarp_handler->input_port_reader.get_port_type() == yarp_handler_class::port_type_enum::BINARY_TYPE)
+    yarp_handler_class::frame* frame = yarp_handler->input_port_reader.take_frame();
+    bool valid = (frame != nullptr);
+    if (valid && yarp_handler->input_port_reader.get_port_type() == yarp_handler_class::port_type_enum::RGB_TYPE)
     {
-        if (yarp_handler->input_port_reader.image_size != 0)
+        if (frame->size != gst_size)
         {
-            //yCDebug() << "bbinary";
-            memcpy(map.data, yarp_handler->input_port_reader.image_buffer, yarp_handler->input_port_reader.image_size);
-            //yCDebug() << "abinary";
-        }
-        else if (yarp_handler->input_port_reader.image_size == 0)
-        {
-            yCError(YVS_COMP) << "No image received yet (binary mode)";
+            yCError(YVS_COMP) << "size mismatch! gst:" << gst_size << "vs yarp:" << frame->size;
+            valid = false;
         }
     }
-    else
+    else if (valid && frame->size == 0)
     {
-        yCError(YVS_COMP) << "unreachable";
-        //unreachable code
+        yCError(YVS_COMP) << "Empty frame received (binary mode)";
+        valid = false;
     }
 
-    yarp_handler->input_port_reader.image_mutex.unlock();
-
-    gst_buffer_unmap(buf, &map);
-
-    return GST_FLOW_OK;
-}
-
-static GstFlowReturn gst_yarp_video_source_alloc(GstPushSrc* src, GstBuffer** buf)
-{
-    if (yarp_handler->input_port.getInputCount() == 0)
+    if (!valid)
     {
-        yCInfo(YVS_COMP) << "Waiting port connection..";
+        if (frame)
+        {
+            yarp_handler->input_port_reader.release_frame(frame);
+        }
+        *buf = gst_buffer_new_allocate(NULL, gst_size, NULL);
+        gst_buffer_memset(*buf, 0, 0, gst_size);
+        return GST_FLOW_OK;
     }
-    std::unique_lock lk(yarp_handler->input_port_reader.cvar_mutex);
-    yarp_handler->input_port_reader.cvar.wait(lk, []
-                                              { return yarp_handler->input_port_reader.frame_ready; });
-    yarp_handler->input_port_reader.frame_ready = false;
-
-    GstYarpVideoSource* yarp_src = (GstYarpVideoSource*)(src);
-    yarp_src->info.width=640;   //<<<<<<<<<<<<<<<<<<<<<<<<
-    yarp_src->info.height=480;  //<<<<<<<<<<<<<<<<<<<<<<<<
-    guint size = yarp_src->info.width * yarp_src->info.height * 3; // RGB format
 
-    GstBuffer* buffer = gst_buffer_new_allocate(NULL, size, NULL);
-    *buf = buffer;
+    // the buffer wraps the memory of the received frame, which is given back
+    // to the reader when the downstream elements (e.g. the encoder) release it
+    frame->owner = yarp_handler;
+    *buf = gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY,
+                                       frame->buffer,
+                                       frame->size,
+                                       0,
+                                       frame->size,
+                                       frame,
+                                       gst_yarp_video_source_release_frame);
 
     return GST_FLOW_OK;
 }
@@ -7,6 +7,9 @@
 #define GST_YARP_VIDEO_SOURCE_H
 
 #include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include <gst/base/gstpushsrc.h>
 #include <gst/gst.h>
@@ -14,6 +17,7 @@
 
 #include <yarp/os/Network.h>
 #include <yarp/os/BufferedPort.h>
+#include <yarp/os/Time.h>
 #include <yarp/sig/Image.h>
 
 YARP_LOG_COMPONENT(YVS_COMP, "yarp.gstreamerplugin.yarpvideosource")
@@ -27,20 +31,30 @@ class yarp_handler_class
         BINARY_TYPE = 1
     };
 
+    // A received frame. Its memory is handed to gstreamer without copies, and the frame
+    // is given back to the reader when gstreamer releases the buffer that wraps it.
+    // Until then the frame keeps the handler alive, since the buffer can outlive the element.
+    struct frame
+    {
+        yarp::sig::ImageOf<yarp::sig::PixelRgb> data_image;
+        yarp::os::Bottle                        data_bottle;
+        unsigned char* buffer = nullptr;
+        size_t size = 0;
+        double timestamp = 0;
+        std::shared_ptr<yarp_handler_class> owner;
+    };
+
     class input_reader : public yarp::os::PortReader
     {
         port_type_enum type=port_type_enum::RGB_TYPE;
-        yarp::sig::ImageOf<yarp::sig::PixelRgb> priv_data_image;
-        yarp::os::Bottle                        priv_data_bottle;
+        frame* last_frame = nullptr;
+        std::vector<frame*> free_frames;
 
     public:
         std::mutex image_mutex;
         std::mutex cvar_mutex;
         std::condition_variable cvar;
         bool frame_ready = false;
-        unsigned char* image_buffer=nullptr;
-        size_t image_size=0;
-        double timestamp=0;
 
         port_type_enum get_port_type()
         {
@@ -52,37 +66,52 @@ class yarp_handler_class
             type = t;
         }
 
+        // takes the ownership of the last received frame, until release_frame() is called
+        frame* take_frame()
+        {
+            std::lock_guard lock(image_mutex);
+            frame* f = last_frame;
+            last_frame = nullptr;
+            return f;
+        }
+
+        void release_frame(frame* f)
+        {
+            std::lock_guard lock(image_mutex);
+            free_frames.push_back(f);
+        }
+
     public:
         virtual bool read(yarp::os::ConnectionReader& connection) override
         {
-            std::unique_lock lk(cvar_mutex);
-            frame_ready = false;
+            frame* f = nullptr;
+            {
+                std::lock_guard lock(image_mutex);
+                if (free_frames.empty())
+                {
+                    f = new frame;
+                }
+                else
+                {
+                    f = free_frames.back();
+                    free_frames.pop_back();
+                }
+            }
 
             bool ret=true;
 
             if (type == port_type_enum::RGB_TYPE)
             {
-                image_mutex.lock();
-                ret = priv_data_image.read(connection);
-                image_buffer = priv_data_image.getRawImage();
-                image_size = priv_data_image.getRawImageSize();
-                timestamp = yarp::os::Time::now();
-                frame_ready = true;
-                cvar.notify_all();
-
-                image_mutex.unlock();
+                ret = f->data_image.read(connection);
+                f->buffer = f->data_image.getRawImage();
+                f->size = f->data_image.getRawImageSize();
             }
             else if (type == port_type_enum::BINARY_TYPE)
             {
-                image_mutex.lock();
-                ret = priv_data_bottle.read(connection);
-                priv_data_bottle.get(0).asInt64();
-                image_buffer = (unsigned char*) priv_data_bottle.get(1).asBlob();
-                image_size = priv_data_bottle.get(1).asBlobLength();
-                timestamp = yarp::os::Time::now();
-                frame_ready = true;
-                cvar.notify_all();
-                image_mutex.unlock();
+                ret = f->data_bottle.read(connection);
+                f->data_bottle.get(0).asInt64();
+                f->buffer = (unsigned char*) f->data_bottle.get(1).asBlob();
+                f->size = f->data_bottle.get(1).asBlobLength();
             }
             else
             {
@@ -92,11 +121,36 @@ class yarp_handler_class
             if (ret==false)
             {
                 yCError(YVS_COMP) << "Data type conversion failed in read(yarp::os::ConnectionReader&)";
+                release_frame(f);
+                return true;
+            }
+            f->timestamp = yarp::os::Time::now();
+
+            std::unique_lock lk(cvar_mutex);
+            {
+                // a frame which has not been taken yet is dropped in favour of the new one
+                std::lock_guard lock(image_mutex);
+                if (last_frame)
+                {
+                    free_frames.push_back(last_frame);
+                }
+                last_frame = f;
             }
+            frame_ready = true;
+            cvar.notify_all();
             return true;
         }
 
         input_reader() = default;
+
+        virtual ~input_reader()
+        {
+            delete last_frame;
+            for (auto* f : free_frames)
+            {
+                delete f;
+            }
+        }
     };
 
 public:
@@ -24,3 +24,17 @@ struct TestAnnotatedTypes
   7: float64 a_float64,
   8: size_t a_size;
 }
+
+struct TestAnnotatedBulkTypes
+{
+  1: vocab a_vocab,
+  2: ui8 a_ui8,
+  3: ui16 a_ui16,
+  4: ui32 a_ui32,
+  5: ui64 a_ui64,
+  6: float32 a_float32,
+  7: float64 a_float64,
+  8: size_t a_size;
+} (
+    yarp.bulk = "true"
+)
@@ -71,6 +71,31 @@ struct TestSomeMoreTypes {
   8: binary a_binary
 }
 
+struct TestSomeBulkTypes {
+  1: bool a_bool,
+  2: i8 a_i8,
+  3: i16 a_i16,
+  4: i32 a_i32,
+  5: i64 a_i64,
+  6: double a_double,
+  7: string a_string,
+  8: list<double> a_list_of_double,
+  9: double b_double,
+  10: i32 b_i32 = 42,
+  11: double c_double,
+  12: bool c_bool
+} (
+    yarp.bulk = "true"
+)
+
+struct TestBulkDoubles {
+  1: double x,
+  2: double y,
+  3: double z
+} (
+    yarp.bulk = "true"
+)
+
 struct TestSomeLists {
   1: list<bool> a_list_of_bool,
   2: list<i8> a_list_of_i8,
@@ -11,7 +11,10 @@
 #include <SurfaceMeshWithBoundingBox.h>
 #include <Wrapping.h>
 #include <TestAnnotatedTypes.h>
+#include <TestAnnotatedBulkTypes.h>
 #include <TestSomeMoreTypes.h>
+#include <TestSomeBulkTypes.h>
+#include <TestBulkDoubles.h>
 #include <TestSomeLists.h>
 #if defined(THRIFT_INCLUDE_PREFIX) && defined(THRIFT_NO_NAMESPACE_PREFIX)
 # include <sub/directory/ClockServer.h>
@@ -997,6 +1000,131 @@ TEST_CASE("IdlThriftTest", "[yarp::idl::thrift]")
         CHECK(a.a_float64 == b.a_float64);
     }
 
+    SECTION("test bulk types")
+    {
+        TestSomeBulkTypes a;
+        TestSomeBulkTypes b;
+        Bottle tmp;
+        a.a_bool = true;
+        a.a_i8 = 8;
+        a.a_i16 = 16;
+        a.a_i32 = 32;
+        a.a_i64 = 64;
+        a.a_double = 0.64;
+        a.a_string = "A string";
+        a.a_list_of_double = std::vector<double>({-0.64, 0.64});
+        a.b_double = 1.28;
+        a.b_i32 = 128;
+        a.c_double = 2.56;
+        a.c_bool = false;
+        tmp.read(a);
+        CHECK(tmp.size() == 12);
+        CHECK(tmp.get(1).asInt8() == 8);
+        CHECK(tmp.get(5).asFloat64() == 0.64);
+        CHECK(tmp.get(10).asFloat64() == 2.56);
+        tmp.write(b);
+        CHECK(a.a_bool == b.a_bool);
+        CHECK(a.a_i8 == b.a_i8);
+        CHECK(a.a_i16 == b.a_i16);
+        CHECK(a.a_i32 == b.a_i32);
+        CHECK(a.a_i64 == b.a_i64);
+        CHECK(a.a_double == b.a_double);
+        CHECK(a.a_string == b.a_string);
+        CHECK(a.a_list_of_double == b.a_list_of_double);
+        CHECK(a.b_double == b.b_double);
+        CHECK(a.b_i32 == b.b_i32);
+        CHECK(a.c_double == b.c_double);
+        CHECK(a.c_bool == b.c_bool);
+
+        // The fields with a different type are converted as when they
+        // are read one by one (here all the integers are int32)
+        tmp.fromString("1 2 3 4 5 6 \"A string\" (0.1 0.2) 0.3 4 0.5 1");
+        CHECK(tmp.write(b));
+        CHECK(b.a_bool);
+        CHECK(b.a_i8 == 2);
+        CHECK(b.a_i16 == 3);
+        CHECK(b.a_i32 == 4);
+        CHECK(b.a_i64 == 5);
+        CHECK(b.a_double == 6);
+        CHECK(b.b_double == 0.3);
+        CHECK(b.b_i32 == 4);
+        CHECK(b.c_double == 0.5);
+        CHECK(b.c_bool);
+    }
+
+    SECTION("test bulk types with integer values")
+    {
+        TestBulkDoubles b;
+        Bottle tmp;
+
+        // A list containing only integers
+        tmp.fromString("1 2 3");
+        CHECK(tmp.write(b));
+        CHECK(b.x == 1);
+        CHECK(b.y == 2);
+        CHECK(b.z == 3);
+
+        // A list containing both integers and doubles
+        tmp.fromString("4.5 5 6.5");
+        CHECK(tmp.write(b));
+        CHECK(b.x == 4.5);
+        CHECK(b.y == 5);
+        CHECK(b.z == 6.5);
+
+        // A list containing only doubles
+        tmp.fromString("0.1 0.2 0.3");
+        CHECK(tmp.write(b));
+        CHECK(b.x == 0.1);
+        CHECK(b.y == 0.2);
+        CHECK(b.z == 0.3);
+
+        // A message in text mode, e.g. from "yarp write"
+        DummyConnector con;
+        con.setTextMode(true);
+        tmp.fromString("7 8.5 9");
+        tmp.write(con.getCleanWriter());
+        CHECK(b.read(con.getReader()));
+        CHECK(b.x == 7);
+        CHECK(b.y == 8.5);
+        CHECK(b.z == 9);
+
+        // Values that are not numbers are still rejected
+        tmp.fromString("1 \"two\" 3");
+        CHECK_FALSE(tmp.write(b));
+    }
+
+    SECTION("test annotated bulk types")
+    {
+        TestAnnotatedTypes a;
+        TestAnnotatedBulkTypes b;
+        TestAnnotatedTypes c;
+        a.a_vocab = yarp::os::createVocab32('d', 'e', 'm', 'o');
+        a.a_ui8 = 0xff;
+        a.a_ui16 = 0xffff;
+        a.a_ui32 = 0xffffffff;
+        a.a_ui64 = 0xffffffffffffffff;
+        a.a_float32 = 0.32;
+        a.a_float64 = 0.64;
+        a.a_size = sizeof(TestAnnotatedTypes);
+
+        // The wire format is the same of the structure without "yarp.bulk"
+        DummyConnector con;
+        a.write(con.getCleanWriter());
+        CHECK(con.getReader().getSize() == TestAnnotatedBulkTypes::wireSize);
+        CHECK(b.read(con.getReader()));
+        b.write(con.getCleanWriter());
+        CHECK(con.getReader().getSize() == TestAnnotatedBulkTypes::wireSize);
+        CHECK(c.read(con.getReader()));
+        CHECK(a.a_vocab == c.a_vocab);
+        CHECK(a.a_ui8 == c.a_ui8);
+        CHECK(a.a_ui16 == c.a_ui16);
+        CHECK(a.a_ui32 == c.a_ui32);
+        CHECK(a.a_ui64 == c.a_ui64);
+        CHECK(a.a_float32 == c.a_float32);
+        CHECK(a.a_float64 == c.a_float64);
+        CHECK(a.a_size == c.a_size);
+    }
+
     SECTION("test settings")
     {
         Settings::Editor settings;